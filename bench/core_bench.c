@@ -0,0 +1,244 @@
+// benchmark driver for the native core (libtalos_core.so, see `make native` in the Makefile).
+// measures the same kernels as bench/kernels.ts without the js side, so that kernels can be
+// profiled with native tooling (perf, vtune, sanitizers) and compiled with -march=native.
+//
+// usage: core_bench [threads] [filter]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/core/build/preprocessed/util.h" // before tensor.h, util.h pulls it in ahead of its own declarations
+#include "../src/core/build/preprocessed/tensor.h"
+#include "../src/core/build/preprocessed/threads.h"
+#include "../src/core/build/preprocessed/optim.h"
+
+// kernels are generated by the preprocessor, they have no header
+void exp_prw(struct tensor_t* a, struct tensor_t* res, float param);
+void relu_prw_acc(struct tensor_t* a, struct tensor_t* res, float param);
+void bw_tanh_acc(struct tensor_t* a, struct tensor_t* b, struct tensor_t* res, float param);
+void add_brc(struct tensor_t* a, struct tensor_t* b, struct tensor_t* res);
+void add_dbrc(struct tensor_t* a, struct tensor_t* b, struct tensor_t* dest);
+void identity_dbrc_acc(struct tensor_t* a, struct tensor_t* dest, float param);
+void sum_red_tns(struct tensor_t* src, struct tensor_t* dest);
+size_t max_red_idx(struct tensor_t* src);
+void convert_tensor(struct tensor_t* a, struct tensor_t* res);
+void init_uniform(struct tensor_t* a, float min, float max, unsigned int seed);
+void init_normal(struct tensor_t* a, float mean, float std_dev, unsigned int seed);
+void init_fill(struct tensor_t* a, float value);
+void dropout(struct tensor_t* a, struct tensor_t* res, float p, unsigned int seed);
+void matmul(struct tensor_t* a, struct tensor_t* b, struct tensor_t* res);
+void dot(struct tensor_t* a, struct tensor_t* b, struct tensor_t* res);
+
+#define F32 4.
+#define MIN_TIME_MS 100.
+#define MIN_RUNS 10
+#define MAX_SAMPLES 4096
+
+static const char* filter = NULL;
+
+// operands of the current benchmark
+static struct tensor_t *a, *b, *res, *src, *row, *scalar;
+static struct optimizer_t* opt;
+
+static struct tensor_t* create_matrix(size_t rows, size_t cols, unsigned int seed) {
+    struct tensor_t* t = create_tensor(2, rows * cols);
+    t->shape[0] = rows; t->shape[1] = cols;
+    t->strides[0] = cols; t->strides[1] = 1;
+    init_uniform(t, -1, 1, seed);
+    return t;
+}
+
+static struct tensor_t* create_vector(size_t n, unsigned int seed) {
+    struct tensor_t* t = create_tensor(1, n);
+    t->shape[0] = n;
+    t->strides[0] = 1;
+    init_uniform(t, -1, 1, seed);
+    return t;
+}
+
+static struct tensor_t* create_transposed(struct tensor_t* source) {
+    struct tensor_t* t = create_reshape_view(source, 2);
+    t->shape[0] = source->shape[1]; t->shape[1] = source->shape[0];
+    t->strides[0] = source->strides[1]; t->strides[1] = source->strides[0];
+    return t;
+}
+
+static int compare_doubles(const void* x, const void* y) {
+    double d = *(const double*)x - *(const double*)y;
+    return (d > 0) - (d < 0);
+}
+
+// median time per call in ns. calls are batched until a batch takes at least 1ms.
+static double measure(void (*fn)()) {
+    static double samples[MAX_SAMPLES];
+
+    for (int i = 0; i < 3; i++) fn();
+
+    size_t batch = 1;
+    for (;;) {
+        double start = platform_now();
+        for (size_t i = 0; i < batch; i++) fn();
+        if (platform_now() - start >= 1 || batch >= (1 << 20)) break;
+        batch *= 2;
+    }
+
+    size_t nsamples = 0;
+    double start = platform_now();
+
+    while (nsamples < MAX_SAMPLES && (nsamples < MIN_RUNS || platform_now() - start < MIN_TIME_MS)) {
+        double batch_start = platform_now();
+        for (size_t i = 0; i < batch; i++) fn();
+        samples[nsamples++] = (platform_now() - batch_start) / batch;
+    }
+
+    qsort(samples, nsamples, sizeof(double), compare_doubles);
+    return samples[nsamples / 2] * 1e6;
+}
+
+static void report(const char* name, void (*fn)(), double elements, double bytes, double flops) {
+    if (filter && !strstr(name, filter)) return;
+
+    double ns = measure(fn);
+    printf("  %-40s %12.2f us   ns_per_element %9.4f   gb_per_s %8.2f", name, ns / 1e3, ns / elements, bytes / ns);
+    if (flops > 0) printf("   gflop_per_s %8.2f", flops / ns);
+    printf("\n");
+}
+
+static void run_exp()           { exp_prw(src, res, 0); }
+static void run_relu_acc()      { relu_prw_acc(src, res, 0); }
+static void run_bw_tanh()       { bw_tanh_acc(src, b, res, 0); }
+static void run_add()           { add_brc(src, b, res); }
+static void run_add_row()       { add_brc(src, row, res); }
+static void run_add_dbrc()      { add_dbrc(src, b, row); }
+static void run_identity_dbrc() { identity_dbrc_acc(src, row, 0); }
+static void run_sum()           { sum_red_tns(src, scalar); }
+static void run_max_idx()       { max_red_idx(src); }
+static void run_copy()          { convert_tensor(src, res); }
+static void run_uniform()       { init_uniform(res, -1, 1, 1); }
+static void run_normal()        { init_normal(res, 0, 1, 1); }
+static void run_fill()          { init_fill(res, 1); }
+static void run_dropout()       { dropout(a, res, .5, 1); }
+static void run_matmul()        { matmul(src, b, res); }
+static void run_dot()           { dot(a, b, res); }
+static void run_optimizer()     { optimizer_step(opt); }
+
+static void bench_elementwise(size_t side) {
+    double n = (double)side * side;
+    char name[64];
+
+    for (int view = 0; view <= 1; view++) {
+        const char* layout = view ? "view" : "contiguous";
+
+        a = create_matrix(side, side, 1);
+        b = create_matrix(side, side, 2);
+        res = create_matrix(side, side, 3);
+        row = create_vector(side, 4);
+        scalar = create_vector(1, 5);
+        src = view ? create_transposed(a) : a;
+
+        #define BENCH(LABEL, FN, BYTES, FLOPS) \
+            snprintf(name, sizeof(name), LABEL " %zux%zu %s", side, side, layout); \
+            report(name, FN, n, BYTES, FLOPS);
+
+        BENCH("prw exp", run_exp, 2 * n * F32, n)
+        BENCH("prw relu_acc", run_relu_acc, 3 * n * F32, 2 * n)
+        BENCH("bw tanh_acc", run_bw_tanh, 4 * n * F32, 4 * n)
+        BENCH("brc add", run_add, 3 * n * F32, n)
+        BENCH("brc add row", run_add_row, 2 * n * F32, n)
+        BENCH("dbrc add", run_add_dbrc, 2 * n * F32, 2 * n)
+        BENCH("dbrc identity_acc", run_identity_dbrc, n * F32, n)
+        BENCH("red sum", run_sum, n * F32, n)
+        BENCH("red max_idx", run_max_idx, n * F32, n)
+        BENCH("copy", run_copy, 2 * n * F32, 0)
+
+        #undef BENCH
+
+        if (view) free_tensor(src);
+        free_tensor(a); free_tensor(b); free_tensor(res); free_tensor(row); free_tensor(scalar);
+    }
+
+    a = create_matrix(side, side, 1);
+    res = create_matrix(side, side, 2);
+
+    snprintf(name, sizeof(name), "init uniform %zux%zu", side, side);
+    report(name, run_uniform, n, n * F32, 0);
+    snprintf(name, sizeof(name), "init normal %zux%zu", side, side);
+    report(name, run_normal, n, n * F32, 0);
+    snprintf(name, sizeof(name), "init fill %zux%zu", side, side);
+    report(name, run_fill, n, n * F32, 0);
+    snprintf(name, sizeof(name), "dropout %zux%zu", side, side);
+    report(name, run_dropout, n, 2 * n * F32, n);
+
+    free_tensor(a); free_tensor(res);
+}
+
+// one parameter of side x side elements, the updates don't depend on the values
+static void bench_optimizer(size_t side) {
+    double n = (double)side * side;
+    char name[64];
+
+    a = create_matrix(side, side, 1);
+    b = create_matrix(side, side, 2);
+    res = create_matrix(2, side * side, 3);
+    init_fill(res, 0);
+
+    const char* labels[] = { "sgd", "adam", "adam clip" };
+    size_t kinds[] = { OPTIM_SGD, OPTIM_ADAM, OPTIM_ADAM };
+
+    for (size_t i = 0; i < 3; i++) {
+        opt = create_optimizer(kinds[i], 1);
+        set_optimizer_param(opt, 0, a, b);
+        set_optimizer_hparams(opt, 1e-6f, .9f, .999f, 1e-8f, 0);
+        if (kinds[i] != OPTIM_SGD) set_optimizer_state(opt, res);
+        if (i == 2) set_optimizer_grad_clipping(opt, 1, 1);
+
+        // clipping reads the gradients once more
+        double bytes = (kinds[i] == OPTIM_SGD ? 3 : 7) * n * F32 + (i == 2 ? n * F32 : 0);
+        snprintf(name, sizeof(name), "optim %s %zux%zu", labels[i], side, side);
+        report(name, run_optimizer, n, bytes, kinds[i] == OPTIM_SGD ? 2 * n : 12 * n);
+        free_optimizer(opt);
+    }
+
+    free_tensor(a); free_tensor(b); free_tensor(res);
+}
+
+static void bench_matmul(size_t side) {
+    double n = (double)side * side;
+    char name[64];
+
+    for (int view = 0; view <= 1; view++) {
+        a = create_matrix(side, side, 1);
+        b = create_matrix(side, side, 2);
+        res = create_matrix(side, side, 3);
+        src = view ? create_transposed(a) : a;
+
+        snprintf(name, sizeof(name), "mat matmul %zux%zu %s", side, side, view ? "view" : "contiguous");
+        report(name, run_matmul, n, 3 * n * F32, 2. * n * side);
+
+        // the rows of a are multiplied with b one by one
+        if (!view) {
+            snprintf(name, sizeof(name), "mat dot %zux%zu", side, side);
+            report(name, run_dot, n, 3 * n * F32, 2. * n * side);
+        }
+
+        if (view) free_tensor(src);
+        free_tensor(a); free_tensor(b); free_tensor(res);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t threads = set_num_threads(argc > 1 ? (size_t)atoi(argv[1]) : 1);
+    filter = argc > 2 ? argv[2] : NULL;
+
+    printf("KERNELS (native, %zu thread(s))\n\n", threads);
+
+    size_t sides[] = { 64, 512, 2048 };
+    for (size_t i = 0; i < 3; i++) bench_elementwise(sides[i]);
+    for (size_t i = 0; i < 3; i++) bench_optimizer(sides[i]);
+
+    size_t matmul_sides[] = { 64, 256, 512 };
+    for (size_t i = 0; i < 3; i++) bench_matmul(matmul_sides[i]);
+
+    set_num_threads(1);
+    return 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * Shared parts of the benchmark suites: timing, reporting, JSON baselines and comparisons.
+ *
+ * Every suite accepts the same arguments:
+ *   --filter <text>      only runs the benchmarks whose name contains text
+ *   --save [path]        stores the results as a baseline (default: bench/baselines/<suite>.json)
+ *   --compare [path]     compares the results with a baseline, exits with 1 on regressions
+ *   --threshold <pct>    slowdown that counts as a regression (default: 10)
+ *
+ * Baselines depend on the machine and the core build, compare them on the same setup only.
+ */
+
+import { get_num_threads } from "../src/raw_tensor/management.ts";
+import { threads, memory64, native } from "../src/core/core.ts";
+
+export interface Measurement {
+    time_ns: number;    // median time per run
+    runs: number;
+}
+
+// work that is performed by one run, used to derive throughputs
+export interface Work {
+    elements?: number;
+    bytes?: number;
+    flops?: number;
+}
+
+export interface BenchResult {
+    name: string;
+    time_ns: number;                    // lower is better, regressions are detected on this metric
+    metrics: Record<string, number>;    // reported and stored, but not compared
+}
+
+export interface Baseline {
+    suite: string;
+    date: string;
+    core: string;
+    threads: number;
+    results: Record<string, BenchResult>;
+}
+
+export interface MeasureOptions {
+    min_time_ms?: number;   // minimum total time of the measured runs
+    min_runs?: number;
+    warmup?: number;
+}
+
+/**
+ * Runs fn repeatedly and returns the median time per run.
+ * Runs are grouped into batches that take at least ~1ms, so that the timer resolution
+ * doesn't dominate fast kernels.
+ */
+export function measure(fn: () => void, { min_time_ms = 100, min_runs = 10, warmup = 3 }: MeasureOptions = {}): Measurement {
+    for (let i = 0; i < warmup; i++) fn();
+
+    let batch = 1;
+    for (;;) {
+        const start = performance.now();
+        for (let i = 0; i < batch; i++) fn();
+        if (performance.now() - start >= 1 || batch >= 1 << 20) break;
+        batch *= 2;
+    }
+
+    const times: number[] = [];
+    const start = performance.now();
+
+    while (times.length < min_runs || performance.now() - start < min_time_ms) {
+        const batch_start = performance.now();
+        for (let i = 0; i < batch; i++) fn();
+        times.push((performance.now() - batch_start) / batch);
+    }
+
+    times.sort((a, b) => a - b);
+    return { time_ns: times[Math.floor(times.length / 2)] * 1e6, runs: times.length * batch };
+}
+
+// ns/element, GB/s and GFLOP/s of a measurement (1 byte/ns = 1 GB/s)
+export function throughput(time_ns: number, { elements, bytes, flops }: Work): Record<string, number> {
+    const metrics: Record<string, number> = {};
+    if (elements) metrics.ns_per_element = time_ns / elements;
+    if (bytes) metrics.gb_per_s = bytes / time_ns;
+    if (flops) metrics.gflop_per_s = flops / time_ns;
+    return metrics;
+}
+
+export const core_name = () => native ? "native" : memory64 ? "wasm64" : threads ? "wasm32-mt" : "wasm32";
+
+export interface SuiteArgs {
+    filter?: string;
+    save?: string;
+    compare?: string;
+    threshold: number;
+}
+
+export function parse_args(suite: string, argv = process.argv.slice(2)): SuiteArgs {
+    const args: SuiteArgs = { threshold: 10 };
+    const default_path = `bench/baselines/${suite}.json`;
+    const value = (i: number) => argv[i + 1] !== undefined && !argv[i + 1].startsWith("--") ? argv[i + 1] : undefined;
+
+    for (let i = 0; i < argv.length; i++) {
+        switch (argv[i]) {
+            case "--filter":    args.filter = value(i); break;
+            case "--save":      args.save = value(i) ?? default_path; break;
+            case "--compare":   args.compare = value(i) ?? default_path; break;
+            case "--threshold": args.threshold = Number(value(i) ?? args.threshold); break;
+        }
+    }
+
+    return args;
+}
+
+const format = (value: number) => value >= 100 ? value.toFixed(0) : value >= 1 ? value.toFixed(2) : value.toPrecision(3);
+
+export function print_result(result: BenchResult) {
+    const metrics = Object.entries(result.metrics).map(([key, value]) => `${key} ${format(value).padStart(9)}`).join("   ");
+    console.log(`  ${result.name.padEnd(40)} ${format(result.time_ns / 1e3).padStart(10)} us   ${metrics}`);
+}
+
+/**
+ * Compares results with a baseline and prints the change of every benchmark.
+ * @returns Names of the benchmarks that are slower than the baseline by more than threshold percent
+ */
+export function compare(results: BenchResult[], baseline: Baseline, threshold: number): string[] {
+    const regressions: string[] = [];
+
+    console.log(`\nCOMPARISON with ${baseline.suite} baseline from ${baseline.date} (${baseline.core}, ${baseline.threads} thread(s))`);
+
+    for (const result of results) {
+        const previous = baseline.results[result.name];
+        if (!previous) {
+            console.log(`  ${result.name.padEnd(40)}        new`);
+            continue;
+        }
+
+        const change = 100 * (result.time_ns / previous.time_ns - 1);
+        const regressed = change > threshold;
+        if (regressed) regressions.push(result.name);
+
+        const label = regressed ? "REGRESSION" : change < -threshold ? "improved" : "";
+        console.log(`  ${result.name.padEnd(40)} ${((change > 0 ? "+" : "") + change.toFixed(1) + "%").padStart(9)}  ${label}`);
+    }
+
+    return regressions;
+}
+
+export async function save_baseline(path: string, suite: string, results: BenchResult[]) {
+    const baseline: Baseline = {
+        suite,
+        date: new Date().toISOString(),
+        core: core_name(),
+        threads: get_num_threads(),
+        results: Object.fromEntries(results.map(result => [result.name, result])),
+    };
+
+    await Bun.write(path, JSON.stringify(baseline, null, 2) + "\n");
+    console.log(`\nBaseline saved to ${path}`);
+}
+
+/**
+ * Runs the benchmarks of a suite, handles --save and --compare and sets the exit code.
+ * @param benchmarks Functions that perform one benchmark each and return its result
+ */
+export async function run_suite(suite: string, benchmarks: { name: string, run: () => BenchResult }[]): Promise<BenchResult[]> {
+    const args = parse_args(suite);
+    const selected = benchmarks.filter(benchmark => !args.filter || benchmark.name.includes(args.filter));
+
+    console.log(`${suite.toUpperCase()} (${core_name()}, ${get_num_threads()} thread(s), ${selected.length} benchmarks)\n`);
+
+    const results: BenchResult[] = [];
+    for (const benchmark of selected) {
+        const result = benchmark.run();
+        print_result(result);
+        results.push(result);
+    }
+
+    if (args.compare) {
+        const file = Bun.file(args.compare);
+        if (!(await file.exists())) throw new Error(`There is no baseline at ${args.compare}, create one with --save.`);
+
+        const regressions = compare(results, await file.json(), args.threshold);
+        if (regressions.length > 0) {
+            console.log(`\n${regressions.length} regression(s) beyond ${args.threshold}%`);
+            process.exitCode = 1;
+        }
+    }
+
+    if (args.save) await save_baseline(args.save, suite, results);
+    return results;
+}
@@ -0,0 +1,154 @@
+/**
+ * Micro-benchmarks of the kernels of the core, run with `bun run bench [--save] [--compare]`
+ * (see harness.ts for all arguments). Every op family is measured on small, medium and large
+ * tensors. Element-wise families are measured on contiguous tensors and on transposed views,
+ * which take the strided paths of the kernels.
+ */
+
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { BenchResult, Work, measure, run_suite, throughput } from "./harness.ts";
+
+await core_ready;
+
+type Setup = () => { fn: () => void, tensors: RawTensor[] };
+
+const F32 = 4;
+
+function kernel(name: string, work: Work, setup: Setup) {
+    return {
+        name,
+        run: (): BenchResult => {
+            const { fn, tensors } = setup();
+
+            try {
+                const { time_ns } = measure(fn);
+                return { name, time_ns, metrics: throughput(time_ns, work) };
+            } finally {
+                // views are listed last and freed first, they reference the data of the other tensors
+                for (const tensor of [...new Set(tensors)].reverse()) tensor.free();
+            }
+        },
+    };
+}
+
+// square matrices with side^2 elements, and views of them
+const matrix = (side: number, seed = 1) => RawTensor.create([side, side]).uniform(-1, 1, seed);
+const transposed = (tensor: RawTensor) => ops.transpose(tensor);
+
+const sides = [64, 512, 2048];
+const layouts = ["contiguous", "view"] as const;
+const benchmarks: ReturnType<typeof kernel>[] = [];
+
+for (const side of sides) {
+    const n = side * side;
+    const size = `${side}x${side}`;
+
+    for (const layout of layouts) {
+        // views: the source is a transposed view, the destination is contiguous
+        const source = (seed = 1) => {
+            const a = matrix(side, seed);
+            return layout === "view" ? [a, transposed(a)] : [a, a];
+        };
+
+        benchmarks.push(
+            kernel(`prw exp ${size} ${layout}`, { elements: n, bytes: 2 * n * F32, flops: n }, () => {
+                const [a, src] = source(), res = RawTensor.create([side, side]);
+                return { fn: () => ops.exp(src, res), tensors: [a, res, src] };
+            }),
+
+            kernel(`prw relu_acc ${size} ${layout}`, { elements: n, bytes: 3 * n * F32, flops: 2 * n }, () => {
+                const [a, src] = source(), res = RawTensor.create([side, side]);
+                return { fn: () => ops.relu_acc(src, res), tensors: [a, res, src] };
+            }),
+
+            kernel(`bw tanh_acc ${size} ${layout}`, { elements: n, bytes: 4 * n * F32, flops: 4 * n }, () => {
+                const [a, src] = source(), grad = matrix(side, 2), res = RawTensor.create([side, side]);
+                return { fn: () => ops.bw_tanh_acc(src, grad, res), tensors: [a, grad, res, src] };
+            }),
+
+            kernel(`brc add ${size} ${layout}`, { elements: n, bytes: 3 * n * F32, flops: n }, () => {
+                const [a, src] = source(), b = matrix(side, 2), res = RawTensor.create([side, side]);
+                return { fn: () => ops.add(src, b, res), tensors: [a, b, res, src] };
+            }),
+
+            kernel(`brc add row ${size} ${layout}`, { elements: n, bytes: 2 * n * F32, flops: n }, () => {
+                const [a, src] = source(), row = RawTensor.create([side]).uniform(-1, 1, 2), res = RawTensor.create([side, side]);
+                return { fn: () => ops.add(src, row, res), tensors: [a, row, res, src] };
+            }),
+
+            kernel(`dbrc add ${size} ${layout}`, { elements: n, bytes: 2 * n * F32, flops: 2 * n }, () => {
+                const [a, src] = source(), b = matrix(side, 2), row = RawTensor.create([side]);
+                return { fn: () => ops.add(src, b, row), tensors: [a, b, row, src] };
+            }),
+
+            kernel(`dbrc identity_acc ${size} ${layout}`, { elements: n, bytes: n * F32, flops: n }, () => {
+                const [a, src] = source(), row = RawTensor.create([side]);
+                return { fn: () => ops.identity_acc(src, row), tensors: [a, row, src] };
+            }),
+
+            kernel(`red sum ${size} ${layout}`, { elements: n, bytes: n * F32, flops: n }, () => {
+                const [a, src] = source(), res = RawTensor.scalar();
+                return { fn: () => ops.sum_tns(src, res), tensors: [a, res, src] };
+            }),
+
+            kernel(`red max_idx ${size} ${layout}`, { elements: n, bytes: n * F32, flops: n }, () => {
+                const [a, src] = source();
+                return { fn: () => ops.max_idx(src), tensors: [a, src] };
+            }),
+
+            kernel(`copy ${size} ${layout}`, { elements: n, bytes: 2 * n * F32 }, () => {
+                const [a, src] = source(), res = RawTensor.create([side, side]);
+                return {
+                    fn: layout === "view" ? () => ops.convert(src, res) : () => ops.clone(src, res),
+                    tensors: [a, res, src],
+                };
+            }),
+        );
+    }
+
+    benchmarks.push(
+        kernel(`init uniform ${size}`, { elements: n, bytes: n * F32 }, () => {
+            const a = RawTensor.create([side, side]);
+            return { fn: () => a.uniform(-1, 1, 1), tensors: [a] };
+        }),
+
+        kernel(`init normal ${size}`, { elements: n, bytes: n * F32 }, () => {
+            const a = RawTensor.create([side, side]);
+            return { fn: () => a.normal(0, 1, 1), tensors: [a] };
+        }),
+
+        kernel(`init fill ${size}`, { elements: n, bytes: n * F32 }, () => {
+            const a = RawTensor.create([side, side]);
+            return { fn: () => a.fill(1), tensors: [a] };
+        }),
+
+        kernel(`dropout ${size}`, { elements: n, bytes: 2 * n * F32, flops: n }, () => {
+            const a = matrix(side), res = RawTensor.create([side, side]);
+            return { fn: () => ops.dropout(a, res, .5, 1), tensors: [a, res] };
+        }),
+
+    );
+}
+
+// matmuls are cubic, the largest size is left out
+for (const side of [64, 256, 512]) {
+    const work = { elements: side * side, bytes: 3 * side * side * F32, flops: 2 * side ** 3 };
+
+    for (const layout of layouts) {
+        benchmarks.push(kernel(`mat matmul ${side}x${side} ${layout}`, work, () => {
+            const a = matrix(side, 1), b = matrix(side, 2), res = RawTensor.create([side, side]);
+            const src = layout === "view" ? transposed(a) : a;
+            return { fn: () => ops.matmul(src, b, res), tensors: [a, b, res, src] };
+        }));
+    }
+
+    // the rows of a are multiplied with b one by one
+    benchmarks.push(kernel(`mat dot ${side}x${side}`, work, () => {
+        const a = matrix(side, 1), b = matrix(side, 2), res = RawTensor.create([side, side]);
+        return { fn: () => ops.dot(a, b, res), tensors: [a, b, res] };
+    }));
+}
+
+await run_suite("kernels", benchmarks);
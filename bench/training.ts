@@ -0,0 +1,129 @@
+/**
+ * Throughput of whole training steps (zero_grad, forward, backward, sgd step) of MLP presets,
+ * run with `bun run bench-training [--save] [--compare]` (see harness.ts for all arguments).
+ *
+ * Every preset is trained for a few warmup iterations, then the steady state is measured:
+ * time per iteration and its split between the passes, samples/s, the peak of the allocated
+ * memory and the drift of the number of tensors (per iteration). A drift of one or more means
+ * that tensors leak in every iteration.
+ */
+
+import { Source } from "../src/autograd/node_operations.ts";
+import { core_ready, get_ntensors, get_total_allocated } from "../src/raw_tensor/management.ts";
+import { tensor } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+import type Tensor from "../src/tensor.ts";
+import { BenchResult, run_suite } from "./harness.ts";
+
+await core_ready;
+
+interface Preset {
+    name: string;
+    depth: number;      // number of linear layers
+    width: number;
+    batch_size: number;
+}
+
+const presets: Preset[] = [
+    { name: "mlp-small",  depth: 2,  width: 64,   batch_size: 32 },
+    { name: "mlp-medium", depth: 4,  width: 256,  batch_size: 64 },
+    { name: "mlp-deep",   depth: 16, width: 128,  batch_size: 64 },
+    { name: "mlp-wide",   depth: 2,  width: 1024, batch_size: 128 },
+];
+
+const WARMUP = 5;
+const MIN_ITERATIONS = 20;
+const MIN_TIME_MS = 1000;
+
+// relu(x * W + b) for all but the last layer, mse loss against a fixed target
+function create_mlp({ depth, width, batch_size }: Preset) {
+    // the whole batch is produced at once, the producer is not part of the measurement
+    const input = new Source([batch_size, width], (dest) => { dest.uniform(0, 1, 1); });
+    let hidden: Tensor = input;
+
+    for (let layer = 0; layer < depth; layer++) {
+        const weight = tensor([width, width], true).kaiming_normal(width, 2 * layer);
+        const bias = tensor([width], true).fill(0);
+        hidden = hidden.matmul(weight).add(bias);
+        if (layer < depth - 1) hidden = hidden.relu();
+    }
+
+    const graph = hidden.mse_loss(tensor([width]).uniform(0, 1, 3)).graph;
+    return { graph, optimizer: new sgd(graph, { lr: 1e-3 }) };
+}
+
+function train(preset: Preset): BenchResult {
+    const { graph, optimizer } = create_mlp(preset);
+    const times = { forward: 0, backward: 0, optimizer: 0 };
+    let peak_bytes = 0;
+
+    const iteration = (measured: boolean) => {
+        const t0 = performance.now();
+        graph.zero_grad();
+        graph.forward();
+        const t1 = performance.now();
+        graph.backward();
+        const t2 = performance.now();
+        optimizer.step();
+        const t3 = performance.now();
+
+        peak_bytes = Math.max(peak_bytes, get_total_allocated());
+        if (!measured) return;
+
+        times.forward += t1 - t0;
+        times.backward += t2 - t1;
+        times.optimizer += t3 - t2;
+    };
+
+    for (let i = 0; i < WARMUP; i++) iteration(false);
+
+    // number of tensors after every measured iteration
+    const tensors: number[] = [];
+    const start = performance.now();
+
+    while (tensors.length < MIN_ITERATIONS || performance.now() - start < MIN_TIME_MS) {
+        iteration(true);
+        tensors.push(get_ntensors());
+    }
+
+    const iterations = tensors.length;
+    const total = times.forward + times.backward + times.optimizer;
+    const time_ns = total / iterations * 1e6;
+
+    return {
+        name: preset.name,
+        time_ns,
+        metrics: {
+            samples_per_s: preset.batch_size / (time_ns / 1e9),
+            forward_pct: 100 * times.forward / total,
+            backward_pct: 100 * times.backward / total,
+            optimizer_pct: 100 * times.optimizer / total,
+            peak_mib: peak_bytes / 2 ** 20,
+            tensor_drift: drift(tensors),
+        },
+    };
+}
+
+// slope of a least-squares line through the values, i.e. the change per iteration
+function drift(values: number[]): number {
+    const n = values.length;
+    const mean_x = (n - 1) / 2;
+    const mean_y = values.reduce((acc, value) => acc + value, 0) / n;
+
+    let covariance = 0, variance = 0;
+    values.forEach((value, x) => {
+        covariance += (x - mean_x) * (value - mean_y);
+        variance += (x - mean_x) ** 2;
+    });
+
+    return variance > 0 ? covariance / variance : 0;
+}
+
+const results = await run_suite("training", presets.map(preset => ({ name: preset.name, run: () => train(preset) })));
+
+// fractional drifts come from tensors that are reclaimed late (e.g. by the garbage collector)
+const leaking = results.filter(result => result.metrics.tensor_drift >= .5);
+if (leaking.length > 0) {
+    console.log(`\nTensors leak in every iteration: ${leaking.map(result => result.name).join(", ")}`);
+    process.exitCode = 1;
+}
@@ -0,0 +1,18 @@
+import type { Shard } from "../src/parallel/data_parallel.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+
+// two layer perceptron on random data, used by data_parallel_scaling.ts
+export default function create_replica({ rank }: Shard) {
+    const features = 256, hidden = 256, outputs = 32, samples = 64;
+
+    const w1 = tensor([hidden, features], true).kaiming_normal(features, 1);
+    const w2 = tensor([outputs, hidden], true).kaiming_normal(hidden, 2);
+
+    let batch = 0;
+    const input = tensor_producer([features, samples], (dest) => dest.uniform(-1, 1, rank * 100003 + batch++));
+    const target = tensor([outputs, samples]).uniform(0, 1, 3);
+
+    const graph = w2.matmul(w1.matmul(input).tanh()).mse_loss(target).graph;
+    return { graph, optimizer: new sgd(graph, { lr: .01 }) };
+}
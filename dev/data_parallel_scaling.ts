@@ -0,0 +1,31 @@
+/**
+ * Measures the training throughput of DataParallel for 1..N workers.
+ * Every worker trains on 64 samples per step, so the mini-batch grows with the number of workers.
+ * Run with `bun run bench-data-parallel [max workers]`.
+ */
+
+import { DataParallel } from "../src/parallel/data_parallel.ts";
+
+const max_workers = Number(process.argv[2] ?? navigator.hardwareConcurrency ?? 4);
+const samples_per_worker = 64;
+const steps = 50;
+const model = new URL("./data_parallel_model.ts", import.meta.url);
+
+let baseline = 0;
+
+for (let workers = 1; workers <= max_workers; workers *= 2) {
+    const trainer = await DataParallel.create(model, { workers, batch_size: workers * samples_per_worker });
+    await trainer.train(5);
+
+    const start = performance.now();
+    const loss = await trainer.train(steps);
+    const seconds = (performance.now() - start) / 1000;
+    trainer.terminate();
+
+    const throughput = steps * workers * samples_per_worker / seconds;
+    if (workers === 1) baseline = throughput;
+
+    console.log(
+        `${String(workers).padStart(3)} worker(s): ${throughput.toFixed(0).padStart(8)} samples/s` +
+        `   x${(throughput / baseline).toFixed(2)}   loss ${loss.toFixed(4)}`);
+}
@@ -0,0 +1,60 @@
+/**
+ * Measures how the kernels of the multithreaded core scale with the number of threads.
+ * Run with `bun run bench-threads` after building the core with `bun run build-core-mt`.
+ */
+
+import { RawTensor } from "../index.ts";
+import { core_ready, get_num_threads, set_num_threads } from "../src/raw_tensor/management.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+
+await core_ready;
+
+const max_threads = Number(process.argv[2] ?? navigator.hardwareConcurrency ?? 4);
+
+const a = RawTensor.create([512, 512]).uniform(-1, 1, 1);
+const b = RawTensor.create([512, 512]).uniform(-1, 1, 2);
+const row = RawTensor.create([512]).uniform(-1, 1, 3);
+const res = RawTensor.create([512, 512]);
+const big = RawTensor.create([1 << 22]).uniform(-1, 1, 4);
+
+const benchmarks: [string, () => void][] = [
+    ["matmul 512x512",   () => ops.matmul(a, b, res)],
+    ["add 512x512",      () => ops.add(a, b, res)],
+    ["add broadcast",    () => ops.add(a, row, res)],
+    ["add debroadcast",  () => ops.add(a, b, row)],
+    ["sum 4M",           () => ops.sum(big)],
+];
+
+// median time per call in ms
+function measure(fn: () => void, runs = 20): number {
+    fn();
+    const times: number[] = [];
+
+    for (let i = 0; i < runs; i++) {
+        const start = performance.now();
+        fn();
+        times.push(performance.now() - start);
+    }
+
+    return times.sort((x, y) => x - y)[Math.floor(runs / 2)];
+}
+
+const baselines = benchmarks.map(([, fn]) => {
+    set_num_threads(1);
+    return measure(fn);
+});
+
+for (let n = 1; n <= max_threads; n *= 2) {
+    const used = set_num_threads(n);
+    if (used < n) console.log(`(only ${used} threads are available)`);
+    console.log(`\n${get_num_threads()} thread(s)`);
+
+    benchmarks.forEach(([name, fn], i) => {
+        const time = measure(fn);
+        console.log(`  ${name.padEnd(18)} ${time.toFixed(3).padStart(9)} ms   x${(baselines[i] / time).toFixed(2)}`);
+    });
+
+    if (used < n) break;
+}
+
+set_num_threads(1);
@@ -1,4 +1,4 @@
-import { RawTensor, core_ready, set_rand_seed, mgmt, optim, tensor, tensor_producer } from "../index";
+import { core_ready, set_rand_seed, mgmt, optim, tensor, tensor_producer } from "../index";
 
 // if your runtime does not support top-level await,
 // you'll have to use core_ready.then(() => { ... }) instead
@@ -8,15 +8,17 @@ set_rand_seed(Date.now());
 console.log("\nRunning SGD demo...\n");
 
 const size = 100;
-const weight = tensor([2, size], true).kaiming_normal(size * 2).set_name("weight");
+const batch_size = 32;
+const weight = tensor([size, size], true).kaiming_normal(size).set_name("weight");
 const bias = tensor([size], true).kaiming_normal(size).set_name("bias");
 const target = tensor([size]).uniform(0, 1);
 
-const a = RawTensor.create([size]);
-const input = tensor_producer([size], () => a.normal(3, 1));
+// the producer fills every sample of a mini-batch of shape [batch_size, size]
+const input = tensor_producer([size], (sample) => sample.normal(3, 1), batch_size);
 
-// define computation graph: mean((target - relu(Weight * input + Bias))^2)
-const nn = weight.matmul(input).add(bias).set_name("add").leaky_relu(.05).mse_loss(target);
+// define computation graph: mean((target - relu(input * Weight + Bias))^2)
+// the whole mini-batch goes through a single matmul, the bias and target are shared by all samples
+const nn = input.matmul(weight).add(bias).set_name("add").leaky_relu(.05).mse_loss(target);
 
 // finds an execution sequence for the operations involved in the previously defined graph
 const graph = nn.graph;
@@ -36,3 +38,17 @@ for (let iteration = 0; iteration <= 1000; iteration++) {
 
 console.write("\nTraining completed in: ");
 console.timeEnd();
+
+// per-node breakdown of a few more steps. pass a path to save a trace for chrome://tracing or ui.perfetto.dev
+const profiler = graph.profile(() => {
+    for (let iteration = 0; iteration < 10; iteration++) {
+        graph.zero_grad();
+        graph.forward();
+        graph.backward();
+        optimizer.step();
+    }
+});
+
+console.log();
+profiler.print(10);
+if (process.argv[2]) await profiler.save_chrome_trace(process.argv[2]);
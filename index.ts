@@ -1,11 +1,18 @@
-import { get_total_allocated, core_ready, get_ntensors } from "./src/raw_tensor/management.ts";
-import core from "./src/core/build/index.js";
+import { get_total_allocated, core_ready, get_ntensors, get_pooled, get_pool_hits, set_pool_limit, trim_pool, set_num_threads, get_num_threads } from "./src/raw_tensor/management.ts";
+import { get_leaked } from "./src/raw_tensor/lifetime.ts";
+import core from "./src/core/core.ts";
 
 export { RawTensor } from "./src/raw_tensor/raw_tensor.ts";
+export { tensor_scope, open_scope, TensorScope, set_leak_handler } from "./src/raw_tensor/lifetime.ts";
 export { set_rand_seed } from "./src/raw_tensor/util.ts";
 export * from "./src/tensor_factory.ts";
-export const mgmt = { get_total_allocated, get_ntensors };
+export const mgmt = { get_total_allocated, get_ntensors, get_pooled, get_pool_hits, set_pool_limit, trim_pool, get_leaked, set_num_threads, get_num_threads };
 export * as optim from "./src/optimizer/optimizer.ts";
+export { no_grad, set_grad_enabled, is_grad_enabled } from "./src/autograd/grad_mode.ts";
+export { Subgraph } from "./src/autograd/subgraph.ts";
+export { Profiler, type ProfileEvent, type ProfiledPass } from "./src/autograd/profiler.ts";
+export { DataParallel, shard_range, type Shard, type Replica, type ReplicaFactory } from "./src/parallel/data_parallel.ts";
+export { DataLoader, type LoaderInfo, type LoaderOptions, type BatchProducer, type ProducerFactory } from "./src/data/loader.ts";
 
 import Tensor from "./src/tensor.ts";
 export { core, core_ready, Tensor };
@@ -13,6 +13,9 @@ const assignments: {[a: string]: string} = {
 // list of the names of all operations that were generated
 const ops: string[] = [];
 
+// macro that generated each operation, it determines the signature of the operation
+const generators: {[op: string]: string} = {};
+
 function multiline_macros(file_content: string): string {
     return file_content.replace(/(?<=(#define.*))\[\[\[[\s\S]*?\]\]\]/gm, (match: string) => match
         // remove [[[ and ]]] before and after the macro
@@ -54,6 +57,7 @@ function macro_invoke_generation(file_content: string): string {
                     const postfix = assignments[assignment_type];
                     const op_name = `${name}${postfix}`;
                     ops.push(`_${op_name}`);
+                    generators[op_name] = macro_name;
                     return `${macro_name}(${op_name}, ${assignment_type}, ${result})`;
                 })
                 .join("\n");
@@ -87,3 +91,11 @@ console.log("\nPREPROCESSING DONE.");
 const op_name_definition = `EXPORTED_OPS=${ops.join(", ")}`;
 
 fs.writeFileSync(op_names_output_dir, op_name_definition);
+
+// x-macro list of the generated ops, used for the op table of the program interpreter (program.c)
+const op_table_definition = ops.map(op => `OP(${op.slice(1)})`).join("\n");
+
+fs.writeFileSync(`${output_dir}/ops.def`, `// generated by the preprocessor\n${op_table_definition}\n`);
+
+// used by the native core to declare the signatures of the generated ops (see src/core/native.ts)
+fs.writeFileSync(`${output_dir}/ops.json`, JSON.stringify(generators, null, 4) + "\n");
@@ -0,0 +1,98 @@
+import Tensor from "../tensor.ts";
+
+/**
+ * Gradient checkpointing.
+ *
+ * Normally, every value computed during the forward pass is kept alive until the
+ * backward pass of its node. With checkpointing, only the values of the checkpoint
+ * nodes (plus inputs, parameters and the output) are kept. The topological ordering
+ * is split into segments that end at a checkpoint. During the backward pass, each
+ * segment is recomputed from the kept values right before its nodes are backpropagated.
+ *
+ * The values that are discarded only turn into actual memory savings once the memory
+ * planner assigns them to shared buffers (see Graph.plan_memory()). The planner uses
+ * the schedule computed here.
+ */
+
+export type Pass = "fw" | "bw";
+export type ScheduleStep = { node: Tensor, pass: Pass };
+
+// nodes whose values are never discarded
+const is_kept = (node: Tensor, checkpoints: Set<Tensor>, output: Tensor) =>
+    node.parents.length === 0 || checkpoints.has(node) || node === output;
+
+/**
+ * Picks every ceil(sqrt(n))-th operation of the ordering as a checkpoint.
+ * This results in O(sqrt(n)) kept values at the cost of about one extra forward pass.
+ */
+export function sqrt_checkpoints(ordering: Tensor[]): Tensor[] {
+    const operations = ordering.filter(node => node.parents.length > 0);
+    const interval = Math.ceil(Math.sqrt(operations.length));
+    return operations.filter((_, i) => (i + 1) % interval === 0);
+}
+
+// nodes whose grads receive a gradient from the output during backward passes
+export function find_grad_reachable(ordering: Tensor[], output: Tensor): Set<Tensor> {
+    const reachable = new Set<Tensor>();
+    if (output.requires_grad) reachable.add(output);
+
+    for (let i = ordering.length; i-- > 0;) {
+        const node = ordering[i];
+        if (!reachable.has(node)) continue;
+
+        for (const parent of node.parents) {
+            if (parent.requires_grad) reachable.add(parent);
+        }
+    }
+
+    return reachable;
+}
+
+/**
+ * Computes the sequence of recomputations and backward passes for the given checkpoints.
+ * Without checkpoints, this is just the reversed topological ordering.
+ * Only nodes that receive a gradient are backpropagated. The grads of other nodes (e.g. in front
+ * of a floor()) are never written, their backward passes would accumulate stale values.
+ */
+export function find_backward_schedule(ordering: Tensor[], output: Tensor, checkpoints: Set<Tensor>): ScheduleStep[] {
+    const reachable = find_grad_reachable(ordering, output);
+    if (checkpoints.size === 0) return [...ordering].reverse().filter(node => reachable.has(node)).map(node => ({ node, pass: "bw" }));
+
+    const index = new Map<Tensor, number>();
+    ordering.forEach((node, i) => index.set(node, i));
+
+    // split ordering into segments that end at a checkpoint
+    const segments: Tensor[][] = [[]];
+    for (const node of ordering) {
+        segments[segments.length - 1].push(node);
+        if (checkpoints.has(node)) segments.push([]);
+    }
+
+    const schedule: ScheduleStep[] = [];
+
+    for (let s = segments.length - 1; s >= 0; s--) {
+        const segment = segments[s].filter(node => reachable.has(node));
+
+        // the backward passes of a segment read the values of its nodes and their parents.
+        // all of these that were discarded (and their discarded ancestors) need to be recomputed.
+        const needed = new Set<Tensor>();
+        const stack = [...segment, ...segment.flatMap(node => node.parents)];
+
+        while (stack.length > 0) {
+            const node = stack.pop()!;
+            if (needed.has(node) || is_kept(node, checkpoints, output)) continue;
+            needed.add(node);
+            stack.push(...node.parents);
+        }
+
+        const recompute = [...needed].sort((a, b) => index.get(a)! - index.get(b)!);
+        for (const node of recompute) schedule.push({ node, pass: "fw" });
+
+        for (let i = segment.length - 1; i >= 0; i--) schedule.push({ node: segment[i], pass: "bw" });
+    }
+
+    return schedule;
+}
+
+// total number of floating point operations of a sequence of forward passes
+export const count_flops = (nodes: Tensor[]) => nodes.reduce((acc, node) => acc + node.flops, 0);
@@ -0,0 +1,132 @@
+import Graph from "./graph.ts";
+import { Program, Recorder, Step } from "../raw_tensor/program.ts";
+import { RawTensor } from "../raw_tensor/raw_tensor.ts";
+
+export interface Steppable {
+    step(): void;
+}
+
+/**
+ * A graph whose passes are compiled into programs (see raw_tensor/program.ts).
+ * A forward pass, a backward pass or a whole training step is a single core call,
+ * instead of a call per operation with shape checks and broadcasting checks in between.
+ * These checks are only performed once, while the graph is compiled.
+ *
+ * The programs reference the tensors of the graph by pointer, and values like the learning rate
+ * of the optimizer are baked into them. The graph needs to be recompiled after its tensors were
+ * replaced (e.g. by applying a memory plan) or these values changed.
+ */
+export class CompiledGraph {
+    readonly graph: Graph;
+
+    readonly zero_grad_program: Program;
+    readonly forward_program: Program;
+    readonly backward_program: Program;
+    readonly step_program?: Program;
+
+    // zero_grad, forward, backward and step in one program
+    readonly train_program: Program;
+
+    private readonly retained: RawTensor[];
+
+    constructor(graph: Graph, optimizer?: Steppable) {
+        this.graph = graph;
+
+        // graphs in inference mode only get a forward program
+        const training = graph.output.grad !== undefined;
+        const recorder = new Recorder();
+        const record = (fn: () => void): Step[] => {
+            recorder.steps = [];
+            fn();
+            return recorder.steps;
+        };
+
+        const zero_grad = training ? record(() => recorder.record(() => graph.zero_grad())) : [];
+
+        const forward = record(() => {
+            for (const node of graph.topological_ordering) recorder.record(() => node.compile_fw());
+        });
+
+        // same sequence as Graph.backward()
+        const backward = !training ? [] : record(() => {
+            for (const { node, pass } of graph.backward_schedule) {
+                if (pass === "fw") {
+                    recorder.record(() => node.compile_recompute());
+                    continue;
+                }
+
+                if (!node.requires_grad) continue;
+
+                const resets = graph.memory_plan?.grad_resets.get(node);
+                if (resets) for (const grad of resets) recorder.record(() => grad.zeros());
+
+                recorder.record(() => node.compile_bw());
+            }
+        });
+
+        const step = training && optimizer ? record(() => recorder.record(() => optimizer.step())) : [];
+
+        // the dropout seeds are stored as raw 32 bit integers
+        const seeds = recorder.seeds.length > 0 ? RawTensor.create([recorder.seeds.length]) : undefined;
+        if (seeds) {
+            new Uint32Array(seeds.data.buffer, seeds.data.byteOffset, recorder.seeds.length).set(recorder.seeds.map(seed => seed >>> 0));
+            recorder.retain(seeds);
+        }
+
+        this.zero_grad_program = new Program(zero_grad, seeds);
+        this.forward_program = new Program(forward, seeds);
+        this.backward_program = new Program(backward, seeds);
+        if (optimizer) this.step_program = new Program(step, seeds);
+        this.train_program = new Program([...zero_grad, ...forward, ...backward, ...step], seeds);
+        this.retained = recorder.retained;
+    }
+
+    zero_grad = () => this.zero_grad_program.run();
+    forward = () => this.forward_program.run();
+
+    backward() {
+        if (!this.graph.output.grad) throw new Error("Output node has no gradient!");
+        this.backward_program.run();
+    }
+
+    step() {
+        if (!this.step_program) throw new Error("The graph was compiled without an optimizer.");
+        this.step_program.run();
+        this.touch_parameters();
+    }
+
+    // zero_grad(), forward(), backward() and step() (if compiled with an optimizer)
+    train_step = () => {
+        this.train_program.run();
+        if (this.step_program) this.touch_parameters();
+    };
+
+    // the programs update the parameters in place, eager forward passes need to recompute their children
+    private touch_parameters() {
+        for (const param of this.graph.parameters) param.touch();
+    }
+
+    free() {
+        this.zero_grad_program.free();
+        this.forward_program.free();
+        this.backward_program.free();
+        this.step_program?.free();
+        this.train_program.free();
+
+        for (const tensor of this.retained) tensor.free();
+        this.retained.length = 0;
+    }
+
+    toString(): string {
+        const describe = (program: Program) =>
+            `${program.ninstr} instructions, ${program.nsegments} segments, parallelism ${program.parallelism.toFixed(2)}`;
+
+        return (
+            "COMPILED GRAPH\n" +
+            `  Forward:   ${describe(this.forward_program)}\n` +
+            `  Backward:  ${describe(this.backward_program)}\n` +
+            `  Train:     ${describe(this.train_program)}`);
+    }
+
+    print = () => console.log(this.toString());
+}
@@ -0,0 +1,24 @@
+// Global switch for gradient tracking.
+// Nodes that are created while gradients are disabled never allocate grads or interims
+// and are skipped during backpropagation. This is what you want when serving a trained model.
+
+let grad_enabled = true;
+
+export const is_grad_enabled = () => grad_enabled;
+export const set_grad_enabled = (enabled: boolean) => grad_enabled = enabled;
+
+/**
+ * Runs a function with gradients disabled, e.g. to build a graph for inference.
+ * @param fn Function that builds (part of) a graph
+ * @returns The return value of fn
+ */
+export function no_grad<T>(fn: () => T): T {
+    const previous = grad_enabled;
+    grad_enabled = false;
+
+    try {
+        return fn();
+    } finally {
+        grad_enabled = previous;
+    }
+}
@@ -1,6 +1,20 @@
 import { graph_to_string } from "../raw_tensor/to_string.ts";
 import Tensor from "../tensor.ts";
 import { Parameter } from "./node_operations.ts";
+import { MemoryPlan, PlanMode, plan_memory } from "./memory_planner.ts";
+import { ScheduleStep, count_flops, find_backward_schedule, sqrt_checkpoints } from "./checkpointing.ts";
+import { CompiledGraph, Steppable } from "./compiler.ts";
+import { OptimizationReport, PassOptions, optimize_graph } from "./passes.ts";
+import { forward_pass } from "./subgraph.ts";
+import { Profiler } from "./profiler.ts";
+
+export interface CheckpointReport {
+    checkpoints: number;
+    recomputed_nodes: number;
+    memory_saved: number;   // bytes
+    extra_flops: number;    // per training step
+    step_flops: number;     // estimated flops of a training step without checkpointing
+}
 
 /**
  * This is a basic implementation of the computation graph.
@@ -21,6 +35,10 @@ export default class Graph {
     all_nodes: Tensor[];
 
     topological_ordering: Tensor[];
+    backward_schedule: ScheduleStep[];
+    checkpoints = new Set<Tensor>();
+    memory_plan?: MemoryPlan;
+    profiler?: Profiler;
 
     constructor(inputs: Tensor[], output: Tensor, parameters: Parameter[], all_nodes: Tensor[]) {
         this.inputs = inputs;
@@ -28,16 +46,102 @@ export default class Graph {
         this.parameters = parameters;
         this.all_nodes = all_nodes;
         this.topological_ordering = this.find_topological_order();
+        this.backward_schedule = find_backward_schedule(this.topological_ordering, this.output, this.checkpoints);
     }
 
     print = (show_id: boolean = false) => console.log(graph_to_string(this.output, show_id));
 
-    // todo: this is where parallelization could come into play
-    //       for parallelization, there are some optimization in the way we find the
-    //       topological ordering. e.g. if there are three input nodes, they are all
-    //       "on the same level", even though maybe it would be wise to first execute
-    //       those where the result deadline is closer. (where the result will be needed
-    //       earlier)
+    /**
+     * Computes the lifetimes of all intermediates and assigns them to shared buffers.
+     * @param mode "forward" if only forward passes will be performed (inference),
+     *             "training" if backward passes are performed as well.
+     * @param apply If true, the buffers of the graph are replaced by the planned ones.
+     */
+    plan_memory(mode: PlanMode = "training", apply = true): MemoryPlan {
+        const plan = plan_memory(this, mode);
+        if (apply) plan.apply();
+        return plan;
+    }
+
+    /**
+     * Folds constant subgraphs, merges duplicate nodes and removes nodes that don't contribute
+     * to the output or to needed gradients (see passes.ts). Removed nodes are freed.
+     * Optimize before setting checkpoints, planning memory or compiling.
+     * @param options Passes that are performed, all are enabled by default
+     */
+    optimize(options?: PassOptions): OptimizationReport {
+        return optimize_graph(this, options);
+    }
+
+    // finds the nodes and the execution order again after nodes were replaced
+    rebuild() {
+        const nodes = new Set<Tensor>();
+        const stack: Tensor[] = [this.output];
+
+        while (stack.length > 0) {
+            const node = stack.pop()!;
+            if (nodes.has(node)) continue;
+            nodes.add(node);
+            stack.push(...node.parents);
+        }
+
+        this.all_nodes = [...nodes];
+        this.inputs = this.all_nodes.filter(node => node.parents.length === 0);
+        this.parameters = this.parameters.filter(parameter => nodes.has(parameter));
+        this.topological_ordering = this.find_topological_order();
+        this.backward_schedule = find_backward_schedule(this.topological_ordering, this.output, this.checkpoints);
+    }
+
+    /**
+     * Compiles the forward pass, the backward pass and optionally the update step of an optimizer
+     * into programs that the core executes without returning to js in between operations.
+     * Apply memory plans and set checkpoints before compiling, the programs reference the current tensors.
+     * @param optimizer Optimizer whose step() is compiled as well
+     */
+    compile(optimizer?: Steppable): CompiledGraph {
+        return new CompiledGraph(this, optimizer);
+    }
+
+    // sequence of all passes that are performed during forward() and backward()
+    get_schedule(mode: PlanMode = "training"): ScheduleStep[] {
+        const forward: ScheduleStep[] = this.topological_ordering.map(node => ({ node, pass: "fw" }));
+        return mode === "training" ? [...forward, ...this.backward_schedule] : forward;
+    }
+
+    /**
+     * Enables gradient checkpointing. Only the values of the checkpoints are kept after the
+     * forward pass, all other intermediates are recomputed segment by segment during backward().
+     * The memory is only reclaimed once a memory plan is applied, so set the checkpoints first.
+     * @param checkpoints Nodes whose values are kept, or "sqrt" to pick every sqrt(n)-th node.
+     *                    An empty array disables checkpointing.
+     * @returns Memory saved by the (training) memory plan vs the extra flops of the recomputations
+     */
+    set_checkpoints(checkpoints: Tensor[] | "sqrt"): CheckpointReport {
+        if (this.memory_plan)
+            throw new Error("Checkpoints need to be set before a memory plan is applied.");
+
+        const baseline = plan_memory(this, "training");
+
+        this.checkpoints = new Set(checkpoints === "sqrt" ? sqrt_checkpoints(this.topological_ordering) : checkpoints);
+        this.backward_schedule = find_backward_schedule(this.topological_ordering, this.output, this.checkpoints);
+
+        const checkpointed = plan_memory(this, "training");
+        const recomputed = this.backward_schedule.filter(step => step.pass === "fw").map(step => step.node);
+
+        return {
+            checkpoints: this.checkpoints.size,
+            recomputed_nodes: recomputed.length,
+            memory_saved: baseline.planned_bytes - checkpointed.planned_bytes,
+            extra_flops: count_flops(recomputed),
+
+            // backward passes take roughly twice as many flops as forward passes
+            step_flops: 3 * count_flops(this.topological_ordering),
+        };
+    }
+
+    // note: this ordering is serial. independent branches are executed concurrently by
+    //       compiled graphs (see compile()), whose programs are scheduled by the core based on
+    //       the data dependencies between the kernels, with the critical path first.
     // todo: handle cycles. topological orderings exist iff the graph is acyclic
 
     /**
@@ -73,12 +177,42 @@ export default class Graph {
         for (const node of this.all_nodes) node.zero_grad();
     }
 
-    forward() {
-        // Step forward through node execution order and update primals using forward functions
-        for (let i = 0; i < this.topological_ordering.length; i++) {
-            const node = this.topological_ordering[i];
-            node.fw();
+    /**
+     * Profiles the forward and backward passes of all nodes that are performed by fn, e.g. a few
+     * training steps. Returns the profiler with the recorded events (profiler.print() for a summary,
+     * profiler.save_chrome_trace(path) for a trace). Compiled programs are not profiled per node.
+     * @param profiler Profiler to add the events to, e.g. of a previous call
+     */
+    profile(fn: () => void, profiler = new Profiler()): Profiler {
+        const previous = this.profiler;
+        this.profiler = profiler;
+
+        try {
+            profiler.run(fn);
+        } finally {
+            this.profiler = previous;
         }
+
+        return profiler;
+    }
+
+    /**
+     * Puts the graph into inference mode by freeing all grads and interims.
+     * Only the values remain, so backward passes are no longer possible afterwards.
+     */
+    inference() {
+        for (const node of this.all_nodes) node.release_grad();
+    }
+
+    /**
+     * Steps forward through the execution order and updates the values of the nodes.
+     * Nodes whose parents didn't change since their last forward pass are skipped (see Tensor.stale),
+     * changes propagate to the children through the versions of the recomputed nodes. This also
+     * holds for partial realizations of intermediates, e.g. after parameter updates.
+     * @param force Recomputes all nodes
+     */
+    forward(force = false) {
+        forward_pass(this.topological_ordering, force, this.profiler);
     }
 
     backward(): void {
@@ -90,9 +224,23 @@ export default class Graph {
         }
 
         // Step backward through node execution order and update grads using backward functions
-        for (let i = this.topological_ordering.length - 1; i >= 0; i--) {
-            const node = this.topological_ordering[i];
-            node.bw();
+        // (with checkpointing, discarded values are recomputed in between)
+        for (const { node, pass } of this.backward_schedule) {
+            if (pass === "fw") {
+                if (this.profiler) this.profiler.measure(node, "recompute", () => node.recompute());
+                else node.recompute();
+                continue;
+            }
+
+            // nodes that can't reach a parameter don't have grads
+            if (!node.requires_grad) continue;
+
+            // grads that share memory with other grads are reset right before they are first written to
+            const resets = this.memory_plan?.grad_resets.get(node);
+            if (resets) for (const grad of resets) grad.zeros();
+
+            if (this.profiler) this.profiler.measure(node, "bw", () => node.bw());
+            else node.bw();
         }
     }
 
@@ -0,0 +1,254 @@
+import { RawTensor } from "../raw_tensor/raw_tensor.ts";
+import { DType, dtype_size } from "../raw_tensor/dtype.ts";
+import Tensor from "../tensor.ts";
+import Graph from "./graph.ts";
+
+/**
+ * Liveness-based memory planning for the intermediates of a graph.
+ *
+ * Every node allocates its own value (and usually a grad, some also interims) at construction
+ * and keeps them for the whole lifetime of the graph. Most of these buffers are only
+ * needed for a short period of the execution though. The planner walks the topological
+ * ordering, computes the steps at which each intermediate is alive and then assigns
+ * intermediates with non-overlapping lifetimes to the same buffer.
+ *
+ * Timeline: every step of the graph's schedule (see Graph.get_schedule()) is one forward or
+ * backward pass of a node. With gradient checkpointing, values that are recomputed during
+ * the backward pass are dead in between.
+ *
+ * Buffers are shared between tensors with the same dtype and size in bytes. The tensors of
+ * a buffer are reshape-views of that buffer, so no core changes are needed to use them.
+ */
+
+export type PlanMode = "forward" | "training";
+type BufferKey = "value" | "grad" | string;
+type Interval = [number, number];
+
+export interface TensorLifetime {
+    node: Tensor;
+    key: BufferKey;     // name of the field of the node that holds the tensor
+    tensor: RawTensor;
+    dtype: DType;
+    bytes: number;
+    intervals: Interval[];
+    first_write?: Tensor; // node whose backward pass writes to this tensor first (grads only)
+}
+
+export interface PlannedBuffer {
+    dtype: DType;
+    bytes: number;
+    members: TensorLifetime[];
+}
+
+const overlaps = (a: Interval[], b: Interval[]) =>
+    a.some(([a_start, a_end]) => b.some(([b_start, b_end]) => a_start <= b_end && b_start <= a_end));
+
+const lifetime = (node: Tensor, key: BufferKey, tensor: RawTensor, intervals: Interval[], first_write?: Tensor): TensorLifetime =>
+    ({ node, key, tensor, dtype: tensor.dtype, bytes: tensor.nelem * dtype_size(tensor.dtype), intervals, first_write });
+
+// tensors that are views don't own any memory and are therefore not planned
+const owns_memory = (tensor?: RawTensor): tensor is RawTensor => tensor !== undefined && !tensor.isview;
+
+// nodes like Transpose or Min don't own their value but alias the value of their parent.
+// any access to such a value is an access to the value of the parent.
+function value_owner(node: Tensor): Tensor {
+    while (node.parents.length === 1 && node.value.isview) node = node.parents[0];
+    return node;
+}
+
+function grad_owner(node: Tensor): Tensor {
+    while (node.parents.length === 1 && node.grad?.isview) node = node.parents[0];
+    return node;
+}
+
+export class MemoryPlan {
+    readonly graph: Graph;
+    readonly mode: PlanMode;
+    readonly lifetimes: TensorLifetime[];
+    readonly buffers: PlannedBuffer[];
+    readonly steps: number;
+
+    // grads that share a buffer need to be zeroed before the first accumulation.
+    // maps nodes to the grads that need to be zeroed right before their backward pass.
+    readonly grad_resets = new Map<Tensor, RawTensor[]>();
+
+    private applied = false;
+
+    constructor(graph: Graph, mode: PlanMode) {
+        this.graph = graph;
+        this.mode = mode;
+        this.steps = graph.get_schedule(mode).length;
+        this.lifetimes = this.compute_lifetimes();
+        this.buffers = this.assign_buffers();
+    }
+
+    // total size of all planned tensors if each of them owns its memory (current behaviour)
+    get naive_bytes(): number {
+        return this.lifetimes.reduce((acc, lt) => acc + lt.bytes, 0);
+    }
+
+    // total size of all buffers of the plan
+    get planned_bytes(): number {
+        return this.buffers.reduce((acc, buffer) => acc + buffer.bytes, 0);
+    }
+
+    // lower bound: largest amount of memory that is alive at a single step
+    get peak_live_bytes(): number {
+        const live = new Array(this.steps).fill(0);
+
+        for (const lt of this.lifetimes) {
+            for (const [start, end] of lt.intervals) {
+                for (let step = start; step <= end; step++) live[step] += lt.bytes;
+            }
+        }
+
+        return Math.max(0, ...live);
+    }
+
+    private compute_lifetimes(): TensorLifetime[] {
+        const schedule = this.graph.get_schedule(this.mode);
+        const training = this.mode === "training";
+
+        // collect the steps at which values are defined/used, grads are written/read
+        // and interims are used. a value can be defined multiple times if it is recomputed.
+        const value_events = new Map<Tensor, { step: number, def: boolean }[]>();
+        const grad_events = new Map<Tensor, { step: number, writer?: Tensor }[]>();
+        const interim_steps = new Map<Tensor, number[]>();
+        const record = <T>(map: Map<Tensor, T[]>, node: Tensor, entry: T) => {
+            if (!map.has(node)) map.set(node, []);
+            map.get(node)!.push(entry);
+        };
+
+        schedule.forEach(({ node, pass }, step) => {
+            const owner = value_owner(node);
+
+            // views don't write to the value they alias
+            record(value_events, owner, { step, def: pass === "fw" && owner === node });
+            record(interim_steps, node, step);
+            for (const parent of node.parents) record(value_events, value_owner(parent), { step, def: false });
+
+            if (pass !== "bw") return;
+            record(grad_events, grad_owner(node), { step });
+            for (const parent of node.parents) record(grad_events, grad_owner(parent), { step, writer: node });
+        });
+
+        const lifetimes: TensorLifetime[] = [];
+
+        for (const node of this.graph.topological_ordering) {
+            // sources, constants and parameters persist across iterations
+            if (node.parents.length === 0) continue;
+
+            // the output value and grad are read by the user after execution
+            const is_output = node === this.graph.output;
+
+            if (!is_output && owns_memory(node.value)) {
+                // a value is alive from each definition until its last use before the next definition
+                const intervals: Interval[] = [];
+                for (const { step, def } of value_events.get(node)!) {
+                    if (def) intervals.push([step, step]);
+                    else if (intervals.length > 0) intervals[intervals.length - 1][1] = step;
+                }
+
+                lifetimes.push(lifetime(node, "value", node.value, intervals));
+            }
+
+            // interims only hold temporary results during the forward or backward passes of their node
+            for (const [key, field] of Object.entries(node)) {
+                if (!key.startsWith("interim") || !(field instanceof RawTensor) || !owns_memory(field)) continue;
+                const intervals: Interval[] = interim_steps.get(node)!.map(step => [step, step]);
+                lifetimes.push(lifetime(node, key, field, intervals));
+            }
+
+            if (training && !is_output && owns_memory(node.grad)) {
+                // a grad is alive from the first accumulation until the backward pass of its node.
+                // grads that are never written keep their own memory, the schedule doesn't backpropagate them.
+                const events = grad_events.get(node) || [];
+                const first = events.find(event => event.writer !== undefined);
+                if (!first) continue;
+
+                const intervals: Interval[] = [[first.step, events[events.length - 1].step]];
+                lifetimes.push(lifetime(node, "grad", node.grad, intervals, first.writer));
+            }
+        }
+
+        return lifetimes;
+    }
+
+    /**
+     * Greedy interval coloring: the lifetimes are visited in order of their first step
+     * and placed into the first buffer of the same dtype and size that is free for the whole lifetime.
+     */
+    private assign_buffers(): PlannedBuffer[] {
+        const buffers: PlannedBuffer[] = [];
+        const sorted = [...this.lifetimes].sort((a, b) => a.intervals[0][0] - b.intervals[0][0]);
+
+        for (const lifetime of sorted) {
+            const buffer = buffers.find(buffer => buffer.dtype === lifetime.dtype && buffer.bytes === lifetime.bytes
+                && buffer.members.every(member => !overlaps(member.intervals, lifetime.intervals)));
+
+            if (buffer) buffer.members.push(lifetime);
+            else buffers.push({ dtype: lifetime.dtype, bytes: lifetime.bytes, members: [lifetime] });
+        }
+
+        return buffers;
+    }
+
+    /**
+     * Replaces the planned tensors of the graph by views of the shared buffers.
+     * The previously allocated tensors are freed, so references to them become invalid.
+     *
+     * A forward plan must only be applied to graphs that are used for inference,
+     * because the values are overwritten before the backward pass could use them.
+     */
+    apply(): void {
+        if (this.applied) throw new Error("Memory plan has already been applied.");
+
+        for (const buffer of this.buffers) {
+            // buffers with a single member would not save any memory
+            if (buffer.members.length < 2) continue;
+
+            const storage = RawTensor.create([buffer.bytes / dtype_size(buffer.dtype)], undefined, buffer.dtype);
+
+            for (const member of buffer.members) {
+                const view = storage.reshape([...member.tensor.shape]);
+                member.tensor.free();
+                member.tensor = view;
+                (member.node as unknown as Record<string, RawTensor>)[member.key] = view;
+
+                // the value is overwritten by other members, it needs to be recomputed in every forward pass
+                if (member.key === "value") member.node.volatile = true;
+
+                if (member.first_write) {
+                    if (!this.grad_resets.has(member.first_write)) this.grad_resets.set(member.first_write, []);
+                    this.grad_resets.get(member.first_write)!.push(view);
+                }
+            }
+        }
+
+        // nodes that hold views of the replaced tensors need to recreate them
+        for (const node of this.graph.topological_ordering) node.bind_views();
+
+        this.graph.memory_plan = this;
+        this.applied = true;
+    }
+
+    toString(): string {
+        const kib = (bytes: number) => `${(bytes / 1024).toFixed(2)} KiB`;
+        const shared = this.buffers.filter(buffer => buffer.members.length > 1);
+
+        return (
+            `MEMORY PLAN (${this.mode})\n` +
+            `  Planned tensors:   ${this.lifetimes.length}\n` +
+            `  Buffers:           ${this.buffers.length} (${shared.length} shared)\n` +
+            `  Naive memory:      ${kib(this.naive_bytes)}\n` +
+            `  Planned memory:    ${kib(this.planned_bytes)}\n` +
+            `  Peak live memory:  ${kib(this.peak_live_bytes)}\n` +
+            `  Savings:           ${(100 * (1 - this.planned_bytes / Math.max(1, this.naive_bytes))).toFixed(1)}%`);
+    }
+
+    print = () => console.log(this.toString());
+}
+
+export function plan_memory(graph: Graph, mode: PlanMode = "training"): MemoryPlan {
+    return new MemoryPlan(graph, mode);
+}
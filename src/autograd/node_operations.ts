@@ -4,10 +4,15 @@ import {RawTensor} from "../raw_tensor/raw_tensor.ts";
 import Shape from "../raw_tensor/shape.ts";
 import { get_global_seed } from "../raw_tensor/util.ts";
 import Tensor from "../tensor.ts";
+import { is_grad_enabled } from "./grad_mode.ts";
+import { recorder } from "../raw_tensor/program.ts";
 
 // This file contains all operations of the graph-node abstraction-level
 // These are essentially all operations of the tensor level plus their derivatives
 
+// NOTE: grads and interims are only allocated if the node requires a gradient.
+//       bw() is never called on nodes that don't, so they can be used without checks there.
+
 // FwOps only have primals (no grad, no backprop)
 export class FwOp extends Tensor {
     value: RawTensor;
@@ -15,26 +20,18 @@ export class FwOp extends Tensor {
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.like(parents[0].value);
+        this.requires_grad = false;
     }
 }
 
 // FwBwOps have primals and gradients
 export class FwBwOp extends FwOp {
-    grad: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
-        this.grad = RawTensor.like(this.value);
-    }
-}
-
-// FwBwInterimOps have primals, grads and an interim to hold intermediate results
-export class FwBwInterimOp extends FwBwOp {
-    interim: RawTensor;
-
-    constructor(parents: Tensor[]) {
-        super(parents);
-        this.interim = RawTensor.like(this.value);
+        this.requires_grad = this.parents_require_grad();
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 }
 
@@ -49,83 +46,112 @@ export class Constant extends Tensor {
 }
 
 // Parameters don't have parents, can change and do require gradients
+// (unless they are created while gradients are disabled)
 export class Parameter extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
     constructor(value: RawTensor | number) {
         super([]);
         this.value = typeof value === "number" ? RawTensor.scalar(value) : value;
-        this.grad = RawTensor.like(this.value);
+        this.requires_grad = is_grad_enabled();
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 }
 
+// the value of a source is never replaced, the producer writes each sample into it.
+// this way, views of the value (e.g. in Matmul) stay valid and no memory is allocated per sample.
+// with a batch size, the value gets a leading batch axis and the producer fills one view
+// of it per sample, so the following operations process the whole mini-batch at once.
 export class Source extends Tensor {
     value: RawTensor;
-    producer: () => RawTensor;
+    producer: (dest: RawTensor, index: number) => void;
+    batch_size?: number;
+    samples: RawTensor[] = [];
+    volatile = true;
 
-    constructor(shape: Shape | number[], producer: () => RawTensor) {
+    constructor(shape: Shape | number[], producer: (dest: RawTensor, index: number) => void, batch_size?: number) {
         super([]);
 
-        this.value = RawTensor.create(shape);
+        if (batch_size !== undefined && !(Number.isInteger(batch_size) && batch_size > 0))
+            throw new Error(`Invalid batch size ${batch_size}.`);
+
+        this.value = RawTensor.create(batch_size === undefined ? [...shape] : [batch_size, ...shape]);
         this.producer = producer;
+        this.batch_size = batch_size;
+
+        const sample_nelem = [...shape].reduce((acc, size) => acc * size, 1);
+        for (let i = 0; i < (batch_size ?? 0); i++) this.samples.push(RawTensor.view_of(this.value, 1, i * sample_nelem));
     }
 
-    fw = () => this.value = this.producer();
+    fw = () => {
+        if (this.batch_size === undefined) this.producer(this.value, 0);
+        else this.samples.forEach((sample, i) => this.producer(sample, i));
+    };
+
+    dispose() {
+        for (const sample of this.samples) sample.free();
+        super.dispose();
+    }
+
+    // the producer is js code, it is called in between the core calls of a compiled program
+    compile_fw() {
+        recorder!.callback(this.fw);
+    }
 }
 
 export class Add extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.create(this.parents[0].value.shape.broadcast(this.parents[1].value.shape));
-        this.grad = RawTensor.like(this.value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 
     fw = () => ops.add(this.parents[0].value, this.parents[1].value, this.value);
 
+    // grads of broadcast parents (e.g. a bias that is added to every sample of a batch)
+    // are summed over the broadcast axes
     bw() {
         // d/da (a+b) = 1
-        if (this.parents[0].grad) ops.add(this.grad, this.parents[0].grad, this.parents[0].grad); // parents[0].grad = 1 * this.grad
+        if (this.parents[0].grad) ops.identity_acc(this.grad, this.parents[0].grad); // parents[0].grad += 1 * this.grad
 
         // d/db (a+b) = 1
-        if (this.parents[1].grad) ops.add(this.grad, this.parents[1].grad, this.parents[1].grad); // parents[0].grad = 1 * this.grad
+        if (this.parents[1].grad) ops.identity_acc(this.grad, this.parents[1].grad); // parents[1].grad += 1 * this.grad
     }
 }
 
 export class Sub extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.create(this.parents[0].value.shape.broadcast(this.parents[1].value.shape));
-        this.grad = RawTensor.like(this.value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 
     fw = () => ops.sub(this.parents[0].value, this.parents[1].value, this.value);
 
     bw() {
         // d/da (a-b) = 1
-        if (this.parents[0].grad) ops.add(this.parents[0].grad, this.grad, this.parents[0].grad); // parents[0].grad = 1 * this.grad
+        if (this.parents[0].grad) ops.identity_acc(this.grad, this.parents[0].grad); // parents[0].grad += 1 * this.grad
 
         // d/db (a-b) = -1
-        if (this.parents[1].grad) ops.sub(this.parents[1].grad, this.grad, this.parents[1].grad); // parents[1].grad parents[0].grad = -1 * this.grad
+        if (this.parents[1].grad) ops.negate_acc(this.grad, this.parents[1].grad); // parents[1].grad += -1 * this.grad
     }
 }
 
 export class Mul extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
-    interim: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.create(this.parents[0].value.shape.broadcast(this.parents[1].value.shape));
-        this.grad = RawTensor.like(this.value);
-        this.interim = RawTensor.like(this.value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 
     fw = () => ops.mul(this.parents[0].value, this.parents[1].value, this.value);
@@ -144,14 +170,12 @@ export class Mul extends Tensor {
 
 export class Div extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
-    interim: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.create(this.parents[0].value.shape.broadcast(this.parents[1].value.shape));
-        this.grad = RawTensor.like(this.value);
-        this.interim = RawTensor.like(this.value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 
     fw = () => ops.div(this.parents[0].value, this.parents[1].value, this.value);
@@ -161,86 +185,55 @@ export class Div extends Tensor {
         const b = this.parents[1];
 
         // d/da (a/b) = 1/b
-        if (a.grad) {
-            ops.div(this.grad, b.value, this.interim); // interim = this.grad * 1/b = this.grad / b
-            ops.add(a.grad, this.interim, a.grad); // a.grad += interim
-        }
+        if (a.grad) ops.div_acc(this.grad, b.value, a.grad);
 
         // d/db (a/b) = -a/(b^2)
-        if (b.grad) {       
-            ops.pow(b.value, 2, this.interim);              // interim = b^2
-            ops.div(a.value, this.interim, this.interim);   // interim = a / b^2
-            ops.negate(this.interim, this.interim);         // interim = -a / b^2
-            ops.mul_acc(this.grad, this.interim, b.grad);   // b.grad += this.grad * (-a / b^2)
-        }
+        if (b.grad) ops.bw_div_b_acc(a.value, b.value, this.grad, b.grad);
     }
 }
 
 export class Pow extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
-    interim_0: RawTensor;
-    interim_1: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.create(this.parents[0].value.shape.broadcast(this.parents[1].value.shape));
-        this.grad = RawTensor.like(this.value);
-        this.interim_0 = RawTensor.like(this.parents[0].value);
-        this.interim_1 = RawTensor.like(this.parents[1].value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
     }
 
     fw = () => ops.pow(this.parents[0].value, this.parents[1].value, this.value);
 
     bw() {
-        const a = this.parents[0].value; // base
-        const b = this.parents[1].value; // exponent
+        const a = this.parents[0]; // base
+        const b = this.parents[1]; // exponent
 
-        if (this.parents[0].grad) {
-            // d/da (a^b) = b * a^(b-1)
-            ops.sub(b, 1, this.interim_1); // interim = b - 1
-            ops.pow(a, this.interim_1, this.interim_0); // interim = a^(b-1)
-            ops.mul(b, this.interim_0, this.interim_0); // interim = b * a^(b-1)
-            ops.mul(this.grad, this.interim_0, this.interim_0); // interim = grad * b * a^(b-1)
-            ops.add_acc(this.interim_0, this.parents[0].grad, this.parents[0].grad); // parents[0].grad += interim
-        }
+        // d/da (a^b) = b * a^(b-1)
+        if (a.grad) ops.bw_pow_a_acc(a.value, b.value, this.grad, a.grad);
 
-        if (this.parents[1].grad) {
-            // todo validate
-            // d/db (a^b) = a^b * ln(a)
-            ops.log(a, this.interim_0); // interim = ln(a)
-            ops.mul(this.value, this.interim_0, this.interim_0); // interim = a^b * ln(a)
-            ops.mul(this.grad, this.interim_0, this.interim_0); // interim = grad * a^b * ln(a)
-            ops.add_acc(this.interim_0, this.parents[1].grad, this.parents[1].grad); // parents[1].grad += interim
-        }
+        // d/db (a^b) = a^b * ln(a)
+        if (b.grad) ops.bw_pow_b_acc(a.value, b.value, this.grad, b.grad);
     }
 }
 
 export class Matmul extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
     // these are views and therefore don't need a lot of memory
-    A: RawTensor;
-    B: RawTensor;
-    A_T: RawTensor;
-    B_T: RawTensor;
+    A!: RawTensor;
+    B!: RawTensor;
+    A_T!: RawTensor;
+    B_T!: RawTensor;
+    extended_A = false;
+    extended_B = false;
 
     constructor(parents: Tensor[]) {
         super(parents);
         
-        const A = this.parents[0].value;
-        const B = this.parents[1].value;
-
-        // extend vectors such that they can be multiplied
-        this.A = A.rank === 1 ? A.left_extend() : A;
-        this.B = B.rank === 1 ? B.right_extend() : B;
-
-        this.A_T = this.A.T;
-        this.B_T = this.B.T;
-
+        this.bind_views();
         this.value = RawTensor.create(get_shape_matmul(this.A, this.B));
-        this.grad = RawTensor.like(this.value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
 
         // todo: YOU LEFT OFF HERE
         // this is nice and all but i think the real solution would be to
@@ -251,7 +244,36 @@ export class Matmul extends Tensor {
         // input tensor rank is higher than that...
     }
 
+    bind_views() {
+        const A = this.parents[0].value;
+        const B = this.parents[1].value;
+
+        // free the views that were derived from the previous parent buffers
+        this.A_T?.free();
+        this.B_T?.free();
+        if (this.extended_A) this.A.free();
+        if (this.extended_B) this.B.free();
+
+        // extend vectors such that they can be multiplied
+        this.extended_A = A.rank === 1;
+        this.extended_B = B.rank === 1;
+        this.A = this.extended_A ? A.left_extend() : A;
+        this.B = this.extended_B ? B.right_extend() : B;
+
+        this.A_T = this.A.T;
+        this.B_T = this.B.T;
+    }
+
+    dispose() {
+        this.A_T.free();
+        this.B_T.free();
+        if (this.extended_A) this.A.free();
+        if (this.extended_B) this.B.free();
+        super.dispose();
+    }
+
     fw = () => ops.matmul(this.A, this.B, this.value);
+    get flops() { return 2 * this.value.nelem * this.A.cols; }
 
     bw() {
         const A = this.parents[0];
@@ -264,20 +286,33 @@ export class Matmul extends Tensor {
 
 export class Dot extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
-    A_T: RawTensor;
-    B_T: RawTensor;
+    A_T!: RawTensor;
+    B_T!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.create(get_shape_dot(this.parents[0].value, this.parents[1].value));
-        this.grad = RawTensor.like(this.value);
+        if (this.requires_grad) this.grad = RawTensor.like(this.value);
+        this.bind_views();
+    }
+
+    bind_views() {
+        this.A_T?.free();
+        this.B_T?.free();
         this.A_T = this.parents[0].value.T;
         this.B_T = this.parents[1].value.T;
     }
 
+    dispose() {
+        this.A_T.free();
+        this.B_T.free();
+        super.dispose();
+    }
+
     fw = () => ops.dot(this.parents[0].value, this.parents[1].value, this.value);
+    get flops() { return 2 * this.value.nelem * this.parents[0].value.cols; }
 
     bw() {
         // todo: validate - it is likely that we need to handle dot differently than matmul
@@ -293,32 +328,63 @@ export class Dot extends Tensor {
 export class Transpose extends Tensor {
     value: RawTensor;
     grad?: RawTensor;
+    permutation: number[];
 
     constructor(parents: Tensor[], ...permutation: number[]) {
         super(parents);
+        this.permutation = permutation;
         this.value = parents[0].value.transpose(...permutation);
-        this.grad = parents[0].grad?.transpose(...permutation);
+        if (this.requires_grad) this.grad = parents[0].grad?.transpose(...permutation);
+    }
+
+    get flops() { return 0; }
+
+    bind_views() {
+        this.value.free();
+        this.grad?.free();
+        this.value = this.parents[0].value.transpose(...this.permutation);
+        if (this.requires_grad) this.grad = this.parents[0].grad?.transpose(...this.permutation);
+    }
+
+    // the grad is a view of the grad of the parent
+    release_grad() {
+        if (this.requires_grad) this.grad?.free();
+        this.grad = undefined;
+        this.requires_grad = false;
     }
 }
 
 export class Min extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
     grad_view?: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = parents[0].value.create_view(parents[0].value.rank);
+        if (!this.requires_grad) return;
         this.grad = RawTensor.scalar(0);
         if (this.parents[0].grad) this.grad_view = this.parents[0].grad.create_view(this.parents[0].grad.rank);
     }
 
-    fw() {
-        const linear_idx = ops.min_idx(this.parents[0].value);
-        ops.shift_view(this.value, linear_idx);
-        if (this.grad_view) ops.shift_view(this.grad_view, linear_idx);
+    release_grad() {
+        this.grad_view?.free();
+        this.grad_view = undefined;
+        super.release_grad();
     }
 
+    bind_views() {
+        this.value.free();
+        this.grad_view?.free();
+        this.value = this.parents[0].value.create_view(this.parents[0].value.rank);
+        const parent_grad = this.parents[0].grad;
+        this.grad_view = parent_grad && this.requires_grad ? parent_grad.create_view(parent_grad.rank) : undefined;
+    }
+
+    get flops() { return this.parents[0].value.nelem; }
+
+    fw = () => ops.shift_to_min(this.parents[0].value, this.value, this.grad_view);
+
     bw() {
         if (!this.parents[0].grad) return;
         ops.add(this.grad_view!, this.grad, this.grad_view);
@@ -326,24 +392,21 @@ export class Min extends Tensor {
 }
 
 export class Max extends Min {
-    fw() {
-        const linear_idx = ops.max_idx(this.parents[0].value);
-        ops.shift_view(this.value, linear_idx);
-        if (this.grad_view) ops.shift_view(this.grad_view, linear_idx);
-    }
+    fw = () => ops.shift_to_max(this.parents[0].value, this.value, this.grad_view);
 }
 
 export class Sum extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.scalar();
-        this.grad = RawTensor.scalar();
+        if (this.requires_grad) this.grad = RawTensor.scalar();
     }
 
     fw = () => ops.sum_tns(this.parents[0].value, this.value);
+    get flops() { return this.parents[0].value.nelem; }
 
     bw() {
         if (!this.parents[0].grad) return;
@@ -354,17 +417,24 @@ export class Sum extends Tensor {
 // OLD MEAN IMPL. APPARENTLY INCORRECT
 export class Mean extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
-    interim: RawTensor;
+    grad!: RawTensor;
+    interim!: RawTensor;
 
     constructor(parents: Tensor[]) {
         super(parents);
         this.value = RawTensor.scalar(); // Scalar tensor to hold the mean value
+        if (!this.requires_grad) return;
         this.grad = RawTensor.like(this.value); // Gradient tensor with the same shape as input
         this.interim = RawTensor.like(this.parents[0].value);
     }
 
+    release_grad() {
+        if (this.requires_grad) this.interim.free();
+        super.release_grad();
+    }
+
     fw = () => ops.mean_tns(this.parents[0].value, this.value);
+    get flops() { return this.parents[0].value.nelem; }
 
     bw() {
         if (!this.parents[0].grad) return;
@@ -375,18 +445,30 @@ export class Mean extends Tensor {
 
 export class MseLoss extends Tensor {
     value: RawTensor;
-    grad: RawTensor;
+    grad!: RawTensor;
 
-    // intermediate values
+    // intermediate values (also used during the forward pass)
     interim: RawTensor;
 
+    // the loss is the mean over all elements. with a leading batch axis, this is the mean of the
+    // per-sample losses, so the gradients don't grow with the batch size. the target may
+    // omit the batch axis, it is then compared to every sample.
     constructor(parents: Tensor[]) {
         super(parents);
 
-        // todo: add shape compat check
+        const shape = parents[0].value.shape.broadcast(parents[1].value.shape);
+
         this.value = RawTensor.scalar(0);
-        this.grad = RawTensor.like(parents[0].value).ones(); // todo: this should be reset to 1 at some point (maybe reintroduce init()?)
-        this.interim = RawTensor.like(parents[0].value);
+        if (this.requires_grad) this.grad = RawTensor.like(parents[0].value).ones(); // todo: this should be reset to 1 at some point (maybe reintroduce init()?)
+        this.interim = RawTensor.create(shape);
+    }
+
+    get flops() { return 3 * this.interim.nelem; }
+
+    // the interim is used by forward passes as well
+    dispose() {
+        this.interim.free();
+        super.dispose();
     }
 
     fw() {
@@ -396,7 +478,7 @@ export class MseLoss extends Tensor {
         // todo: for perf optimizations, this could be moved to the core as a single operation
         ops.sub(prediction, target, this.interim);
         ops.pow(this.interim, 2, this.interim);
-        this.value.fill(ops.mean(this.interim));
+        ops.mean_tns(this.interim, this.value);
     }
 
     bw() {
@@ -406,15 +488,18 @@ export class MseLoss extends Tensor {
         if (!prediction.grad && !target.grad) return;
         ops.sub(prediction.value, target.value, this.interim);
 
-        // gradient of MSE loss w.r.t. prediction: 2 * (prediction - target) / N       
-        if (prediction.grad) ops.mul_acc(this.interim, 2 / prediction.value.nelem, prediction.grad);
-        if (target.grad) ops.mul_acc(this.interim, -2 / prediction.value.nelem, target.grad);
+        // gradient of MSE loss w.r.t. prediction: 2 * (prediction - target) / N
+        // (summed over the batch axis if prediction or target don't have one)
+        ops.mul(this.interim, 2 / this.interim.nelem, this.interim);
+        if (prediction.grad) ops.identity_acc(this.interim, prediction.grad);
+        if (target.grad) ops.negate_acc(this.interim, target.grad);
     }
 }
 
 export class Dropout extends FwBwOp {
     p: number;
     seed: number = 0;
+    volatile = true;   // new mask in every forward pass
 
     constructor(parents: Tensor[], p: number) {
         super(parents);
@@ -431,23 +516,40 @@ export class Dropout extends FwBwOp {
         ops.dropout(this.parents[0].value, this.value, this.p, this.seed);
     }
 
+    // reuse the mask of the last forward pass
+    recompute() {
+        ops.dropout(this.parents[0].value, this.value, this.p, this.seed);
+    }
+
     bw() {
         // todo: figure out which mask to use for backprop after a mini batch
         ops.dropout_acc(this.grad, this.parents[0].grad, this.p, this.seed);
     }
+
+    // compiled programs keep the seed in the core, every forward pass advances it
+    compile_fw() {
+        recorder!.dropout(this.parents[0].value, this.value, this.p, this, true);
+    }
+
+    compile_recompute() {
+        recorder!.dropout(this.parents[0].value, this.value, this.p, this, false);
+    }
+
+    compile_bw() {
+        recorder!.dropout(this.grad, this.parents[0].grad!, this.p, this, false, true);
+    }
 }
 
-export class Relu extends FwBwInterimOp {
+export class Relu extends FwBwOp {
     fw = () => ops.relu(this.parents[0].value, this.value);
     bw() {
         // d/dx relu(x) = binstep(x)
         if (!this.parents[0].grad) return;
-        ops.df_relu(this.parents[0].value, this.interim);
-        ops.mul_acc(this.interim, this.grad, this.parents[0].grad);
+        ops.bw_relu_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class LeakyRelu extends FwBwInterimOp {
+export class LeakyRelu extends FwBwOp {
     neg_slope: number;
 
     constructor(parents: Tensor[], neg_slope: number) {
@@ -459,21 +561,16 @@ export class LeakyRelu extends FwBwInterimOp {
     bw() {
         // d/dx leaky_relu(x) = x < 0 ? neg_slope : 1
         if (!this.parents[0].grad) return;
-        ops.df_leaky_relu(this.parents[0].value, this.interim, this.neg_slope);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_leaky_relu_acc(this.parents[0].value, this.grad, this.parents[0].grad, this.neg_slope);
     }
 }
 
-export class Logistic extends FwBwInterimOp {
-    one = RawTensor.scalar(1);
-
+export class Logistic extends FwBwOp {
     fw = () => ops.logistic(this.parents[0].value, this.value);
     bw() {
         // df/dx = f(x) * (1 - f(x))
         if (!this.parents[0].grad) return;
-        ops.sub(this.one, this.value, this.interim);  // interim = 1 - value
-        ops.mul(this.value, this.interim, this.interim); // this.grad = value * (1 - value)
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_logistic_acc(this.value, this.grad, this.parents[0].grad);
     }
 }
 
@@ -486,93 +583,84 @@ export class Negate extends FwBwOp {
     }
 }
 
-export class Sin extends FwBwInterimOp {
+export class Sin extends FwBwOp {
     fw = () => ops.sin(this.parents[0].value, this.value);
     bw() {
         // d/dx sin(x) = cos(x)
         if (!this.parents[0].grad) return;
-        ops.df_sin(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_sin_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Cos extends FwBwInterimOp {
+export class Cos extends FwBwOp {
     fw = () => ops.cos(this.parents[0].value, this.value);
     bw() {
         // d/dx cos(x) = -sin(x)
         if (!this.parents[0].grad) return;
-        ops.df_cos(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_cos_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Tan extends FwBwInterimOp {
+export class Tan extends FwBwOp {
     fw = () => ops.tan(this.parents[0].value, this.value);
     bw() {
         // d/dx tan(x) = sec^2(x) = 1 / cos^2(x)
         if (!this.parents[0].grad) return;
-        ops.df_tan(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_tan_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Asin extends FwBwInterimOp {
+export class Asin extends FwBwOp {
     fw = () => ops.asin(this.parents[0].value, this.value);
     bw() {
         // d/dx asin(x) = 1 / sqrt(1 - x^2)
         if (!this.parents[0].grad) return;
-        ops.df_asin(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_asin_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Acos extends FwBwInterimOp {
+export class Acos extends FwBwOp {
     fw = () => ops.acos(this.parents[0].value, this.value);
     bw() {
         // d/dx asin(x) = -1 / sqrt(1 - x^2)
         if (!this.parents[0].grad) return;
-        ops.df_acos(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_acos_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Atan extends FwBwInterimOp {
+export class Atan extends FwBwOp {
     fw = () => ops.atan(this.parents[0].value, this.value);
     bw() {
         // d/dx atan(x) = asec^2(x) = 1 / (x^2 + 1)
         if (!this.parents[0].grad) return;
-        ops.df_atan(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_atan_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Sinh extends FwBwInterimOp {
+export class Sinh extends FwBwOp {
     fw = () => ops.sinh(this.parents[0].value, this.value);
     bw() {
         // d/dx sinh(x) = cosh(x)
         if (!this.parents[0].grad) return;
-        ops.df_sinh(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_sinh_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Cosh extends FwBwInterimOp {
+export class Cosh extends FwBwOp {
     fw = () => ops.cosh(this.parents[0].value, this.value);
     bw() {
         // d/dx cosh(x) = sinh(x)
         if (!this.parents[0].grad) return;
-        ops.df_cosh(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_cosh_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Tanh extends FwBwInterimOp {
+export class Tanh extends FwBwOp {
     fw = () => ops.tanh(this.parents[0].value, this.value);
     bw() {
         // d/dx tanh(x) = 1 - tanh^2(x)
         if (!this.parents[0].grad) return;
-        ops.df_tanh(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_tanh_acc(this.value, this.grad, this.parents[0].grad);
     }
 }
 
@@ -581,80 +669,70 @@ export class Exp extends FwBwOp {
     bw() {
         // d/dx e^x = e^x
         if (!this.parents[0].grad) return;
-        ops.add(this.value, this.parents[0].grad, this.parents[0].grad);
+        ops.bw_exp_acc(this.value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Log extends FwBwInterimOp {
+export class Log extends FwBwOp {
     fw = () => ops.log(this.parents[0].value, this.value);
     bw() {
         // d/dx ln(x) = 1/x
         if (!this.parents[0].grad) return;
-        ops.df_log(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].value);
+        ops.bw_log_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Log10 extends FwBwInterimOp {
-    ln10 = Math.log(10);
+export class Log10 extends FwBwOp {
     fw = () => ops.log10(this.parents[0].value, this.value);
     bw() {
         // d/dx log10(x) = 1 / (x * ln(10))
         if (!this.parents[0].grad) return;
-        ops.df_log10(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_log10_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Log2 extends FwBwInterimOp {
-    ln2 = Math.log(2);
-
+export class Log2 extends FwBwOp {
     fw = () => ops.log2(this.parents[0].value, this.value);
     bw() {
         // d/dx log2(x) = 1 / (x * ln(2))
         if (!this.parents[0].grad) return;
-        ops.df_log2(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_log2_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Invsqrt extends FwBwInterimOp {
+export class Invsqrt extends FwBwOp {
     fw = () => ops.invsqrt(this.parents[0].value, this.value);
     bw() {
         // d/dx 1 / sqrt(x) = - 1 / (2x^(3/2))
         if (!this.parents[0].grad) return;
-        ops.df_invsqrt(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_invsqrt_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Sqrt extends FwBwInterimOp {
+export class Sqrt extends FwBwOp {
     fw = () => ops.sqrt(this.parents[0].value, this.value);
     bw() {
         // d/dx sqrt(x) = 1 / (2 * sqrt(x))
         if (!this.parents[0].grad) return;
-        ops.df_sqrt(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_sqrt_acc(this.value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Abs extends FwBwInterimOp {
+export class Abs extends FwBwOp {
     fw = () => ops.abs(this.parents[0].value, this.value);
     bw() {
         // d/dx |x| = sign(x)
         if (!this.parents[0].grad) return;
-        ops.df_abs(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_abs_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
-export class Reciprocal extends FwBwInterimOp {
+export class Reciprocal extends FwBwOp {
     fw = () => ops.reciprocal(this.parents[0].value, this.value);
     bw() {
         // d/dx 1 / x = -1 / (x^2)
         if (!this.parents[0].grad) return;
-        ops.df_reciprocal(this.parents[0].value, this.interim);
-        ops.mul_acc(this.grad, this.interim, this.parents[0].grad);
+        ops.bw_reciprocal_acc(this.parents[0].value, this.grad, this.parents[0].grad);
     }
 }
 
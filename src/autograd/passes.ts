@@ -0,0 +1,179 @@
+import Tensor from "../tensor.ts";
+import type Graph from "./graph.ts";
+import { Add, Constant, Mul, Parameter } from "./node_operations.ts";
+import * as ops from "../raw_tensor/raw_tensor_operations.ts";
+import { find_grad_reachable } from "./checkpointing.ts";
+
+/**
+ * Graph optimization passes (see Graph.optimize()). They run once, before the graph is executed:
+ *
+ * - constant folding: operations that only depend on constants are computed once and replaced
+ *   by a constant that holds the result
+ * - common subexpression elimination: nodes that perform the same operation with the same options
+ *   on the same parents (e.g. built twice through the chaining api) are merged into one
+ * - dead node elimination: nodes that no longer contribute to the output are unlinked and freed.
+ *   grads that can never receive a gradient from the output (e.g. above a floor()) are released,
+ *   their nodes are skipped during backward passes.
+ *
+ * Nodes that are removed from the graph are freed, they must not be used afterwards.
+ */
+
+export interface PassOptions {
+    fold_constants?: boolean;
+    eliminate_common_subexpressions?: boolean;
+    eliminate_dead_nodes?: boolean;
+}
+
+export interface OptimizationReport {
+    folded: number;     // operations that are no longer computed because they only depend on constants
+    merged: number;     // duplicate nodes
+    removed: number;    // nodes that were removed from the graph (including folded and merged ones)
+    released: number;   // grads that were released because they can't receive a gradient
+}
+
+// operations that produce a different result every time, or read state from outside the graph
+const is_volatile = (node: Tensor) => node.volatile || node instanceof Parameter;
+
+// lets the children (in the graph) of a node use another node instead
+function replace_node(node: Tensor, replacement: Tensor, nodes: Set<Tensor>) {
+    for (const child of new Set(node.children)) {
+        if (!nodes.has(child)) continue;
+
+        child.parents.forEach((parent, i) => {
+            if (parent !== node) return;
+            child.parents[i] = replacement;
+            replacement.children.push(child);
+        });
+    }
+
+    remove_children(node, child => nodes.has(child));
+}
+
+function remove_children(node: Tensor, predicate: (child: Tensor) => boolean) {
+    const remaining = node.children.filter(child => !predicate(child));
+    node.children.length = 0;
+    node.children.push(...remaining);
+}
+
+function fold_constants(graph: Graph, nodes: Set<Tensor>): number {
+    const foldable = new Set<Tensor>();
+
+    for (const node of graph.topological_ordering) {
+        if (node.parents.length === 0 || is_volatile(node) || node === graph.output) continue;
+        if (node.parents.every(parent => parent instanceof Constant || foldable.has(parent))) foldable.add(node);
+    }
+
+    for (const node of foldable) node.fw();
+
+    // only the outermost folded nodes are replaced, the rest becomes dead
+    for (const node of foldable) {
+        if (node.children.every(child => !nodes.has(child) || foldable.has(child))) continue;
+
+        const constant = new Constant(ops.clone(node.value));
+        constant.name = node.name;
+        replace_node(node, constant, nodes);
+    }
+
+    return foldable.size;
+}
+
+// nodes with the same key compute the same value
+function cse_key(node: Tensor): string | undefined {
+    if (node instanceof Constant) {
+        return node.value.nelem === 1 && node.value.dtype === "fp32" ? `Constant(${node.value.item})` : undefined;
+    }
+
+    if (node.parents.length === 0 || is_volatile(node)) return undefined;
+
+    const parents = node.parents.map(parent => parent.id);
+    if (node instanceof Add || node instanceof Mul) parents.sort((a, b) => a - b);
+
+    return `${node.constructor.name}(${parents})${JSON.stringify(node.options)}${node.requires_grad}`;
+}
+
+function eliminate_common_subexpressions(graph: Graph, nodes: Set<Tensor>): number {
+    const canonical = new Map<string, Tensor>();
+    let merged = 0;
+
+    // parents are merged before their children, so the children of merged nodes get the same keys
+    for (const node of graph.topological_ordering) {
+        const key = cse_key(node);
+        if (key === undefined) continue;
+
+        const existing = canonical.get(key);
+        if (!existing) {
+            canonical.set(key, node);
+            continue;
+        }
+
+        if (node === graph.output) continue;
+        replace_node(node, existing, nodes);
+        merged++;
+    }
+
+    return merged;
+}
+
+function eliminate_dead_nodes(graph: Graph, previous: Tensor[]): { removed: number, released: number } {
+    const live = new Set(graph.all_nodes);
+    const dead = previous.filter(node => !live.has(node));
+    const dead_set = new Set(dead);
+
+    for (const node of dead) {
+        for (const parent of node.parents) remove_children(parent, child => dead_set.has(child));
+    }
+
+    // nodes that are still used by other graphs are kept
+    for (const node of dead) {
+        if (node.parents.length > 0 && node.children.length === 0) node.dispose();
+    }
+
+    // children first, their grads may be views of the grads of their parents
+    const reachable = find_grad_reachable(graph.topological_ordering, graph.output);
+    let released = 0;
+
+    for (let i = graph.topological_ordering.length; i-- > 0;) {
+        const node = graph.topological_ordering[i];
+        if (!node.requires_grad || reachable.has(node) || node instanceof Parameter) continue;
+
+        node.release_grad();
+        released++;
+    }
+
+    return { removed: dead.length, released };
+}
+
+export function optimize_graph(graph: Graph, options: PassOptions = {}): OptimizationReport {
+    if (graph.memory_plan || graph.checkpoints.size > 0)
+        throw new Error("Graphs need to be optimized before checkpoints are set or a memory plan is applied.");
+
+    const {
+        fold_constants: fold = true,
+        eliminate_common_subexpressions: cse = true,
+        eliminate_dead_nodes: dce = true,
+    } = options;
+
+    const previous = graph.all_nodes;
+    const report: OptimizationReport = { folded: 0, merged: 0, removed: 0, released: 0 };
+
+    if (fold) {
+        report.folded = fold_constants(graph, new Set(graph.all_nodes));
+        graph.rebuild();
+    }
+
+    if (cse) {
+        report.merged = eliminate_common_subexpressions(graph, new Set(graph.all_nodes));
+        graph.rebuild();
+    }
+
+    // nodes that hold views of replaced parents need to recreate them
+    for (const node of graph.topological_ordering) node.bind_views();
+
+    if (dce) {
+        const { removed, released } = eliminate_dead_nodes(graph, previous);
+        report.removed = removed;
+        report.released = released;
+    }
+
+    return report;
+}
@@ -0,0 +1,162 @@
+import type Tensor from "../tensor.ts";
+import type { RawTensor } from "../raw_tensor/raw_tensor.ts";
+import { dtype_size } from "../raw_tensor/dtype.ts";
+import { get_kernel_time, get_ntensors, get_total_allocated, set_profiling } from "../raw_tensor/management.ts";
+
+/**
+ * Per-node profiling of forward and backward passes (see Graph.profile()).
+ *
+ * Every pass of a node is measured twice: the wall time in js, and the time the core spent in its
+ * kernels (measured with emscripten_get_now in parallel_for). The difference is the overhead of
+ * the js side, i.e. shape checks, broadcasting checks, allocations and the calls into the core.
+ * Bytes and flops are estimates: every input is read once and every output is written once.
+ */
+
+export type ProfiledPass = "fw" | "bw" | "recompute";
+
+export interface ProfileEvent {
+    node: Tensor;
+    pass: ProfiledPass;
+    start: number;              // ms since the profiler was started
+    wall_time: number;          // ms
+    kernel_time: number;        // ms
+    flops: number;
+    bytes_read: number;
+    bytes_written: number;
+    allocated_bytes: number;    // net change of the allocated memory
+    allocated_tensors: number;  // net change of the number of tensors
+}
+
+const nbytes = (tensor?: RawTensor) => tensor ? tensor.nelem * dtype_size(tensor.dtype) : 0;
+const sum = (values: number[]) => values.reduce((acc, value) => acc + value, 0);
+
+// estimated memory traffic of a pass
+function traffic(node: Tensor, pass: ProfiledPass): { read: number, written: number } {
+    const values = sum(node.parents.map(parent => nbytes(parent.value)));
+    if (pass !== "bw") return { read: values, written: nbytes(node.value) };
+
+    // gradients are accumulated, the grads of the parents are read and written
+    const grads = sum(node.parents.map(parent => nbytes(parent.grad)));
+    return { read: values + nbytes(node.grad) + grads, written: grads };
+}
+
+export const node_label = (node: Tensor) => `${node.constructor.name}${node.name ? ` "${node.name}"` : ""} #${node.id}`;
+
+export class Profiler {
+    readonly events: ProfileEvent[] = [];
+
+    // time spent in the profiled section as a whole, including work outside of nodes (e.g. optimizer steps)
+    total_wall_time = 0;
+    total_kernel_time = 0;
+
+    private readonly origin = performance.now();
+
+    measure(node: Tensor, pass: ProfiledPass, fn: () => void) {
+        const { read, written } = traffic(node, pass);
+        const bytes = get_total_allocated(), tensors = get_ntensors();
+        const kernel_start = get_kernel_time();
+        const start = performance.now();
+
+        fn();
+
+        const end = performance.now();
+        this.events.push({
+            node, pass,
+            start: start - this.origin,
+            wall_time: end - start,
+            kernel_time: get_kernel_time() - kernel_start,
+            flops: pass === "bw" ? 2 * node.flops : node.flops,
+            bytes_read: read,
+            bytes_written: written,
+            allocated_bytes: get_total_allocated() - bytes,
+            allocated_tensors: get_ntensors() - tensors,
+        });
+    }
+
+    // measures the whole section, the passes of the nodes are measured through measure()
+    run(fn: () => void) {
+        const kernel_start = get_kernel_time();
+        const start = performance.now();
+        set_profiling(true);
+
+        try {
+            fn();
+        } finally {
+            set_profiling(false);
+            this.total_wall_time += performance.now() - start;
+            this.total_kernel_time += get_kernel_time() - kernel_start;
+        }
+    }
+
+    /**
+     * Table with one row per node and pass, sorted by wall time.
+     * @param limit Maximum number of rows
+     */
+    summary(limit = 20): string {
+        const rows = new Map<string, { label: string, pass: ProfiledPass, calls: number, wall: number, kernel: number, flops: number, bytes: number, allocated: number }>();
+
+        for (const event of this.events) {
+            const key = `${event.node.id}:${event.pass}`;
+            const row = rows.get(key) ?? { label: node_label(event.node), pass: event.pass, calls: 0, wall: 0, kernel: 0, flops: 0, bytes: 0, allocated: 0 };
+
+            row.calls++;
+            row.wall += event.wall_time;
+            row.kernel += event.kernel_time;
+            row.flops += event.flops;
+            row.bytes += event.bytes_read + event.bytes_written;
+            row.allocated += event.allocated_bytes;
+            rows.set(key, row);
+        }
+
+        const sorted = [...rows.values()].sort((a, b) => b.wall - a.wall).slice(0, limit);
+        const ms = (time: number) => time.toFixed(3).padStart(10);
+        const rate = (amount: number, time: number) => (time > 0 ? amount / time / 1e6 : 0).toFixed(2).padStart(10);
+        const width = Math.max(4, ...sorted.map(row => row.label.length));
+
+        const node_wall = sum(this.events.map(event => event.wall_time));
+        const node_kernel = sum(this.events.map(event => event.kernel_time));
+
+        return (
+            `PROFILE (${this.events.length} passes)\n` +
+            `  Total wall time:   ${this.total_wall_time.toFixed(3)} ms (${node_wall.toFixed(3)} ms in nodes)\n` +
+            `  Kernel time:       ${this.total_kernel_time.toFixed(3)} ms (${node_kernel.toFixed(3)} ms in nodes)\n` +
+            `  JS overhead:       ${(node_wall - node_kernel).toFixed(3)} ms in nodes\n\n` +
+            `  ${"node".padEnd(width)}  pass       calls    wall ms  kernel ms      js ms     GFLOP/s       GB/s  alloc bytes\n` +
+            sorted.map(row =>
+                `  ${row.label.padEnd(width)}  ${row.pass.padEnd(9)}${String(row.calls).padStart(7)}` +
+                `${ms(row.wall)} ${ms(row.kernel)} ${ms(row.wall - row.kernel)} ` +
+                `${rate(row.flops, row.wall)} ${rate(row.bytes, row.wall)} ${String(row.allocated).padStart(12)}`
+            ).join("\n"));
+    }
+
+    print = (limit?: number) => console.log(this.summary(limit));
+
+    // trace event format, can be opened in chrome://tracing or https://ui.perfetto.dev
+    chrome_trace(): string {
+        const us = (time: number) => Math.round(time * 1000);
+
+        const events = this.events.map(event => ({
+            name: node_label(event.node),
+            cat: event.pass,
+            ph: "X",
+            ts: us(event.start),
+            dur: Math.max(1, us(event.wall_time)),
+            pid: 0,
+            tid: 0,
+            args: {
+                kernel_ms: event.kernel_time,
+                js_ms: event.wall_time - event.kernel_time,
+                flops: event.flops,
+                bytes_read: event.bytes_read,
+                bytes_written: event.bytes_written,
+                allocated_bytes: event.allocated_bytes,
+                allocated_tensors: event.allocated_tensors,
+                shape: [...event.node.value.shape],
+            },
+        }));
+
+        return JSON.stringify({ traceEvents: events, displayTimeUnit: "ms" });
+    }
+
+    save_chrome_trace = async (path: string) => { await Bun.write(path, this.chrome_trace()); };
+}
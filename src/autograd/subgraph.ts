@@ -0,0 +1,157 @@
+import type Tensor from "../tensor.ts";
+import type { RawTensor } from "../raw_tensor/raw_tensor.ts";
+import type { Profiler } from "./profiler.ts";
+
+/**
+ * Execution plan for a set of requested nodes, e.g. several heads of one model.
+ * The nodes that the outputs depend on are found and ordered once, every run() evaluates
+ * them in a single forward pass. A trunk that is shared by the outputs is computed once per call
+ * (and not at all if its inputs didn't change, see Graph.forward()), nodes that no output
+ * depends on are never executed.
+ *
+ * Optionally, run() also computes the gradients of the sum of the outputs w.r.t. some nodes (wrt).
+ * The backward pass only visits the nodes on the paths from wrt to the outputs and only writes their grads.
+ * Parents off these paths (e.g. x for w * x with wrt [w]) are detached from their grads while it runs,
+ * so their grads, and the grads of all other nodes, are left untouched.
+ * Checkpoints and memory plans of the full graph are not considered, use Graph.backward() for
+ * graphs that have them.
+ */
+
+// executes the forward passes of the nodes in order, skipping the ones whose inputs didn't change
+export function forward_pass(ordering: Tensor[], force = false, profiler?: Profiler) {
+    for (const node of ordering) {
+        if (!force && !node.stale) continue;
+
+        if (profiler) profiler.measure(node, "fw", () => node.fw());
+        else node.fw();
+        if (node.parents.length > 0 || node.volatile) node.mark_computed();
+    }
+}
+
+// all nodes that the outputs depend on, parents before children
+function find_ordering(outputs: Tensor[]): Tensor[] {
+    const ordering: Tensor[] = [];
+    const visited = new Set<Tensor>();
+
+    // iterative post-order dfs, deep graphs would overflow the stack otherwise
+    for (const output of outputs) {
+        const stack: [Tensor, number][] = [[output, 0]];
+
+        while (stack.length > 0) {
+            const top = stack[stack.length - 1];
+            const [node, i] = top;
+
+            if (i === 0 && visited.has(node)) {
+                stack.pop();
+                continue;
+            }
+
+            visited.add(node);
+
+            if (i < node.parents.length) {
+                top[1]++;
+                if (!visited.has(node.parents[i])) stack.push([node.parents[i], 0]);
+                continue;
+            }
+
+            ordering.push(node);
+            stack.pop();
+        }
+    }
+
+    return ordering;
+}
+
+export class Subgraph {
+    readonly outputs: Tensor[];
+    readonly wrt: Tensor[];
+
+    // nodes that the outputs depend on, in execution order
+    readonly ordering: Tensor[];
+
+    // nodes whose backward passes contribute to the grads of wrt, in execution order
+    readonly backward_ordering: Tensor[];
+
+    // grads of the nodes on the paths, and the ones that are seeded
+    private readonly written_grads: RawTensor[];
+    private readonly seeded_grads: RawTensor[];
+
+    // parents of visited nodes that are off the paths, their grads are hidden from the backward passes
+    private readonly detached: Tensor[];
+
+    constructor(outputs: Tensor[], wrt: Tensor[] = []) {
+        if (outputs.length === 0) throw new Error("A subgraph needs at least one output.");
+
+        for (const node of wrt) {
+            if (!node.requires_grad || !node.grad) throw new Error(`Cannot compute the gradient of ${node.name ?? "a node"} that doesn't require a gradient.`);
+        }
+
+        this.outputs = [...outputs];
+        this.wrt = [...wrt];
+        this.ordering = find_ordering(this.outputs);
+
+        const missing = this.wrt.find(node => !this.ordering.includes(node));
+        if (missing) throw new Error(`The outputs don't depend on ${missing.name ?? "one of the requested nodes"}.`);
+
+        // nodes on a path from wrt to an output
+        const on_path = new Set<Tensor>(this.wrt);
+        for (const node of this.ordering) {
+            if (node.parents.some(parent => on_path.has(parent))) on_path.add(node);
+        }
+
+        this.backward_ordering = this.ordering
+            .filter(node => node.requires_grad && node.parents.some(parent => on_path.has(parent)))
+            .reverse();
+
+        const written = new Set<RawTensor>(), detached = new Set<Tensor>();
+        for (const node of this.backward_ordering) {
+            if (node.grad) written.add(node.grad);
+            for (const parent of node.parents) {
+                if (!parent.grad) continue;
+                if (on_path.has(parent)) written.add(parent.grad);
+                else detached.add(parent);
+            }
+        }
+
+        this.written_grads = [...written];
+        this.detached = [...detached];
+        this.seeded_grads = this.outputs.filter(output => on_path.has(output) && output.grad).map(output => output.grad!);
+    }
+
+    forward(force = false) {
+        forward_pass(this.ordering, force);
+    }
+
+    // seeds the grads of the outputs with ones and accumulates them into the grads of wrt
+    backward() {
+        if (this.wrt.length === 0) throw new Error("The subgraph was created without nodes to differentiate w.r.t.");
+
+        for (const grad of this.written_grads) grad.zeros();
+        for (const grad of this.seeded_grads) grad.ones();
+
+        // backward passes skip parents without grads
+        const grads = this.detached.map(node => node.grad);
+        for (const node of this.detached) node.grad = undefined;
+
+        try {
+            for (const node of this.backward_ordering) node.bw();
+        } finally {
+            this.detached.forEach((node, i) => node.grad = grads[i]);
+        }
+    }
+
+    /**
+     * Evaluates the outputs, and their gradients if the subgraph was created with wrt.
+     * @returns The values of the outputs, the gradients are in the grads of wrt
+     */
+    run(): RawTensor[] {
+        this.forward();
+        if (this.wrt.length > 0) this.backward();
+
+        return this.outputs.map(output => output.value);
+    }
+
+    get grads(): RawTensor[] {
+        return this.wrt.map(node => node.grad!);
+    }
+}
@@ -0,0 +1 @@
+var Module=typeof Module!="undefined"?Module:{};var ENVIRONMENT_IS_WEB=typeof window=="object";var ENVIRONMENT_IS_WORKER=typeof importScripts=="function";var ENVIRONMENT_IS_NODE=typeof process=="object"&&typeof process.versions=="object"&&typeof process.versions.node=="string";if(ENVIRONMENT_IS_NODE){}var moduleOverrides=Object.assign({},Module);var arguments_=[];var thisProgram="./this.program";var quit_=(status,toThrow)=>{throw toThrow};var scriptDirectory="";var read_,readAsync,readBinary;if(ENVIRONMENT_IS_NODE){var fs=require("fs");var nodePath=require("path");scriptDirectory=__dirname+"/";read_=(filename,binary)=>{filename=isFileURI(filename)?new URL(filename):nodePath.normalize(filename);return fs.readFileSync(filename,binary?undefined:"utf8")};readBinary=filename=>{var ret=read_(filename,true);if(!ret.buffer){ret=new Uint8Array(ret)}return ret};readAsync=(filename,onload,onerror,binary=true)=>{filename=isFileURI(filename)?new URL(filename):nodePath.normalize(filename);fs.readFile(filename,binary?undefined:"utf8",(err,data)=>{if(err)onerror(err);else onload(binary?data.buffer:data)})};if(!Module["thisProgram"]&&process.argv.length>1){thisProgram=process.argv[1].replace(/\\/g,"/")}arguments_=process.argv.slice(2);if(typeof module!="undefined"){module["exports"]=Module}process.on("uncaughtException",ex=>{if(ex!=="unwind"&&!(ex instanceof ExitStatus)&&!(ex.context instanceof ExitStatus)){throw ex}});quit_=(status,toThrow)=>{process.exitCode=status;throw toThrow}}else if(ENVIRONMENT_IS_WEB||ENVIRONMENT_IS_WORKER){if(ENVIRONMENT_IS_WORKER){scriptDirectory=self.location.href}else if(typeof document!="undefined"&&document.currentScript){scriptDirectory=document.currentScript.src}if(scriptDirectory.startsWith("blob:")){scriptDirectory=""}else{scriptDirectory=scriptDirectory.substr(0,scriptDirectory.replace(/[?#].*/,"").lastIndexOf("/")+1)}{read_=url=>{var xhr=new XMLHttpRequest;xhr.open("GET",url,false);xhr.send(null);return xhr.responseText};if(ENVIRONMENT_IS_WORKER){readBinary=url=>{var xhr=new XMLHttpRequest;xhr.open("GET",url,false);xhr.responseType="arraybuffer";xhr.send(null);return new Uint8Array(xhr.response)}}readAsync=(url,onload,onerror)=>{if(isFileURI(url)){var xhr=new XMLHttpRequest;xhr.open("GET",url,true);xhr.responseType="arraybuffer";xhr.onload=()=>{if(xhr.status==200||xhr.status==0&&xhr.response){onload(xhr.response);return}onerror()};xhr.onerror=onerror;xhr.send(null);return}fetch(url,{credentials:"same-origin"}).then(response=>{if(response.ok){return response.arrayBuffer()}return Promise.reject(new Error(response.status+" : "+response.url))}).then(onload,onerror)}}}else{}var out=Module["print"]||console.log.bind(console);var err=Module["printErr"]||console.error.bind(console);Object.assign(Module,moduleOverrides);moduleOverrides=null;if(Module["arguments"])arguments_=Module["arguments"];if(Module["thisProgram"])thisProgram=Module["thisProgram"];if(Module["quit"])quit_=Module["quit"];var wasmBinary;if(Module["wasmBinary"])wasmBinary=Module["wasmBinary"];function intArrayFromBase64(s){if(typeof ENVIRONMENT_IS_NODE!="undefined"&&ENVIRONMENT_IS_NODE){var buf=Buffer.from(s,"base64");return new Uint8Array(buf.buffer,buf.byteOffset,buf.length)}var decoded=atob(s);var bytes=new Uint8Array(decoded.length);for(var i=0;i<decoded.length;++i){bytes[i]=decoded.charCodeAt(i)}return bytes}function tryParseAsDataURI(filename){if(!isDataURI(filename)){return}return intArrayFromBase64(filename.slice(dataURIPrefix.length))}var wasmMemory;var ABORT=false;var EXITSTATUS;var HEAP8,HEAPU8,HEAP16,HEAPU16,HEAP32,HEAPU32,HEAPF32,HEAPF64;function updateMemoryViews(){var b=wasmMemory.buffer;Module["HEAP8"]=HEAP8=new Int8Array(b);Module["HEAP16"]=HEAP16=new Int16Array(b);Module["HEAPU8"]=HEAPU8=new Uint8Array(b);Module["HEAPU16"]=HEAPU16=new Uint16Array(b);Module["HEAP32"]=HEAP32=new Int32Array(b);Module["HEAPU32"]=HEAPU32=new Uint32Array(b);Module["HEAPF32"]=HEAPF32=new Float32Array(b);Module["HEAPF64"]=HEAPF64=new Float64Array(b)}var __ATPRERUN__=[];var __ATINIT__=[];var __ATPOSTRUN__=[];var runtimeInitialized=false;function preRun(){if(Module["preRun"]){if(typeof Module["preRun"]=="function")Module["preRun"]=[Module["preRun"]];while(Module["preRun"].length){addOnPreRun(Module["preRun"].shift())}}callRuntimeCallbacks(__ATPRERUN__)}function initRuntime(){runtimeInitialized=true;callRuntimeCallbacks(__ATINIT__)}function postRun(){if(Module["postRun"]){if(typeof Module["postRun"]=="function")Module["postRun"]=[Module["postRun"]];while(Module["postRun"].length){addOnPostRun(Module["postRun"].shift())}}callRuntimeCallbacks(__ATPOSTRUN__)}function addOnPreRun(cb){__ATPRERUN__.unshift(cb)}function addOnInit(cb){__ATINIT__.unshift(cb)}function addOnPostRun(cb){__ATPOSTRUN__.unshift(cb)}var runDependencies=0;var runDependencyWatcher=null;var dependenciesFulfilled=null;function addRunDependency(id){runDependencies++;Module["monitorRunDependencies"]?.(runDependencies)}function removeRunDependency(id){runDependencies--;Module["monitorRunDependencies"]?.(runDependencies);if(runDependencies==0){if(runDependencyWatcher!==null){clearInterval(runDependencyWatcher);runDependencyWatcher=null}if(dependenciesFulfilled){var callback=dependenciesFulfilled;dependenciesFulfilled=null;callback()}}}function abort(what){Module["onAbort"]?.(what);what="Aborted("+what+")";err(what);ABORT=true;EXITSTATUS=1;what+=". Build with -sASSERTIONS for more info.";var e=new WebAssembly.RuntimeError(what);throw e}var dataURIPrefix="data:application/octet-stream;base64,";var isDataURI=filename=>filename.startsWith(dataURIPrefix);var isFileURI=filename=>filename.startsWith("file://");function findWasmBinary(){var f="data:application/octet-stream;base64,AGFzbQEAAAABlwEaYAN+fn0AYAN+fn4AYAJ+fgBgAn59AGAEfn59fwBgAX4BfmAEfn5+fQBgAX4AYAR+fn5+AGABfAF8YAABfGACfHwBfGACfX0BfWABfgF/YAAAYAJ+fgF9YAABfmABfwBgBH59fX8AYAR+fn5/AGADfn5+AX5gAX4BfWACfn4BfmAGfn19fX19AGADfn19AGAFfn5+fn4AAtcBEQNlbnYDbG9nAAkDZW52EmVtc2NyaXB0ZW5fZ2V0X25vdwAKA2VudgNzaW4ACQNlbnYDY29zAAkDZW52A3RhbgAJA2VudgRhc2luAAkDZW52BGFjb3MACQNlbnYEYXRhbgAJA2VudgRzaW5oAAkDZW52BGNvc2gACQNlbnYEdGFuaAAJA2VudgNleHAACQNlbnYEbG9nMgAJA2VudgVsb2cxMAAJA2VudgNwb3cACwNlbnYEcG93ZgAMA2VudhZlbXNjcmlwdGVuX3Jlc2l6ZV9oZWFwAA0D7AXqBQ4PAgACBRARChISAwEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQABAAEAAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBBgEGAQYBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBARMBFAcBAQEBCAEIAQgBCAEIAQgBARUVFRUVFQUFAgIEBAEBFgcIAhcYFQcOBxYUFgIQDRAFBQcHAhYWBxUCEAUNBQUHFhYHBRAZBAcBcAHfAt8CBQcBBYACgIAQBggBfgFCgIAECwfgMIcDBm1lbW9yeQIAEV9fd2FzbV9jYWxsX2N0b3JzABEKc2hpZnRfdmlldwATDmNvbnZlcnRfdGVuc29yABUPc2V0X251bV90aHJlYWRzABYPZ2V0X251bV90aHJlYWRzABcNc2V0X3Byb2ZpbGluZwAYD2dldF9rZXJuZWxfdGltZQAZDGluaXRfdW5pZm9ybQAaC2luaXRfbm9ybWFsABsJaW5pdF9maWxsABwHc2luX3BydwAeC3Npbl9wcndfYWNjACAHY29zX3BydwAiC2Nvc19wcndfYWNjACQHdGFuX3BydwAmC3Rhbl9wcndfYWNjACgIYXNpbl9wcncAKgxhc2luX3Byd19hY2MALAhhY29zX3BydwAuDGFjb3NfcHJ3X2FjYwAwCGF0YW5fcHJ3ADIMYXRhbl9wcndfYWNjADQIc2luaF9wcncANgxzaW5oX3Byd19hY2MAOAhjb3NoX3BydwA6DGNvc2hfcHJ3X2FjYwA8CHRhbmhfcHJ3AD4MdGFuaF9wcndfYWNjAEAHZXhwX3BydwBCC2V4cF9wcndfYWNjAEQHbG9nX3BydwBGC2xvZ19wcndfYWNjAEgIbG9nMl9wcncASgxsb2cyX3Byd19hY2MATAlsb2cxMF9wcncATg1sb2cxMF9wcndfYWNjAFALaW52c3FydF9wcncAUg9pbnZzcXJ0X3Byd19hY2MAVAhzcXJ0X3BydwBWDHNxcnRfcHJ3X2FjYwBYCGNlaWxfcHJ3AFoMY2VpbF9wcndfYWNjAFwJZmxvb3JfcHJ3AF4NZmxvb3JfcHJ3X2FjYwBgB2Fic19wcncAYgthYnNfcHJ3X2FjYwBkCHNpZ25fcHJ3AGYMc2lnbl9wcndfYWNjAGgKbmVnYXRlX3BydwBqDm5lZ2F0ZV9wcndfYWNjAGwMaWRlbnRpdHlfcHJ3AG4QaWRlbnRpdHlfcHJ3X2FjYwBwDnJlY2lwcm9jYWxfcHJ3AHIScmVjaXByb2NhbF9wcndfYWNjAHQIcmVsdV9wcncAdgxyZWx1X3Byd19hY2MAeA5sZWFreV9yZWx1X3BydwB6EmxlYWt5X3JlbHVfcHJ3X2FjYwB8C2JpbnN0ZXBfcHJ3AH4PYmluc3RlcF9wcndfYWNjAIABDGxvZ2lzdGljX3BydwCCARBsb2dpc3RpY19wcndfYWNjAIQBCmRmX3Npbl9wcncAhgEOZGZfc2luX3Byd19hY2MAiAEKZGZfY29zX3BydwCKAQ5kZl9jb3NfcHJ3X2FjYwCMAQpkZl90YW5fcHJ3AI4BDmRmX3Rhbl9wcndfYWNjAJABC2RmX2FzaW5fcHJ3AJIBD2RmX2FzaW5fcHJ3X2FjYwCUAQtkZl9hY29zX3BydwCWAQ9kZl9hY29zX3Byd19hY2MAmAELZGZfYXRhbl9wcncAmgEPZGZfYXRhbl9wcndfYWNjAJwBC2RmX3NpbmhfcHJ3AJ4BD2RmX3NpbmhfcHJ3X2FjYwCgAQtkZl9jb3NoX3BydwCiAQ9kZl9jb3NoX3Byd19hY2MApAELZGZfdGFuaF9wcncApgEPZGZfdGFuaF9wcndfYWNjAKgBCmRmX2xvZ19wcncAqgEOZGZfbG9nX3Byd19hY2MArAELZGZfbG9nMl9wcncArgEPZGZfbG9nMl9wcndfYWNjALABDGRmX2xvZzEwX3BydwCyARBkZl9sb2cxMF9wcndfYWNjALQBDmRmX2ludnNxcnRfcHJ3ALYBEmRmX2ludnNxcnRfcHJ3X2FjYwC4AQtkZl9zcXJ0X3BydwC6AQ9kZl9zcXJ0X3Byd19hY2MAvAEKZGZfYWJzX3BydwC+AQ5kZl9hYnNfcHJ3X2FjYwDAAQ1kZl9uZWdhdGVfcHJ3AMIBEWRmX25lZ2F0ZV9wcndfYWNjAMQBEWRmX3JlY2lwcm9jYWxfcHJ3AMYBFWRmX3JlY2lwcm9jYWxfcHJ3X2FjYwDIAQtkZl9yZWx1X3BydwDKAQ9kZl9yZWx1X3Byd19hY2MAzAERZGZfbGVha3lfcmVsdV9wcncAzgEVZGZfbGVha3lfcmVsdV9wcndfYWNjANABB3Npbl9icmMA0gELc2luX2JyY19hY2MA1AEHY29zX2JyYwDWAQtjb3NfYnJjX2FjYwDYAQd0YW5fYnJjANoBC3Rhbl9icmNfYWNjANwBCGFzaW5fYnJjAN4BDGFzaW5fYnJjX2FjYwDgAQhhY29zX2JyYwDiAQxhY29zX2JyY19hY2MA5AEIYXRhbl9icmMA5gEMYXRhbl9icmNfYWNjAOgBCHNpbmhfYnJjAOoBDHNpbmhfYnJjX2FjYwDsAQhjb3NoX2JyYwDuAQxjb3NoX2JyY19hY2MA8AEIdGFuaF9icmMA8gEMdGFuaF9icmNfYWNjAPQBB2V4cF9icmMA9gELZXhwX2JyY19hY2MA+AEHbG9nX2JyYwD6AQtsb2dfYnJjX2FjYwD8AQhsb2cyX2JyYwD+AQxsb2cyX2JyY19hY2MAgAIJbG9nMTBfYnJjAIICDWxvZzEwX2JyY19hY2MAhAILaW52c3FydF9icmMAhgIPaW52c3FydF9icmNfYWNjAIgCCHNxcnRfYnJjAIoCDHNxcnRfYnJjX2FjYwCMAghjZWlsX2JyYwCOAgxjZWlsX2JyY19hY2MAkAIJZmxvb3JfYnJjAJICDWZsb29yX2JyY19hY2MAlAIHYWJzX2JyYwCWAgthYnNfYnJjX2FjYwCYAghzaWduX2JyYwCaAgxzaWduX2JyY19hY2MAnAIKbmVnYXRlX2JyYwCeAg5uZWdhdGVfYnJjX2FjYwCgAgxpZGVudGl0eV9icmMAogIQaWRlbnRpdHlfYnJjX2FjYwCkAg5yZWNpcHJvY2FsX2JyYwCmAhJyZWNpcHJvY2FsX2JyY19hY2MAqAIIcmVsdV9icmMAqgIMcmVsdV9icmNfYWNjAKwCDmxlYWt5X3JlbHVfYnJjAK4CEmxlYWt5X3JlbHVfYnJjX2FjYwCwAgtiaW5zdGVwX2JyYwCyAg9iaW5zdGVwX2JyY19hY2MAtAIMbG9naXN0aWNfYnJjALYCEGxvZ2lzdGljX2JyY19hY2MAuAIKZGZfc2luX2JyYwC6Ag5kZl9zaW5fYnJjX2FjYwC8AgpkZl9jb3NfYnJjAL4CDmRmX2Nvc19icmNfYWNjAMACCmRmX3Rhbl9icmMAwgIOZGZfdGFuX2JyY19hY2MAxAILZGZfYXNpbl9icmMAxgIPZGZfYXNpbl9icmNfYWNjAMgCC2RmX2Fjb3NfYnJjAMoCD2RmX2Fjb3NfYnJjX2FjYwDMAgtkZl9hdGFuX2JyYwDOAg9kZl9hdGFuX2JyY19hY2MA0AILZGZfc2luaF9icmMA0gIPZGZfc2luaF9icmNfYWNjANQCC2RmX2Nvc2hfYnJjANYCD2RmX2Nvc2hfYnJjX2FjYwDYAgtkZl90YW5oX2JyYwDaAg9kZl90YW5oX2JyY19hY2MA3AIKZGZfbG9nX2JyYwDeAg5kZl9sb2dfYnJjX2FjYwDgAgtkZl9sb2cyX2JyYwDiAg9kZl9sb2cyX2JyY19hY2MA5AIMZGZfbG9nMTBfYnJjAOYCEGRmX2xvZzEwX2JyY19hY2MA6AIOZGZfaW52c3FydF9icmMA6gISZGZfaW52c3FydF9icmNfYWNjAOwCC2RmX3NxcnRfYnJjAO4CD2RmX3NxcnRfYnJjX2FjYwDwAgpkZl9hYnNfYnJjAPICDmRmX2Fic19icmNfYWNjAPQCDWRmX25lZ2F0ZV9icmMA9QIRZGZfbmVnYXRlX2JyY19hY2MA9wIRZGZfcmVjaXByb2NhbF9icmMA+QIVZGZfcmVjaXByb2NhbF9icmNfYWNjAPsCC2RmX3JlbHVfYnJjAP0CD2RmX3JlbHVfYnJjX2FjYwD/AhFkZl9sZWFreV9yZWx1X2JyYwCBAxVkZl9sZWFreV9yZWx1X2JyY19hY2MAgwMIc2luX2RicmMAhQMMc2luX2RicmNfYWNjAIcDCGNvc19kYnJjAIkDDGNvc19kYnJjX2FjYwCLAwh0YW5fZGJyYwCNAwx0YW5fZGJyY19hY2MAjwMJYXNpbl9kYnJjAJEDDWFzaW5fZGJyY19hY2MAkwMJYWNvc19kYnJjAJUDDWFjb3NfZGJyY19hY2MAlwMJYXRhbl9kYnJjAJkDDWF0YW5fZGJyY19hY2MAmwMJc2luaF9kYnJjAJ0DDXNpbmhfZGJyY19hY2MAnwMJY29zaF9kYnJjAKEDDWNvc2hfZGJyY19hY2MAowMJdGFuaF9kYnJjAKUDDXRhbmhfZGJyY19hY2MApwMIZXhwX2RicmMAqQMMZXhwX2RicmNfYWNjAKsDCGxvZ19kYnJjAK0DDGxvZ19kYnJjX2FjYwCvAwlsb2cyX2RicmMAsQMNbG9nMl9kYnJjX2FjYwCzAwpsb2cxMF9kYnJjALUDDmxvZzEwX2RicmNfYWNjALcDDGludnNxcnRfZGJyYwC5AxBpbnZzcXJ0X2RicmNfYWNjALsDCXNxcnRfZGJyYwC9Aw1zcXJ0X2RicmNfYWNjAL8DCWNlaWxfZGJyYwDBAw1jZWlsX2RicmNfYWNjAMMDCmZsb29yX2RicmMAxQMOZmxvb3JfZGJyY19hY2MAxwMIYWJzX2RicmMAyQMMYWJzX2RicmNfYWNjAMsDCXNpZ25fZGJyYwDNAw1zaWduX2RicmNfYWNjAM8DC25lZ2F0ZV9kYnJjANEDD25lZ2F0ZV9kYnJjX2FjYwDTAw1pZGVudGl0eV9kYnJjANUDEWlkZW50aXR5X2RicmNfYWNjANcDD3JlY2lwcm9jYWxfZGJyYwDZAxNyZWNpcHJvY2FsX2RicmNfYWNjANsDCXJlbHVfZGJyYwDdAw1yZWx1X2RicmNfYWNjAN8DD2xlYWt5X3JlbHVfZGJyYwDhAxNsZWFreV9yZWx1X2RicmNfYWNjAOMDDGJpbnN0ZXBfZGJyYwDlAxBiaW5zdGVwX2RicmNfYWNjAOcDDWxvZ2lzdGljX2RicmMA6QMRbG9naXN0aWNfZGJyY19hY2MA6wMLZGZfc2luX2RicmMA7QMPZGZfc2luX2RicmNfYWNjAO8DC2RmX2Nvc19kYnJjAPEDD2RmX2Nvc19kYnJjX2FjYwDzAwtkZl90YW5fZGJyYwD1Aw9kZl90YW5fZGJyY19hY2MA9wMMZGZfYXNpbl9kYnJjAPkDEGRmX2FzaW5fZGJyY19hY2MA+wMMZGZfYWNvc19kYnJjAP0DEGRmX2Fjb3NfZGJyY19hY2MA/wMMZGZfYXRhbl9kYnJjAIEEEGRmX2F0YW5fZGJyY19hY2MAgwQMZGZfc2luaF9kYnJjAIUEEGRmX3NpbmhfZGJyY19hY2MAhwQMZGZfY29zaF9kYnJjAIkEEGRmX2Nvc2hfZGJyY19hY2MAiwQMZGZfdGFuaF9kYnJjAI0EEGRmX3RhbmhfZGJyY19hY2MAjwQLZGZfbG9nX2RicmMAkQQPZGZfbG9nX2RicmNfYWNjAJMEDGRmX2xvZzJfZGJyYwCVBBBkZl9sb2cyX2RicmNfYWNjAJcEDWRmX2xvZzEwX2RicmMAmQQRZGZfbG9nMTBfZGJyY19hY2MAmwQPZGZfaW52c3FydF9kYnJjAJ0EE2RmX2ludnNxcnRfZGJyY19hY2MAnwQMZGZfc3FydF9kYnJjAKEEEGRmX3NxcnRfZGJyY19hY2MAowQLZGZfYWJzX2RicmMApQQPZGZfYWJzX2RicmNfYWNjAKcEDmRmX25lZ2F0ZV9kYnJjAKkEEmRmX25lZ2F0ZV9kYnJjX2FjYwCrBBJkZl9yZWNpcHJvY2FsX2RicmMArQQWZGZfcmVjaXByb2NhbF9kYnJjX2FjYwCvBAxkZl9yZWx1X2RicmMAsQQQZGZfcmVsdV9kYnJjX2FjYwCzBBJkZl9sZWFreV9yZWx1X2RicmMAtQQWZGZfbGVha3lfcmVsdV9kYnJjX2FjYwC3BAZid19zaW4AuQQKYndfc2luX2FjYwC7BAZid19jb3MAvQQKYndfY29zX2FjYwC/BAZid190YW4AwQQKYndfdGFuX2FjYwDDBAdid19hc2luAMUEC2J3X2FzaW5fYWNjAMcEB2J3X2Fjb3MAyQQLYndfYWNvc19hY2MAywQHYndfYXRhbgDNBAtid19hdGFuX2FjYwDPBAdid19zaW5oANEEC2J3X3NpbmhfYWNjANMEB2J3X2Nvc2gA1QQLYndfY29zaF9hY2MA1wQHYndfdGFuaADZBAtid190YW5oX2FjYwDbBAZid19leHAA3QQKYndfZXhwX2FjYwDfBAtid19sb2dpc3RpYwDhBA9id19sb2dpc3RpY19hY2MA4wQGYndfbG9nAOUECmJ3X2xvZ19hY2MA5wQHYndfbG9nMgDpBAtid19sb2cyX2FjYwDrBAhid19sb2cxMADtBAxid19sb2cxMF9hY2MA7wQKYndfaW52c3FydADxBA5id19pbnZzcXJ0X2FjYwDzBAdid19zcXJ0APUEC2J3X3NxcnRfYWNjAPcEBmJ3X2FicwD5BApid19hYnNfYWNjAPsEDWJ3X3JlY2lwcm9jYWwA/QQRYndfcmVjaXByb2NhbF9hY2MA/wQHYndfcmVsdQCBBQtid19yZWx1X2FjYwCDBQ1id19sZWFreV9yZWx1AIUFEWJ3X2xlYWt5X3JlbHVfYWNjAIcFB2FkZF9icmMAiQULYWRkX2JyY19hY2MAiwUHc3ViX2JyYwCNBQtzdWJfYnJjX2FjYwCPBQdtdWxfYnJjAJEFC211bF9icmNfYWNjAJMFB2Rpdl9icmMAlQULZGl2X2JyY19hY2MAlwUHcG93X2JyYwCZBQtwb3dfYnJjX2FjYwCbBQhhZGRfZGJyYwCdBQxhZGRfZGJyY19hY2MAnwUIc3ViX2RicmMAoQUMc3ViX2RicmNfYWNjAKMFCG11bF9kYnJjAKUFDG11bF9kYnJjX2FjYwCnBQhkaXZfZGJyYwCpBQxkaXZfZGJyY19hY2MAqwUIcG93X2RicmMArQUMcG93X2RicmNfYWNjAK8FBm1hdG11bACyBQtjcmVhdGVfdmlldwCzBQtmcmVlX3RlbnNvcgC0BQptYXRtdWxfYWNjALUFA2RvdAC2BQdkb3RfYWNjALcFCGJ3X2Rpdl9iALkFDGJ3X2Rpdl9iX2FjYwC7BQhid19wb3dfYQC9BQxid19wb3dfYV9hY2MAvwUIYndfcG93X2IAwQUMYndfcG93X2JfYWNjAMMFC21heF9yZWRfc2NsAMgFC21pbl9yZWRfc2NsAMkFC3N1bV9yZWRfc2NsAMoFDG1lYW5fcmVkX3NjbADLBQttYXhfcmVkX2lkeADMBQttaW5fcmVkX2lkeADNBQtzdW1fcmVkX3RucwDOBQxtZWFuX3JlZF90bnMAzwUHZHJvcG91dADQBQtkcm9wb3V0X2FjYwDRBRBjcmVhdGVfb3B0aW1pemVyANQFDmZyZWVfb3B0aW1pemVyANUFE3NldF9vcHRpbWl6ZXJfcGFyYW0A1gUTc2V0X29wdGltaXplcl9zdGF0ZQDXBRVzZXRfb3B0aW1pemVyX2hwYXJhbXMA2AUbc2V0X29wdGltaXplcl9ncmFkX2NsaXBwaW5nANkFF2dldF9vcHRpbWl6ZXJfZ3JhZF9ub3JtANoFDm9wdGltaXplcl9zdGVwANsFCXBvb2xfdHJpbQDcBQ5zZXRfcG9vbF9saW1pdADdBQ1jcmVhdGVfdGVuc29yAN4FE2NyZWF0ZV90ZW5zb3JfZHR5cGUA3wUTY3JlYXRlX3Jlc2hhcGVfdmlldwDgBQxjbG9uZV90ZW5zb3IA4QUMZ2V0X21nbXRfcHRyAOIFDnJlc2VydmVfbWVtb3J5AOMFCGdldF9ub3BzAOQFC2dldF9vcF9uYW1lAOUFDmNyZWF0ZV9wcm9ncmFtAOYFDGZyZWVfcHJvZ3JhbQDnBQtydW5fcHJvZ3JhbQDpBQxwbGFuX3Byb2dyYW0A6wUNZnJlZV9zY2hlZHVsZQDsBQ9nZXRfcGFyYWxsZWxpc20A7QUMcnVuX3NjaGVkdWxlAO4FGV9lbXNjcmlwdGVuX3N0YWNrX3Jlc3RvcmUA9wUXX2Vtc2NyaXB0ZW5fc3RhY2tfYWxsb2MA+AUcZW1zY3JpcHRlbl9zdGFja19nZXRfY3VycmVudAD5BQmQBQEAQQEL3gKyBbUFtgW3Bc4FzwXNBcwF4QUVHNsFiQWLBY0FjwWRBZMFlQWXBZkFmwW5BbsFvQW/BcEFwwWdBZ8FoQWjBaUFpwWpBasFrQWvBdAF0QXSAdQB1gHYAdoB3AHeAeAB4gHkAeYB6AHqAewB7gHwAfIB9AH2AfgB+gH8Af4BgAKCAoQChgKIAooCjAKOApACkgKUApYCmAKaApwCngKgAqICpAKmAqgCqgKsAq4CsAKyArQCtgK4AroCvAK+AsACwgLEAsYCyALKAswCzgLQAtIC1ALWAtgC2gLcAt4C4ALiAuQC5gLoAuoC7ALuAvAC8gL0AvUC9wL5AvsC/QL/AoEDgwO5BLsEvQS/BMEEwwTFBMcEyQTLBM0EzwTRBNME1QTXBNkE2wTdBN8E4QTjBOUE5wTpBOsE7QTvBPEE8wT1BPcE+QT7BP0E/wSBBYMFhQWHBYUDhwOJA4sDjQOPA5EDkwOVA5cDmQObA50DnwOhA6MDpQOnA6kDqwOtA68DsQOzA7UDtwO5A7sDvQO/A8EDwwPFA8cDyQPLA80DzwPRA9MD1QPXA9kD2wPdA98D4QPjA+UD5wPpA+sD7QPvA/ED8wP1A/cD+QP7A/0D/wOBBIMEhQSHBIkEiwSNBI8EkQSTBJUElwSZBJsEnQSfBKEEowSlBKcEqQSrBK0ErwSxBLMEtQS3BB4gIiQmKCosLjAyNDY4Ojw+QEJERkhKTE5QUlRWWFpcXmBiZGZoamxucHJ0dnh6fH6AAYIBhAGGAYgBigGMAY4BkAGSAZQBlgGYAZoBnAGeAaABogGkAaYBqAGqAawBrgGwAbIBtAG2AbgBugG8Ab4BwAHCAcQBxgHIAcoBzAHOAdABCvLGIeoFAgAL0AICBn4EfyAAKQMwIQICQCAAKQMYIgNQDQAgACkDCCADQgOGQnh8IgR8IQUgACkDECAEfCEEA0AgBCkDACABIAEgBSkDACIGgCIHIAZ+fX4gAnwhAiAFQnh8IQUgBEJ4fCEEIAchASADQn98IgNQRQ0ACwsCQCAAKQNQQn98IgFCAVYNAAJAAkAgAacOAgABAAsgACkDACACQgGGfC4BACIIQf8HcSEJIAhBgICAgHhxIQoCQCAIQf//A3EiC0EKdkEfcSIIRQ0AAkAgCEEfRw0AIAogC0ENdHJBgICA/Adyvg8LIAhBF3RBgICAwANqIApyIAlBDXRyvg8LAkAgCUUNAEGAgICYBCAJZyIIQRd0ayAKciALIAhBamp0QQ50QYCA/wNxciEKCyAKvg8LIAApAwAgAkIBhnwvAQBBEHS+DwsgACkDACACQgKGfCoCAAt9AQZ+IAApA0giAikDMCEDAkAgAikDGCIEUA0AIAIpAwggBEIDhkJ4fCIFfCEGIAIpAxAgBXwhAgNAIAIpAwAgASABIAYpAwAiBYAiByAFfn1+IAN8IQMgBkJ4fCEGIAJCeHwhAiAHIQEgBEJ/fCIEUEUNAAsLIAAgAzcDMAv+AgIBfgV/AkAgACkDUEJ/fCIDQgFWDQACQAJAIAOnDgIAAQALIAK8IgRB////A3EhBSAEQRB2QYCAAnEhBgJAAkAgBEEXdkH/AXEiB0H/AUcNACAGIAVBAEdBCXRyQYD4AXIhBgwBCwJAIAdBjwFJDQAgBkGA+AFyIQYMAQsCQAJAIAdB8ABLDQAgB0HmAEkNAiAFQYCAgARyIgRB/gAgB2siCHYhBSAEQX8gCHRBf3NxIQRBAUH9ACAHa3QhBwwBCyAHQQp0IAVBDXZyQYCAeWohBSAEQf8/cSEEQYAgIQcLAkACQCAEIAdLDQAgBCAHRw0BIAVBAXFFDQELIAVBAWohBQsgBiAFciEGCyAAKQMAIAFCAYZ8IAY7AQAPCyACvCIGQRB2IQQCQAJAIAZB/////wdxQYGAgPwHSQ0AIARBwAByIQYMAQsgBiAEQQFxakH//wFqQRB2IQYLIAApAwAgAUIBhnwgBjsBAA8LIAApAwAgAUIChnwgAjgCAAvKBAMJfgR/AX0CQCAALQBADQAgAS0AQA0AIAApA1AiAiABKQNQUg0AIAEpAwAgACkDACAAKQMgQgRCAiACUBt+/AoAAA8LAkAgACkDIFANAEIAIQMDQCABKQMwIQQCQCABKQMYIgVQDQAgASkDCCAFQgOGIgZ8Qnh8IQIgASkDECAGfEJ4fCEGIAMhBwNAIAYpAwAgByAHIAIpAwAiCIAiCSAIfn1+IAR8IQQgAkJ4fCECIAZCeHwhBiAJIQcgBUJ/fCIFQgBSDQALCyAAKQMwIQUCQCAAKQMYIghQDQAgACkDCCAIQgOGIgZ8Qnh8IQIgACkDECAGfEJ4fCEGIAMhBwNAIAYpAwAgByAHIAIpAwAiCYAiCiAJfn1+IAV8IQUgAkJ4fCECIAZCeHwhBiAKIQcgCEJ/fCIIQgBSDQALCwJAAkAgACkDUEJ/fCICQgFWDQACQAJAIAKnDgIAAQALIAApAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAAKQMAIAVCAYZ8LwEAQRB0viEPDAELIAApAwAgBUIChnwqAgAhDwsgASAEIA8QlICAgAAgA0IBfCIDIAApAyBUDQALCwsEAEIBCwQAQgELFQBCACAAQQBHOgDAxISAgICAgIAACxAAQgArA9DEhICAgICAgAALlgQDCX4BfQF+I4CAgIAAQhB9IgQkgICAgAAgBCADNgIMIAIgAZMhAgJAAkAgACkDUFANACAAKQMgUA0BQgAhBQNAIAApAzAhBgJAIAApAxgiB1ANACAAKQMIIAdCA4YiCHxCeHwhCSAAKQMQIAh8Qnh8IQggBSEKA0AgCCkDACAKIAogCSkDACILgCIMIAt+fX4gBnwhBiAJQnh8IQkgCEJ4fCEIIAwhCiAHQn98IgdCAFINAAsLIAAgBiACIARCDHwQ8YWAgACyQwAAADCUlCABkhCUgICAACAFQgF8IgUgACkDIFQNAAwCCwsgACkDICEJAkAgAC0AQEUNACAJUA0BQgAhBQNAIAIgBEIMfBDxhYCAALJDAAAAMJSUIAGSIQ0gACkDMCEGIAApAwAhDgJAIAApAxgiB1ANACAAKQMIIAdCA4YiCHxCeHwhCSAAKQMQIAh8Qnh8IQggBSEKA0AgCCkDACAKIAogCSkDACILgCIMIAt+fX4gBnwhBiAJQnh8IQkgCEJ4fCEIIAwhCiAHQn98IgdCAFINAAsLIA4gBkIChnwgDTgCACAFQgF8IgUgACkDIFQNAAwCCwsgCVANAEIAIQlCACEIA0AgBEIMfBDxhYCAACEDIAApAwAgCXwgAiADskMAAAAwlJQgAZI4AgAgCUIEfCEJIAhCAXwiCCAAKQMgVA0ACwsgBEIQfCSAgICAAAvMCQUBfgJ8CH4DfAF+I4CAgIAAQhB9IgQkgICAgAAgBCADNgIMAkACQCAAKQNQUA0AIAApAyBQDQEgArshBSABuyEGQgAhBwNAIAApAzAhCAJAIAApAxgiCVANACAAKQMIIAlCA4YiCnxCeHwhCyAAKQMQIAp8Qnh8IQogByEMA0AgCikDACAMIAwgCykDACINgCIOIA1+fX4gCHwhCCALQnh8IQsgCkJ4fCEKIA4hDCAJQn98IglCAFINAAsLAkACQEIALQCwxISAgICAgIAARQ0AQgBBADoAsMSEgICAgICAAEIAKwO4xISAgICAgIAAIAWiIQ8MAQtCAEEBOgCwxISAgICAgIAAA0AgBEIMfBDxhYCAALdEAADA////30GjIg8gD6BEAAAAAAAA8L+gIg8gD6IgBEIMfBDxhYCAALdEAADA////30GjIhAgEKBEAAAAAAAA8L+gIhAgEKKgIhFEAAAAAAAA8D9mDQAgEUQAAAAAAAAAAGENAAtCACAQIBEQgICAgABEAAAAAAAAAMCiIBGjnyIRojkDuMSEgICAgICAACAPIAWiIBGiIQ8LIAAgCCAPIAagthCUgICAACAHQgF8IgcgACkDIFQNAAwCCwsgACkDICEKAkAgAC0AQEUNACAKUA0BIAK7IQYgAbshBUIAIQcDQAJAAkBCAC0AsMSEgICAgICAAEUNAEIAQQA6ALDEhICAgICAgABCACsDuMSEgICAgICAACAGoiEPDAELQgBBAToAsMSEgICAgICAAANAIARCDHwQ8YWAgAC3RAAAwP///99BoyIPIA+gRAAAAAAAAPC/oCIPIA+iIARCDHwQ8YWAgAC3RAAAwP///99BoyIQIBCgRAAAAAAAAPC/oCIQIBCioCIRRAAAAAAAAPA/Zg0AIBFEAAAAAAAAAABhDQALQgAgECAREICAgIAARAAAAAAAAADAoiARo58iEaI5A7jEhICAgICAgAAgDyAGoiARoiEPCyAPIAWgtiEBIAApAzAhCCAAKQMAIRICQCAAKQMYIglQDQAgACkDCCAJQgOGIgp8Qnh8IQsgACkDECAKfEJ4fCEKIAchDANAIAopAwAgDCAMIAspAwAiDYAiDiANfn1+IAh8IQggC0J4fCELIApCeHwhCiAOIQwgCUJ/fCIJQgBSDQALCyASIAhCAoZ8IAE4AgAgB0IBfCIHIAApAyBUDQAMAgsLIApQDQAgArshBSABuyEGQgAhCwNAAkACQEIALQCwxISAgICAgIAARQ0AQgBBADoAsMSEgICAgICAAEIAKwO4xISAgICAgIAAIAWiIQ8MAQtCAEEBOgCwxISAgICAgIAAA0AgBEIMfBDxhYCAALdEAADA////30GjIg8gD6BEAAAAAAAA8L+gIg8gD6IgBEIMfBDxhYCAALdEAADA////30GjIhAgEKBEAAAAAAAA8L+gIhAgEKKgIhFEAAAAAAAA8D9mDQAgEUQAAAAAAAAAAGENAAtCACAQIBEQgICAgABEAAAAAAAAAMCiIBGjnyIRojkDuMSEgICAgICAACAPIAWiIBGiIQ8gACkDICEKCyAAKQMAIAtCAoZ8IA8gBqC2OAIAIAtCAXwiCyAKVA0ACwsgBEIQfCSAgICAAAvKBAENfgJAAkAgACkDUFANACAAKQMgUA0BQgAhAgNAIAApAzAhAwJAIAApAxgiBFANACAAKQMIIARCA4YiBXxCeHwhBiAAKQMQIAV8Qnh8IQUgAiEHA0AgBSkDACAHIAcgBikDACIIgCIJIAh+fX4gA3whAyAGQnh8IQYgBUJ4fCEFIAkhByAEQn98IgRCAFINAAsLIAAgAyABEJSAgIAAIAJCAXwiAiAAKQMgVA0ADAILCyAAKQMgIQICQAJAIAAtAEBFDQAgAlANAiAAKQMwIQogACkDACELIAApAxgiDEIAUg0BIAsgCkIChnwgATgCAA8LIAJQDQEgAkIHgyEFIAApAwAhBEIAIQcCQCACQn98QgdUDQAgBEIQfCEGIAJCeIMhA0IAIQcDQCAGIAE4AgAgBkIMfCABOAIAIAZCCHwgATgCACAGQgR8IAE4AgAgBkJ8fCABOAIAIAZCeHwgATgCACAGQnR8IAE4AgAgBkJwfCABOAIAIAZCIHwhBiADIAdCCHwiB1INAAsLIAVQDQEgBCAHQgKGfCEGA0AgBiABOAIAIAZCBHwhBiAFQn98IgVCAFINAAwCCwsgACkDCCAMQgOGQnh8IgZ8IQ0gACkDECAGfCEOQgAhAANAIA0hBiAOIQUgDCEEIAohAyAAIQcDQCAFKQMAIAcgByAGKQMAIgiAIgkgCH59fiADfCEDIAZCeHwhBiAFQnh8IQUgCSEHIARCf3wiBEIAUg0ACyALIANCAoZ8IAE4AgAgAEIBfCIAIAJSDQALCwu2CwYIfgR/AX0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAUgD7sQgoCAgAC2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHwgBSAIfCoCALsQgoCAgAC2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAFIAFCAoYiBnwhACAHIAZ8IQcDQCAHIAAqAgC7EIKAgIAAtjgCACAHQgR8IABCBHwqAgC7EIKAgIAAtjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIAJ8IQggEiARQgKGfCEAAkAgAiABfUIDgyIHUA0AA0AgACAEKgIAuxCCgICAALY4AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgBCoCALsQgoCAgAC2OAIAIAAgBCoCALsQgoCAgAC2OAIAIAAgBCoCALsQgoCAgAC2OAIAIAAgBCoCALsQgoCAgAC2OAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEEIDhkJ4fCIAfCEVIAMpAxAgAHwhAwNAIAQqAgC7EIKAgIAAIRYgFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnwgFrY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEXIAQpAxAgAHwhGCAQUCELIBBCf3xCA4YhBANAIBchACAYIQcgFSEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8KgIAuxCCgICAALYhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQnYCAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEJ2AgIAACyADQuAAfCSAgICAAAvFDQYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIA+7EIKAgIAAIBC7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGKgIAIQ8gBiAHIAh8KgIAuxCCgICAACAPu6C2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAHIAFCAoYiAHwhByAFIAB8IQADQCAAKgIAIQ8gACAHKgIAuxCCgICAACAPu6C2OAIAIABCBHwiBSoCACEPIAUgB0IEfCoCALsQgoCAgAAgD7ugtjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCIAKgIAIQ8CQCACIAF9QgGDUA0AIAAgBCoCALsQgoCAgAAgD7ugtiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIAAgBCoCALsQgoCAgAAgD7ugtiIPOAIAIAAgBCoCALsQgoCAgAAgD7ugtiIPOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgC7IRcgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwiACoCACEPIAAgFxCCgICAACAPu6C2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgEVAhCyARQn98QgOGIQQDQCAYIQAgGSEHIBYhBiAUIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFSAFQgKGfCoCALsQgoCAgAAhFyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IgAgFyAAKgIAu6C2OAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEJ+AgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCfgICAAAsgA0LgAHwkgICAgAALtgsGCH4EfwF9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFIA+7EIOAgIAAthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8IAUgCHwqAgC7EIOAgIAAtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgByAAKgIAuxCDgICAALY4AgAgB0IEfCAAQgR8KgIAuxCDgICAALY4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIAAgBCoCALsQg4CAgAC2OAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIAQqAgC7EIOAgIAAtjgCACAAIAQqAgC7EIOAgIAAtjgCACAAIAQqAgC7EIOAgIAAtjgCACAAIAQqAgC7EIOAgIAAtjgCACAHQnx8IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCDgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQg4CAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEKGAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABChgICAAAsgA0LgAHwkgICAgAALxQ0GCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCDgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBioCACEPIAYgByAIfCoCALsQg4CAgAAgD7ugtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgACoCACEPIAAgByoCALsQg4CAgAAgD7ugtjgCACAAQgR8IgUqAgAhDyAFIAdCBHwqAgC7EIOAgIAAIA+7oLY4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAAIAQqAgC7EIOAgIAAIA+7oLYiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAAIAQqAgC7EIOAgIAAIA+7oLYiDzgCACAAIAQqAgC7EIOAgIAAIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAuyEXIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAqAgAhDyAAIBcQg4CAgAAgD7ugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIOAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCjgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQo4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCEgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQhICAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EISAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCEgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQhICAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEKWAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABClgICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCEgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EISAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCEgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQhICAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EISAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCngICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQp4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCFgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQhYCAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EIWAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCFgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQhYCAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEKmAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCpgICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCFgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EIWAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCFgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQhYCAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIWAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCrgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQq4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCGgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQhoCAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EIaAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCGgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQhoCAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEK2AgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCtgICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCGgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EIaAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCGgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQhoCAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIaAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCvgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQr4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCHgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQh4CAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EIeAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCHgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQh4CAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAELGAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCxgICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCHgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EIeAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCHgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQh4CAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIeAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCzgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQs4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCIgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQiICAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EIiAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCIgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQiICAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAELWAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABC1gICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCIgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EIiAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCIgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQiICAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIiAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABC3gICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQt4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCJgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQiYCAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EImAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCJgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQiYCAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAELmAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABC5gICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCJgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EImAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCJgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQiYCAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EImAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABC7gICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQu4CAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCKgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQioCAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EIqAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCKgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQioCAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEL2AgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABC9gICAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCKgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EIqAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCKgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQioCAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIqAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABC/gICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQv4CAgAALIANC4AB8JICAgIAAC7YLBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCLgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfCAFIAh8KgIAuxCLgICAALY4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAcgACoCALsQi4CAgAC2OAIAIAdCBHwgAEIEfCoCALsQi4CAgAC2OAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAFCf4UgAnwhCCASIBFCAoZ8IQACQCACIAF9QgODIgdQDQADQCAAIAQqAgC7EIuAgIAAtjgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAuxCLgICAALY4AgAgACAEKgIAuxCLgICAALY4AgAgACAEKgIAuxCLgICAALY4AgAgACAEKgIAuxCLgICAALY4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCALsQi4CAgAAhFiAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCAWtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRcgBCkDECAAfCEYIBBQIQsgEEJ/fEIDhiEEA0AgFyEAIBghByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwqAgC7EIuAgIAAtiEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDBgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQwYCAgAALIANC4AB8JICAgIAAC8UNBgh+BH8CfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgD7sQi4CAgAAgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEFIAQpAwAhBwJAIAIgAX1CAYNQDQAgBSABQgKGIgh8IgYqAgAhDyAGIAcgCHwqAgC7EIuAgIAAIA+7oLY4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAcgAUIChiIAfCEHIAUgAHwhAANAIAAqAgAhDyAAIAcqAgC7EIuAgIAAIA+7oLY4AgAgAEIEfCIFKgIAIQ8gBSAHQgR8KgIAuxCLgICAACAPu6C2OAIAIAdCCHwhByAAQgh8IQAgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IgAqAgAhDwJAIAIgAX1CAYNQDQAgACAEKgIAuxCLgICAACAPu6C2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgACAEKgIAuxCLgICAACAPu6C2Ig84AgAgACAEKgIAuxCLgICAACAPu6C2Ig84AgAgB0J+fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAKgIAIQ8gACAXEIuAgIAAIA+7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEYIAQpAxAgAHwhGSARUCELIBFCf3xCA4YhBANAIBghACAZIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAVIAVCAoZ8KgIAuxCLgICAACEXIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAXIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQw4CAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEMOAgIAACyADQuAAfCSAgICAAAu2CwYIfgR/AX0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAUgD7sQgICAgAC2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHwgBSAIfCoCALsQgICAgAC2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAFIAFCAoYiBnwhACAHIAZ8IQcDQCAHIAAqAgC7EICAgIAAtjgCACAHQgR8IABCBHwqAgC7EICAgIAAtjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIAJ8IQggEiARQgKGfCEAAkAgAiABfUIDgyIHUA0AA0AgACAEKgIAuxCAgICAALY4AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgBCoCALsQgICAgAC2OAIAIAAgBCoCALsQgICAgAC2OAIAIAAgBCoCALsQgICAgAC2OAIAIAAgBCoCALsQgICAgAC2OAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEEIDhkJ4fCIAfCEVIAMpAxAgAHwhAwNAIAQqAgC7EICAgIAAIRYgFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnwgFrY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEXIAQpAxAgAHwhGCAQUCELIBBCf3xCA4YhBANAIBchACAYIQcgFSEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8KgIAuxCAgICAALYhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQxYCAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEMWAgIAACyADQuAAfCSAgICAAAvFDQYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIA+7EICAgIAAIBC7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGKgIAIQ8gBiAHIAh8KgIAuxCAgICAACAPu6C2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAHIAFCAoYiAHwhByAFIAB8IQADQCAAKgIAIQ8gACAHKgIAuxCAgICAACAPu6C2OAIAIABCBHwiBSoCACEPIAUgB0IEfCoCALsQgICAgAAgD7ugtjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCIAKgIAIQ8CQCACIAF9QgGDUA0AIAAgBCoCALsQgICAgAAgD7ugtiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIAAgBCoCALsQgICAgAAgD7ugtiIPOAIAIAAgBCoCALsQgICAgAAgD7ugtiIPOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgC7IRcgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwiACoCACEPIAAgFxCAgICAACAPu6C2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgEVAhCyARQn98QgOGIQQDQCAYIQAgGSEHIBYhBiAUIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFSAFQgKGfCoCALsQgICAgAAhFyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IgAgFyAAKgIAu6C2OAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEMeAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDHgICAAAsgA0LgAHwkgICAgAALtgsGCH4EfwF9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFIA+7EIyAgIAAthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8IAUgCHwqAgC7EIyAgIAAtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgByAAKgIAuxCMgICAALY4AgAgB0IEfCAAQgR8KgIAuxCMgICAALY4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIAAgBCoCALsQjICAgAC2OAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIAQqAgC7EIyAgIAAtjgCACAAIAQqAgC7EIyAgIAAtjgCACAAIAQqAgC7EIyAgIAAtjgCACAAIAQqAgC7EIyAgIAAtjgCACAHQnx8IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCMgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQjICAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEMmAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDJgICAAAsgA0LgAHwkgICAgAALxQ0GCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCMgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBioCACEPIAYgByAIfCoCALsQjICAgAAgD7ugtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgACoCACEPIAAgByoCALsQjICAgAAgD7ugtjgCACAAQgR8IgUqAgAhDyAFIAdCBHwqAgC7EIyAgIAAIA+7oLY4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAAIAQqAgC7EIyAgIAAIA+7oLYiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAAIAQqAgC7EIyAgIAAIA+7oLYiDzgCACAAIAQqAgC7EIyAgIAAIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAuyEXIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAqAgAhDyAAIBcQjICAgAAgD7ugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIyAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDLgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQy4CAgAALIANC4AB8JICAgIAAC7YLBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCNgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfCAFIAh8KgIAuxCNgICAALY4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAcgACoCALsQjYCAgAC2OAIAIAdCBHwgAEIEfCoCALsQjYCAgAC2OAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAFCf4UgAnwhCCASIBFCAoZ8IQACQCACIAF9QgODIgdQDQADQCAAIAQqAgC7EI2AgIAAtjgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAuxCNgICAALY4AgAgACAEKgIAuxCNgICAALY4AgAgACAEKgIAuxCNgICAALY4AgAgACAEKgIAuxCNgICAALY4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCALsQjYCAgAAhFiAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCAWtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRcgBCkDECAAfCEYIBBQIQsgEEJ/fEIDhiEEA0AgFyEAIBghByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwqAgC7EI2AgIAAtiEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDNgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQzYCAgAALIANC4AB8JICAgIAAC8UNBgh+BH8CfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgD7sQjYCAgAAgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEFIAQpAwAhBwJAIAIgAX1CAYNQDQAgBSABQgKGIgh8IgYqAgAhDyAGIAcgCHwqAgC7EI2AgIAAIA+7oLY4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAcgAUIChiIAfCEHIAUgAHwhAANAIAAqAgAhDyAAIAcqAgC7EI2AgIAAIA+7oLY4AgAgAEIEfCIFKgIAIQ8gBSAHQgR8KgIAuxCNgICAACAPu6C2OAIAIAdCCHwhByAAQgh8IQAgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IgAqAgAhDwJAIAIgAX1CAYNQDQAgACAEKgIAuxCNgICAACAPu6C2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgACAEKgIAuxCNgICAACAPu6C2Ig84AgAgACAEKgIAuxCNgICAACAPu6C2Ig84AgAgB0J+fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAKgIAIQ8gACAXEI2AgIAAIA+7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEYIAQpAxAgAHwhGSARUCELIBFCf3xCA4YhBANAIBghACAZIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAVIAVCAoZ8KgIAuxCNgICAACEXIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAXIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQz4CAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEM+AgIAACyADQuAAfCSAgICAAAuADQYIfgR/AX0GfgF9An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAUgD0MAAAC/lEHfs935BSAPvEEBdWu+Ig+UIA+UQwAAwD+SIA+UEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHwgBSAIfCoCACIPQwAAAL+UQd+z3fkFIA+8QQF1a74iD5QgD5RDAADAP5IgD5Q4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAdDAADAPyAAKgIAIg9DAAAAP5RB37Pd+QUgD7xBAXVrviIPlCAPlJMgD5Q4AgAgB0IEfEMAAMA/IABCBHwqAgAiD0MAAAA/lEHfs935BSAPvEEBdWu+Ig+UIA+UkyAPlDgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIQcgEiARQgKGfCEAAkAgAiABfUIBg1ANACAAIAQqAgAiD0MAAAC/lEHfs935BSAPvEEBdWu+Ig+UIA+UQwAAwD+SIA+UOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABDAADAPyAEKgIAIg9DAAAAP5RB37Pd+QUgD7xBAXVrviIPlCAPlJMgD5Q4AgAgAEMAAMA/IAQqAgAiD0MAAAA/lEHfs935BSAPvEEBdWu+Ig+UIA+UkyAPlDgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAIg9DAAAAv5RB37Pd+QUgD7xBAXVrviIPlCAPlEMAAMA/kiEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBYgD5Q4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEXIAQpAxAgAHwhGCAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCACIPQwAAAL+UQd+z3fkFIA+8QQF1a74iD5QgD5RDAADAP5IgD5QhDyARIQUCQCAQUA0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAENGAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDRgICAAAsgA0LgAHwkgICAgAAL+g0ECH4EfwJ9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIA9DAAAAv5RB37Pd+QUgD7xBAXVrviIPlCAPlEMAAMA/kiAPlCAQkhCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgACAAKgIAIAcqAgAiD0MAAAC/lEHfs935BSAPvEEBdWu+Ig+UIA+UQwAAwD+SIA+UkjgCACAHQgR8IQcgAEIEfCEAIAhCf3wiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCIAKgIAIRACQCACIAF9QgGDUA0AIAAgBCoCACIPQwAAAL+UQd+z3fkFIA+8QQF1a74iD5QgD5RDAADAP5IgD5QgEJIiEDgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAAQwAAwD8gBCoCACIPQwAAAD+UQd+z3fkFIA+8QQF1a74iD5QgD5STIA+UIBCSIhA4AgAgAEMAAMA/IAQqAgAiD0MAAAA/lEHfs935BSAPvEEBdWu+Ig+UIA+UkyAPlCAQkiIQOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgAiD0MAAAC/lEHfs935BSAPvEEBdWu+Ig+UIA+UQwAAwD+SIRAgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwiACAQIA+UIAAqAgCSOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgAiD0MAAAC/lEHfs935BSAPvEEBdWu+Ig+UIA+UQwAAwD+SIA+UIQ8gEiEFAkAgEVANACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAPIAAqAgCSOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAENOAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDTgICAAAsgA0LgAHwkgICAgAALrAsECH4EfwF9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAUgD5EQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSACfCEJIAMpAwAhCCAEKQMAIQUCQCACIAF9QgODIgZQDQAgBSABQgKGIgd8IQAgCCAHfCEHA0AgByAAKgIAkTgCACAAQgR8IQAgB0IEfCEHIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAIAUgBnwiByoCAJE4AgAgAEIEfCAHQgR8KgIAkTgCACAAQgh8IAdCCHwqAgCROAIAIABCDHwgB0IMfCoCAJE4AgAgBUIQfCEFIAhCEHwhCCAJQnx8IglCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIAAgBCoCAJE4AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgBCoCAJE4AgAgACAEKgIAkTgCACAAIAQqAgCROAIAIAAgBCoCAJE4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCACEPIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IA+ROAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFiAEKQMQIAB8IRcgEFAhCyAQQn98QgOGIQQDQCAWIQAgFyEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCAJEhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ1YCAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAENWAgIAACyADQuAAfCSAgICAAAuIDQYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIA+7nyAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBiAHIAh8KgIAu58gBioCALugtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgACAHKgIAu58gACoCALugtjgCACAAQgR8IgUgB0IEfCoCALufIAUqAgC7oLY4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAAIAQqAgC7nyAPu6C2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgACAEKgIAu58gD7ugtiIPOAIAIAAgBCoCALufIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAuyEXIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAgF58gACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7nyEXIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAXIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ14CAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAENeAgIAACyADQuAAfCSAgICAAAusCwQIfgR/AX0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPjRCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIAJ8IQkgAykDACEIIAQpAwAhBQJAIAIgAX1CA4MiBlANACAFIAFCAoYiB3whACAIIAd8IQcDQCAHIAAqAgCNOAIAIABCBHwhACAHQgR8IQcgAUIBfCEBIAZCf3wiBkIAUg0ACwsgCUIDVA0BIAFCAoYhBiACIAF9IQkDQCAIIAZ8IgAgBSAGfCIHKgIAjTgCACAAQgR8IAdCBHwqAgCNOAIAIABCCHwgB0IIfCoCAI04AgAgAEIMfCAHQgx8KgIAjTgCACAFQhB8IQUgCEIQfCEIIAlCfHwiCUIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIAJ8IQggEiARQgKGfCEAAkAgAiABfUIDgyIHUA0AA0AgACAEKgIAjTgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAjTgCACAAIAQqAgCNOAIAIAAgBCoCAI04AgAgACAEKgIAjTgCACAHQnx8IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAIQ8gFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnwgD404AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEWIAQpAxAgAHwhFyAQUCELIBBCf3xCA4YhBANAIBYhACAXIQcgFSEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8KgIAjSEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDZgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ2YCAgAALIANC4AB8JICAgIAAC5oNBAh+BH8CfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPjSAQkhCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEFIAQpAwAhBwJAIAIgAX1CAYNQDQAgBSABQgKGIgh8IgYgByAIfCoCAI0gBioCAJI4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAcgAUIChiIAfCEHIAUgAHwhAANAIAAgByoCAI0gACoCAJI4AgAgAEIEfCIFIAdCBHwqAgCNIAUqAgCSOAIAIAdCCHwhByAAQgh8IQAgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UgAnwhCCATIBJCAoZ8IgAqAgAhDwJAIAIgAX1CA4MiB1ANAANAIAAgBCoCAI0gD5IiDzgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAjSAPkiIPOAIAIAAgBCoCAI0gD5IiDzgCACAAIAQqAgCNIA+SIg84AgAgACAEKgIAjSAPkiIPOAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgAhDyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIA+NIAAqAgCSOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEVAhCyARQn98QgOGIQQDQCAXIQAgGCEHIBYhBiAUIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFSAFQgKGfCoCAI0hDyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IgAgDyAAKgIAkjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDbgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ24CAgAALIANC4AB8JICAgIAAC6wLBAh+BH8BfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFIA+OEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UgAnwhCSADKQMAIQggBCkDACEFAkAgAiABfUIDgyIGUA0AIAUgAUIChiIHfCEAIAggB3whBwNAIAcgACoCAI44AgAgAEIEfCEAIAdCBHwhByABQgF8IQEgBkJ/fCIGQgBSDQALCyAJQgNUDQEgAUIChiEGIAIgAX0hCQNAIAggBnwiACAFIAZ8IgcqAgCOOAIAIABCBHwgB0IEfCoCAI44AgAgAEIIfCAHQgh8KgIAjjgCACAAQgx8IAdCDHwqAgCOOAIAIAVCEHwhBSAIQhB8IQggCUJ8fCIJQgBSDQAMAgsLIAIgAVgNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAFCf4UgAnwhCCASIBFCAoZ8IQACQCACIAF9QgODIgdQDQADQCAAIAQqAgCOOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIAQqAgCOOAIAIAAgBCoCAI44AgAgACAEKgIAjjgCACAAIAQqAgCOOAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEEIDhkJ4fCIAfCEVIAMpAxAgAHwhAwNAIAQqAgAhDyAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCAPjjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRYgBCkDECAAfCEXIBBQIQsgEEJ/fEIDhiEEA0AgFiEAIBchByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwqAgCOIQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEN2AgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDdgICAAAsgA0LgAHwkgICAgAALmg0ECH4EfwJ9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIA+OIBCSEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBiAHIAh8KgIAjiAGKgIAkjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgACAHKgIAjiAAKgIAkjgCACAAQgR8IgUgB0IEfCoCAI4gBSoCAJI4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSACfCEIIBMgEkIChnwiACoCACEPAkAgAiABfUIDgyIHUA0AA0AgACAEKgIAjiAPkiIPOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIAQqAgCOIA+SIg84AgAgACAEKgIAjiAPkiIPOAIAIAAgBCoCAI4gD5IiDzgCACAAIAQqAgCOIA+SIg84AgAgB0J8fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCACEPIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAgD44gACoCAJI4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEXIAQpAxAgAHwhGCARUCELIBFCf3xCA4YhBANAIBchACAYIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAVIAVCAoZ8KgIAjiEPIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAPIAAqAgCSOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEN+AgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDfgICAAAsgA0LgAHwkgICAgAALrAsECH4EfwF9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAUgD4sQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSACfCEJIAMpAwAhCCAEKQMAIQUCQCACIAF9QgODIgZQDQAgBSABQgKGIgd8IQAgCCAHfCEHA0AgByAAKgIAizgCACAAQgR8IQAgB0IEfCEHIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAIAUgBnwiByoCAIs4AgAgAEIEfCAHQgR8KgIAizgCACAAQgh8IAdCCHwqAgCLOAIAIABCDHwgB0IMfCoCAIs4AgAgBUIQfCEFIAhCEHwhCCAJQnx8IglCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIAAgBCoCAIs4AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgBCoCAIs4AgAgACAEKgIAizgCACAAIAQqAgCLOAIAIAAgBCoCAIs4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCACEPIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IA+LOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFiAEKQMQIAB8IRcgEFAhCyAQQn98QgOGIQQDQCAWIQAgFyEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCAIshDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ4YCAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEOGAgIAACyADQuAAfCSAgICAAAuaDQQIfgR/An0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgD4sgEJIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGIAcgCHwqAgCLIAYqAgCSOAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAHIAFCAoYiAHwhByAFIAB8IQADQCAAIAcqAgCLIAAqAgCSOAIAIABCBHwiBSAHQgR8KgIAiyAFKgIAkjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIAJ8IQggEyASQgKGfCIAKgIAIQ8CQCACIAF9QgODIgdQDQADQCAAIAQqAgCLIA+SIg84AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgBCoCAIsgD5IiDzgCACAAIAQqAgCLIA+SIg84AgAgACAEKgIAiyAPkiIPOAIAIAAgBCoCAIsgD5IiDzgCACAHQnx8IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAIQ8gFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwiACAPiyAAKgIAkjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgCLIQ8gEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIA8gACoCAJI4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ44CAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEOOAgIAACyADQuAAfCSAgICAAAvVCwQIfgR/AX0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPQwAAAABeIA9DAAAAAF1rshCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8IAUgCHwqAgAiD0MAAAAAXiAPQwAAAABda7I4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAcgACoCACIPQwAAAABeIA9DAAAAAF1rsjgCACAHQgR8IABCBHwqAgAiD0MAAAAAXiAPQwAAAABda7I4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSEHIBIgEUIChnwhAAJAIAIgAX1CAYNQDQAgACAEKgIAIg9DAAAAAF4gD0MAAAAAXWuyOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIAAgBCoCACIPQwAAAABeIA9DAAAAAF1rsjgCACAAIAQqAgAiD0MAAAAAXiAPQwAAAABda7I4AgAgB0J+fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCACIPQwAAAABeIA9DAAAAAF1rIQsgFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnwgC7I4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEWIAQpAxAgAHwhFyAQUCELIBBCf3xCA4YhBANAIBYhACAXIQcgFSEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8KgIAIg9DAAAAAF4gD0MAAAAAXWuyIQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEOWAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDlgICAAAsgA0LgAHwkgICAgAALgA4ECH4EfwJ9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIBAgD0MAAAAAXiAPQwAAAABda7KSEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBiAGKgIAIAcgCHwqAgAiD0MAAAAAXiAPQwAAAABda7KSOAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAHIAFCAoYiAHwhByAFIAB8IQADQCAAIAAqAgAgByoCACIPQwAAAABeIA9DAAAAAF1rspI4AgAgAEIEfCIFIAUqAgAgB0IEfCoCACIPQwAAAABeIA9DAAAAAF1rspI4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAAIA8gBCoCACIQQwAAAABeIBBDAAAAAF1rspIiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAAIA8gBCoCACIQQwAAAABeIBBDAAAAAF1rspIiDzgCACAAIA8gBCoCACIQQwAAAABeIBBDAAAAAF1rspIiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAIg9DAAAAAF4gD0MAAAAAXWshCyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIAAqAgAgC7KSOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEVAhCyARQn98QgOGIQQDQCAXIQAgGCEHIBYhBiAUIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFSAFQgKGfCoCACIPQwAAAABeIA9DAAAAAF1rsiEPIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAAKgIAIA+SOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEOeAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDngICAAAsgA0LgAHwkgICAgAALrAsECH4EfwF9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAUgD4wQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSACfCEJIAMpAwAhCCAEKQMAIQUCQCACIAF9QgODIgZQDQAgBSABQgKGIgd8IQAgCCAHfCEHA0AgByAAKgIAjDgCACAAQgR8IQAgB0IEfCEHIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAIAUgBnwiByoCAIw4AgAgAEIEfCAHQgR8KgIAjDgCACAAQgh8IAdCCHwqAgCMOAIAIABCDHwgB0IMfCoCAIw4AgAgBUIQfCEFIAhCEHwhCCAJQnx8IglCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIAAgBCoCAIw4AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgBCoCAIw4AgAgACAEKgIAjDgCACAAIAQqAgCMOAIAIAAgBCoCAIw4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCACEPIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IA+MOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFiAEKQMQIAB8IRcgEFAhCyAQQn98QgOGIQQDQCAWIQAgFyEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCAIwhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ6YCAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEOmAgIAACyADQuAAfCSAgICAAAviDQQIfgR/An0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgECAPkxCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIAJ8IQkgAykDACEIIAQpAwAhBQJAIAIgAX1CA4MiBlANACAFIAFCAoYiAHwhByAIIAB8IQADQCAAIAAqAgAgByoCAJM4AgAgB0IEfCEHIABCBHwhACABQgF8IQEgBkJ/fCIGQgBSDQALCyAJQgNUDQEgAUIChiEGIAIgAX0hCQNAIAggBnwiACAAKgIAIAUgBnwiByoCAJM4AgAgAEIEfCIKIAoqAgAgB0IEfCoCAJM4AgAgAEIIfCIKIAoqAgAgB0IIfCoCAJM4AgAgAEIMfCIAIAAqAgAgB0IMfCoCAJM4AgAgBUIQfCEFIAhCEHwhCCAJQnx8IglCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSACfCEIIBMgEkIChnwiACoCACEPAkAgAiABfUIDgyIHUA0AA0AgACAPIAQqAgCTIg84AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIAAgDyAEKgIAkyIPOAIAIAAgDyAEKgIAkyIPOAIAIAAgDyAEKgIAkyIPOAIAIAAgDyAEKgIAkyIPOAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgAhDyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIAAqAgAgD5M4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEXIAQpAxAgAHwhGCARUCELIBFCf3xCA4YhBANAIBchACAYIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAVIAVCAoZ8KgIAIQ8gEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIAAqAgAgD5M4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ64CAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEOuAgIAACyADQuAAfCSAgICAAAvHCwQIfgR/AX0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UgAnwhCSADKQMAIQggBCkDACEFAkAgAiABfUIDgyIGUA0AIAUgAUIChiIHfCEAIAggB3whBwNAIAcgACoCADgCACAAQgR8IQAgB0IEfCEHIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAIAUgBnwiByoCADgCACAAQgR8IAdCBHwqAgA4AgAgAEIIfCAHQgh8KgIAOAIAIABCDHwgB0IMfCoCADgCACAFQhB8IQUgCEIQfCEIIAlCfHwiCUIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIAJ8IQggEiARQgKGfCEAAkAgAiABfUIHgyIHUA0AA0AgACAEKgIAOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCB1QNAiACIAF9IQcDQCAAIAQqAgA4AgAgACAEKgIAOAIAIAAgBCoCADgCACAAIAQqAgA4AgAgACAEKgIAOAIAIAAgBCoCADgCACAAIAQqAgA4AgAgACAEKgIAOAIAIAdCeHwiB1BFDQAMAwsLIAMpAwggEEIDhkJ4fCIAfCEVIAMpAxAgAHwhAwNAIAQqAgAhDyAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFiAEKQMQIAB8IRcgEFAhCyAQQn98QgOGIQQDQCAWIQAgFyEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCACEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDtgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ7YCAgAALIANC4AB8JICAgIAAC+INBAh+BH8CfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPIBCSEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UgAnwhCSADKQMAIQggBCkDACEFAkAgAiABfUIDgyIGUA0AIAUgAUIChiIAfCEHIAggAHwhAANAIAAgByoCACAAKgIAkjgCACAHQgR8IQcgAEIEfCEAIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAIAUgBnwiByoCACAAKgIAkjgCACAAQgR8IgogB0IEfCoCACAKKgIAkjgCACAAQgh8IgogB0IIfCoCACAKKgIAkjgCACAAQgx8IgAgB0IMfCoCACAAKgIAkjgCACAFQhB8IQUgCEIQfCEIIAlCfHwiCUIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIAJ8IQggEyASQgKGfCIAKgIAIQ8CQCACIAF9QgODIgdQDQADQCAAIAQqAgAgD5IiDzgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAIA+SIg84AgAgACAEKgIAIA+SIg84AgAgACAEKgIAIA+SIg84AgAgACAEKgIAIA+SIg84AgAgB0J8fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCACEPIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAgDyAAKgIAkjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgAhDyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IgAgDyAAKgIAkjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDvgICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ74CAgAALIANC4AB8JICAgIAAC5wLBAh+BH8BfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFQwAAgD8gD5UQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfEMAAIA/IAUgCHwqAgCVOAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAFIAFCAoYiBnwhACAHIAZ8IQcDQCAHQwAAgD8gACoCAJU4AgAgB0IEfEMAAIA/IABCBHwqAgCVOAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAFCf4UgAnwhCCASIBFCAoZ8IQACQCACIAF9QgODIgdQDQADQCAAQwAAgD8gBCoCAJU4AgAgAUIBfCEBIAdCf3wiB0IAUg0ACwsgCEIDVA0CIAIgAX0hBwNAIABDAACAPyAEKgIAlTgCACAAQwAAgD8gBCoCAJU4AgAgAEMAAIA/IAQqAgCVOAIAIABDAACAPyAEKgIAlTgCACAHQnx8IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAIQ8gFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnxDAACAPyAPlTgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRYgBCkDECAAfCEXIBBQIQsgEEJ/fEIDhiEEA0AgFiEAIBchByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALQwAAgD8gFCAFQgKGfCoCAJUhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ8YCAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEPGAgIAACyADQuAAfCSAgICAAAvZDQYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAPA/IA+7oyAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBkQAAAAAAADwPyAHIAh8KgIAu6MgBioCALugtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgAEQAAAAAAADwPyAHKgIAu6MgACoCALugtjgCACAAQgR8IgVEAAAAAAAA8D8gB0IEfCoCALujIAUqAgC7oLY4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAARAAAAAAAAPA/IAQqAgC7oyAPu6C2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgAEQAAAAAAADwPyAEKgIAu6MgD7ugtiIPOAIAIABEAAAAAAAA8D8gBCoCALujIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAuyEXIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgBEAAAAAAAA8D8gF6MgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAPA/IBUgBUIChnwqAgC7oyEXIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAXIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQ84CAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEPOAgIAACyADQuAAfCSAgICAAAvtCwQIfgR/AX0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPQwAAAACXEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UgAnwhCSADKQMAIQggBCkDACEFAkAgAiABfUIDgyIGUA0AIAUgAUIChiIHfCEAIAggB3whBwNAIAcgACoCAEMAAAAAlzgCACAAQgR8IQAgB0IEfCEHIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAIAUgBnwiByoCAEMAAAAAlzgCACAAQgR8IAdCBHwqAgBDAAAAAJc4AgAgAEIIfCAHQgh8KgIAQwAAAACXOAIAIABCDHwgB0IMfCoCAEMAAAAAlzgCACAFQhB8IQUgCEIQfCEIIAlCfHwiCUIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIAJ8IQggEiARQgKGfCEAAkAgAiABfUIDgyIHUA0AA0AgACAEKgIAQwAAAACXOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIAQqAgBDAAAAAJc4AgAgACAEKgIAQwAAAACXOAIAIAAgBCoCAEMAAAAAlzgCACAAIAQqAgBDAAAAAJc4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCACEPIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IA9DAAAAAJc4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEWIAQpAxAgAHwhFyAQUCELIBBCf3xCA4YhBANAIBYhACAXIQcgFSEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8KgIAQwAAAACXIQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEPWAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABD1gICAAAsgA0LgAHwkgICAgAAL0Q0ECH4EfwJ9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFIA9DAAAAAJcgEJIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGIAYqAgAgByAIfCoCAEMAAAAAl5I4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAcgAUIChiIAfCEHIAUgAHwhAANAIAAgACoCACAHKgIAQwAAAACXkjgCACAAQgR8IgUgBSoCACAHQgR8KgIAQwAAAACXkjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIAJ8IQggEyASQgKGfCIAKgIAIQ8CQCACIAF9QgODIgdQDQADQCAAIAQqAgBDAAAAAJcgD5IiDzgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAQwAAAACXIA+SIg84AgAgACAEKgIAQwAAAACXIA+SIg84AgAgACAEKgIAQwAAAACXIA+SIg84AgAgACAEKgIAQwAAAACXIA+SIg84AgAgB0J8fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCACEPIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAgD0MAAAAAlyAAKgIAkjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgBDAAAAAJchDyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IgAgDyAAKgIAkjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABD3gICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ94CAgAALIANC4AB8JICAgIAAC7YMBwF9CH4EfwF9Bn4BfQJ+IAAqAiAhAyAAKQMYIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUFANAQsgAiABWA0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAQgBiAQIANDAACAPyAQQwAAAABdG5QQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACACIAFYDQEgAUJ/hSEAIAQpAwAhCCAFKQMAIQYCQCACIAF9QgGDUA0AIAggAUIChiIJfCAGIAl8KgIAIhAgA0MAAIA/IBBDAAAAAF0blDgCACABQgF8IQELIABCACACfVENASACIAF9IQkgBiABQgKGIgd8IQAgCCAHfCEIA0AgCCAAKgIAIhAgA0MAAIA/IBBDAAAAAF0blDgCACAIQgR8IABCBHwqAgAiECADQwAAgD8gEEMAAAAAXRuUOAIAIABCCHwhACAIQgh8IQggCUJ+fCIJQgBSDQAMAgsLIAIgAVgNACAEKQMYIREgBCkDMCESIAQpAwAhEyAFKQMwIRQgBSkDACEVAkAgBSkDGCIWQgBSDQAgFSAUQgKGfCEFAkAgEUIAUg0AIAFCf4UgAnwhCSATIBJCAoZ8IQACQCACIAF9QgODIghQDQADQCAAIAUqAgAiECADQwAAgD8gEEMAAAAAXRuUOAIAIAFCAXwhASAIQn98IghCAFINAAsLIAlCA1QNAiACIAF9IQgDQCAAIAUqAgAiECADQwAAgD8gEEMAAAAAXRuUOAIAIAAgBSoCACIQIANDAACAPyAQQwAAAABdG5Q4AgAgACAFKgIAIhAgA0MAAIA/IBBDAAAAAF0blDgCACAAIAUqAgAiECADQwAAgD8gEEMAAAAAXRuUOAIAIAhCfHwiCFBFDQAMAwsLIAQpAwggEUIDhkJ4fCIAfCEWIAQpAxAgAHwhBANAIANDAACAPyAFKgIAIhBDAAAAAF0bIRcgFiEAIAQhCCARIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALIBMgBkIChnwgECAXlDgCACABQgF8IgEgAlINAAwCCwsgBSkDCCAWQgOGQnh8IgB8IRggBSkDECAAfCEZIBFQIQwgEUJ/fEIDhiEFA0AgGCEAIBkhCCAWIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALIBUgBkIChnwqAgAiECADQwAAgD8gEEMAAAAAXRuUIRAgEiEGAkAgDA0AIAQpAwggBXwhACAEKQMQIAV8IQggESEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEPmAgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABD5gICAAAsgA0LgAHwkgICAgAAL5w4FAX0IfgR/An0IfiAAKgIgIQMgACkDGCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BQDQELIAIgAVgNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgBCAGIBAgA0MAAIA/IBBDAAAAAF0blCARkhCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAIgAVgNASABQn+FIQAgBCkDACEGIAUpAwAhCAJAIAIgAX1CAYNQDQAgBiABQgKGIgl8IgcgByoCACAIIAl8KgIAIhAgA0MAAIA/IBBDAAAAAF0blJI4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEJIAggAUIChiIAfCEIIAYgAHwhAANAIAAgACoCACAIKgIAIhAgA0MAAIA/IBBDAAAAAF0blJI4AgAgAEIEfCIGIAYqAgAgCEIEfCoCACIQIANDAACAPyAQQwAAAABdG5SSOAIAIAhCCHwhCCAAQgh8IQAgCUJ+fCIJQgBSDQAMAgsLIAIgAVgNACAEKQMYIRIgBCkDMCETIAQpAwAhFCAFKQMwIRUgBSkDACEWAkAgBSkDGCIXQgBSDQAgFiAVQgKGfCEFAkAgEkIAUg0AIAFCf4UgAnwhCSAUIBNCAoZ8IgAqAgAhEAJAIAIgAX1CA4MiCFANAANAIAAgBSoCACIRIANDAACAPyARQwAAAABdG5QgEJIiEDgCACABQgF8IQEgCEJ/fCIIQgBSDQALCyAJQgNUDQIgAiABfSEIA0AgACAFKgIAIhEgA0MAAIA/IBFDAAAAAF0blCAQkiIQOAIAIAAgBSoCACIRIANDAACAPyARQwAAAABdG5QgEJIiEDgCACAAIAUqAgAiESADQwAAgD8gEUMAAAAAXRuUIBCSIhA4AgAgACAFKgIAIhEgA0MAAIA/IBFDAAAAAF0blCAQkiIQOAIAIAhCfHwiCFBFDQAMAwsLIAQpAwggEkIDhkJ4fCIAfCEXIAQpAxAgAHwhBANAIANDAACAPyAFKgIAIhBDAAAAAF0bIREgFyEAIAQhCCASIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALIBQgBkIChnwiACAQIBGUIAAqAgCSOAIAIAFCAXwiASACUg0ADAILCyAFKQMIIBdCA4ZCeHwiAHwhGCAFKQMQIAB8IRkgElAhDCASQn98QgOGIQUDQCAYIQAgGSEIIBchByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsgFiAGQgKGfCoCACIQIANDAACAPyAQQwAAAABdG5QhECATIQYCQCAMDQAgBCkDCCAFfCEAIAQpAxAgBXwhCCASIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAUIAZCAoZ8IgAgECAAKgIAkjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABD7gICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ+4CAgAALIANC4AB8JICAgIAAC/wMBAh+BH8BfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFQwAAAABDAACAPyAPQwAAAABdGxCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIAJ8IQkgAykDACEIIAQpAwAhBQJAIAIgAX1CA4MiBlANACAFIAFCAoYiB3whACAIIAd8IQcDQCAHQwAAAABDAACAPyAAKgIAQwAAAABdGzgCACAAQgR8IQAgB0IEfCEHIAFCAXwhASAGQn98IgZCAFINAAsLIAlCA1QNASABQgKGIQYgAiABfSEJA0AgCCAGfCIAQwAAAABDAACAPyAFIAZ8IgcqAgBDAAAAAF0bOAIAIABCBHxDAAAAAEMAAIA/IAdCBHwqAgBDAAAAAF0bOAIAIABCCHxDAAAAAEMAAIA/IAdCCHwqAgBDAAAAAF0bOAIAIABCDHxDAAAAAEMAAIA/IAdCDHwqAgBDAAAAAF0bOAIAIAVCEHwhBSAIQhB8IQggCUJ8fCIJQgBSDQAMAgsLIAIgAVgNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAFCf4UgAnwhCCASIBFCAoZ8IQACQCACIAF9QgODIgdQDQADQCAAQwAAAABDAACAPyAEKgIAQwAAAABdGzgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgAEMAAAAAQwAAgD8gBCoCAEMAAAAAXRs4AgAgAEMAAAAAQwAAgD8gBCoCAEMAAAAAXRs4AgAgAEMAAAAAQwAAgD8gBCoCAEMAAAAAXRs4AgAgAEMAAAAAQwAAgD8gBCoCAEMAAAAAXRs4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCACEPIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8QwAAAABDAACAPyAPQwAAAABdGzgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRYgBCkDECAAfCEXIBBQIQsgEEJ/fEIDhiEEA0AgFiEAIBchByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALQwAAAABDAACAPyAUIAVCAoZ8KgIAQwAAAABdGyEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABD9gICAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQ/YCAgAALIANC4AB8JICAgIAAC8oOBAh+BH8CfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAQQwAAAABDAACAPyAPQwAAAABdG5IQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGIAYqAgBDAAAAAEMAAIA/IAcgCHwqAgBDAAAAAF0bkjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgACAAKgIAQwAAAABDAACAPyAHKgIAQwAAAABdG5I4AgAgAEIEfCIFIAUqAgBDAAAAAEMAAIA/IAdCBHwqAgBDAAAAAF0bkjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIAJ8IQggEyASQgKGfCIAKgIAIQ8CQCACIAF9QgODIgdQDQADQCAAIA9DAAAAAEMAAIA/IAQqAgBDAAAAAF0bkiIPOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIA9DAAAAAEMAAIA/IAQqAgBDAAAAAF0bkiIPOAIAIAAgD0MAAAAAQwAAgD8gBCoCAEMAAAAAXRuSIg84AgAgACAPQwAAAABDAACAPyAEKgIAQwAAAABdG5IiDzgCACAAIA9DAAAAAEMAAIA/IAQqAgBDAAAAAF0bkiIPOAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgAhDyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIAAqAgBDAAAAAEMAAIA/IA9DAAAAAF0bkjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALQwAAAABDAACAPyAVIAVCAoZ8KgIAQwAAAABdGyEPIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAAKgIAIA+SOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEP+AgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABD/gICAAAsgA0LgAHwkgICAgAAL/goECH4EfwF9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAVEAAAAAAAA8D8gD4y7EIuAgIAARAAAAAAAAPA/oKO2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhCCADKQMAIQcgBCkDACEAAkAgAiABfUIBg1ANACAHIAFCAoYiBXxEAAAAAAAA8D8gACAFfCoCAIy7EIuAgIAARAAAAAAAAPA/oKO2OAIAIAFCAXwhAQsgCEIAIAJ9UQ0BIAIgAX0hCCAAIAFCAoYiBXwhACAHIAV8IQcDQCAHRAAAAAAAAPA/IAAqAgCMuxCLgICAAEQAAAAAAADwP6CjtjgCACAHQgR8RAAAAAAAAPA/IABCBHwqAgCMuxCLgICAAEQAAAAAAADwP6CjtjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhFSAQUCELIBBCf3xCA4YhBANARAAAAAAAAPA/IBUqAgCMuxCLgICAAEQAAAAAAADwP6CjtiEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRYgBCkDECAAfCEXIBBQIQsgEEJ/fEIDhiEEA0AgFiEAIBchByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAPA/IBQgBUIChnwqAgCMuxCLgICAAEQAAAAAAADwP6CjtiEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCBgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQgYGAgAALIANC4AB8JICAgIAAC68KBQh+BH8CfQh+AXwgACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAPA/IA+MuxCLgICAAEQAAAAAAADwP6CjIBC7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIAfCEHIAMpAwAgAHwhAANAIABEAAAAAAAA8D8gByoCAIy7EIuAgIAARAAAAAAAAPA/oKMgACoCALugtjgCACAHQgR8IQcgAEIEfCEAIAhCf3wiCEIAUg0ADAILCyABIAJaDQAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUIAQpAxgiFVAhCyADKQMYIhZQIQ0gFkJ/fEIDhiEXIBVCf3xCA4YhGANAIBMhBQJAIAsNACAEKQMIIBh8IQAgBCkDECAYfCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLRAAAAAAAAPA/IBQgBUIChnwqAgCMuxCLgICAAEQAAAAAAADwP6CjIRkgESEFAkAgDQ0AIAMpAwggF3whACADKQMQIBd8IQcgFiEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCIAIBkgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCDgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQg4GAgAALIANC4AB8JICAgIAAC7YLBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCDgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfCAFIAh8KgIAuxCDgICAALY4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAcgACoCALsQg4CAgAC2OAIAIAdCBHwgAEIEfCoCALsQg4CAgAC2OAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAFCf4UgAnwhCCASIBFCAoZ8IQACQCACIAF9QgODIgdQDQADQCAAIAQqAgC7EIOAgIAAtjgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgACAEKgIAuxCDgICAALY4AgAgACAEKgIAuxCDgICAALY4AgAgACAEKgIAuxCDgICAALY4AgAgACAEKgIAuxCDgICAALY4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCALsQg4CAgAAhFiAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCAWtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRcgBCkDECAAfCEYIBBQIQsgEEJ/fEIDhiEEA0AgFyEAIBghByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwqAgC7EIOAgIAAtiEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCFgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQhYGAgAALIANC4AB8JICAgIAAC8UNBgh+BH8CfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgD7sQg4CAgAAgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEFIAQpAwAhBwJAIAIgAX1CAYNQDQAgBSABQgKGIgh8IgYqAgAhDyAGIAcgCHwqAgC7EIOAgIAAIA+7oLY4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAcgAUIChiIAfCEHIAUgAHwhAANAIAAqAgAhDyAAIAcqAgC7EIOAgIAAIA+7oLY4AgAgAEIEfCIFKgIAIQ8gBSAHQgR8KgIAuxCDgICAACAPu6C2OAIAIAdCCHwhByAAQgh8IQAgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IgAqAgAhDwJAIAIgAX1CAYNQDQAgACAEKgIAuxCDgICAACAPu6C2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgACAEKgIAuxCDgICAACAPu6C2Ig84AgAgACAEKgIAuxCDgICAACAPu6C2Ig84AgAgB0J+fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAKgIAIQ8gACAXEIOAgIAAIA+7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEYIAQpAxAgAHwhGSARUCELIBFCf3xCA4YhBANAIBghACAZIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAVIAVCAoZ8KgIAuxCDgICAACEXIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACAXIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQh4GAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEIeBgIAACyADQuAAfCSAgICAAAu9CwQIfgR/AX0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCCgICAALaMEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHwgBSAIfCoCALsQgoCAgAC2jDgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgByAAKgIAuxCCgICAALaMOAIAIAdCBHwgAEIEfCoCALsQgoCAgAC2jDgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIAJ8IQggEiARQgKGfCEAAkAgAiABfUIDgyIHUA0AA0AgACAEKgIAuxCCgICAALaMOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAIAQqAgC7EIKAgIAAtow4AgAgACAEKgIAuxCCgICAALaMOAIAIAAgBCoCALsQgoCAgAC2jDgCACAAIAQqAgC7EIKAgIAAtow4AgAgB0J8fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0AgBCoCALsQgoCAgAC2IQ8gFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnwgD4w4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFUIDhkJ4fCIAfCEWIAQpAxAgAHwhFyAQUCELIBBCf3xCA4YhBANAIBYhACAXIQcgFSEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8KgIAuxCCgICAALaMIQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEImBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCJgYCAAAsgA0LgAHwkgICAgAALtQ0GCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAQuyAPuxCCgICAAKG2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQUgBCkDACEHAkAgAiABfUIBg1ANACAFIAFCAoYiCHwiBiAGKgIAuyAHIAh8KgIAuxCCgICAAKG2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAHIAFCAoYiAHwhByAFIAB8IQADQCAAIAAqAgC7IAcqAgC7EIKAgIAAobY4AgAgAEIEfCIFIAUqAgC7IAdCBHwqAgC7EIKAgIAAobY4AgAgB0IIfCEHIABCCHwhACAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAAIA+7IAQqAgC7EIKAgIAAobYiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAAIA+7IAQqAgC7EIKAgIAAobYiDzgCACAAIA+7IAQqAgC7EIKAgIAAobYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAuyEXIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAgACoCALsgFxCCgICAAKG2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgEVAhCyARQn98QgOGIQQDQCAYIQAgGSEHIBYhBiAUIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFSAFQgKGfCoCALsQgoCAgAAhFyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IgAgACoCALsgF6G2OAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEIuBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCLgYCAAAsgA0LgAHwkgICAgAALhgwFCH4EfwF9AXwIfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADwPyAPuxCDgICAACIQIBCio7YQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfEQAAAAAAADwPyAFIAh8KgIAuxCDgICAACIQIBCio7Y4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAdEAAAAAAAA8D8gACoCALsQg4CAgAAiECAQoqO2OAIAIAdCBHxEAAAAAAAA8D8gAEIEfCoCALsQg4CAgAAiECAQoqO2OAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IQACQCACIAF9QgGDUA0AIABEAAAAAAAA8D8gBCoCALsQg4CAgAAiECAQoqO2OAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA8D8gBCoCALsQg4CAgAAiECAQoqO2OAIAIABEAAAAAAAA8D8gBCoCALsQg4CAgAAiECAQoqO2OAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNARAAAAAAAAPA/IAQqAgC7EIOAgIAAIhAgEKKjIRAgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwgELY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEXIAQpAxAgAHwhGCARUCELIBFCf3xCA4YhBANAIBchACAYIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADwPyAVIAVCAoZ8KgIAuxCDgICAACIQIBCio7YhDyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQjYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEI2BgIAACyADQuAAfCSAgICAAAudCgUIfgR/An0BfAh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBUQAAAAAAADwPyAPuxCDgICAACIRIBGioyAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAARAAAAAAAAPA/IAcqAgC7EIOAgIAAIhEgEaKjIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAEKQMYIhZQIQsgAykDGCIXUCENIBdCf3xCA4YhGCAWQn98QgOGIRkDQCAUIQUCQCALDQAgBCkDCCAZfCEAIAQpAxAgGXwhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALC0QAAAAAAADwPyAVIAVCAoZ8KgIAuxCDgICAACIRIBGioyERIBIhBQJAIA0NACADKQMIIBh8IQAgAykDECAYfCEHIBchBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwiACARIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQj4GAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEI+BgIAACyADQuAAfCSAgICAAAuzDAUIfgR/AX0BfAh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFRAAAAAAAAPA/RAAAAAAAAPA/IA+7IhAgEKKhn6O2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHxEAAAAAAAA8D9EAAAAAAAA8D8gBSAIfCoCALsiECAQoqGfo7Y4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAdEAAAAAAAA8D9EAAAAAAAA8D8gACoCALsiECAQoqGfo7Y4AgAgB0IEfEQAAAAAAADwP0QAAAAAAADwPyAAQgR8KgIAuyIQIBCioZ+jtjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCEAAkAgAiABfUIBg1ANACAARAAAAAAAAPA/RAAAAAAAAPA/IAQqAgC7IhAgEKKhn6O2OAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA8D9EAAAAAAAA8D8gBCoCALsiECAQoqGfo7Y4AgAgAEQAAAAAAADwP0QAAAAAAADwPyAEKgIAuyIQIBCioZ+jtjgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQEQAAAAAAADwP0QAAAAAAADwPyAEKgIAuyIQIBCioZ+jIRAgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwgELY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEXIAQpAxAgAHwhGCARUCELIBFCf3xCA4YhBANAIBchACAYIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADwP0QAAAAAAADwPyAVIAVCAoZ8KgIAuyIQIBCioZ+jtiEPIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCRgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQkYGAgAALIANC4AB8JICAgIAAC8oNBQh+BH8CfQF8CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAPA/RAAAAAAAAPA/IA+7IhEgEaKhn6MgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgAEQAAAAAAADwP0QAAAAAAADwPyAHKgIAuyIRIBGioZ+jIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgAiABWA0AIAMpAxghEiADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYCQCAEKQMYIhdCAFINACAWIBVCAoZ8IQQCQCASQgBSDQAgAUJ/hSEHIBQgE0IChnwiACoCACEPAkAgAiABfUIBg1ANACAARAAAAAAAAPA/RAAAAAAAAPA/IAQqAgC7IhEgEaKhn6MgD7ugtiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA8D9EAAAAAAAA8D8gBCoCALsiESARoqGfoyAPu6C2Ig84AgAgAEQAAAAAAADwP0QAAAAAAADwPyAEKgIAuyIRIBGioZ+jIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBJCA4ZCeHwiAHwhFyADKQMQIAB8IQMDQEQAAAAAAADwPyAEKgIAuyIRIBGioZ8hESAXIQAgAyEHIBIhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCIARAAAAAAAAPA/IBGjIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggF0IDhkJ4fCIAfCEYIAQpAxAgAHwhGSASUCELIBJCf3xCA4YhBANAIBghACAZIQcgFyEGIBUhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADwP0QAAAAAAADwPyAWIAVCAoZ8KgIAuyIRIBGioZ+jIREgEyEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgEiEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgFCAFQgKGfCIAIBEgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCTgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQk4GAgAALIANC4AB8JICAgIAAC7MMBQh+BH8BfQF8CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAVEAAAAAAAA8L9EAAAAAAAA8D8gD7siECAQoqGfo7YQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfEQAAAAAAADwv0QAAAAAAADwPyAFIAh8KgIAuyIQIBCioZ+jtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgB0QAAAAAAADwv0QAAAAAAADwPyAAKgIAuyIQIBCioZ+jtjgCACAHQgR8RAAAAAAAAPC/RAAAAAAAAPA/IABCBHwqAgC7IhAgEKKhn6O2OAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IQACQCACIAF9QgGDUA0AIABEAAAAAAAA8L9EAAAAAAAA8D8gBCoCALsiECAQoqGfo7Y4AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgAEQAAAAAAADwv0QAAAAAAADwPyAEKgIAuyIQIBCioZ+jtjgCACAARAAAAAAAAPC/RAAAAAAAAPA/IAQqAgC7IhAgEKKhn6O2OAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNARAAAAAAAAPC/RAAAAAAAAPA/IAQqAgC7IhAgEKKhn6MhECAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCAQtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAPC/RAAAAAAAAPA/IBUgBUIChnwqAgC7IhAgEKKhn6O2IQ8gEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEJWBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCVgYCAAAsgA0LgAHwkgICAgAALyg0FCH4EfwJ9AXwIfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgELtEAAAAAAAA8D9EAAAAAAAA8D8gD7siESARoqGfo6G2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAAqAgC7RAAAAAAAAPA/RAAAAAAAAPA/IAcqAgC7IhEgEaKhn6OhtjgCACAHQgR8IQcgAEIEfCEAIAhCf3wiCEIAUg0ADAILCyACIAFYDQAgAykDGCESIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFgJAIAQpAxgiF0IAUg0AIBYgFUIChnwhBAJAIBJCAFINACABQn+FIQcgFCATQgKGfCIAKgIAIQ8CQCACIAF9QgGDUA0AIAAgD7tEAAAAAAAA8D9EAAAAAAAA8D8gBCoCALsiESARoqGfo6G2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgACAPu0QAAAAAAADwP0QAAAAAAADwPyAEKgIAuyIRIBGioZ+jobYiDzgCACAAIA+7RAAAAAAAAPA/RAAAAAAAAPA/IAQqAgC7IhEgEaKhn6OhtiIPOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEkIDhkJ4fCIAfCEXIAMpAxAgAHwhAwNARAAAAAAAAPA/IAQqAgC7IhEgEaKhnyERIBchACADIQcgEiEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAUIAVCAoZ8IgAgACoCALtEAAAAAAAA8L8gEaOgtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAXQgOGQnh8IgB8IRggBCkDECAAfCEZIBJQIQsgEkJ/fEIDhiEEA0AgGCEAIBkhByAXIQYgFSEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAPA/RAAAAAAAAPA/IBYgBUIChnwqAgC7IhEgEaKhn6MhESATIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyAUIAVCAoZ8IgAgACoCALsgEaG2OAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEJeBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCXgYCAAAsgA0LgAHwkgICAgAALqgwFCH4EfwF9AXwIfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADwPyAPuyIQIBCiRAAAAAAAAPA/oKO2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHxEAAAAAAAA8D8gBSAIfCoCALsiECAQokQAAAAAAADwP6CjtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgB0QAAAAAAADwPyAAKgIAuyIQIBCiRAAAAAAAAPA/oKO2OAIAIAdCBHxEAAAAAAAA8D8gAEIEfCoCALsiECAQokQAAAAAAADwP6CjtjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCEAAkAgAiABfUIBg1ANACAARAAAAAAAAPA/IAQqAgC7IhAgEKJEAAAAAAAA8D+go7Y4AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgAEQAAAAAAADwPyAEKgIAuyIQIBCiRAAAAAAAAPA/oKO2OAIAIABEAAAAAAAA8D8gBCoCALsiECAQokQAAAAAAADwP6CjtjgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQEQAAAAAAADwPyAEKgIAuyIQIBCiRAAAAAAAAPA/oKMhECAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCAQtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAPA/IBUgBUIChnwqAgC7IhAgEKJEAAAAAAAA8D+go7YhDyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQmYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEJmBgIAACyADQuAAfCSAgICAAAvDDQUIfgR/An0BfAh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBUQAAAAAAADwPyAPuyIRIBGiRAAAAAAAAPA/oKMgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgAEQAAAAAAADwPyAHKgIAuyIRIBGiRAAAAAAAAPA/oKMgACoCALugtjgCACAHQgR8IQcgAEIEfCEAIAhCf3wiCEIAUg0ADAILCyACIAFYDQAgAykDGCESIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFgJAIAQpAxgiF0IAUg0AIBYgFUIChnwhBAJAIBJCAFINACABQn+FIQcgFCATQgKGfCIAKgIAIQ8CQCACIAF9QgGDUA0AIABEAAAAAAAA8D8gBCoCALsiESARokQAAAAAAADwP6CjIA+7oLYiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAARAAAAAAAAPA/IAQqAgC7IhEgEaJEAAAAAAAA8D+goyAPu6C2Ig84AgAgAEQAAAAAAADwPyAEKgIAuyIRIBGiRAAAAAAAAPA/oKMgD7ugtiIPOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEkIDhkJ4fCIAfCEXIAMpAxAgAHwhAwNAIAQqAgC7IhEgEaJEAAAAAAAA8D+gIREgFyEAIAMhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwiAEQAAAAAAADwPyARoyAAKgIAu6C2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBdCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgElAhCyASQn98QgOGIQQDQCAYIQAgGSEHIBchBiAVIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA8D8gFiAFQgKGfCoCALsiESARokQAAAAAAADwP6CjIREgEyEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgEiEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgFCAFQgKGfCIAIBEgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCbgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQm4GAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCJgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQiYCAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EImAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCJgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQiYCAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEJ2BgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCdgYCAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCJgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EImAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCJgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQiYCAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EImAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCfgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQn4GAgAALIANC4AB8JICAgIAAC9QJBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBSAPuxCIgICAALYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIHfCEAIAMpAwAgB3whBwNAIAcgACoCALsQiICAgAC2OAIAIABCBHwhACAHQgR8IQcgCEJ/fCIIQgBSDQAMAgsLIAEgAloNACADKQMYIRAgAykDMCERIAMpAwAhEiAEKQMwIRMgBCkDACEUAkAgBCkDGCIVQgBSDQAgFCATQgKGfCEEAkAgEEIAUg0AIAIgAX0hACASIBFCAoZ8IQcDQCAHIAQqAgC7EIiAgIAAtjgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAuxCIgICAACEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgFCAFQgKGfCoCALsQiICAgAC2IQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEKGBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABChgYCAAAsgA0LgAHwkgICAgAAL6gsGCH4EfwJ9Bn4BfAJ+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAPuxCIgICAACAQu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAcqAgC7EIiAgIAAIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAiABfSEAIBMgEkIChnwiByoCACEPA0AgByAEKgIAuxCIgICAACAPu6C2Ig84AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCALshFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIAIBcQiICAgAAgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRggBCkDECAAfCEZIBFQIQsgEUJ/fEIDhiEEA0AgGCEAIBkhByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBUgBUIChnwqAgC7EIiAgIAAIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCjgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQo4GAgAALIANC4AB8JICAgIAAC50KBQh+BH8BfQF8CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAVEAAAAAAAA8D8gD7sQioCAgAAiECAQoqG2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hCCAEKQMAIAFCAoYiB3whACADKQMAIAd8IQcDQCAHRAAAAAAAAPA/IAAqAgC7EIqAgIAAIhAgEKKhtjgCACAAQgR8IQAgB0IEfCEHIAhCf3wiCEIAUg0ADAILCyABIAJaDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACACIAF9IQAgEyASQgKGfCEHA0AgB0QAAAAAAADwPyAEKgIAuxCKgICAACIQIBCiobY4AgAgAEJ/fCIAUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0BEAAAAAAAA8D8gBCoCALsQioCAgAAiECAQoqEhECAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCAQtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAPA/IBUgBUIChnwqAgC7EIqAgIAAIhAgEKKhtiEPIBIhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBMgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABClgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQpYGAgAALIANC4AB8JICAgIAAC7MMBQh+BH8CfQF8CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAPA/IA+7EIqAgIAAIhEgEaKhIBC7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEIIAQpAwAgAUIChiIAfCEHIAMpAwAgAHwhAANAIABEAAAAAAAA8D8gByoCALsQioCAgAAiESARoqEgACoCALugtjgCACAHQgR8IQcgAEIEfCEAIAhCf3wiCEIAUg0ADAILCyABIAJaDQAgAykDGCESIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFgJAIAQpAxgiF0IAUg0AIBYgFUIChnwhBAJAIBJCAFINACACIAF9IQAgFCATQgKGfCIHKgIAIQ8DQCAHRAAAAAAAAPA/IAQqAgC7EIqAgIAAIhEgEaKhIA+7oLYiDzgCACAAQn98IgBQRQ0ADAMLCyADKQMIIBJCA4ZCeHwiAHwhFyADKQMQIAB8IQMDQCAEKgIAuxCKgICAACIRIBGiIREgFyEAIAMhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwiAEQAAAAAAADwPyARoSAAKgIAu6C2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBdCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgElAhCyASQn98QgOGIQQDQCAYIQAgGSEHIBchBiAVIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA8D8gFiAFQgKGfCoCALsQioCAgAAiESARoqEhESATIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyAUIAVCAoZ8IgAgESAAKgIAu6C2OAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEKeBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABCngYCAAAsgA0LgAHwkgICAgAALnAsECH4EfwF9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAVDAACAPyAPlRCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8QwAAgD8gBSAIfCoCAJU4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAdDAACAPyAAKgIAlTgCACAHQgR8QwAAgD8gAEIEfCoCAJU4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIABDAACAPyAEKgIAlTgCACABQgF8IQEgB0J/fCIHQgBSDQALCyAIQgNUDQIgAiABfSEHA0AgAEMAAIA/IAQqAgCVOAIAIABDAACAPyAEKgIAlTgCACAAQwAAgD8gBCoCAJU4AgAgAEMAAIA/IAQqAgCVOAIAIAdCfHwiB1BFDQAMAwsLIAMpAwggEEIDhkJ4fCIAfCEVIAMpAxAgAHwhAwNAIAQqAgAhDyAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfEMAAIA/IA+VOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFiAEKQMQIAB8IRcgEFAhCyAQQn98QgOGIQQDQCAWIQAgFyEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtDAACAPyAUIAVCAoZ8KgIAlSEPIBEhBQJAIAsNACADKQMIIAR8IQAgAykDECAEfCEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIBIgBUIChnwgDzgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCpgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQqYGAgAALIANC4AB8JICAgIAAC9kNBgh+BH8CfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAVEAAAAAAAA8D8gD7ujIBC7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGRAAAAAAAAPA/IAcgCHwqAgC7oyAGKgIAu6C2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAHIAFCAoYiAHwhByAFIAB8IQADQCAARAAAAAAAAPA/IAcqAgC7oyAAKgIAu6C2OAIAIABCBHwiBUQAAAAAAADwPyAHQgR8KgIAu6MgBSoCALugtjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCIAKgIAIQ8CQCACIAF9QgGDUA0AIABEAAAAAAAA8D8gBCoCALujIA+7oLYiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAARAAAAAAAAPA/IAQqAgC7oyAPu6C2Ig84AgAgAEQAAAAAAADwPyAEKgIAu6MgD7ugtiIPOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgC7IRcgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwiAEQAAAAAAADwPyAXoyAAKgIAu6C2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBZCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgEVAhCyARQn98QgOGIQQDQCAYIQAgGSEHIBYhBiAUIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA8D8gFSAFQgKGfCoCALujIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCrgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQq4GAgAALIANC4AB8JICAgIAAC/8LBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADwPyAPu0TvOfr+Qi7mP6KjthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8RAAAAAAAAPA/IAUgCHwqAgC7RO85+v5CLuY/oqO2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAFIAFCAoYiBnwhACAHIAZ8IQcDQCAHRAAAAAAAAPA/IAAqAgC7RO85+v5CLuY/oqO2OAIAIAdCBHxEAAAAAAAA8D8gAEIEfCoCALtE7zn6/kIu5j+io7Y4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSEHIBIgEUIChnwhAAJAIAIgAX1CAYNQDQAgAEQAAAAAAADwPyAEKgIAu0TvOfr+Qi7mP6KjtjgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAARAAAAAAAAPA/IAQqAgC7RO85+v5CLuY/oqO2OAIAIABEAAAAAAAA8D8gBCoCALtE7zn6/kIu5j+io7Y4AgAgB0J+fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0BEAAAAAAAA8D8gBCoCALtE7zn6/kIu5j+ioyEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA8D8gFCAFQgKGfCoCALtE7zn6/kIu5j+io7YhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQrYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEK2BgIAACyADQuAAfCSAgICAAAuiDQYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAPA/IA+7RO85+v5CLuY/oqMgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgAEQAAAAAAADwPyAHKgIAu0TvOfr+Qi7mP6KjIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAARAAAAAAAAPA/IAQqAgC7RO85+v5CLuY/oqMgD7ugtiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA8D8gBCoCALtE7zn6/kIu5j+ioyAPu6C2Ig84AgAgAEQAAAAAAADwPyAEKgIAu0TvOfr+Qi7mP6KjIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAu0TvOfr+Qi7mP6IhFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIARAAAAAAAAPA/IBejIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEYIAQpAxAgAHwhGSARUCELIBFCf3xCA4YhBANAIBghACAZIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADwPyAVIAVCAoZ8KgIAu0TvOfr+Qi7mP6KjIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCvgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQr4GAgAALIANC4AB8JICAgIAAC/8LBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADwPyAPu0QWVbW7sWsCQKKjthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8RAAAAAAAAPA/IAUgCHwqAgC7RBZVtbuxawJAoqO2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAFIAFCAoYiBnwhACAHIAZ8IQcDQCAHRAAAAAAAAPA/IAAqAgC7RBZVtbuxawJAoqO2OAIAIAdCBHxEAAAAAAAA8D8gAEIEfCoCALtEFlW1u7FrAkCio7Y4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSEHIBIgEUIChnwhAAJAIAIgAX1CAYNQDQAgAEQAAAAAAADwPyAEKgIAu0QWVbW7sWsCQKKjtjgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAARAAAAAAAAPA/IAQqAgC7RBZVtbuxawJAoqO2OAIAIABEAAAAAAAA8D8gBCoCALtEFlW1u7FrAkCio7Y4AgAgB0J+fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0BEAAAAAAAA8D8gBCoCALtEFlW1u7FrAkCioyEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA8D8gFCAFQgKGfCoCALtEFlW1u7FrAkCio7YhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQsYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAELGBgIAACyADQuAAfCSAgICAAAuiDQYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAPA/IA+7RBZVtbuxawJAoqMgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgAEQAAAAAAADwPyAHKgIAu0QWVbW7sWsCQKKjIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAARAAAAAAAAPA/IAQqAgC7RBZVtbuxawJAoqMgD7ugtiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA8D8gBCoCALtEFlW1u7FrAkCioyAPu6C2Ig84AgAgAEQAAAAAAADwPyAEKgIAu0QWVbW7sWsCQKKjIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAu0QWVbW7sWsCQKIhFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIARAAAAAAAAPA/IBejIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEYIAQpAxAgAHwhGSARUCELIBFCf3xCA4YhBANAIBghACAZIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADwPyAVIAVCAoZ8KgIAu0QWVbW7sWsCQKKjIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABCzgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQs4GAgAALIANC4AB8JICAgIAAC6wMBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADgvyAPu0QAAAAAAAD4PxCOgICAAKO2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHxEAAAAAAAA4L8gBSAIfCoCALtEAAAAAAAA+D8QjoCAgACjtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgB0QAAAAAAADgvyAAKgIAu0QAAAAAAAD4PxCOgICAAKO2OAIAIAdCBHxEAAAAAAAA4L8gAEIEfCoCALtEAAAAAAAA+D8QjoCAgACjtjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIQcgEiARQgKGfCEAAkAgAiABfUIBg1ANACAARAAAAAAAAOC/IAQqAgC7RAAAAAAAAPg/EI6AgIAAo7Y4AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgAEQAAAAAAADgvyAEKgIAu0QAAAAAAAD4PxCOgICAAKO2OAIAIABEAAAAAAAA4L8gBCoCALtEAAAAAAAA+D8QjoCAgACjtjgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQEQAAAAAAADgvyAEKgIAu0QAAAAAAAD4PxCOgICAAKMhFiAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCAWtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRcgBCkDECAAfCEYIBBQIQsgEEJ/fEIDhiEEA0AgFyEAIBghByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAOC/IBQgBUIChnwqAgC7RAAAAAAAAPg/EI6AgIAAo7YhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQtYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAELWBgIAACyADQuAAfCSAgICAAAv6CwUIfgR/An0BfAh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAQu0QAAAAAAADgvyAPu0QAAAAAAAD4PxCOgICAAKOgthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgByoCALtEAAAAAAAA+D8QjoCAgAAhESAAIAAqAgC7RAAAAAAAAOC/IBGjoLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgASACWg0AIAMpAxghEiADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYCQCAEKQMYIhdCAFINACAWIBVCAoZ8IRcgElAhCyASQn98QgOGIQQDQEQAAAAAAADgPyAXKgIAu0QAAAAAAAD4PxCOgICAAKMhESATIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyAUIAVCAoZ8IgAgACoCALsgEaG2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBdCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgElAhCyASQn98QgOGIQQDQCAYIQAgGSEHIBchBiAVIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA4D8gFiAFQgKGfCoCALtEAAAAAAAA+D8QjoCAgACjIREgEyEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgEiEGIBMhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgFCAFQgKGfCIAIAAqAgC7IBGhtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABC3gYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQt4GAgAALIANC4AB8JICAgIAAC64LBgh+BH8BfQZ+AXwCfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADgPyAPu5+jthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEHIAQpAwAhBQJAIAIgAX1CAYNQDQAgByABQgKGIgh8RAAAAAAAAOA/IAUgCHwqAgC7n6O2OAIAIAFCAXwhAQsgAEIAIAJ9UQ0BIAIgAX0hCCAFIAFCAoYiBnwhACAHIAZ8IQcDQCAHRAAAAAAAAOA/IAAqAgC7n6O2OAIAIAdCBHxEAAAAAAAA4D8gAEIEfCoCALufo7Y4AgAgAEIIfCEAIAdCCHwhByAIQn58IghCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSEHIBIgEUIChnwhAAJAIAIgAX1CAYNQDQAgAEQAAAAAAADgPyAEKgIAu5+jtjgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAARAAAAAAAAOA/IAQqAgC7n6O2OAIAIABEAAAAAAAA4D8gBCoCALufo7Y4AgAgB0J+fCIHUEUNAAwDCwsgAykDCCAQQgOGQnh8IgB8IRUgAykDECAAfCEDA0BEAAAAAAAA4D8gBCoCALufoyEWIBUhACADIQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyASIAVCAoZ8IBa2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFyAEKQMQIAB8IRggEFAhCyAQQn98QgOGIQQDQCAXIQAgGCEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA4D8gFCAFQgKGfCoCALufo7YhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQuYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAELmBgIAACyADQuAAfCSAgICAAAvjDAYIfgR/An0GfgF8An4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hEAwECyALQRd0QYCAgMADaiANciAMQQ10cr4hEAwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hEAwCCyADKQMAIAVCAYZ8LwEAQRB0viEQDAELIAMpAwAgBUIChnwqAgAhEAsgAyAFRAAAAAAAAOA/IA+7n6MgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASACIAF9IQggBCkDACABQgKGIgB8IQcgAykDACAAfCEAA0AgAEQAAAAAAADgPyAHKgIAu5+jIAAqAgC7oLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgAiABWA0AIAMpAxghESADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUCQCAEKQMYIhZCAFINACAVIBRCAoZ8IQQCQCARQgBSDQAgAUJ/hSEHIBMgEkIChnwiACoCACEPAkAgAiABfUIBg1ANACAARAAAAAAAAOA/IAQqAgC7n6MgD7ugtiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA4D8gBCoCALufoyAPu6C2Ig84AgAgAEQAAAAAAADgPyAEKgIAu5+jIA+7oLYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBFCA4ZCeHwiAHwhFiADKQMQIAB8IQMDQCAEKgIAu58hFyAWIQAgAyEHIBEhBiASIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEyAFQgKGfCIARAAAAAAAAOA/IBejIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEYIAQpAxAgAHwhGSARUCELIBFCf3xCA4YhBANAIBghACAZIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADgPyAVIAVCAoZ8KgIAu5+jIRcgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBcgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABC7gYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQu4GAgAALIANC4AB8JICAgIAAC9ULBAh+BH8BfQh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgAyAFIA9DAAAAAF4gD0MAAAAAXWuyEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhACADKQMAIQcgBCkDACEFAkAgAiABfUIBg1ANACAHIAFCAoYiCHwgBSAIfCoCACIPQwAAAABeIA9DAAAAAF1rsjgCACABQgF8IQELIABCACACfVENASACIAF9IQggBSABQgKGIgZ8IQAgByAGfCEHA0AgByAAKgIAIg9DAAAAAF4gD0MAAAAAXWuyOAIAIAdCBHwgAEIEfCoCACIPQwAAAABeIA9DAAAAAF1rsjgCACAAQgh8IQAgB0IIfCEHIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCEQIAMpAzAhESADKQMAIRIgBCkDMCETIAQpAwAhFAJAIAQpAxgiFUIAUg0AIBQgE0IChnwhBAJAIBBCAFINACABQn+FIQcgEiARQgKGfCEAAkAgAiABfUIBg1ANACAAIAQqAgAiD0MAAAAAXiAPQwAAAABda7I4AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgACAEKgIAIg9DAAAAAF4gD0MAAAAAXWuyOAIAIAAgBCoCACIPQwAAAABeIA9DAAAAAF1rsjgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAIg9DAAAAAF4gD0MAAAAAXWshCyAVIQAgAyEHIBAhBiARIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsgEiAFQgKGfCALsjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAVQgOGQnh8IgB8IRYgBCkDECAAfCEXIBBQIQsgEEJ/fEIDhiEEA0AgFiEAIBchByAVIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwqAgAiD0MAAAAAXiAPQwAAAABda7IhDyARIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyASIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQvYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEL2BgIAACyADQuAAfCSAgICAAAuADgQIfgR/An0IfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAUgECAPQwAAAABeIA9DAAAAAF1rspIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhBSAEKQMAIQcCQCACIAF9QgGDUA0AIAUgAUIChiIIfCIGIAYqAgAgByAIfCoCACIPQwAAAABeIA9DAAAAAF1rspI4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAcgAUIChiIAfCEHIAUgAHwhAANAIAAgACoCACAHKgIAIg9DAAAAAF4gD0MAAAAAXWuykjgCACAAQgR8IgUgBSoCACAHQgR8KgIAIg9DAAAAAF4gD0MAAAAAXWuykjgCACAHQgh8IQcgAEIIfCEAIAhCfnwiCEIAUg0ADAILCyACIAFYDQAgAykDGCERIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFQJAIAQpAxgiFkIAUg0AIBUgFEIChnwhBAJAIBFCAFINACABQn+FIQcgEyASQgKGfCIAKgIAIQ8CQCACIAF9QgGDUA0AIAAgDyAEKgIAIhBDAAAAAF4gEEMAAAAAXWuykiIPOAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIAAgDyAEKgIAIhBDAAAAAF4gEEMAAAAAXWuykiIPOAIAIAAgDyAEKgIAIhBDAAAAAF4gEEMAAAAAXWuykiIPOAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNAIAQqAgAiD0MAAAAAXiAPQwAAAABdayELIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgAgACoCACALspI4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEXIAQpAxAgAHwhGCARUCELIBFCf3xCA4YhBANAIBchACAYIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyAVIAVCAoZ8KgIAIg9DAAAAAF4gD0MAAAAAXWuyIQ8gEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIAAqAgAgD5I4AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQv4GAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEL+BgIAACyADQuAAfCSAgICAAAulCAMEfgF/CH4gACkDGCEDAkACQAJAAkAgACkDACIAKQNQQgBSDQAgAykDUFANAQsgAiABWA0CIAMpA1AhBCADKQMYIQUgAykDMCEGIAApAxhQDQEgBVAhByAFQn98QgOGIQgDQCAGIQkCQCAHDQAgAykDCCAIfCEAIAMpAxAgCHwhCiAFIQsgBiEJIAEhDANAIAopAwAgDCAMIAApAwAiDYAiDiANfn1+IAl8IQkgAEJ4fCEAIApCeHwhCiAOIQwgC0J/fCILQgBSDQALCwJAAkAgBEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgCUIBhnxBgPgCOwEADAILIAMpAwAgCUIBhnxBgP8COwEADAELIAMpAwAgCUIChnxBgICA/Hs2AgALIAFCAXwiASACUg0ADAMLCwJAIAAtAEANACADLQBADQAgAiABWA0CIAFCf4UgAnwhCSADKQMAIQwCQCACIAF9QgeDIgpQDQAgDCABQgKGfCEAA0AgAEGAgID8ezYCACAAQgR8IQAgAUIBfCEBIApCf3wiCkIAUg0ACwsgCUIHVA0CIAIgAX0hCiABQgKGIAx8Qhx8IQADQCAAQnx8QoCAgPyLgIDAv383AgAgAEJ0fEKAgID8i4CAwL9/NwIAIABCbHxCgICA/IuAgMC/fzcCACAAQmR8QoCAgPyLgIDAv383AgAgAEIgfCEAIApCeHwiCkIAUg0ADAMLCyACIAFYDQEgAykDMCEEIAMpAwAhCAJAIAMpAxgiBkIAUg0AIAggBEIChnxBgICA/Hs2AgAPCyADKQMIIAZCA4ZCeHwiAHwhBSADKQMQIAB8IQMDQCAFIQAgAyEKIAYhCyAEIQkgASEMA0AgCikDACAMIAwgACkDACINgCIOIA1+fX4gCXwhCSAAQnh8IQAgCkJ4fCEKIA4hDCALQn98IgtCAFINAAsgCCAJQgKGfEGAgID8ezYCACABQgF8IgEgAlINAAwCCwsCQCAFQgBSDQACQCAEQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfEGA+AI7AQAPCyADKQMAIAZCAYZ8QYD/AjsBAA8LIAMpAwAgBkIChnxBgICA/Hs2AgAPCyADKQMIIAVCA4ZCeHwiAHwhCCADKQMQIAB8IQ8DQCAIIQAgDyEKIAUhCyAGIQkgASEMA0AgCikDACAMIAwgACkDACINgCIOIA1+fX4gCXwhCSAAQnh8IQAgCkJ4fCEKIA4hDCALQn98IgtQRQ0ACwJAAkAgBEJ/fCIAQgFWDQACQAJAIACnDgIBAAELIAMpAwAgCUIBhnxBgP8COwEADAILIAMpAwAgCUIBhnxBgPgCOwEADAELIAMpAwAgCUIChnxBgICA/Hs2AgALIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEMGBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDBgYCAAAsgA0LgAHwkgICAgAALogkEB34EfwF9BH4gACkDGCEDAkACQAJAIAApAwAiACkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAMpAzAhBAJAIAMpAxgiBVANACADKQMIIAVCA4YiBnxCeHwhACADKQMQIAZ8Qnh8IQYgASEHA0AgBikDACAHIAcgACkDACIIgCIJIAh+fX4gBHwhBCAAQnh8IQAgBkJ4fCEGIAkhByAFQn98IgVCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAEQgGGfC4BACIKQf8HcSELIApBgICAgHhxIQwCQCAKQf//A3EiDUEKdkEfcSIKRQ0AAkAgCkEfRw0AIAwgDUENdHJBgICA/AdyviEODAQLIApBF3RBgICAwANqIAxyIAtBDXRyviEODAMLAkAgC0UNAEGAgICYBCALZyIKQRd0ayAMciANIApBamp0QQ50QYCA/wNxciEMCyAMviEODAILIAMpAwAgBEIBhnwvAQBBEHS+IQ4MAQsgAykDACAEQgKGfCoCACEOCyADIAQgDkMAAIC/khCUgICAACABQgF8IgEgAlINAAwCCwsCQCAALQBADQAgAy0AQA0AIAIgAVgNASABQn+FIAJ8IQQgAykDACEHAkAgAiABfUIDgyIGUA0AIAcgAUIChnwhAANAIAAgACoCAEMAAIC/kjgCACAAQgR8IQAgAUIBfCEBIAZCf3wiBkIAUg0ACwsgBEIDVA0BIAIgAX0hBiAHIAFCAoZ8IQADQCAAIAAqAgBDAACAv5I4AgAgAEIEfCIHIAcqAgBDAACAv5I4AgAgAEIIfCIHIAcqAgBDAACAv5I4AgAgAEIMfCIHIAcqAgBDAACAv5I4AgAgAEIQfCEAIAZCfHwiBkIAUg0ADAILCyACIAFYDQAgAykDMCEPIAMpAwAhEAJAIAMpAxgiEUIAUg0AIBAgD0IChnwiBioCACEOAkACQCAAKQMYUA0AIAFCf4UgAnwhBwJAIAIgAX1CB4MiAFANAANAIAFCAXwhASAOQwAAgL+SIQ4gAEJ/fCIAQgBSDQALCyAHQgdUDQEgAiABfSEAA0AgDkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kiEOIABCeHwiAEIAUg0ADAILCyABQn+FIAJ8IQcCQCACIAF9QgeDIgBQDQADQCABQgF8IQEgDkMAAIC/kiEOIABCf3wiAEIAUg0ACwsgB0IHVA0AIAIgAX0hAANAIA5DAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5IhDiAAQnh8IgBQRQ0ACwsgBiAOOAIADwsgAykDCCARQgOGQnh8IgB8IRIgAykDECAAfCEDA0AgEiEAIAMhBiARIQUgDyEEIAEhBwNAIAYpAwAgByAHIAApAwAiCIAiCSAIfn1+IAR8IQQgAEJ4fCEAIAZCeHwhBiAJIQcgBUJ/fCIFQgBSDQALIBAgBEIChnwiACAAKgIAQwAAgL+SOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEMOBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDDgYCAAAsgA0LgAHwkgICAgAAL0AsFCH4EfwF9AXwIfiAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLIAMgBUQAAAAAAADwvyAPuyIQIBCio7YQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEAIAMpAwAhByAEKQMAIQUCQCACIAF9QgGDUA0AIAcgAUIChiIIfEQAAAAAAADwvyAFIAh8KgIAuyIQIBCio7Y4AgAgAUIBfCEBCyAAQgAgAn1RDQEgAiABfSEIIAUgAUIChiIGfCEAIAcgBnwhBwNAIAdEAAAAAAAA8L8gACoCALsiECAQoqO2OAIAIAdCBHxEAAAAAAAA8L8gAEIEfCoCALsiECAQoqO2OAIAIABCCHwhACAHQgh8IQcgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IQACQCACIAF9QgGDUA0AIABEAAAAAAAA8L8gBCoCALsiECAQoqO2OAIAIAFCAXwhAQsgB0IAIAJ9UQ0CIAIgAX0hBwNAIABEAAAAAAAA8L8gBCoCALsiECAQoqO2OAIAIABEAAAAAAAA8L8gBCoCALsiECAQoqO2OAIAIAdCfnwiB1BFDQAMAwsLIAMpAwggEUIDhkJ4fCIAfCEWIAMpAxAgAHwhAwNARAAAAAAAAPC/IAQqAgC7IhAgEKKjIRAgFiEAIAMhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBMgBUIChnwgELY4AgAgAUIBfCIBIAJSDQAMAgsLIAQpAwggFkIDhkJ4fCIAfCEXIAQpAxAgAHwhGCARUCELIBFCf3xCA4YhBANAIBchACAYIQcgFiEGIBQhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0AC0QAAAAAAADwvyAVIAVCAoZ8KgIAuyIQIBCio7YhDyASIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByARIQYgEiEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyATIAVCAoZ8IA84AgAgAUIBfCIBIAJSDQALCwuJAgIBfgJ8I4CAgIAAQuAAfSIDJICAgIAAIANCEHxBAELQAPwLACADIAI4AiggAyABNwMgQgApA8jEhICAgICAgAAhASADIAA3AwggACkDICEAAkACQEIALQDAxISAgICAgIAARQ0AIAFCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBAJAIABQDQAgA0IIfEIAIAAQxYGAgAALEIGAgIAAIQVCAEIAKwPQxISAgICAgIAAIAUgBKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAAUA0AIANCCHxCACAAEMWBgIAACyADQuAAfCSAgICAAAv9DAUIfgR/An0BfAh+IAApAxghAwJAAkACQCAAKQMAIgQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAEKQMwIQUCQCAEKQMYIgZQDQAgBCkDCCAGQgOGIgd8Qnh8IQAgBCkDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBUIBhnwuAQAiC0H/B3EhDCALQYCAgIB4cSENAkAgC0H//wNxIg5BCnZBH3EiC0UNAAJAIAtBH0cNACANIA5BDXRyQYCAgPwHcr4hDwwECyALQRd0QYCAgMADaiANciAMQQ10cr4hDwwDCwJAIAxFDQBBgICAmAQgDGciC0EXdGsgDXIgDiALQWpqdEEOdEGAgP8DcXIhDQsgDb4hDwwCCyAEKQMAIAVCAYZ8LwEAQRB0viEPDAELIAQpAwAgBUIChnwqAgAhDwsgAykDMCEFAkAgAykDGCIGUA0AIAMpAwggBkIDhiIHfEJ4fCEAIAMpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IRAMBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IRAMAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IRAMAgsgAykDACAFQgGGfC8BAEEQdL4hEAwBCyADKQMAIAVCAoZ8KgIAIRALIAMgBSAQu0QAAAAAAADwvyAPuyIRIBGio6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAIgAX0hCCAEKQMAIAFCAoYiAHwhByADKQMAIAB8IQADQCAAIAAqAgC7RAAAAAAAAPC/IAcqAgC7IhEgEaKjoLY4AgAgB0IEfCEHIABCBHwhACAIQn98IghCAFINAAwCCwsgAiABWA0AIAMpAxghEiADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYCQCAEKQMYIhdCAFINACAWIBVCAoZ8IQQCQCASQgBSDQAgAUJ/hSEHIBQgE0IChnwiACoCACEPAkAgAiABfUIBg1ANACAAIA+7RAAAAAAAAPC/IAQqAgC7IhEgEaKjoLYiDzgCACABQgF8IQELIAdCACACfVENAiACIAF9IQcDQCAAIA+7RAAAAAAAAPA/IAQqAgC7IhEgEaKjobYiDzgCACAAIA+7RAAAAAAAAPA/IAQqAgC7IhEgEaKjobYiDzgCACAHQn58IgdQRQ0ADAMLCyADKQMIIBJCA4ZCeHwiAHwhFyADKQMQIAB8IQMDQCAEKgIAuyIRIBGiIREgFyEAIAMhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBQgBUIChnwiACAAKgIAu0QAAAAAAADwvyARo6C2OAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBdCA4ZCeHwiAHwhGCAEKQMQIAB8IRkgElAhCyASQn98QgOGIQQDQCAYIQAgGSEHIBchBiAVIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtEAAAAAAAA8D8gFiAFQgKGfCoCALsiESARoqMhESATIQUCQCALDQAgAykDCCAEfCEAIAMpAxAgBHwhByASIQYgEyEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyAUIAVCAoZ8IgAgACoCALsgEaG2OAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEMeBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDHgYCAAAsgA0LgAHwkgICAgAAL/AwECH4EfwF9CH4gACkDGCEDAkACQAJAIAApAwAiBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAQpAzAhBQJAIAQpAxgiBlANACAEKQMIIAZCA4YiB3xCeHwhACAEKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEPDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEPDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEPDAILIAQpAwAgBUIBhnwvAQBBEHS+IQ8MAQsgBCkDACAFQgKGfCoCACEPCyADKQMwIQUCQCADKQMYIgZQDQAgAykDCCAGQgOGIgd8Qnh8IQAgAykDECAHfEJ4fCEHIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALCyADIAVDAAAAAEMAAIA/IA9DAAAAAF0bEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UgAnwhCSADKQMAIQggBCkDACEFAkAgAiABfUIDgyIGUA0AIAUgAUIChiIHfCEAIAggB3whBwNAIAdDAAAAAEMAAIA/IAAqAgBDAAAAAF0bOAIAIABCBHwhACAHQgR8IQcgAUIBfCEBIAZCf3wiBkIAUg0ACwsgCUIDVA0BIAFCAoYhBiACIAF9IQkDQCAIIAZ8IgBDAAAAAEMAAIA/IAUgBnwiByoCAEMAAAAAXRs4AgAgAEIEfEMAAAAAQwAAgD8gB0IEfCoCAEMAAAAAXRs4AgAgAEIIfEMAAAAAQwAAgD8gB0IIfCoCAEMAAAAAXRs4AgAgAEIMfEMAAAAAQwAAgD8gB0IMfCoCAEMAAAAAXRs4AgAgBUIQfCEFIAhCEHwhCCAJQnx8IglCAFINAAwCCwsgAiABWA0AIAMpAxghECADKQMwIREgAykDACESIAQpAzAhEyAEKQMAIRQCQCAEKQMYIhVCAFINACAUIBNCAoZ8IQQCQCAQQgBSDQAgAUJ/hSACfCEIIBIgEUIChnwhAAJAIAIgAX1CA4MiB1ANAANAIABDAAAAAEMAAIA/IAQqAgBDAAAAAF0bOAIAIAFCAXwhASAHQn98IgdCAFINAAsLIAhCA1QNAiACIAF9IQcDQCAAQwAAAABDAACAPyAEKgIAQwAAAABdGzgCACAAQwAAAABDAACAPyAEKgIAQwAAAABdGzgCACAAQwAAAABDAACAPyAEKgIAQwAAAABdGzgCACAAQwAAAABDAACAPyAEKgIAQwAAAABdGzgCACAHQnx8IgdQRQ0ADAMLCyADKQMIIBBCA4ZCeHwiAHwhFSADKQMQIAB8IQMDQCAEKgIAIQ8gFSEAIAMhByAQIQYgESEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALIBIgBUIChnxDAAAAAEMAAIA/IA9DAAAAAF0bOAIAIAFCAXwiASACUg0ADAILCyAEKQMIIBVCA4ZCeHwiAHwhFiAEKQMQIAB8IRcgEFAhCyAQQn98QgOGIQQDQCAWIQAgFyEHIBUhBiATIQUgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAtDAAAAAEMAAIA/IBQgBUIChnwqAgBDAAAAAF0bIQ8gESEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgECEGIBEhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEiAFQgKGfCAPOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEMmBgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDJgYCAAAsgA0LgAHwkgICAgAAL1Q4FCH4EfwJ9CH4BfCAAKQMYIQMCQAJAAkAgACkDACIEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBCkDMCEFAkAgBCkDGCIGUA0AIAQpAwggBkIDhiIHfEJ4fCEAIAQpAxAgB3xCeHwhByABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAVCAYZ8LgEAIgtB/wdxIQwgC0GAgICAeHEhDQJAIAtB//8DcSIOQQp2QR9xIgtFDQACQCALQR9HDQAgDSAOQQ10ckGAgID8B3K+IQ8MBAsgC0EXdEGAgIDAA2ogDXIgDEENdHK+IQ8MAwsCQCAMRQ0AQYCAgJgEIAxnIgtBF3RrIA1yIA4gC0FqanRBDnRBgID/A3FyIQ0LIA2+IQ8MAgsgBCkDACAFQgGGfC8BAEEQdL4hDwwBCyAEKQMAIAVCAoZ8KgIAIQ8LIAMpAzAhBQJAIAMpAxgiBlANACADKQMIIAZCA4YiB3xCeHwhACADKQMQIAd8Qnh8IQcgASEIA0AgBykDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgB0J4fCEHIAohCCAGQn98IgZCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAFQgGGfC4BACILQf8HcSEMIAtBgICAgHhxIQ0CQCALQf//A3EiDkEKdkEfcSILRQ0AAkAgC0EfRw0AIA0gDkENdHJBgICA/AdyviEQDAQLIAtBF3RBgICAwANqIA1yIAxBDXRyviEQDAMLAkAgDEUNAEGAgICYBCAMZyILQRd0ayANciAOIAtBamp0QQ50QYCA/wNxciENCyANviEQDAILIAMpAwAgBUIBhnwvAQBBEHS+IRAMAQsgAykDACAFQgKGfCoCACEQCyADIAVEAAAAAAAAAABEAAAAAAAA8D8gD0MAAAAAXRsgELugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQAgAykDACEFIAQpAwAhBwJAIAIgAX1CAYNQDQAgBSABQgKGIgh8IgZEAAAAAAAAAABEAAAAAAAA8D8gByAIfCoCAEMAAAAAXRsgBioCALugtjgCACABQgF8IQELIABCACACfVENASACIAF9IQggByABQgKGIgB8IQcgBSAAfCEAA0AgAEQAAAAAAAAAAEQAAAAAAADwPyAHKgIAQwAAAABdGyAAKgIAu6C2OAIAIABCBHwiBUQAAAAAAAAAAEQAAAAAAADwPyAHQgR8KgIAQwAAAABdGyAFKgIAu6C2OAIAIAdCCHwhByAAQgh8IQAgCEJ+fCIIQgBSDQAMAgsLIAIgAVgNACADKQMYIREgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVAkAgBCkDGCIWQgBSDQAgFSAUQgKGfCEEAkAgEUIAUg0AIAFCf4UhByATIBJCAoZ8IgAqAgAhDwJAIAIgAX1CAYNQDQAgAEQAAAAAAAAAAEQAAAAAAADwPyAEKgIAQwAAAABdGyAPu6C2Ig84AgAgAUIBfCEBCyAHQgAgAn1RDQIgAiABfSEHA0AgAEQAAAAAAAAAAEQAAAAAAADwPyAEKgIAQwAAAABdGyAPu6C2Ig84AgAgAEQAAAAAAAAAAEQAAAAAAADwPyAEKgIAQwAAAABdGyAPu6C2Ig84AgAgB0J+fCIHUEUNAAwDCwsgAykDCCARQgOGQnh8IgB8IRYgAykDECAAfCEDA0AgBCoCACEPIBYhACADIQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACyATIAVCAoZ8IgBEAAAAAAAAAABEAAAAAAAA8D8gD0MAAAAAXRsgACoCALugtjgCACABQgF8IgEgAlINAAwCCwsgBCkDCCAWQgOGQnh8IgB8IRcgBCkDECAAfCEYIBFQIQsgEUJ/fEIDhiEEA0AgFyEAIBghByAWIQYgFCEFIAEhCANAIAcpAwAgCCAIIAApAwAiCYAiCiAJfn1+IAV8IQUgAEJ4fCEAIAdCeHwhByAKIQggBkJ/fCIGQgBSDQALRAAAAAAAAAAARAAAAAAAAPA/IBUgBUIChnwqAgBDAAAAAF0bIRkgEiEFAkAgCw0AIAMpAwggBHwhACADKQMQIAR8IQcgESEGIBIhBSABIQgDQCAHKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAHQnh8IQcgCiEIIAZCf3wiBkIAUg0ACwsgEyAFQgKGfCIAIBkgACoCALugtjgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDLgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQy4GAgAALIANC4AB8JICAgIAAC94MBQF9CH4EfwF9CH4gACoCICEDIAApAxghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgBCAGIANDAACAPyAQQwAAAABdGxCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAIgAVgNASABQn+FIAJ8IQogBCkDACEJIAUpAwAhBgJAIAIgAX1CA4MiB1ANACAGIAFCAoYiCHwhACAJIAh8IQgDQCAIIANDAACAPyAAKgIAQwAAAABdGzgCACAAQgR8IQAgCEIEfCEIIAFCAXwhASAHQn98IgdCAFINAAsLIApCA1QNASABQgKGIQcgAiABfSEKA0AgCSAHfCIAIANDAACAPyAGIAd8IggqAgBDAAAAAF0bOAIAIABCBHwgA0MAAIA/IAhCBHwqAgBDAAAAAF0bOAIAIABCCHwgA0MAAIA/IAhCCHwqAgBDAAAAAF0bOAIAIABCDHwgA0MAAIA/IAhCDHwqAgBDAAAAAF0bOAIAIAZCEHwhBiAJQhB8IQkgCkJ8fCIKQgBSDQAMAgsLIAIgAVgNACAEKQMYIREgBCkDMCESIAQpAwAhEyAFKQMwIRQgBSkDACEVAkAgBSkDGCIWQgBSDQAgFSAUQgKGfCEFAkAgEUIAUg0AIAFCf4UgAnwhCSATIBJCAoZ8IQACQCACIAF9QgODIghQDQADQCAAIANDAACAPyAFKgIAQwAAAABdGzgCACABQgF8IQEgCEJ/fCIIQgBSDQALCyAJQgNUDQIgAiABfSEIA0AgACADQwAAgD8gBSoCAEMAAAAAXRs4AgAgACADQwAAgD8gBSoCAEMAAAAAXRs4AgAgACADQwAAgD8gBSoCAEMAAAAAXRs4AgAgACADQwAAgD8gBSoCAEMAAAAAXRs4AgAgCEJ8fCIIUEUNAAwDCwsgBCkDCCARQgOGQnh8IgB8IRYgBCkDECAAfCEEA0AgBSoCACEQIBYhACAEIQggESEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACyATIAZCAoZ8IANDAACAPyAQQwAAAABdGzgCACABQgF8IgEgAlINAAwCCwsgBSkDCCAWQgOGQnh8IgB8IRcgBSkDECAAfCEYIBFQIQwgEUJ/fEIDhiEFA0AgFyEAIBghCCAWIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALIANDAACAPyAVIAZCAoZ8KgIAQwAAAABdGyEQIBIhBgJAIAwNACAEKQMIIAV8IQAgBCkDECAFfCEIIBEhByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC4kCAgF+AnwjgICAgABC4AB9IgMkgICAgAAgA0IQfEEAQtAA/AsAIAMgAjgCKCADIAE3AyBCACkDyMSEgICAgICAACEBIAMgADcDCCAAKQMgIQACQAJAQgAtAMDEhICAgICAgABFDQAgAUIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEEAkAgAFANACADQgh8QgAgABDNgYCAAAsQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIABQDQAgA0IIfEIAIAAQzYGAgAALIANC4AB8JICAgIAAC7IOBQF9CH4EfwJ9CH4gACoCICEDIAApAxghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAQgBiADQwAAgD8gEEMAAAAAXRsgEZIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACACIAFYDQEgAUJ/hSEAIAQpAwAhBiAFKQMAIQgCQCACIAF9QgGDUA0AIAYgAUIChiIJfCIHIAcqAgAgA0MAAIA/IAggCXwqAgBDAAAAAF0bkjgCACABQgF8IQELIABCACACfVENASACIAF9IQkgCCABQgKGIgB8IQggBiAAfCEAA0AgACAAKgIAIANDAACAPyAIKgIAQwAAAABdG5I4AgAgAEIEfCIGIAYqAgAgA0MAAIA/IAhCBHwqAgBDAAAAAF0bkjgCACAIQgh8IQggAEIIfCEAIAlCfnwiCUIAUg0ADAILCyACIAFYDQAgBCkDGCESIAQpAzAhEyAEKQMAIRQgBSkDMCEVIAUpAwAhFgJAIAUpAxgiF0IAUg0AIBYgFUIChnwhBQJAIBJCAFINACABQn+FIAJ8IQkgFCATQgKGfCIAKgIAIRACQCACIAF9QgODIghQDQADQCAAIANDAACAPyAFKgIAQwAAAABdGyAQkiIQOAIAIAFCAXwhASAIQn98IghCAFINAAsLIAlCA1QNAiACIAF9IQgDQCAAIANDAACAPyAFKgIAQwAAAABdGyAQkiIQOAIAIAAgA0MAAIA/IAUqAgBDAAAAAF0bIBCSIhA4AgAgACADQwAAgD8gBSoCAEMAAAAAXRsgEJIiEDgCACAAIANDAACAPyAFKgIAQwAAAABdGyAQkiIQOAIAIAhCfHwiCFBFDQAMAwsLIAQpAwggEkIDhkJ4fCIAfCEXIAQpAxAgAHwhBANAIAUqAgAhECAXIQAgBCEIIBIhByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsgFCAGQgKGfCIAIANDAACAPyAQQwAAAABdGyAAKgIAkjgCACABQgF8IgEgAlINAAwCCwsgBSkDCCAXQgOGQnh8IgB8IRggBSkDECAAfCEZIBJQIQwgEkJ/fEIDhiEFA0AgGCEAIBkhCCAXIQcgFSEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALIANDAACAPyAWIAZCAoZ8KgIAQwAAAABdGyEQIBMhBgJAIAwNACAEKQMIIAV8IQAgBCkDECAFfCEIIBIhByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAQIAAqAgCSOAIAIAFCAXwiASACUg0ACwsLiQICAX4CfCOAgICAAELgAH0iAySAgICAACADQhB8QQBC0AD8CwAgAyACOAIoIAMgATcDIEIAKQPIxISAgICAgIAAIQEgAyAANwMIIAApAyAhAAJAAkBCAC0AwMSEgICAgICAAEUNACABQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQCQCAAUA0AIANCCHxCACAAEM+BgIAACxCBgICAACEFQgBCACsD0MSEgICAgICAACAFIAShoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAFANACADQgh8QgAgABDPgYCAAAsgA0LgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCCgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADENGBgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDRgYCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQgoCAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ04GAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADENOBgIAACyAEQuAAfCSAgICAAAvUAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBK7EIOAgIAAthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ1YGAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADENWBgIAACyAEQuAAfCSAgICAAAvGBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASuxCDgICAACATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDXgYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ14GAgAALIARC4AB8JICAgIAAC9QDAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAYgErsQhICAgAC2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDZgYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ2YGAgAALIARC4AB8JICAgIAAC8YFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBK7EISAgIAAIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADENuBgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDbgYCAAAsgBELgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCFgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEN2BgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDdgYCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQhYCAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ34GAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEN+BgIAACyAEQuAAfCSAgICAAAvUAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBK7EIaAgIAAthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ4YGAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEOGBgIAACyAEQuAAfCSAgICAAAvGBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASuxCGgICAACATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDjgYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ44GAgAALIARC4AB8JICAgIAAC9QDAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAYgErsQh4CAgAC2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDlgYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ5YGAgAALIARC4AB8JICAgIAAC8YFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBK7EIeAgIAAIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEOeBgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDngYCAAAsgBELgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCIgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEOmBgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDpgYCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQiICAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ64GAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEOuBgIAACyAEQuAAfCSAgICAAAvUAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBK7EImAgIAAthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ7YGAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEO2BgIAACyAEQuAAfCSAgICAAAvGBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASuxCJgICAACATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDvgYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ74GAgAALIARC4AB8JICAgIAAC9QDAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAYgErsQioCAgAC2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDxgYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ8YGAgAALIARC4AB8JICAgIAAC8YFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBK7EIqAgIAAIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEPOBgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDzgYCAAAsgBELgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCLgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEPWBgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxD1gYCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQi4CAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ94GAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEPeBgIAACyAEQuAAfCSAgICAAAvUAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBK7EICAgIAAthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ+YGAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEPmBgIAACyAEQuAAfCSAgICAAAvGBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASuxCAgICAACATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxD7gYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ+4GAgAALIARC4AB8JICAgIAAC9QDAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAYgErsQjICAgAC2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxD9gYCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ/YGAgAALIARC4AB8JICAgIAAC8YFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBK7EIyAgIAAIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEP+BgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxD/gYCAAAsgBELgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCNgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEIGCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCBgoCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQjYCAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQg4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEIOCgIAACyAEQuAAfCSAgICAAAvvAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBJDAAAAv5RB37Pd+QUgErxBAXVrviISlCASlEMAAMA/kiASlBCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQhYKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEIWCgIAACyAEQuAAfCSAgICAAAvgBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASQwAAAL+UQd+z3fkFIBK8QQF1a74iEpQgEpRDAADAP5IgEpQgE5IQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEIeCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCHgoCAAAsgBELgAHwkgICAgAALzQMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASkRCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQiYKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEImCgIAACyAEQuAAfCSAgICAAAvBBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASu58gE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQi4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEIuCgIAACyAEQuAAfCSAgICAAAvNAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBKNEJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCNgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQjYKAgAALIARC4AB8JICAgIAAC74FAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBKNIBOSEJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCPgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQj4KAgAALIARC4AB8JICAgIAAC80DAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAYgEo4QlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEJGCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCRgoCAAAsgBELgAHwkgICAgAALvgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgEo4gE5IQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEJOCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCTgoCAAAsgBELgAHwkgICAgAALzQMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASixCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQlYKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEJWCgIAACyAEQuAAfCSAgICAAAu+BQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASiyATkhCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQl4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEJeCgIAACyAEQuAAfCSAgICAAAvcAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBJDAAAAAF4gEkMAAAAAXWuyEJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCZgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQmYKAgAALIARC4AB8JICAgIAAC80FAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBMgEkMAAAAAXiASQwAAAABda7KSEJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCbgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQm4KAgAALIARC4AB8JICAgIAAC80DAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAYgEowQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEJ2CgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCdgoCAAAsgBELgAHwkgICAgAALvQUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgEyASkxCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQn4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEJ+CgIAACyAEQuAAfCSAgICAAAvMAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBIQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEKGCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxChgoCAAAsgBELgAHwkgICAgAALvQUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgEiATkhCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQo4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEKOCgIAACyAEQuAAfCSAgICAAAvSAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGQwAAgD8gEpUQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEKWCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxClgoCAAAsgBELgAHwkgICAgAALygUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAZEAAAAAAAA8D8gErujIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEKeCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCngoCAAAsgBELgAHwkgICAgAAL0gMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASQwAAAACXEJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCpgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQqYKAgAALIARC4AB8JICAgIAAC8oFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBK7RAAAAAAAAAAApSATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCrgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQq4KAgAALIARC4AB8JICAgIAAC+YDBAF9C34EfwF9AkAgASACWg0AIAAqAiAhAyAAKQMYIQQgACkDACEFIAApAyhCeHwhBgNAIAQpAzAhByAFKQMwIQgCQCAEKQMYIglQDQAgBiAJQgOGIgp8IQAgBCkDCCAKfEJ4fCELIAQpAxAgCnxCeHwhCiABIQwDQCAKKQMAIAwgDCALKQMAIg2AIg4gDX59Igx+IAd8IQcgACkDACAMfiAIfCEIIAtCeHwhCyAAQnh8IQAgCkJ4fCEKIA4hDCAJQn98IglCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAIQgGGfC4BACIPQf8HcSEQIA9BgICAgHhxIRECQCAPQf//A3EiEkEKdkEfcSIPRQ0AAkAgD0EfRw0AIBEgEkENdHJBgICA/AdyviETDAQLIA9BF3RBgICAwANqIBFyIBBBDXRyviETDAMLAkAgEEUNAEGAgICYBCAQZyIPQRd0ayARciASIA9Bamp0QQ50QYCA/wNxciERCyARviETDAILIAUpAwAgCEIBhnwvAQBBEHS+IRMMAQsgBSkDACAIQgKGfCoCACETCyAEIAcgEyADQwAAgD8gE0MAAAAAXRuUEJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCtgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQrYKAgAALIARC4AB8JICAgIAAC9cFBAF9C34EfwJ9AkAgASACWg0AIAAqAiAhAyAAKQMYIQQgACkDACEFIAApAyhCeHwhBgNAIAQpAzAhByAFKQMwIQgCQCAEKQMYIglQDQAgBiAJQgOGIgp8IQAgBCkDCCAKfEJ4fCELIAQpAxAgCnxCeHwhCiABIQwDQCAKKQMAIAwgDCALKQMAIg2AIg4gDX59Igx+IAd8IQcgACkDACAMfiAIfCEIIAtCeHwhCyAAQnh8IQAgCkJ4fCEKIA4hDCAJQn98IglCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAIQgGGfC4BACIPQf8HcSEQIA9BgICAgHhxIRECQCAPQf//A3EiEkEKdkEfcSIPRQ0AAkAgD0EfRw0AIBEgEkENdHJBgICA/AdyviETDAQLIA9BF3RBgICAwANqIBFyIBBBDXRyviETDAMLAkAgEEUNAEGAgICYBCAQZyIPQRd0ayARciASIA9Bamp0QQ50QYCA/wNxciERCyARviETDAILIAUpAwAgCEIBhnwvAQBBEHS+IRMMAQsgBSkDACAIQgKGfCoCACETCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiD0H/B3EhECAPQYCAgIB4cSERAkAgD0H//wNxIhJBCnZBH3EiD0UNAAJAIA9BH0cNACARIBJBDXRyQYCAgPwHcr4hFAwECyAPQRd0QYCAgMADaiARciAQQQ10cr4hFAwDCwJAIBBFDQBBgICAmAQgEGciD0EXdGsgEXIgEiAPQWpqdEEOdEGAgP8DcXIhEQsgEb4hFAwCCyAEKQMAIAdCAYZ8LwEAQRB0viEUDAELIAQpAwAgB0IChnwqAgAhFAsgBCAHIBMgA0MAAIA/IBNDAAAAAF0blCAUkhCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQr4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEK+CgIAACyAEQuAAfCSAgICAAAvdAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGQwAAAABDAACAPyASQwAAAABdGxCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQsYKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADELGCgIAACyAEQuAAfCSAgICAAAvYBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBkQAAAAAAAAAAEQAAAAAAADwPyASQwAAAABdGyATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxCzgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQs4KAgAALIARC4AB8JICAgIAAC+kDAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAZEAAAAAAAA8D8gEoy7EIuAgIAARAAAAAAAAPA/oKO2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxC1goCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQtYKAgAALIARC4AB8JICAgIAAC9sFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGRAAAAAAAAPA/IBKMuxCLgICAAEQAAAAAAADwP6CjIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADELeCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxC3goCAAAsgBELgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCDgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADELmCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxC5goCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQg4CAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQu4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADELuCgIAACyAEQuAAfCSAgICAAAvVAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBK7EIKAgIAAtowQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEL2CgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxC9goCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgE7sgErsQgoCAgAChthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQv4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEL+CgIAACyAEQuAAfCSAgICAAAvlAwQLfgR/AX0BfAJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAZEAAAAAAAA8D8gErsQg4CAgAAiEyAToqO2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDBgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQwYKAgAALIARC4AB8JICAgIAAC9cFBAt+BH8CfQF8AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAZEAAAAAAAA8D8gErsQg4CAgAAiFCAUoqMgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQw4KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEMOCgIAACyAEQuAAfCSAgICAAAvqAwQLfgR/AX0BfAJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAZEAAAAAAAA8D9EAAAAAAAA8D8gErsiEyAToqGfo7YQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEMWCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDFgoCAAAsgBELgAHwkgICAgAAL3AUEC34EfwJ9AXwCQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBkQAAAAAAADwP0QAAAAAAADwPyASuyIUIBSioZ+jIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEMeCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDHgoCAAAsgBELgAHwkgICAgAAL6gMEC34EfwF9AXwCQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGRAAAAAAAAPC/RAAAAAAAAPA/IBK7IhMgE6Khn6O2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDJgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQyYKAgAALIARC4AB8JICAgIAAC9wFBAt+BH8CfQF8AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgE7tEAAAAAAAA8D9EAAAAAAAA8D8gErsiFCAUoqGfo6G2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDLgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQy4KAgAALIARC4AB8JICAgIAAC+kDBAt+BH8BfQF8AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBkQAAAAAAADwPyASuyITIBOiRAAAAAAAAPA/oKO2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDNgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQzYKAgAALIARC4AB8JICAgIAAC9sFBAt+BH8CfQF8AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAZEAAAAAAAA8D8gErsiFCAUokQAAAAAAADwP6CjIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEM+CgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDPgoCAAAsgBELgAHwkgICAgAAL1AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASuxCJgICAALYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADENGCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDRgoCAAAsgBELgAHwkgICAgAALxgUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgErsQiYCAgAAgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ04KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADENOCgIAACyAEQuAAfCSAgICAAAvUAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGIBK7EIiAgIAAthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ1YKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADENWCgIAACyAEQuAAfCSAgICAAAvGBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiASuxCIgICAACATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDXgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ14KAgAALIARC4AB8JICAgIAAC+UDBAt+BH8BfQF8AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBkQAAAAAAADwPyASuxCKgICAACITIBOiobYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADENmCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDZgoCAAAsgBELgAHwkgICAgAAL1wUEC34EfwJ9AXwCQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBkQAAAAAAADwPyASuxCKgICAACIUIBSioSATu6C2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDbgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ24KAgAALIARC4AB8JICAgIAAC9IDAwt+BH8BfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCyADIAZDAACAPyASlRCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ3YKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEN2CgIAACyAEQuAAfCSAgICAAAvKBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBkQAAAAAAADwPyASu6MgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ34KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEN+CgIAACyAEQuAAfCSAgICAAAviAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGRAAAAAAAAPA/IBK7RO85+v5CLuY/oqO2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDhgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ4YKAgAALIARC4AB8JICAgIAAC9QFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGRAAAAAAAAPA/IBK7RO85+v5CLuY/oqMgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ44KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEOOCgIAACyAEQuAAfCSAgICAAAviAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGRAAAAAAAAPA/IBK7RBZVtbuxawJAoqO2EJSAgIAAIAFCAXwiASACUg0ACwsL7gMCCX4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyABKQMYIgVCA4YiBkIPfEJwg30iBySAgICAAAJAIAVQDQAgACkDGCIIQn98IQkgBiAHfEJ4fCEDIAhCA4ZCeHwhCCAFIQYDQCAGIgpCf3whBkIAIQsCQCAFIAkgCnxWDQBCACELIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQsLIAMgCzcDACADQnh8IQMgCEJ4fCEIIAZCAFINAAsLIARCGHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDECAEIAA3AwggBEIANwM4IAQgBzcDMCAEIAI4AihCACkDyMSEgICAgICAACEGIAQgATcDICABKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgBkIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgA1ANACAEQgh8QgAgAxDlgoCAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQ5YKAgAALIARC4AB8JICAgIAAC9QFAwt+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGRAAAAAAAAPA/IBK7RBZVtbuxawJAoqMgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ54KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEOeCgIAACyAEQuAAfCSAgICAAAvnAwMLfgR/AX0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGRAAAAAAAAOC/IBK7RAAAAAAAAPg/EI6AgIAAo7YQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEOmCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDpgoCAAAsgBELgAHwkgICAgAAL2QUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAYgE7tEAAAAAAAA4L8gErtEAAAAAAAA+D8QjoCAgACjoLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEOuCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDrgoCAAAsgBELgAHwkgICAgAAL2QMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBkQAAAAAAADgPyASu5+jthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ7YKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEO2CgIAACyAEQuAAfCSAgICAAAvLBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBkQAAAAAAADgPyASu5+jIBO7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEO+CgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxDvgoCAAAsgBELgAHwkgICAgAAL3AMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBiASQwAAAABeIBJDAAAAAF1rshCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ8YKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEPGCgIAACyAEQuAAfCSAgICAAAvNBQMLfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRMMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRMMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRMMAgsgAykDACAGQgGGfC8BAEEQdL4hEwwBCyADKQMAIAZCAoZ8KgIAIRMLIAMgBiATIBJDAAAAAF4gEkMAAAAAXWuykhCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ84KAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEPOCgIAACyAEQuAAfCSAgICAAAvcCAUCfgF8C34BfAF+IAEpAyAhAyABKQMYIQQCQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIANQDQAgASkDUCEGIAEpAzAhBAJAIAEpAxgiB0IAUg0AAkAgBkJ/fCIGQgFWDQACQAJAIAanDgIAAQALIAEpAwAgBEIBhnxBgPgCOwEADAMLIAEpAwAgBEIBhnxBgP8COwEADAILIAEpAwAgBEIChnxBgICA/Hs2AgAMAQsgASkDECEIIAEpAwghCQJAIAZCf3wiBkIBVg0AAkACQCAGpw4CAAEACyAJIAdCA4ZCeHwiBnwhCiAIIAZ8IQsgASkDACEMQgAhAQNAIAohBiALIQggByENIAQhDiABIQkDQCAIKQMAIAkgCSAGKQMAIg+AIhAgD359fiAOfCEOIAZCeHwhBiAIQnh8IQggECEJIA1Cf3wiDUIAUg0ACyAMIA5CAYZ8QYD4AjsBACABQgF8IgEgA1INAAwDCwsgCSAHQgOGQnh8IgZ8IQogCCAGfCELIAEpAwAhDEIAIQEDQCAKIQYgCyEIIAchDSAEIQ4gASEJA0AgCCkDACAJIAkgBikDACIPgCIQIA9+fX4gDnwhDiAGQnh8IQYgCEJ4fCEIIBAhCSANQn98Ig1CAFINAAsgDCAOQgGGfEGA/wI7AQAgAUIBfCIBIANSDQAMAgsLIAkgB0IDhkJ4fCIGfCEKIAggBnwhCyABKQMAIQxCACEBA0AgCiEGIAshCCAHIQ0gBCEOIAEhCQNAIAgpAwAgCSAJIAYpAwAiD4AiECAPfn1+IA58IQ4gBkJ4fCEGIAhCeHwhCCAQIQkgDUJ/fCINQgBSDQALIAwgDkIChnxBgICA/Hs2AgAgAUIBfCIBIANSDQALCxCBgICAACERQgBCACsD0MSEgICAgICAACARIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAPCwJAIANQDQAgASkDUCEKIAEpAzAhCwJAIARCAFINAAJAIApCf3wiBkIBVg0AAkACQCAGpw4CAAEACyABKQMAIAtCAYZ8QYD4AjsBAA8LIAEpAwAgC0IBhnxBgP8COwEADwsgASkDACALQgKGfEGAgID8ezYCAA8LIAEpAwggBEIDhkJ4fCIGfCEMIAEpAxAgBnwhEkIAIQcDQCAMIQYgEiEIIAQhDSALIQ4gByEJA0AgCCkDACAJIAkgBikDACIPgCIQIA9+fX4gDnwhDiAGQnh8IQYgCEJ4fCEIIBAhCSANQn98Ig1CAFINAAsCQAJAIApCf3wiBkIBVg0AAkACQCAGpw4CAAEACyABKQMAIA5CAYZ8QYD4AjsBAAwCCyABKQMAIA5CAYZ8QYD/AjsBAAwBCyABKQMAIA5CAoZ8QYCAgPx7NgIACyAHQgF8IgcgA1INAAsLC50DAwd+BH8BfQJAIAEgAloNACAAKQMYIQMDQCADKQMwIQQCQCADKQMYIgVQDQAgAykDCCAFQgOGIgZ8Qnh8IQAgAykDECAGfEJ4fCEGIAEhBwNAIAYpAwAgByAHIAApAwAiCIAiCSAIfn1+IAR8IQQgAEJ4fCEAIAZCeHwhBiAJIQcgBUJ/fCIFQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBEIBhnwuAQAiCkH/B3EhCyAKQYCAgIB4cSEMAkAgCkH//wNxIg1BCnZBH3EiCkUNAAJAIApBH0cNACAMIA1BDXRyQYCAgPwHcr4hDgwECyAKQRd0QYCAgMADaiAMciALQQ10cr4hDgwDCwJAIAtFDQBBgICAmAQgC2ciCkEXdGsgDHIgDSAKQWpqdEEOdEGAgP8DcXIhDAsgDL4hDgwCCyADKQMAIARCAYZ8LwEAQRB0viEODAELIAMpAwAgBEIChnwqAgAhDgsgAyAEIA5DAACAv5IQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEPaCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxD2goCAAAsgBELgAHwkgICAgAAL3wMEC34EfwF9AXwCQCABIAJaDQAgACkDGCEDIAApAwAhBCAAKQMoQnh8IQUDQCADKQMwIQYgBCkDMCEHAkAgAykDGCIIUA0AIAUgCEIDhiIJfCEAIAMpAwggCXxCeHwhCiADKQMQIAl8Qnh8IQkgASELA0AgCSkDACALIAsgCikDACIMgCINIAx+fSILfiAGfCEGIAApAwAgC34gB3whByAKQnh8IQogAEJ4fCEAIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyAEKQMAIAdCAYZ8LwEAQRB0viESDAELIAQpAwAgB0IChnwqAgAhEgsgAyAGRAAAAAAAAPC/IBK7IhMgE6KjthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ+IKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEPiCgIAACyAEQuAAfCSAgICAAAvRBQQLfgR/An0BfAJAIAEgAloNACAAKQMYIQMgACkDACEEIAApAyhCeHwhBQNAIAMpAzAhBiAEKQMwIQcCQCADKQMYIghQDQAgBSAIQgOGIgl8IQAgAykDCCAJfEJ4fCEKIAMpAxAgCXxCeHwhCSABIQsDQCAJKQMAIAsgCyAKKQMAIgyAIg0gDH59Igt+IAZ8IQYgACkDACALfiAHfCEHIApCeHwhCiAAQnh8IQAgCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviESDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviESDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviESDAILIAQpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBCkDACAHQgKGfCoCACESCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEwwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEwwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEwwCCyADKQMAIAZCAYZ8LwEAQRB0viETDAELIAMpAwAgBkIChnwqAgAhEwsgAyAGIBO7RAAAAAAAAPC/IBK7IhQgFKKjoLYQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEPqCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxD6goCAAAsgBELgAHwkgICAgAAL3QMDC34EfwF9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILIAMgBkMAAAAAQwAAgD8gEkMAAAAAXRsQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEPyCgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxD8goCAAAsgBELgAHwkgICAgAAL2AUDC34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMAIQQgACkDKEJ4fCEFA0AgAykDMCEGIAQpAzAhBwJAIAMpAxgiCFANACAFIAhCA4YiCXwhACADKQMIIAl8Qnh8IQogAykDECAJfEJ4fCEJIAEhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn0iC34gBnwhBiAAKQMAIAt+IAd8IQcgCkJ4fCEKIABCeHwhACAJQnh8IQkgDSELIAhCf3wiCEIAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg5B/wdxIQ8gDkGAgICAeHEhEAJAIA5B//8DcSIRQQp2QR9xIg5FDQACQCAOQR9HDQAgECARQQ10ckGAgID8B3K+IRIMBAsgDkEXdEGAgIDAA2ogEHIgD0ENdHK+IRIMAwsCQCAPRQ0AQYCAgJgEIA9nIg5BF3RrIBByIBEgDkFqanRBDnRBgID/A3FyIRALIBC+IRIMAgsgBCkDACAHQgGGfC8BAEEQdL4hEgwBCyAEKQMAIAdCAoZ8KgIAIRILAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviETDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviETDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviETDAILIAMpAwAgBkIBhnwvAQBBEHS+IRMMAQsgAykDACAGQgKGfCoCACETCyADIAZEAAAAAAAAAABEAAAAAAAA8D8gEkMAAAAAXRsgE7ugthCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQ/oKAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEP6CgIAACyAEQuAAfCSAgICAAAvjAwQBfQt+BH8BfQJAIAEgAloNACAAKgIgIQMgACkDGCEEIAApAwAhBSAAKQMoQnh8IQYDQCAEKQMwIQcgBSkDMCEIAkAgBCkDGCIJUA0AIAYgCUIDhiIKfCEAIAQpAwggCnxCeHwhCyAEKQMQIAp8Qnh8IQogASEMA0AgCikDACAMIAwgCykDACINgCIOIA1+fSIMfiAHfCEHIAApAwAgDH4gCHwhCCALQnh8IQsgAEJ4fCEAIApCeHwhCiAOIQwgCUJ/fCIJQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgCEIBhnwuAQAiD0H/B3EhECAPQYCAgIB4cSERAkAgD0H//wNxIhJBCnZBH3EiD0UNAAJAIA9BH0cNACARIBJBDXRyQYCAgPwHcr4hEwwECyAPQRd0QYCAgMADaiARciAQQQ10cr4hEwwDCwJAIBBFDQBBgICAmAQgEGciD0EXdGsgEXIgEiAPQWpqdEEOdEGAgP8DcXIhEQsgEb4hEwwCCyAFKQMAIAhCAYZ8LwEAQRB0viETDAELIAUpAwAgCEIChnwqAgAhEwsgBCAHIANDAACAPyATQwAAAABdGxCUgICAACABQgF8IgEgAlINAAsLC+4DAgl+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgASkDGCIFQgOGIgZCD3xCcIN9IgckgICAgAACQCAFUA0AIAApAxgiCEJ/fCEJIAYgB3xCeHwhAyAIQgOGQnh8IQggBSEGA0AgBiIKQn98IQZCACELAkAgBSAJIAp8Vg0AQgAhCyAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACELCyADIAs3AwAgA0J4fCEDIAhCeHwhCCAGQgBSDQALCyAEQhh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AxAgBCAANwMIIARCADcDOCAEIAc3AzAgBCACOAIoQgApA8jEhICAgICAgAAhBiAEIAE3AyAgASkDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAZCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIANQDQAgBEIIfEIAIAMQgIOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEICDgIAACyAEQuAAfCSAgICAAAvUBQQBfQt+BH8CfQJAIAEgAloNACAAKgIgIQMgACkDGCEEIAApAwAhBSAAKQMoQnh8IQYDQCAEKQMwIQcgBSkDMCEIAkAgBCkDGCIJUA0AIAYgCUIDhiIKfCEAIAQpAwggCnxCeHwhCyAEKQMQIAp8Qnh8IQogASEMA0AgCikDACAMIAwgCykDACINgCIOIA1+fSIMfiAHfCEHIAApAwAgDH4gCHwhCCALQnh8IQsgAEJ4fCEAIApCeHwhCiAOIQwgCUJ/fCIJQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgCEIBhnwuAQAiD0H/B3EhECAPQYCAgIB4cSERAkAgD0H//wNxIhJBCnZBH3EiD0UNAAJAIA9BH0cNACARIBJBDXRyQYCAgPwHcr4hEwwECyAPQRd0QYCAgMADaiARciAQQQ10cr4hEwwDCwJAIBBFDQBBgICAmAQgEGciD0EXdGsgEXIgEiAPQWpqdEEOdEGAgP8DcXIhEQsgEb4hEwwCCyAFKQMAIAhCAYZ8LwEAQRB0viETDAELIAUpAwAgCEIChnwqAgAhEwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAdCAYZ8LgEAIg9B/wdxIRAgD0GAgICAeHEhEQJAIA9B//8DcSISQQp2QR9xIg9FDQACQCAPQR9HDQAgESASQQ10ckGAgID8B3K+IRQMBAsgD0EXdEGAgIDAA2ogEXIgEEENdHK+IRQMAwsCQCAQRQ0AQYCAgJgEIBBnIg9BF3RrIBFyIBIgD0FqanRBDnRBgID/A3FyIRELIBG+IRQMAgsgBCkDACAHQgGGfC8BAEEQdL4hFAwBCyAEKQMAIAdCAoZ8KgIAIRQLIAQgByADQwAAgD8gE0MAAAAAXRsgFJIQlICAgAAgAUIBfCIBIAJSDQALCwvuAwIJfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAEpAxgiBUIDhiIGQg98QnCDfSIHJICAgIAAAkAgBVANACAAKQMYIghCf3whCSAGIAd8Qnh8IQMgCEIDhkJ4fCEIIAUhBgNAIAYiCkJ/fCEGQgAhCwJAIAUgCSAKfFYNAEIAIQsgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhCwsgAyALNwMAIANCeHwhAyAIQnh8IQggBkIAUg0ACwsgBEIYfEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMQIAQgADcDCCAEQgA3AzggBCAHNwMwIAQgAjgCKEIAKQPIxISAgICAgIAAIQYgBCABNwMgIAEpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAGQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCADUA0AIARCCHxCACADEIKDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCCg4CAAAsgBELgAHwkgICAgAALsgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFrsQgoCAgAAgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEISDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCEg4CAAAsgA0LgAHwkgICAgAALlwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLsQgoCAgAAgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQhoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEIaDgIAACyADQuAAfCSAgICAAAuyBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAWuxCDgICAACAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQiIOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEIiDgIAACyADQuAAfCSAgICAAAuXBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyAYuxCDgICAACATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCKg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQioOAgAALIANC4AB8JICAgIAAC7IGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBa7EISAgIAAIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCMg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQjIOAgAALIANC4AB8JICAgIAAC5cHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBi7EISAgIAAIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEI6DgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCOg4CAAAsgA0LgAHwkgICAgAALsgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFrsQhYCAgAAgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEJCDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCQg4CAAAsgA0LgAHwkgICAgAALlwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLsQhYCAgAAgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQkoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEJKDgIAACyADQuAAfCSAgICAAAuyBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAWuxCGgICAACAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQlIOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEJSDgIAACyADQuAAfCSAgICAAAuXBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyAYuxCGgICAACATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCWg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQloOAgAALIANC4AB8JICAgIAAC7IGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBa7EIeAgIAAIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCYg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQmIOAgAALIANC4AB8JICAgIAAC5cHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBi7EIeAgIAAIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEJqDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCag4CAAAsgA0LgAHwkgICAgAALsgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFrsQiICAgAAgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEJyDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCcg4CAAAsgA0LgAHwkgICAgAALlwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLsQiICAgAAgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQnoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEJ6DgIAACyADQuAAfCSAgICAAAuyBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAWuxCJgICAACAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQoIOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEKCDgIAACyADQuAAfCSAgICAAAuXBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyAYuxCJgICAACATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCig4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQooOAgAALIANC4AB8JICAgIAAC7IGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBa7EIqAgIAAIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCkg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQpIOAgAALIANC4AB8JICAgIAAC5cHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBi7EIqAgIAAIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEKaDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCmg4CAAAsgA0LgAHwkgICAgAALsgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFrsQi4CAgAAgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEKiDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCog4CAAAsgA0LgAHwkgICAgAALlwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLsQi4CAgAAgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQqoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEKqDgIAACyADQuAAfCSAgICAAAuyBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAWuxCAgICAACAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQrIOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEKyDgIAACyADQuAAfCSAgICAAAuXBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyAYuxCAgICAACATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCug4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQroOAgAALIANC4AB8JICAgIAAC7IGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBa7EIyAgIAAIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCwg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQsIOAgAALIANC4AB8JICAgIAAC5cHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBi7EIyAgIAAIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGELKDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCyg4CAAAsgA0LgAHwkgICAgAALsgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFrsQjYCAgAAgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGELSDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhC0g4CAAAsgA0LgAHwkgICAgAALlwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLsQjYCAgAAgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQtoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGELaDgIAACyADQuAAfCSAgICAAAvMBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAUIBZDAAAAv5RB37Pd+QUgFrxBAXVrviIWlCAWlEMAAMA/kiAWlJIhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhC4g4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQuIOAgAALIANC4AB8JICAgIAAC7EHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBMgGEMAAAC/lEHfs935BSAYvEEBdWu+IhiUIBiUQwAAwD+SIBiUkiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQuoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGELqDgIAACyADQuAAfCSAgICAAAutBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAWu58gFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGELyDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhC8g4CAAAsgA0LgAHwkgICAgAALkgcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLufIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEL6DgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhC+g4CAAAsgA0LgAHwkgICAgAALqgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFCAWjZIhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDAg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQwIOAgAALIANC4AB8JICAgIAAC48HCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBMgGI2SIRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDCg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQwoOAgAALIANC4AB8JICAgIAAC6oGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBQgFo6SIRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQxIOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEMSDgIAACyADQuAAfCSAgICAAAuPBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyATIBiOkiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQxoOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEMaDgIAACyADQuAAfCSAgICAAAuqBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAUIBaLkiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEMiDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDIg4CAAAsgA0LgAHwkgICAgAALjwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgEyAYi5IhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEMqDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDKg4CAAAsgA0LgAHwkgICAgAALuQYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFCAWQwAAAABeIBZDAAAAAF1rspIhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDMg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQzIOAgAALIANC4AB8JICAgIAAC54HCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBMgGEMAAAAAXiAYQwAAAABda7KSIRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDOg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQzoOAgAALIANC4AB8JICAgIAAC6kGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBQgFpMhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDQg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQ0IOAgAALIANC4AB8JICAgIAAC44HCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBMgGJMhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGENKDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDSg4CAAAsgA0LgAHwkgICAgAALqQYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFCAWkiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGENSDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDUg4CAAAsgA0LgAHwkgICAgAALjgcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgEyAYkiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQ1oOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGENaDgIAACyADQuAAfCSAgICAAAu2BgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWC0QAAAAAAADwPyAWu6MgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGENiDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDYg4CAAAsgA0LgAHwkgICAgAALmwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAtEAAAAAAAA8D8gGLujIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGENqDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDag4CAAAsgA0LgAHwkgICAgAALrwYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFCAWQwAAAACXkiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGENyDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDcg4CAAAsgA0LgAHwkgICAgAALlAcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgEyAYQwAAAACXkiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQ3oOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEN6DgIAACyADQuAAfCSAgICAAAvFBg0DfgJ/BH4BfQJ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACoCICEMIAApAwAhDSAAKQNAIg6nIg9Bf2oiB61CA4YhEANAIAMpAzAhESANKQMwIRICQCADKAIYIgZBf2oiE0F/TA0AIAMpAwggE60iCUIDhiIIfCEAIAMpAxAgCHwhCCANKQMQIA4gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiARfCERIAkpAwAgBX4gEnwhEiAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyANKQNQIRRDAAAAACEVQgAhFgNAIBIhBQJAIAdBf0wNACANKQMIIBB8IQAgDSkDECAQfCEIIA8hBiAWIQkgEiEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDSkDACAFQgGGfC8BAEEQdL4hFwwCCyANKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRMCQAJAAkAgBkH//wNxIhhBCnZBH3EiGUEfRg0AIAZB/wdxIQYgGQ0BIAZFDQJBgICAmAQgBmciBkEXdGsgE3IgGCAGQWpqdEEOdEGAgP8DcXK+IRcMBAsgEyAYQQ10ckGAgID8B3K+IRcMAwsgGUEXdEGAgIDAA2ogE3IgBkENdHIhEwsgE74hFwwBCyANKQMAIAVCAoZ8KgIAIRcLIBUgFyAMQwAAgD8gF0MAAAAAXRuUkiEVIBZCAXwiFiAEUg0ACyADIBEgFRCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEOCDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDgg4CAAAsgA0LgAHwkgICAgAALqAcKAX0EfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACoCICEDIAApA0ghBCAAKQMYIQUgACkDACEGIAApA0AiB6ciCEF/aiIJrUIDhiEKA0AgBSkDMCELIAYpAzAhDAJAIAUoAhgiDUF/aiIOQQBIDQAgBSkDECAOrSIPQgOGIhB8IQAgBSkDCCAQfCEQIAYpAxAgByAPfEIDhnwhDyABIREDQCAAKQMAIBEgESAQKQMAIhKAIhMgEn59IhF+IAt8IQsgDykDACARfiAMfCEMIABCeHwhACAPQnh8IQ8gEEJ4fCEQIBMhESANQX9qIg1BAEoNAAsLAkACQCAEUEUNAEMAAAAAIRQMAQsgBikDUCEVQwAAAAAhFEIAIRYDQCAMIRECQCAJQQBIDQAgBikDECAKfCEAIAYpAwggCnwhECAIIQ0gFiEPIAwhEQNAIAApAwAgDyAPIBApAwAiEoAiEyASfn1+IBF8IREgAEJ4fCEAIBBCeHwhECATIQ8gDUF/aiINQQBKDQALCwJAAkAgFUJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAYpAwAgEUIBhnwuAQAiDUH/B3EhFyANQYCAgIB4cSEOAkAgDUH//wNxIhhBCnZBH3EiDUUNAAJAIA1BH0cNACAOIBhBDXRyQYCAgPwHcr4hGQwECyANQRd0QYCAgMADaiAOciAXQQ10cr4hGQwDCwJAIBdFDQBBgICAmAQgF2ciDUEXdGsgDnIgGCANQWpqdEEOdEGAgP8DcXIhDgsgDr4hGQwCCyAGKQMAIBFCAYZ8LwEAQRB0viEZDAELIAYpAwAgEUIChnwqAgAhGQsgFCAZIANDAACAPyAZQwAAAABdG5SSIRQgFkIBfCIWIARSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgC0IBhnwuAQAiDUH/B3EhFyANQYCAgIB4cSEOAkAgDUH//wNxIhhBCnZBH3EiDUUNAAJAIA1BH0cNACAOIBhBDXRyQYCAgPwHcr4hGQwECyANQRd0QYCAgMADaiAOciAXQQ10cr4hGQwDCwJAIBdFDQBBgICAmAQgF2ciDUEXdGsgDnIgGCANQWpqdEEOdEGAgP8DcXIhDgsgDr4hGQwCCyAFKQMAIAtCAYZ8LwEAQRB0viEZDAELIAUpAwAgC0IChnwqAgAhGQsgBSALIBQgGZIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDig4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQ4oOAgAALIANC4AB8JICAgIAAC7oGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBRDAAAAAEMAAIA/IBZDAAAAAF0bkiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEOSDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDkg4CAAAsgA0LgAHwkgICAgAALnwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgE0MAAAAAQwAAgD8gGEMAAAAAXRuSIRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDmg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQ5oOAgAALIANC4AB8JICAgIAAC8cGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLRAAAAAAAAPA/IBaMuxCLgICAAEQAAAAAAADwP6CjIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDog4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQ6IOAgAALIANC4AB8JICAgIAAC6wHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLRAAAAAAAAPA/IBiMuxCLgICAAEQAAAAAAADwP6CjIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEOqDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDqg4CAAAsgA0LgAHwkgICAgAALsgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgsgFrsQg4CAgAAgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEOyDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhDsg4CAAAsgA0LgAHwkgICAgAALlwcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgGLsQg4CAgAAgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQ7oOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEO6DgIAACyADQuAAfCSAgICAAAuyBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAUuyAWuxCCgICAAKG2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQ8IOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEPCDgIAACyADQuAAfCSAgICAAAuXBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyATuyAYuxCCgICAAKG2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhDyg4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQ8oOAgAALIANC4AB8JICAgIAAC8MGDAN+An8GfgF/A34BfwF+AX0BfgF9An8BfAJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgtEAAAAAAAA8D8gFrsQg4CAgAAiGSAZoqMgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEPSDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhD0g4CAAAsgA0LgAHwkgICAgAALqAcKBH4CfwN+An8FfgF9An4CfwF9AXwCQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYC0QAAAAAAADwPyAYuxCDgICAACIZIBmioyATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhD2g4CAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQ9oOAgAALIANC4AB8JICAgIAAC8gGDAN+An8GfgF/A34BfwF+AX0BfgF9An8BfAJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgtEAAAAAAAA8D9EAAAAAAAA8D8gFrsiGSAZoqGfoyAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQ+IOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEPiDgIAACyADQuAAfCSAgICAAAutBwoEfgJ/A34CfwV+AX0CfgJ/AX0BfAJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLRAAAAAAAAPA/RAAAAAAAAPA/IBi7IhkgGaKhn6MgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQ+oOAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEPqDgIAACyADQuAAfCSAgICAAAvIBgwDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AXwCQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBS7RAAAAAAAAPA/RAAAAAAAAPA/IBa7IhkgGaKhn6OhtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEPyDgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhD8g4CAAAsgA0LgAHwkgICAgAALrQcKBH4CfwN+An8FfgF9An4CfwF9AXwCQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyATu0QAAAAAAADwP0QAAAAAAADwPyAYuyIZIBmioZ+jobYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEP6DgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhD+g4CAAAsgA0LgAHwkgICAgAALxwYMA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwF8AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWC0QAAAAAAADwPyAWuyIZIBmiRAAAAAAAAPA/oKMgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEICEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCAhICAAAsgA0LgAHwkgICAgAALrAcKBH4CfwN+An8FfgF9An4CfwF9AXwCQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYC0QAAAAAAADwPyAYuyIZIBmiRAAAAAAAAPA/oKMgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQgoSAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEIKEgIAACyADQuAAfCSAgICAAAuyBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAWuxCJgICAACAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQhISAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEISEgIAACyADQuAAfCSAgICAAAuXBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyAYuxCJgICAACATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCGhICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQhoSAgAALIANC4AB8JICAgIAAC7IGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBa7EIiAgIAAIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCIhICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQiISAgAALIANC4AB8JICAgIAAC5cHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLIBi7EIiAgIAAIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEIqEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCKhICAAAsgA0LgAHwkgICAgAALwwYMA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwF8AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWC0QAAAAAAADwPyAWuxCKgICAACIZIBmioSAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQjISAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEIyEgIAACyADQuAAfCSAgICAAAuoBwoEfgJ/A34CfwV+AX0CfgJ/AX0BfAJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLRAAAAAAAAPA/IBi7EIqAgIAAIhkgGaKhIBO7oLYhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEI6EgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCOhICAAAsgA0LgAHwkgICAgAALtgYLA34CfwZ+AX8DfgF/AX4BfQF+AX0CfwJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDACEMIAApA0AiDaciDkF/aiIHrUIDhiEPA0AgAykDMCEQIAwpAzAhEQJAIAMoAhgiBkF/aiISQX9MDQAgAykDCCASrSIJQgOGIgh8IQAgAykDECAIfCEIIAwpAxAgDSAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBB8IRAgCSkDACAFfiARfCERIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIAwpA1AhE0MAAAAAIRRCACEVA0AgESEFAkAgB0F/TA0AIAwpAwggD3whACAMKQMQIA98IQggDiEGIBUhCSARIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBNCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIAVCAYZ8LwEAQRB0viEWDAILIAwpAwAgBUIBhnwuAQAiBkGAgICAeHEhEgJAAkACQCAGQf//A3EiF0EKdkEfcSIYQR9GDQAgBkH/B3EhBiAYDQEgBkUNAkGAgICYBCAGZyIGQRd0ayASciAXIAZBamp0QQ50QYCA/wNxcr4hFgwECyASIBdBDXRyQYCAgPwHcr4hFgwDCyAYQRd0QYCAgMADaiASciAGQQ10ciESCyASviEWDAELIAwpAwAgBUIChnwqAgAhFgtEAAAAAAAA8D8gFrujIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCQhICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQkISAgAALIANC4AB8JICAgIAAC5sHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLRAAAAAAAAPA/IBi7oyATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCShICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQkoSAgAALIANC4AB8JICAgIAAC8AGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLRAAAAAAAAPA/IBa7RO85+v5CLuY/oqMgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEJSEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCUhICAAAsgA0LgAHwkgICAgAALpQcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAtEAAAAAAAA8D8gGLtE7zn6/kIu5j+ioyATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCWhICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQloSAgAALIANC4AB8JICAgIAAC8AGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLRAAAAAAAAPA/IBa7RBZVtbuxawJAoqMgFLugtiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEJiEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCYhICAAAsgA0LgAHwkgICAgAALpQcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAtEAAAAAAAA8D8gGLtEFlW1u7FrAkCioyATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCahICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQmoSAgAALIANC4AB8JICAgIAAC8UGCwN+An8GfgF/A34BfwF+AX0BfgF9An8CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBS7RAAAAAAAAOC/IBa7RAAAAAAAAPg/EI6AgIAAo6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQnISAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEJyEgIAACyADQuAAfCSAgICAAAuqBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYCyATu0QAAAAAAADgvyAYu0QAAAAAAAD4PxCOgICAAKOgtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQnoSAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEJ6EgIAACyADQuAAfCSAgICAAAu3BgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWC0QAAAAAAADgPyAWu5+jIBS7oLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCghICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQoISAgAALIANC4AB8JICAgIAAC5wHCQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwAhBSAAKQNAIganIgdBf2oiCK1CA4YhCQNAIAQpAzAhCiAFKQMwIQsCQCAEKAIYIgxBf2oiDUEASA0AIAQpAxAgDa0iDkIDhiIPfCEAIAQpAwggD3whDyAFKQMQIAYgDnxCA4Z8IQ4gASEQA0AgACkDACAQIBAgDykDACIRgCISIBF+fSIQfiAKfCEKIA4pAwAgEH4gC3whCyAAQnh8IQAgDkJ4fCEOIA9CeHwhDyASIRAgDEF/aiIMQQBKDQALCwJAAkAgA1BFDQBDAAAAACETDAELIAUpA1AhFEMAAAAAIRNCACEVA0AgCyEQAkAgCEEASA0AIAUpAxAgCXwhACAFKQMIIAl8IQ8gByEMIBUhDiALIRADQCAAKQMAIA4gDiAPKQMAIhGAIhIgEX59fiAQfCEQIABCeHwhACAPQnh8IQ8gEiEOIAxBf2oiDEEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIBBCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBSkDACAQQgGGfC8BAEEQdL4hGAwBCyAFKQMAIBBCAoZ8KgIAIRgLRAAAAAAAAOA/IBi7n6MgE7ugtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQooSAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEKKEgIAACyADQuAAfCSAgICAAAu5BgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWCyAUIBZDAAAAAF4gFkMAAAAAXWuykiEUIBVCAXwiFSAEUg0ACyADIBAgFBCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEKSEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCkhICAAAsgA0LgAHwkgICAgAALngcJBH4CfwN+An8FfgF9An4CfwF9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgEyAYQwAAAABeIBhDAAAAAF1rspIhEyAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAKQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAQpAwAgCkIBhnwvAQBBEHS+IRgMAQsgBCkDACAKQgKGfCoCACEYCyAEIAogEyAYkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGEKaEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhCmhICAAAsgA0LgAHwkgICAgAALqAYEA34CfwZ+AX0CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEQgBSDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiBHwhACADKQMIIAR8IQQgASEIA0AgACkDACAIIAggBCkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgBEJ4fCEEIAohCCAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAAoAkBBf2pBf0oNACAEQniDIQsgBEIHgyEMIARCf3whDQNAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQX9MDQAgAykDCCAHrUIDhiIEfCEAIAMpAxAgBHwhBCABIQgDQCAEKQMAIAggCCAAKQMAIgmAIgogCX59fiAFfCEFIABCeHwhACAEQnh8IQQgCiEIIAZBf2oiBkEASg0ACwtDAAAAACEOAkAgDUIHVA0AQwAAAAAhDiALIQADQCAOQwAAgL+SQwAAgL+SQwAAgL+SQwAAgL+SQwAAgL+SQwAAgL+SQwAAgL+SQwAAgL+SIQ4gAEJ4fCIAUEUNAAsLAkAgDFANACAMIQADQCAOQwAAgL+SIQ4gAEJ/fCIAQgBSDQALCyADIAUgDhCUgICAACABQgF8IgEgAlINAAwCCwsgBEJ4gyELIARCB4MhDCAEQn98IQ0DQCADKQMwIQUCQCADKAIYIgZBf2oiB0F/TA0AIAMpAwggB61CA4YiBHwhACADKQMQIAR8IQQgASEIA0AgBCkDACAIIAggACkDACIJgCIKIAl+fX4gBXwhBSAAQnh8IQAgBEJ4fCEEIAohCCAGQX9qIgZBAEoNAAsLQwAAAAAhDgJAIA1CB1QNAEMAAAAAIQ4gCyEAA0AgDkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kiEOIABCeHwiAEIAUg0ACwsCQCAMUA0AIAwhAANAIA5DAACAv5IhDiAAQn98IgBCAFINAAsLIAMgBSAOEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQqISAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEKiEgIAACyADQuAAfCSAgICAAAvqBQgFfgF/AX4CfwR+AX0CfwF9AkAgASACWg0AIAApAxghAyAAKQNIIgRCB4MhBSAEQniDIQYgBEJ/fCEHIAAoAkBBf2pBf0ohCANAIAMpAzAhCQJAIAMoAhgiCkF/aiILQQBIDQAgAykDECALrUIDhiIMfCEAIAMpAwggDHwhDCABIQ0DQCAAKQMAIA0gDSAMKQMAIg6AIg8gDn59fiAJfCEJIABCeHwhACAMQnh8IQwgDyENIApBf2oiCkEASg0ACwsCQAJAIARQRQ0AQwAAAAAhEAwBCwJAIAgNAEMAAAAAIRACQCAHQgdUDQBDAAAAACEQIAYhAANAIBBDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5JDAACAv5IhECAAQnh8IgBQRQ0ACwsgBVANASAFIQADQCAQQwAAgL+SIRAgAEJ/fCIAQgBSDQAMAgsLQwAAAAAhEAJAIAdCB1QNAEMAAAAAIRAgBiEAA0AgEEMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kkMAAIC/kiEQIABCeHwiAFBFDQALCyAFUA0AIAUhAANAIBBDAACAv5IhECAAQn98IgBQRQ0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAlCAYZ8LgEAIgpB/wdxIREgCkGAgICAeHEhCwJAIApB//8DcSISQQp2QR9xIgpFDQACQCAKQR9HDQAgCyASQQ10ckGAgID8B3K+IRMMBAsgCkEXdEGAgIDAA2ogC3IgEUENdHK+IRMMAwsCQCARRQ0AQYCAgJgEIBFnIgpBF3RrIAtyIBIgCkFqanRBDnRBgID/A3FyIQsLIAu+IRMMAgsgAykDACAJQgGGfC8BAEEQdL4hEwwBCyADKQMAIAlCAoZ8KgIAIRMLIAMgCSAQIBOSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQqoSAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEKqEgIAACyADQuAAfCSAgICAAAu9BgwDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AXwCQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwAhDCAAKQNAIg2nIg5Bf2oiB61CA4YhDwNAIAMpAzAhECAMKQMwIRECQCADKAIYIgZBf2oiEkF/TA0AIAMpAwggEq0iCUIDhiIIfCEAIAMpAxAgCHwhCCAMKQMQIA0gCXxCA4Z8IQkgASEFA0AgCCkDACAFIAUgACkDACIKgCILIAp+fSIFfiAQfCEQIAkpAwAgBX4gEXwhESAAQnh8IQAgCUJ4fCEJIAhCeHwhCCALIQUgBkF/aiIGQQBKDQALCyAMKQNQIRNDAAAAACEUQgAhFQNAIBEhBQJAIAdBf0wNACAMKQMIIA98IQAgDCkDECAPfCEIIA4hBiAVIQkgESEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCATQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACAFQgGGfC8BAEEQdL4hFgwCCyAMKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRICQAJAAkAgBkH//wNxIhdBCnZBH3EiGEEfRg0AIAZB/wdxIQYgGA0BIAZFDQJBgICAmAQgBmciBkEXdGsgEnIgFyAGQWpqdEEOdEGAgP8DcXK+IRYMBAsgEiAXQQ10ckGAgID8B3K+IRYMAwsgGEEXdEGAgIDAA2ogEnIgBkENdHIhEgsgEr4hFgwBCyAMKQMAIAVCAoZ8KgIAIRYLIBS7RAAAAAAAAPC/IBa7IhkgGaKjoLYhFCAVQgF8IhUgBFINAAsgAyAQIBQQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCshICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQrISAgAALIANC4AB8JICAgIAAC6IHCgR+An8DfgJ/BX4BfQJ+An8BfQF8AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDACEFIAApA0AiBqciB0F/aiIIrUIDhiEJA0AgBCkDMCEKIAUpAzAhCwJAIAQoAhgiDEF/aiINQQBIDQAgBCkDECANrSIOQgOGIg98IQAgBCkDCCAPfCEPIAUpAxAgBiAOfEIDhnwhDiABIRADQCAAKQMAIBAgECAPKQMAIhGAIhIgEX59IhB+IAp8IQogDikDACAQfiALfCELIABCeHwhACAOQnh8IQ4gD0J4fCEPIBIhECAMQX9qIgxBAEoNAAsLAkACQCADUEUNAEMAAAAAIRMMAQsgBSkDUCEUQwAAAAAhE0IAIRUDQCALIRACQCAIQQBIDQAgBSkDECAJfCEAIAUpAwggCXwhDyAHIQwgFSEOIAshEANAIAApAwAgDiAOIA8pAwAiEYAiEiARfn1+IBB8IRAgAEJ4fCEAIA9CeHwhDyASIQ4gDEF/aiIMQQBKDQALCwJAAkAgFEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgEEIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAFKQMAIBBCAYZ8LwEAQRB0viEYDAELIAUpAwAgEEIChnwqAgAhGAsgE7tEAAAAAAAA8L8gGLsiGSAZoqOgtiETIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIApCAYZ8LgEAIgxB/wdxIRYgDEGAgICAeHEhDQJAIAxB//8DcSIXQQp2QR9xIgxFDQACQCAMQR9HDQAgDSAXQQ10ckGAgID8B3K+IRgMBAsgDEEXdEGAgIDAA2ogDXIgFkENdHK+IRgMAwsCQCAWRQ0AQYCAgJgEIBZnIgxBF3RrIA1yIBcgDEFqanRBDnRBgID/A3FyIQ0LIA2+IRgMAgsgBCkDACAKQgGGfC8BAEEQdL4hGAwBCyAEKQMAIApCAoZ8KgIAIRgLIAQgCiATIBiSEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQroSAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGEK6EgIAACyADQuAAfCSAgICAAAvEBgsDfgJ/Bn4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMAIQwgACkDQCINpyIOQX9qIgetQgOGIQ8DQCADKQMwIRAgDCkDMCERAkAgAygCGCIGQX9qIhJBf0wNACADKQMIIBKtIglCA4YiCHwhACADKQMQIAh8IQggDCkDECANIAl8QgOGfCEJIAEhBQNAIAgpAwAgBSAFIAApAwAiCoAiCyAKfn0iBX4gEHwhECAJKQMAIAV+IBF8IREgAEJ4fCEAIAlCeHwhCSAIQnh8IQggCyEFIAZBf2oiBkEASg0ACwsgDCkDUCETQwAAAAAhFEIAIRUDQCARIQUCQCAHQX9MDQAgDCkDCCAPfCEAIAwpAxAgD3whCCAOIQYgFSEJIBEhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgE0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgBUIBhnwvAQBBEHS+IRYMAgsgDCkDACAFQgGGfC4BACIGQYCAgIB4cSESAkACQAJAIAZB//8DcSIXQQp2QR9xIhhBH0YNACAGQf8HcSEGIBgNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBJyIBcgBkFqanRBDnRBgID/A3FyviEWDAQLIBIgF0ENdHJBgICA/AdyviEWDAMLIBhBF3RBgICAwANqIBJyIAZBDXRyIRILIBK+IRYMAQsgDCkDACAFQgKGfCoCACEWC0QAAAAAAAAAAEQAAAAAAADwPyAWQwAAAABdGyAUu6C2IRQgFUIBfCIVIARSDQALIAMgECAUEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQsISAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGELCEgIAACyADQuAAfCSAgICAAAupBwkEfgJ/A34CfwV+AX0CfgJ/AX0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMAIQUgACkDQCIGpyIHQX9qIgitQgOGIQkDQCAEKQMwIQogBSkDMCELAkAgBCgCGCIMQX9qIg1BAEgNACAEKQMQIA2tIg5CA4YiD3whACAEKQMIIA98IQ8gBSkDECAGIA58QgOGfCEOIAEhEANAIAApAwAgECAQIA8pAwAiEYAiEiARfn0iEH4gCnwhCiAOKQMAIBB+IAt8IQsgAEJ4fCEAIA5CeHwhDiAPQnh8IQ8gEiEQIAxBf2oiDEEASg0ACwsCQAJAIANQRQ0AQwAAAAAhEwwBCyAFKQNQIRRDAAAAACETQgAhFQNAIAshEAJAIAhBAEgNACAFKQMQIAl8IQAgBSkDCCAJfCEPIAchDCAVIQ4gCyEQA0AgACkDACAOIA4gDykDACIRgCISIBF+fX4gEHwhECAAQnh8IQAgD0J4fCEPIBIhDiAMQX9qIgxBAEoNAAsLAkACQCAUQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAQQgGGfC4BACIMQf8HcSEWIAxBgICAgHhxIQ0CQCAMQf//A3EiF0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA0gF0ENdHJBgICA/AdyviEYDAQLIAxBF3RBgICAwANqIA1yIBZBDXRyviEYDAMLAkAgFkUNAEGAgICYBCAWZyIMQRd0ayANciAXIAxBamp0QQ50QYCA/wNxciENCyANviEYDAILIAUpAwAgEEIBhnwvAQBBEHS+IRgMAQsgBSkDACAQQgKGfCoCACEYC0QAAAAAAAAAAEQAAAAAAADwPyAYQwAAAABdGyATu6C2IRMgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCkIBhnwuAQAiDEH/B3EhFiAMQYCAgIB4cSENAkAgDEH//wNxIhdBCnZBH3EiDEUNAAJAIAxBH0cNACANIBdBDXRyQYCAgPwHcr4hGAwECyAMQRd0QYCAgMADaiANciAWQQ10cr4hGAwDCwJAIBZFDQBBgICAmAQgFmciDEEXdGsgDXIgFyAMQWpqdEEOdEGAgP8DcXIhDQsgDb4hGAwCCyAEKQMAIApCAYZ8LwEAQRB0viEYDAELIAQpAwAgCkIChnwqAgAhGAsgBCAKIBMgGJIQlICAgAAgAUIBfCIBIAJSDQALCwuEBAIJfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBCAAKQMYIQUCQCABKQMgIgZCAVENACAFIAEpAxh9IQULAkAgBVANACAFQgODIQcgACkDCCEIAkACQCAFQn98QgNaDQBCASEEQgAhCQwBCyAFQnyDIQpCASEEQgAhCSAIIQsDQCALQhh8KQMAIAtCEHwpAwAgC0IIfCkDACALKQMAIAR+fn5+IQQgC0IgfCELIAogCUIEfCIJUg0ACwsgB1ANACAIIAlCA4Z8IQsDQCALKQMAIAR+IQQgC0IIfCELIAdCf3wiB0IAUg0ACwsgA0IYfEIANwMAIANCOHxCADcDACADQsAAfEIANwMAIANCADcDECADIAA3AwggA0IANwMwIAMgAjgCKCADIAE3AyAgA0IANwNYIAMgBDcDUCADIAU3A0gCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEMAkAgBlANACADQgh8QgAgBhCyhICAAAsQgYCAgAAhDUIAQgArA9DEhICAgICAgAAgDSAMoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAZQDQAgA0IIfEIAIAYQsoSAgAALIANC4AB8JICAgIAAC8IGDQN+An8EfgF9An4BfwN+AX8BfgF9AX4BfQJ/AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKgIgIQwgACkDACENIAApA0AiDqciD0F/aiIHrUIDhiEQA0AgAykDMCERIA0pAzAhEgJAIAMoAhgiBkF/aiITQX9MDQAgAykDCCATrSIJQgOGIgh8IQAgAykDECAIfCEIIA0pAxAgDiAJfEIDhnwhCSABIQUDQCAIKQMAIAUgBSAAKQMAIgqAIgsgCn59IgV+IBF8IREgCSkDACAFfiASfCESIABCeHwhACAJQnh8IQkgCEJ4fCEIIAshBSAGQX9qIgZBAEoNAAsLIA0pA1AhFEMAAAAAIRVCACEWA0AgEiEFAkAgB0F/TA0AIA0pAwggEHwhACANKQMQIBB8IQggDyEGIBYhCSASIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBRCf3wiAEIBVg0AAkACQCAApw4CAQABCyANKQMAIAVCAYZ8LwEAQRB0viEXDAILIA0pAwAgBUIBhnwuAQAiBkGAgICAeHEhEwJAAkACQCAGQf//A3EiGEEKdkEfcSIZQR9GDQAgBkH/B3EhBiAZDQEgBkUNAkGAgICYBCAGZyIGQRd0ayATciAYIAZBamp0QQ50QYCA/wNxcr4hFwwECyATIBhBDXRyQYCAgPwHcr4hFwwDCyAZQRd0QYCAgMADaiATciAGQQ10ciETCyATviEXDAELIA0pAwAgBUIChnwqAgAhFwsgFSAMQwAAgD8gF0MAAAAAXRuSIRUgFkIBfCIWIARSDQALIAMgESAVEJSAgIAAIAFCAXwiASACUg0ACwsLhAQCCX4CfCOAgICAAELgAH0iAySAgICAAEIBIQQgACkDGCEFAkAgASkDICIGQgFRDQAgBSABKQMYfSEFCwJAIAVQDQAgBUIDgyEHIAApAwghCAJAAkAgBUJ/fEIDWg0AQgEhBEIAIQkMAQsgBUJ8gyEKQgEhBEIAIQkgCCELA0AgC0IYfCkDACALQhB8KQMAIAtCCHwpAwAgCykDACAEfn5+fiEEIAtCIHwhCyAKIAlCBHwiCVINAAsLIAdQDQAgCCAJQgOGfCELA0AgCykDACAEfiEEIAtCCHwhCyAHQn98IgdCAFINAAsLIANCGHxCADcDACADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AxAgAyAANwMIIANCADcDMCADIAI4AiggAyABNwMgIANCADcDWCADIAQ3A1AgAyAFNwNIAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhDAJAIAZQDQAgA0IIfEIAIAYQtISAgAALEIGAgIAAIQ1CAEIAKwPQxISAgICAgIAAIA0gDKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIANCCHxCACAGELSEgIAACyADQuAAfCSAgICAAAulBwoBfQR+An8DfgJ/BX4BfQJ+An8BfQJAIAEgAloNACAAKgIgIQMgACkDSCEEIAApAxghBSAAKQMAIQYgACkDQCIHpyIIQX9qIgmtQgOGIQoDQCAFKQMwIQsgBikDMCEMAkAgBSgCGCINQX9qIg5BAEgNACAFKQMQIA6tIg9CA4YiEHwhACAFKQMIIBB8IRAgBikDECAHIA98QgOGfCEPIAEhEQNAIAApAwAgESARIBApAwAiEoAiEyASfn0iEX4gC3whCyAPKQMAIBF+IAx8IQwgAEJ4fCEAIA9CeHwhDyAQQnh8IRAgEyERIA1Bf2oiDUEASg0ACwsCQAJAIARQRQ0AQwAAAAAhFAwBCyAGKQNQIRVDAAAAACEUQgAhFgNAIAwhEQJAIAlBAEgNACAGKQMQIAp8IQAgBikDCCAKfCEQIAghDSAWIQ8gDCERA0AgACkDACAPIA8gECkDACISgCITIBJ+fX4gEXwhESAAQnh8IQAgEEJ4fCEQIBMhDyANQX9qIg1BAEoNAAsLAkACQCAVQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBikDACARQgGGfC4BACINQf8HcSEXIA1BgICAgHhxIQ4CQCANQf//A3EiGEEKdkEfcSINRQ0AAkAgDUEfRw0AIA4gGEENdHJBgICA/AdyviEZDAQLIA1BF3RBgICAwANqIA5yIBdBDXRyviEZDAMLAkAgF0UNAEGAgICYBCAXZyINQRd0ayAOciAYIA1Bamp0QQ50QYCA/wNxciEOCyAOviEZDAILIAYpAwAgEUIBhnwvAQBBEHS+IRkMAQsgBikDACARQgKGfCoCACEZCyAUIANDAACAPyAZQwAAAABdG5IhFCAWQgF8IhYgBFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACALQgGGfC4BACINQf8HcSEXIA1BgICAgHhxIQ4CQCANQf//A3EiGEEKdkEfcSINRQ0AAkAgDUEfRw0AIA4gGEENdHJBgICA/AdyviEZDAQLIA1BF3RBgICAwANqIA5yIBdBDXRyviEZDAMLAkAgF0UNAEGAgICYBCAXZyINQRd0ayAOciAYIA1Bamp0QQ50QYCA/wNxciEOCyAOviEZDAILIAUpAwAgC0IBhnwvAQBBEHS+IRkMAQsgBSkDACALQgKGfCoCACEZCyAFIAsgFCAZkhCUgICAACABQgF8IgEgAlINAAsLC4QEAgl+AnwjgICAgABC4AB9IgMkgICAgABCASEEIAApAxghBQJAIAEpAyAiBkIBUQ0AIAUgASkDGH0hBQsCQCAFUA0AIAVCA4MhByAAKQMIIQgCQAJAIAVCf3xCA1oNAEIBIQRCACEJDAELIAVCfIMhCkIBIQRCACEJIAghCwNAIAtCGHwpAwAgC0IQfCkDACALQgh8KQMAIAspAwAgBH5+fn4hBCALQiB8IQsgCiAJQgR8IglSDQALCyAHUA0AIAggCUIDhnwhCwNAIAspAwAgBH4hBCALQgh8IQsgB0J/fCIHQgBSDQALCyADQhh8QgA3AwAgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMQIAMgADcDCCADQgA3AzAgAyACOAIoIAMgATcDICADQgA3A1ggAyAENwNQIAMgBTcDSAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQwCQCAGUA0AIANCCHxCACAGELaEgIAACxCBgICAACENQgBCACsD0MSEgICAgICAACANIAyhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBlANACADQgh8QgAgBhC2hICAAAsgA0LgAHwkgICAgAALpg0ECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgELsQg4CAgAAgEbuithCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEGIAMpAwAhCSAEKQMAIQggBSkDACEAAkAgAiABfUIBg1ANACAIIAFCAoYiB3wqAgAhECAJIAd8IAAgB3wqAgC7EIOAgIAAIBC7orY4AgAgAUIBfCEBCyAGQgAgAn1RDQEgAiABfSEGIAAgAUIChiIHfCEAIAggB3whCCAJIAd8IQkDQCAIKgIAIRAgCSAAKgIAuxCDgICAACAQu6K2OAIAIAhCBHwqAgAhECAJQgR8IABCBHwqAgC7EIOAgIAAIBC7orY4AgAgAEIIfCEAIAhCCHwhCCAJQgh8IQkgBkJ+fCIGQgBSDQAMAgsLIAIgAVgNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFSAGQgKGfCoCACERIBC7EIOAgIAAIBG7orYhECASIQYCQCAaUA0AIAMpAwggG3whACADKQMQIBt8IQggGiEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQuISAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACELiEgIAACyAEQuAAfCSAgICAAAunDgUJfgR/A30MfgF8IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRIMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRIMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRIMAgsgAykDACAGQgGGfC8BAEEQdL4hEgwBCyADKQMAIAZCAoZ8KgIAIRILIAMgBiAQuxCDgICAACARu6IgErugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEGIAUpAwAgAUIChiIAfCEIIAQpAwAgAHwhCSADKQMAIAB8IQADQCAJKgIAIRAgACAIKgIAuxCDgICAACAQu6IgACoCALugtjgCACAIQgR8IQggCUIEfCEJIABCBHwhACAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFiAFKQMwIRcgBSkDACEYIAUpAxgiGVAhDCAEKQMYIhpQIQ4gAykDGCIbQn98QgOGIRwgGkJ/fEIDhiEdIBlCf3xCA4YhHgNAIBchBgJAIAwNACAFKQMIIB58IQAgBSkDECAefCEIIBkhByAXIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBggBkIChnwqAgAhECAVIQYCQCAODQAgBCkDCCAdfCEAIAQpAxAgHXwhCCAaIQcgFSEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAWIAZCAoZ8KgIAIREgELsQg4CAgAAgEbuiIR8gEyEGAkAgG1ANACADKQMIIBx8IQAgAykDECAcfCEIIBshByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAfIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhC6hICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQuoSAgAALIARC4AB8JICAgIAAC6sNBAl+BH8CfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgAyAGIBC7EIKAgIAAmiARu6K2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQYgAykDACEJIAQpAwAhCCAFKQMAIQACQCACIAF9QgGDUA0AIAggAUIChiIHfCoCACEQIAkgB3wgACAHfCoCALsQgoCAgACaIBC7orY4AgAgAUIBfCEBCyAGQgAgAn1RDQEgAiABfSEGIAAgAUIChiIHfCEAIAggB3whCCAJIAd8IQkDQCAIKgIAIRAgCSAAKgIAuxCCgICAAJogELuitjgCACAIQgR8KgIAIRAgCUIEfCAAQgR8KgIAuxCCgICAAJogELuitjgCACAAQgh8IQAgCEIIfCEIIAlCCHwhCSAGQn58IgZCAFINAAwCCwsgAiABWA0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAUpAxgiGFAhDCAEKQMYIhlQIQ4gAykDGCIaQn98QgOGIRsgGUJ/fEIDhiEcIBhCf3xCA4YhHQNAIBYhBgJAIAwNACAFKQMIIB18IQAgBSkDECAdfCEIIBghByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgAhECAUIQYCQCAODQAgBCkDCCAcfCEAIAQpAxAgHHwhCCAZIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAVIAZCAoZ8KgIAIREgELsQgoCAgACaIBG7orYhECASIQYCQCAaUA0AIAMpAwggG3whACADKQMQIBt8IQggGiEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQvISAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACELyEgIAACyAEQuAAfCSAgICAAAutDgYJfgR/A30BfAx+AXwgACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGIBK7IBC7EIKAgIAAIBG7oqG2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgB8IQggBCkDACAAfCEJIAMpAwAgAHwhAANAIAkqAgAhECAIKgIAuxCCgICAACETIAAgACoCALsgEyAQu6KhtjgCACAIQgR8IQggCUIEfCEJIABCBHwhACAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhFCADKQMAIRUgBCkDMCEWIAQpAwAhFyAFKQMwIRggBSkDACEZIAUpAxgiGlAhDCAEKQMYIhtQIQ4gAykDGCIcQn98QgOGIR0gG0J/fEIDhiEeIBpCf3xCA4YhHwNAIBghBgJAIAwNACAFKQMIIB98IQAgBSkDECAffCEIIBohByAYIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBkgBkIChnwqAgAhECAWIQYCQCAODQAgBCkDCCAefCEAIAQpAxAgHnwhCCAbIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAuyETIBC7EIKAgIAAISAgFCEGAkAgHFANACADKQMIIB18IQAgAykDECAdfCEIIBwhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBUgBkIChnwiACAAKgIAuyAgIBOiobY4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhC+hICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQvoSAgAALIARC4AB8JICAgIAAC6wMBQl+BH8CfQF8DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgEbsgELsQg4CAgAAiEiASoqO2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgl8IQAgBCkDACAJfCEIIAMpAwAgCXwhCQNAIAkgCCoCALsgACoCALsQg4CAgAAiEiASoqO2OAIAIABCBHwhACAIQgR8IQggCUIEfCEJIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCETIAMpAwAhFCAEKQMwIRUgBCkDACEWIAUpAzAhFyAFKQMAIRggBSkDGCIZUCEMIAQpAxgiGlAhDiADKQMYIhtCf3xCA4YhHCAaQn98QgOGIR0gGUJ/fEIDhiEeA0AgFyEGAkAgDA0AIAUpAwggHnwhACAFKQMQIB58IQggGSEHIBchBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGCAGQgKGfCoCACEQIBUhBgJAIA4NACAEKQMIIB18IQAgBCkDECAdfCEIIBohByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBYgBkIChnwqAgC7IBC7EIOAgIAAIhIgEqKjtiEQIBMhBgJAIBtQDQAgAykDCCAcfCEAIAMpAxAgHHwhCCAbIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAUIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDAhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQwISAgAALIARC4AB8JICAgIAAC64OBQl+BH8DfQF8DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGIBG7IBC7EIOAgIAAIhMgE6KjIBK7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiAHwhCCAEKQMAIAB8IQkgAykDACAAfCEAA0AgACAJKgIAuyAIKgIAuxCDgICAACITIBOioyAAKgIAu6C2OAIAIAhCBHwhCCAJQgR8IQkgAEIEfCEAIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCEUIAMpAwAhFSAEKQMwIRYgBCkDACEXIAUpAzAhGCAFKQMAIRkgBSkDGCIaUCEMIAQpAxgiG1AhDiADKQMYIhxCf3xCA4YhHSAbQn98QgOGIR4gGkJ/fEIDhiEfA0AgGCEGAkAgDA0AIAUpAwggH3whACAFKQMQIB98IQggGiEHIBghBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGSAGQgKGfCoCACEQIBYhBgJAIA4NACAEKQMIIB58IQAgBCkDECAefCEIIBshByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgC7IBC7EIOAgIAAIhMgE6KjIRMgFCEGAkAgHFANACADKQMIIB18IQAgAykDECAdfCEIIBwhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBUgBkIChnwiACATIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDChICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQwoSAgAALIARC4AB8JICAgIAAC6kMBAl+BH8CfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgAyAGIBG7QwAAgD8gECAQlJO7n6O2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgl8IQAgBCkDACAJfCEIIAMpAwAgCXwhCQNAIAkgCCoCALtDAACAPyAAKgIAIhAgEJSTu5+jtjgCACAAQgR8IQAgCEIEfCEIIAlCBHwhCSAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAUpAxgiGFAhDCAEKQMYIhlQIQ4gAykDGCIaQn98QgOGIRsgGUJ/fEIDhiEcIBhCf3xCA4YhHQNAIBYhBgJAIAwNACAFKQMIIB18IQAgBSkDECAdfCEIIBghByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgAhECAUIQYCQCAODQAgBCkDCCAcfCEAIAQpAxAgHHwhCCAZIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAVIAZCAoZ8KgIAu0MAAIA/IBAgEJSTu5+jtiEQIBIhBgJAIBpQDQAgAykDCCAbfCEAIAMpAxAgG3whCCAaIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyATIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDEhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQxISAgAALIARC4AB8JICAgIAAC60OBQl+BH8DfQx+AXwgACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGIBG7QwAAgD8gECAQlJO7n6MgErugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEGIAUpAwAgAUIChiIAfCEIIAQpAwAgAHwhCSADKQMAIAB8IQADQCAAIAkqAgC7QwAAgD8gCCoCACIQIBCUk7ufoyAAKgIAu6C2OAIAIAhCBHwhCCAJQgR8IQkgAEIEfCEAIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCETIAMpAwAhFCAEKQMwIRUgBCkDACEWIAUpAzAhFyAFKQMAIRggBSkDGCIZUCEMIAQpAxgiGlAhDiADKQMYIhtCf3xCA4YhHCAaQn98QgOGIR0gGUJ/fEIDhiEeA0AgFyEGAkAgDA0AIAUpAwggHnwhACAFKQMQIB58IQggGSEHIBchBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGCAGQgKGfCoCACEQIBUhBgJAIA4NACAEKQMIIB18IQAgBCkDECAdfCEIIBohByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBYgBkIChnwqAgC7QwAAgD8gECAQlJO7n6MhHyATIQYCQCAbUA0AIAMpAwggHHwhACADKQMQIBx8IQggGyEHIBMhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFCAGQgKGfCIAIB8gACoCALugtjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEMaEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDGhICAAAsgBELgAHwkgICAgAALrAwECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgEYy7QwAAgD8gECAQlJO7n6O2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgl8IQAgBCkDACAJfCEIIAMpAwAgCXwhCQNAIAkgCCoCAIy7QwAAgD8gACoCACIQIBCUk7ufo7Y4AgAgAEIEfCEAIAhCBHwhCCAJQgR8IQkgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFSAGQgKGfCoCAIy7QwAAgD8gECAQlJO7n6O2IRAgEiEGAkAgGlANACADKQMIIBt8IQAgAykDECAbfCEIIBohByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEMiEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDIhICAAAsgBELgAHwkgICAgAALrg4FCX4EfwN9DH4BfCAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAYgErsgEbtDAACAPyAQIBCUk7ufo6G2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgB8IQggBCkDACAAfCEJIAMpAwAgAHwhAANAIAAgACoCALsgCSoCALtDAACAPyAIKgIAIhAgEJSTu5+jobY4AgAgCEIEfCEIIAlCBHwhCSAAQgR8IQAgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYgBSkDMCEXIAUpAwAhGCAFKQMYIhlQIQwgBCkDGCIaUCEOIAMpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQYCQCAMDQAgBSkDCCAefCEAIAUpAxAgHnwhCCAZIQcgFyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAYIAZCAoZ8KgIAIRAgFSEGAkAgDg0AIAQpAwggHXwhACAEKQMQIB18IQggGiEHIBUhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFiAGQgKGfCoCAIy7QwAAgD8gECAQlJO7n6MhHyATIQYCQCAbUA0AIAMpAwggHHwhACADKQMQIBx8IQggGyEHIBMhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFCAGQgKGfCIAIB8gACoCALugtjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEMqEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDKhICAAAsgBELgAHwkgICAgAALsgwECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgEbsgECAQlLtEAAAAAAAA8D+go7YQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiCXwhACAEKQMAIAl8IQggAykDACAJfCEJA0AgCSAIKgIAuyAAKgIAIhAgEJS7RAAAAAAAAPA/oKO2OAIAIABCBHwhACAIQgR8IQggCUIEfCEJIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVIAUpAzAhFiAFKQMAIRcgBSkDGCIYUCEMIAQpAxgiGVAhDiADKQMYIhpCf3xCA4YhGyAZQn98QgOGIRwgGEJ/fEIDhiEdA0AgFiEGAkAgDA0AIAUpAwggHXwhACAFKQMQIB18IQggGCEHIBYhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFyAGQgKGfCoCACEQIBQhBgJAIA4NACAEKQMIIBx8IQAgBCkDECAcfCEIIBkhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBUgBkIChnwqAgC7IBAgEJS7RAAAAAAAAPA/oKO2IRAgEiEGAkAgGlANACADKQMIIBt8IQAgAykDECAbfCEIIBohByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEMyEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDMhICAAAsgBELgAHwkgICAgAALtg4FCX4EfwN9DH4BfCAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAYgEbsgECAQlLtEAAAAAAAA8D+goyASu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgB8IQggBCkDACAAfCEJIAMpAwAgAHwhAANAIAAgCSoCALsgCCoCACIQIBCUu0QAAAAAAADwP6CjIAAqAgC7oLY4AgAgCEIEfCEIIAlCBHwhCSAAQgR8IQAgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYgBSkDMCEXIAUpAwAhGCAFKQMYIhlQIQwgBCkDGCIaUCEOIAMpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQYCQCAMDQAgBSkDCCAefCEAIAUpAxAgHnwhCCAZIQcgFyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAYIAZCAoZ8KgIAIRAgFSEGAkAgDg0AIAQpAwggHXwhACAEKQMQIB18IQggGiEHIBUhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFiAGQgKGfCoCALsgECAQlLtEAAAAAAAA8D+goyEfIBMhBgJAIBtQDQAgAykDCCAcfCEAIAMpAxAgHHwhCCAbIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAUIAZCAoZ8IgAgHyAAKgIAu6C2OAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQzoSAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEM6EgIAACyAEQuAAfCSAgICAAAubDAQJfgR/An0MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAMgBiAQuxCJgICAACARu6K2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgl8IQAgBCkDACAJfCEIIAMpAwAgCXwhCQNAIAkgACoCALsQiYCAgAAgCCoCALuitjgCACAAQgR8IQAgCEIEfCEIIAlCBHwhCSAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAUpAxgiGFAhDCAEKQMYIhlQIQ4gAykDGCIaQn98QgOGIRsgGUJ/fEIDhiEcIBhCf3xCA4YhHQNAIBYhBgJAIAwNACAFKQMIIB18IQAgBSkDECAdfCEIIBghByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgAhECAUIQYCQCAODQAgBCkDCCAcfCEAIAQpAxAgHHwhCCAZIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAQuxCJgICAACAVIAZCAoZ8KgIAu6K2IRAgEiEGAkAgGlANACADKQMIIBt8IQAgAykDECAbfCEIIBohByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACENCEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDQhICAAAsgBELgAHwkgICAgAALnw4FCX4EfwN9DH4BfCAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAYgELsQiYCAgAAgEbuiIBK7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiAHwhCCAEKQMAIAB8IQkgAykDACAAfCEAA0AgACAIKgIAuxCJgICAACAJKgIAu6IgACoCALugtjgCACAIQgR8IQggCUIEfCEJIABCBHwhACAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFiAFKQMwIRcgBSkDACEYIAUpAxgiGVAhDCAEKQMYIhpQIQ4gAykDGCIbQn98QgOGIRwgGkJ/fEIDhiEdIBlCf3xCA4YhHgNAIBchBgJAIAwNACAFKQMIIB58IQAgBSkDECAefCEIIBkhByAXIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBggBkIChnwqAgAhECAVIQYCQCAODQAgBCkDCCAdfCEAIAQpAxAgHXwhCCAaIQcgFSEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAQuxCJgICAACAWIAZCAoZ8KgIAu6IhHyATIQYCQCAbUA0AIAMpAwggHHwhACADKQMQIBx8IQggGyEHIBMhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFCAGQgKGfCIAIB8gACoCALugtjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACENKEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDShICAAAsgBELgAHwkgICAgAALmwwECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgELsQiICAgAAgEbuithCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEGIAUpAwAgAUIChiIJfCEAIAQpAwAgCXwhCCADKQMAIAl8IQkDQCAJIAAqAgC7EIiAgIAAIAgqAgC7orY4AgAgAEIEfCEAIAhCBHwhCCAJQgR8IQkgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgELsQiICAgAAgFSAGQgKGfCoCALuitiEQIBIhBgJAIBpQDQAgAykDCCAbfCEAIAMpAxAgG3whCCAaIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyATIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDUhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ1ISAgAALIARC4AB8JICAgIAAC58OBQl+BH8DfQx+AXwgACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGIBC7EIiAgIAAIBG7oiASu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgB8IQggBCkDACAAfCEJIAMpAwAgAHwhAANAIAAgCCoCALsQiICAgAAgCSoCALuiIAAqAgC7oLY4AgAgCEIEfCEIIAlCBHwhCSAAQgR8IQAgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYgBSkDMCEXIAUpAwAhGCAFKQMYIhlQIQwgBCkDGCIaUCEOIAMpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQYCQCAMDQAgBSkDCCAefCEAIAUpAxAgHnwhCCAZIQcgFyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAYIAZCAoZ8KgIAIRAgFSEGAkAgDg0AIAQpAwggHXwhACAEKQMQIB18IQggGiEHIBUhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgELsQiICAgAAgFiAGQgKGfCoCALuiIR8gEyEGAkAgG1ANACADKQMIIBx8IQAgAykDECAcfCEIIBshByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAfIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDWhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ1oSAgAALIARC4AB8JICAgIAAC78NBAl+BH8CfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgAyAGRAAAAAAAAPA/IBAgEJS7oSARu6K2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQYgAykDACEJIAQpAwAhCCAFKQMAIQACQCACIAF9QgGDUA0AIAkgAUIChiIHfEQAAAAAAADwPyAAIAd8KgIAIhAgEJS7oSAIIAd8KgIAu6K2OAIAIAFCAXwhAQsgBkIAIAJ9UQ0BIAIgAX0hBiAAIAFCAoYiB3whACAIIAd8IQggCSAHfCEJA0AgCUQAAAAAAADwPyAAKgIAIhAgEJS7oSAIKgIAu6K2OAIAIAlCBHxEAAAAAAAA8D8gAEIEfCoCACIQIBCUu6EgCEIEfCoCALuitjgCACAAQgh8IQAgCEIIfCEIIAlCCHwhCSAGQn58IgZCAFINAAwCCwsgAiABWA0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAUpAxgiGFAhDCAEKQMYIhlQIQ4gAykDGCIaQn98QgOGIRsgGUJ/fEIDhiEcIBhCf3xCA4YhHQNAIBYhBgJAIAwNACAFKQMIIB18IQAgBSkDECAdfCEIIBghByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgAhECAUIQYCQCAODQAgBCkDCCAcfCEAIAQpAxAgHHwhCCAZIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALC0QAAAAAAADwPyAQIBCUu6EgFSAGQgKGfCoCALuitiEQIBIhBgJAIBpQDQAgAykDCCAbfCEAIAMpAxAgG3whCCAaIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyATIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDYhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ2ISAgAALIARC4AB8JICAgIAAC7YOBQl+BH8DfQx+AXwgACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGRAAAAAAAAPA/IBAgEJS7oSARu6IgErugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEGIAUpAwAgAUIChiIAfCEIIAQpAwAgAHwhCSADKQMAIAB8IQADQCAARAAAAAAAAPA/IAgqAgAiECAQlLuhIAkqAgC7oiAAKgIAu6C2OAIAIAhCBHwhCCAJQgR8IQkgAEIEfCEAIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCETIAMpAwAhFCAEKQMwIRUgBCkDACEWIAUpAzAhFyAFKQMAIRggBSkDGCIZUCEMIAQpAxgiGlAhDiADKQMYIhtCf3xCA4YhHCAaQn98QgOGIR0gGUJ/fEIDhiEeA0AgFyEGAkAgDA0AIAUpAwggHnwhACAFKQMQIB58IQggGSEHIBchBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGCAGQgKGfCoCACEQIBUhBgJAIA4NACAEKQMIIB18IQAgBCkDECAdfCEIIBohByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLRAAAAAAAAPA/IBAgEJS7oSAWIAZCAoZ8KgIAu6IhHyATIQYCQCAbUA0AIAMpAwggHHwhACADKQMQIBx8IQggGyEHIBMhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFCAGQgKGfCIAIB8gACoCALugtjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACENqEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDahICAAAsgBELgAHwkgICAgAAL6QwECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgECARlBCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEGIAMpAwAhCSAEKQMAIQggBSkDACEAAkAgAiABfUIBg1ANACAJIAFCAoYiB3wgACAHfCoCACAIIAd8KgIAlDgCACABQgF8IQELIAZCACACfVENASACIAF9IQYgACABQgKGIgd8IQAgCCAHfCEIIAkgB3whCQNAIAkgACoCACAIKgIAlDgCACAJQgR8IABCBHwqAgAgCEIEfCoCAJQ4AgAgAEIIfCEAIAhCCHwhCCAJQgh8IQkgBkJ+fCIGQgBSDQAMAgsLIAIgAVgNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgECAVIAZCAoZ8KgIAlCEQIBIhBgJAIBpQDQAgAykDCCAbfCEAIAMpAxAgG3whCCAaIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyATIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDchICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ3ISAgAALIARC4AB8JICAgIAAC/gOBAl+BH8DfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRIMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRIMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRIMAgsgAykDACAGQgGGfC8BAEEQdL4hEgwBCyADKQMAIAZCAoZ8KgIAIRILIAMgBiAQIBGUIBKSEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQYgAykDACEAIAQpAwAhCSAFKQMAIQgCQCACIAF9QgGDUA0AIAAgAUIChiIHfCIKIAggB3wqAgAgCSAHfCoCAJQgCioCAJI4AgAgAUIBfCEBCyAGQgAgAn1RDQEgAiABfSEGIAggAUIChiIHfCEIIAkgB3whCSAAIAd8IQADQCAAIAgqAgAgCSoCAJQgACoCAJI4AgAgAEIEfCIHIAhCBHwqAgAgCUIEfCoCAJQgByoCAJI4AgAgCEIIfCEIIAlCCHwhCSAAQgh8IQAgBkJ+fCIGQgBSDQAMAgsLIAIgAVgNACADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYgBSkDMCEXIAUpAwAhGCAFKQMYIhlQIQwgBCkDGCIaUCEOIAMpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQYCQCAMDQAgBSkDCCAefCEAIAUpAxAgHnwhCCAZIQcgFyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAYIAZCAoZ8KgIAIRAgFSEGAkAgDg0AIAQpAwggHXwhACAEKQMQIB18IQggGiEHIBUhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgECAWIAZCAoZ8KgIAlCEQIBMhBgJAIBtQDQAgAykDCCAcfCEAIAMpAxAgHHwhCCAbIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAUIAZCAoZ8IgAgECAAKgIAkjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEN6EgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDehICAAAsgBELgAHwkgICAgAALvw0ECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAZEAAAAAAAA8D8gELuhIBAgEZS7orYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhBiADKQMAIQkgBCkDACEIIAUpAwAhAAJAIAIgAX1CAYNQDQAgCSABQgKGIgd8RAAAAAAAAPA/IAAgB3wqAgAiELuhIBAgCCAHfCoCAJS7orY4AgAgAUIBfCEBCyAGQgAgAn1RDQEgAiABfSEGIAAgAUIChiIHfCEAIAggB3whCCAJIAd8IQkDQCAJRAAAAAAAAPA/IAAqAgAiELuhIBAgCCoCAJS7orY4AgAgCUIEfEQAAAAAAADwPyAAQgR8KgIAIhC7oSAQIAhCBHwqAgCUu6K2OAIAIABCCHwhACAIQgh8IQggCUIIfCEJIAZCfnwiBkIAUg0ADAILCyACIAFYDQAgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVIAUpAzAhFiAFKQMAIRcgBSkDGCIYUCEMIAQpAxgiGVAhDiADKQMYIhpCf3xCA4YhGyAZQn98QgOGIRwgGEJ/fEIDhiEdA0AgFiEGAkAgDA0AIAUpAwggHXwhACAFKQMQIB18IQggGCEHIBYhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFyAGQgKGfCoCACEQIBQhBgJAIA4NACAEKQMIIBx8IQAgBCkDECAcfCEIIBkhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLRAAAAAAAAPA/IBC7oSAQIBUgBkIChnwqAgCUu6K2IRAgEiEGAkAgGlANACADKQMIIBt8IQAgAykDECAbfCEIIBohByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEOCEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDghICAAAsgBELgAHwkgICAgAALtg4FCX4EfwN9DH4BfCAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAZEAAAAAAAA8D8gELuhIBAgEZS7oiASu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgB8IQggBCkDACAAfCEJIAMpAwAgAHwhAANAIABEAAAAAAAA8D8gCCoCACIQu6EgECAJKgIAlLuiIAAqAgC7oLY4AgAgCEIEfCEIIAlCBHwhCSAAQgR8IQAgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYgBSkDMCEXIAUpAwAhGCAFKQMYIhlQIQwgBCkDGCIaUCEOIAMpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQYCQCAMDQAgBSkDCCAefCEAIAUpAxAgHnwhCCAZIQcgFyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAYIAZCAoZ8KgIAIRAgFSEGAkAgDg0AIAQpAwggHXwhACAEKQMQIB18IQggGiEHIBUhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwtEAAAAAAAA8D8gELuhIBAgFiAGQgKGfCoCAJS7oiEfIBMhBgJAIBtQDQAgAykDCCAcfCEAIAMpAxAgHHwhCCAbIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAUIAZCAoZ8IgAgHyAAKgIAu6C2OAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ4oSAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEOKEgIAACyAEQuAAfCSAgICAAAvpDAQJfgR/An0MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAMgBiARIBCVEJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAIgAVgNASABQn+FIQYgAykDACEJIAQpAwAhCCAFKQMAIQACQCACIAF9QgGDUA0AIAkgAUIChiIHfCAIIAd8KgIAIAAgB3wqAgCVOAIAIAFCAXwhAQsgBkIAIAJ9UQ0BIAIgAX0hBiAAIAFCAoYiB3whACAIIAd8IQggCSAHfCEJA0AgCSAIKgIAIAAqAgCVOAIAIAlCBHwgCEIEfCoCACAAQgR8KgIAlTgCACAAQgh8IQAgCEIIfCEIIAlCCHwhCSAGQn58IgZCAFINAAwCCwsgAiABWA0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAUpAxgiGFAhDCAEKQMYIhlQIQ4gAykDGCIaQn98QgOGIRsgGUJ/fEIDhiEcIBhCf3xCA4YhHQNAIBYhBgJAIAwNACAFKQMIIB18IQAgBSkDECAdfCEIIBghByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgAhECAUIQYCQCAODQAgBCkDCCAcfCEAIAQpAxAgHHwhCCAZIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAVIAZCAoZ8KgIAIBCVIRAgEiEGAkAgGlANACADKQMIIBt8IQAgAykDECAbfCEIIBohByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEOSEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDkhICAAAsgBELgAHwkgICAgAAL+A4ECX4EfwN9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgAiABWA0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGIBEgEJUgEpIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhBiADKQMAIQAgBCkDACEJIAUpAwAhCAJAIAIgAX1CAYNQDQAgACABQgKGIgd8IgogCSAHfCoCACAIIAd8KgIAlSAKKgIAkjgCACABQgF8IQELIAZCACACfVENASACIAF9IQYgCCABQgKGIgd8IQggCSAHfCEJIAAgB3whAANAIAAgCSoCACAIKgIAlSAAKgIAkjgCACAAQgR8IgcgCUIEfCoCACAIQgR8KgIAlSAHKgIAkjgCACAIQgh8IQggCUIIfCEJIABCCHwhACAGQn58IgZCAFINAAwCCwsgAiABWA0AIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFiAFKQMwIRcgBSkDACEYIAUpAxgiGVAhDCAEKQMYIhpQIQ4gAykDGCIbQn98QgOGIRwgGkJ/fEIDhiEdIBlCf3xCA4YhHgNAIBchBgJAIAwNACAFKQMIIB58IQAgBSkDECAefCEIIBkhByAXIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBggBkIChnwqAgAhECAVIQYCQCAODQAgBCkDCCAdfCEAIAQpAxAgHXwhCCAaIQcgFSEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAWIAZCAoZ8KgIAIBCVIRAgEyEGAkAgG1ANACADKQMIIBx8IQAgAykDECAcfCEIIBshByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAQIAAqAgCSOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ5oSAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEOaEgIAACyAEQuAAfCSAgICAAAunDAQJfgR/An0MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAMgBiARuyAQu0TvOfr+Qi7mP6KjthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEGIAUpAwAgAUIChiIJfCEAIAQpAwAgCXwhCCADKQMAIAl8IQkDQCAJIAgqAgC7IAAqAgC7RO85+v5CLuY/oqO2OAIAIABCBHwhACAIQgR8IQggCUIEfCEJIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVIAUpAzAhFiAFKQMAIRcgBSkDGCIYUCEMIAQpAxgiGVAhDiADKQMYIhpCf3xCA4YhGyAZQn98QgOGIRwgGEJ/fEIDhiEdA0AgFiEGAkAgDA0AIAUpAwggHXwhACAFKQMQIB18IQggGCEHIBYhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFyAGQgKGfCoCACEQIBQhBgJAIA4NACAEKQMIIBx8IQAgBCkDECAcfCEIIBkhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBUgBkIChnwqAgC7IBC7RO85+v5CLuY/oqO2IRAgEiEGAkAgGlANACADKQMIIBt8IQAgAykDECAbfCEIIBohByASIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBMgBkIChnwgEDgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEOiEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDohICAAAsgBELgAHwkgICAgAALqw4FCX4EfwN9DH4BfCAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAYgEbsgELtE7zn6/kIu5j+ioyASu6C2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgB8IQggBCkDACAAfCEJIAMpAwAgAHwhAANAIAAgCSoCALsgCCoCALtE7zn6/kIu5j+ioyAAKgIAu6C2OAIAIAhCBHwhCCAJQgR8IQkgAEIEfCEAIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCETIAMpAwAhFCAEKQMwIRUgBCkDACEWIAUpAzAhFyAFKQMAIRggBSkDGCIZUCEMIAQpAxgiGlAhDiADKQMYIhtCf3xCA4YhHCAaQn98QgOGIR0gGUJ/fEIDhiEeA0AgFyEGAkAgDA0AIAUpAwggHnwhACAFKQMQIB58IQggGSEHIBchBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGCAGQgKGfCoCACEQIBUhBgJAIA4NACAEKQMIIB18IQAgBCkDECAdfCEIIBohByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBYgBkIChnwqAgC7IBC7RO85+v5CLuY/oqMhHyATIQYCQCAbUA0AIAMpAwggHHwhACADKQMQIBx8IQggGyEHIBMhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFCAGQgKGfCIAIB8gACoCALugtjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEOqEgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhDqhICAAAsgBELgAHwkgICAgAALpwwECX4EfwJ9DH4gACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyADIAYgEbsgELtEFlW1u7FrAkCio7YQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiCXwhACAEKQMAIAl8IQggAykDACAJfCEJA0AgCSAIKgIAuyAAKgIAu0QWVbW7sWsCQKKjtjgCACAAQgR8IQAgCEIEfCEIIAlCBHwhCSAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhEiADKQMAIRMgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAUpAxgiGFAhDCAEKQMYIhlQIQ4gAykDGCIaQn98QgOGIRsgGUJ/fEIDhiEcIBhCf3xCA4YhHQNAIBYhBgJAIAwNACAFKQMIIB18IQAgBSkDECAdfCEIIBghByAWIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBcgBkIChnwqAgAhECAUIQYCQCAODQAgBCkDCCAcfCEAIAQpAxAgHHwhCCAZIQcgFCEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAVIAZCAoZ8KgIAuyAQu0QWVbW7sWsCQKKjtiEQIBIhBgJAIBpQDQAgAykDCCAbfCEAIAMpAxAgG3whCCAaIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyATIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDshICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ7ISAgAALIARC4AB8JICAgIAAC6sOBQl+BH8DfQx+AXwgACkDGCEDIAApAwghBAJAAkACQCAAKQMAIgUpA1BCAFINACAEKQNQQgBSDQAgAykDUFANAQsgASACWg0BA0AgBSkDMCEGAkAgBSkDGCIHUA0AIAUpAwggB0IDhiIIfEJ4fCEAIAUpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRAMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRAMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRAMAgsgBSkDACAGQgGGfC8BAEEQdL4hEAwBCyAFKQMAIAZCAoZ8KgIAIRALIAQpAzAhBgJAIAQpAxgiB1ANACAEKQMIIAdCA4YiCHxCeHwhACAEKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviERDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviERDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviERDAILIAQpAwAgBkIBhnwvAQBBEHS+IREMAQsgBCkDACAGQgKGfCoCACERCyADKQMwIQYCQCADKQMYIgdQDQAgAykDCCAHQgOGIgh8Qnh8IQAgAykDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEgwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEgwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEgwCCyADKQMAIAZCAYZ8LwEAQRB0viESDAELIAMpAwAgBkIChnwqAgAhEgsgAyAGIBG7IBC7RBZVtbuxawJAoqMgErugthCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACABIAJaDQEgAiABfSEGIAUpAwAgAUIChiIAfCEIIAQpAwAgAHwhCSADKQMAIAB8IQADQCAAIAkqAgC7IAgqAgC7RBZVtbuxawJAoqMgACoCALugtjgCACAIQgR8IQggCUIEfCEJIABCBHwhACAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFiAFKQMwIRcgBSkDACEYIAUpAxgiGVAhDCAEKQMYIhpQIQ4gAykDGCIbQn98QgOGIRwgGkJ/fEIDhiEdIBlCf3xCA4YhHgNAIBchBgJAIAwNACAFKQMIIB58IQAgBSkDECAefCEIIBkhByAXIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBggBkIChnwqAgAhECAVIQYCQCAODQAgBCkDCCAdfCEAIAQpAxAgHXwhCCAaIQcgFSEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAWIAZCAoZ8KgIAuyAQu0QWVbW7sWsCQKKjIR8gEyEGAkAgG1ANACADKQMIIBx8IQAgAykDECAcfCEIIBshByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAfIAAqAgC7oLY4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDuhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ7oSAgAALIARC4AB8JICAgIAAC9QMBAl+BH8CfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgAyAGIBG7RAAAAAAAAOC/oiAQu0QAAAAAAAD4PxCOgICAAKO2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgl8IQAgBCkDACAJfCEIIAMpAwAgCXwhCQNAIAkgCCoCALtEAAAAAAAA4L+iIAAqAgC7RAAAAAAAAPg/EI6AgIAAo7Y4AgAgAEIEfCEAIAhCBHwhCCAJQgR8IQkgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFSAGQgKGfCoCALtEAAAAAAAA4L+iIBC7RAAAAAAAAPg/EI6AgIAAo7YhECASIQYCQCAaUA0AIAMpAwggG3whACADKQMQIBt8IQggGiEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ8ISAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEPCEgIAACyAEQuAAfCSAgICAAAvgDgUJfgR/A30BfAx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRIMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRIMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRIMAgsgAykDACAGQgGGfC8BAEEQdL4hEgwBCyADKQMAIAZCAoZ8KgIAIRILIAMgBiASuyARu0QAAAAAAADgv6IgELtEAAAAAAAA+D8QjoCAgACjoLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiAHwhCCAEKQMAIAB8IQkgAykDACAAfCEAA0AgCSoCACEQIAgqAgC7RAAAAAAAAPg/EI6AgIAAIRMgACAAKgIAuyAQu0QAAAAAAADgv6IgE6OgtjgCACAIQgR8IQggCUIEfCEJIABCBHwhACAGQn98IgZCAFINAAwCCwsgASACWg0AIAMpAzAhFCADKQMAIRUgBCkDMCEWIAQpAwAhFyAFKQMwIRggBSkDACEZIAUpAxgiGlAhDCAEKQMYIhtQIQ4gAykDGCIcQn98QgOGIR0gG0J/fEIDhiEeIBpCf3xCA4YhHwNAIBghBgJAIAwNACAFKQMIIB98IQAgBSkDECAffCEIIBohByAYIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBkgBkIChnwqAgAhECAWIQYCQCAODQAgBCkDCCAefCEAIAQpAxAgHnwhCCAbIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAu0QAAAAAAADgP6IgELtEAAAAAAAA+D8QjoCAgACjIRMgFCEGAkAgHFANACADKQMIIB18IQAgAykDECAdfCEIIBwhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBUgBkIChnwiACAAKgIAuyATobY4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhDyhICAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQ8oSAgAALIARC4AB8JICAgIAAC6cMBAl+BH8CfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgAyAGIBG7RAAAAAAAAOA/oiAQu6O2EJSAgIAAIAFCAXwiASACUg0ADAILCwJAIAUtAEANACAELQBADQAgAy0AQA0AIAEgAloNASACIAF9IQYgBSkDACABQgKGIgl8IQAgBCkDACAJfCEIIAMpAwAgCXwhCQNAIAkgCCoCALtEAAAAAAAA4D+iIAAqAgC7o7Y4AgAgAEIEfCEAIAhCBHwhCCAJQgR8IQkgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFSAGQgKGfCoCALtEAAAAAAAA4D+iIBC7o7YhECASIQYCQCAaUA0AIAMpAwggG3whACADKQMQIBt8IQggGiEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ9ISAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEPSEgIAACyAEQuAAfCSAgICAAAurDgUJfgR/A30MfgF8IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAEgAloNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRIMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRIMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRIMAgsgAykDACAGQgGGfC8BAEEQdL4hEgwBCyADKQMAIAZCAoZ8KgIAIRILIAMgBiARu0QAAAAAAADgP6IgELujIBK7oLYQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiAHwhCCAEKQMAIAB8IQkgAykDACAAfCEAA0AgACAJKgIAu0QAAAAAAADgP6IgCCoCALujIAAqAgC7oLY4AgAgCEIEfCEIIAlCBHwhCSAAQgR8IQAgBkJ/fCIGQgBSDQAMAgsLIAEgAloNACADKQMwIRMgAykDACEUIAQpAzAhFSAEKQMAIRYgBSkDMCEXIAUpAwAhGCAFKQMYIhlQIQwgBCkDGCIaUCEOIAMpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQYCQCAMDQAgBSkDCCAefCEAIAUpAxAgHnwhCCAZIQcgFyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAYIAZCAoZ8KgIAIRAgFSEGAkAgDg0AIAQpAwggHXwhACAEKQMQIB18IQggGiEHIBUhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFiAGQgKGfCoCALtEAAAAAAAA4D+iIBC7oyEfIBMhBgJAIBtQDQAgAykDCCAcfCEAIAMpAxAgHHwhCCAbIQcgEyEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAUIAZCAoZ8IgAgHyAAKgIAu6C2OAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ9oSAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEPaEgIAACyAEQuAAfCSAgICAAAu/DQQJfgR/An0MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAMgBiARIBBDAAAAAF4gEEMAAAAAXWuylBCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEGIAMpAwAhCSAEKQMAIQggBSkDACEAAkAgAiABfUIBg1ANACAJIAFCAoYiB3wgCCAHfCoCACAAIAd8KgIAIhBDAAAAAF4gEEMAAAAAXWuylDgCACABQgF8IQELIAZCACACfVENASACIAF9IQYgACABQgKGIgd8IQAgCCAHfCEIIAkgB3whCQNAIAkgCCoCACAAKgIAIhBDAAAAAF4gEEMAAAAAXWuylDgCACAJQgR8IAhCBHwqAgAgAEIEfCoCACIQQwAAAABeIBBDAAAAAF1rspQ4AgAgAEIIfCEAIAhCCHwhCCAJQgh8IQkgBkJ+fCIGQgBSDQAMAgsLIAIgAVgNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFSAGQgKGfCoCACAQQwAAAABeIBBDAAAAAF1rspQhECASIQYCQCAaUA0AIAMpAwggG3whACADKQMQIBt8IQggGiEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ+ISAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEPiEgIAACyAEQuAAfCSAgICAAAuxDgQJfgR/A30MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyABIAJaDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAYgESAQQwAAAABeIBBDAAAAAF1rspQgEpIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgASACWg0BIAIgAX0hBiAFKQMAIAFCAoYiAHwhCCAEKQMAIAB8IQkgAykDACAAfCEAA0AgACAAKgIAIAkqAgAgCCoCACIQQwAAAABeIBBDAAAAAF1rspSSOAIAIAhCBHwhCCAJQgR8IQkgAEIEfCEAIAZCf3wiBkIAUg0ADAILCyABIAJaDQAgAykDMCETIAMpAwAhFCAEKQMwIRUgBCkDACEWIAUpAzAhFyAFKQMAIRggBSkDGCIZUCEMIAQpAxgiGlAhDiADKQMYIhtCf3xCA4YhHCAaQn98QgOGIR0gGUJ/fEIDhiEeA0AgFyEGAkAgDA0AIAUpAwggHnwhACAFKQMQIB58IQggGSEHIBchBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGCAGQgKGfCoCACEQIBUhBgJAIA4NACAEKQMIIB18IQAgBCkDECAdfCEIIBohByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBYgBkIChnwqAgAgEEMAAAAAXiAQQwAAAABda7KUIRAgEyEGAkAgG1ANACADKQMIIBx8IQAgAykDECAcfCEIIBshByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAQIAAqAgCSOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ+oSAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEPqEgIAACyAEQuAAfCSAgICAAAuDDQQJfgR/An0MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAMgBiARjCAQIBCUlRCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEGIAMpAwAhCSAEKQMAIQggBSkDACEAAkAgAiABfUIBg1ANACAJIAFCAoYiB3wgCCAHfCoCAIwgACAHfCoCACIQIBCUlTgCACABQgF8IQELIAZCACACfVENASACIAF9IQYgACABQgKGIgd8IQAgCCAHfCEIIAkgB3whCQNAIAkgCCoCAIwgACoCACIQIBCUlTgCACAJQgR8IAhCBHwqAgCMIABCBHwqAgAiECAQlJU4AgAgAEIIfCEAIAhCCHwhCCAJQgh8IQkgBkJ+fCIGQgBSDQAMAgsLIAIgAVgNACADKQMwIRIgAykDACETIAQpAzAhFCAEKQMAIRUgBSkDMCEWIAUpAwAhFyAFKQMYIhhQIQwgBCkDGCIZUCEOIAMpAxgiGkJ/fEIDhiEbIBlCf3xCA4YhHCAYQn98QgOGIR0DQCAWIQYCQCAMDQAgBSkDCCAdfCEAIAUpAxAgHXwhCCAYIQcgFiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyAXIAZCAoZ8KgIAIRAgFCEGAkAgDg0AIAQpAwggHHwhACAEKQMQIBx8IQggGSEHIBQhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFSAGQgKGfCoCAIwgECAQlJUhECASIQYCQCAaUA0AIAMpAwggG3whACADKQMQIBt8IQggGiEHIBIhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgEyAGQgKGfCAQOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ/ISAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEPyEgIAACyAEQuAAfCSAgICAAAuRDwQJfgR/A30MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviESDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviESDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviESDAILIAMpAwAgBkIBhnwvAQBBEHS+IRIMAQsgAykDACAGQgKGfCoCACESCyADIAYgEiARIBAgEJSVkxCUgICAACABQgF8IgEgAlINAAwCCwsCQCAFLQBADQAgBC0AQA0AIAMtAEANACACIAFYDQEgAUJ/hSEGIAMpAwAhACAEKQMAIQkgBSkDACEIAkAgAiABfUIBg1ANACAAIAFCAoYiB3wiCiAKKgIAIAkgB3wqAgAgCCAHfCoCACIQIBCUlZM4AgAgAUIBfCEBCyAGQgAgAn1RDQEgAiABfSEGIAggAUIChiIHfCEIIAkgB3whCSAAIAd8IQADQCAAIAAqAgAgCSoCACAIKgIAIhAgEJSVkzgCACAAQgR8IgcgByoCACAJQgR8KgIAIAhCBHwqAgAiECAQlJWTOAIAIAhCCHwhCCAJQgh8IQkgAEIIfCEAIAZCfnwiBkIAUg0ADAILCyACIAFYDQAgAykDMCETIAMpAwAhFCAEKQMwIRUgBCkDACEWIAUpAzAhFyAFKQMAIRggBSkDGCIZUCEMIAQpAxgiGlAhDiADKQMYIhtCf3xCA4YhHCAaQn98QgOGIR0gGUJ/fEIDhiEeA0AgFyEGAkAgDA0AIAUpAwggHnwhACAFKQMQIB58IQggGSEHIBchBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgGCAGQgKGfCoCACEQIBUhBgJAIA4NACAEKQMIIB18IQAgBCkDECAdfCEIIBohByAVIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBYgBkIChnwqAgAhESAQIBCUIRAgEyEGAkAgG1ANACADKQMIIBx8IQAgAykDECAcfCEIIBshByATIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBQgBkIChnwiACAAKgIAIBEgEJWTOAIAIAFCAXwiASACUg0ACwsLxwICAX4CfCOAgICAAELgAH0iBCSAgICAACAEQjh8QgA3AwAgBELAAHxCADcDACAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3AzAgBCADOAIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhACAEIAI3AyAgAikDICECAkACQEIALQDAxISAgICAgIAARQ0AIABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBQJAIAJQDQAgBEIIfEIAIAIQ/oSAgAALEIGAgIAAIQZCAEIAKwPQxISAgICAgIAAIAYgBaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyACUA0AIARCCHxCACACEP6EgIAACyAEQuAAfCSAgICAAAugDQQJfgR/An0MfiAAKQMYIQMgACkDCCEEAkACQAJAIAApAwAiBSkDUEIAUg0AIAQpA1BCAFINACADKQNQUA0BCyACIAFYDQEDQCAFKQMwIQYCQCAFKQMYIgdQDQAgBSkDCCAHQgOGIgh8Qnh8IQAgBSkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEAwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEAwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEAwCCyAFKQMAIAZCAYZ8LwEAQRB0viEQDAELIAUpAwAgBkIChnwqAgAhEAsgBCkDMCEGAkAgBCkDGCIHUA0AIAQpAwggB0IDhiIIfEJ4fCEAIAQpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IREMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IREMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IREMAgsgBCkDACAGQgGGfC8BAEEQdL4hEQwBCyAEKQMAIAZCAoZ8KgIAIRELIAMpAzAhBgJAIAMpAxgiB1ANACADKQMIIAdCA4YiCHxCeHwhACADKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIAMgBkMAAAAAIBEgEEMAAAAAXRsQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhBiADKQMAIQkgBCkDACEIIAUpAwAhAAJAIAIgAX1CAYNQDQAgCSABQgKGIgd8QwAAAAAgCCAHfCoCACAAIAd8KgIAQwAAAABdGzgCACABQgF8IQELIAZCACACfVENASACIAF9IQYgACABQgKGIgd8IQAgCCAHfCEIIAkgB3whCQNAIAlDAAAAACAIKgIAIAAqAgBDAAAAAF0bOAIAIAlCBHxDAAAAACAIQgR8KgIAIABCBHwqAgBDAAAAAF0bOAIAIABCCHwhACAIQgh8IQggCUIIfCEJIAZCfnwiBkIAUg0ADAILCyACIAFYDQAgAykDMCESIAMpAwAhEyAEKQMwIRQgBCkDACEVIAUpAzAhFiAFKQMAIRcgBSkDGCIYUCEMIAQpAxgiGVAhDiADKQMYIhpCf3xCA4YhGyAZQn98QgOGIRwgGEJ/fEIDhiEdA0AgFiEGAkAgDA0AIAUpAwggHXwhACAFKQMQIB18IQggGCEHIBYhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFyAGQgKGfCoCACEQIBQhBgJAIA4NACAEKQMIIBx8IQAgBCkDECAcfCEIIBkhByAUIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLQwAAAAAgFSAGQgKGfCoCACAQQwAAAABdGyEQIBIhBgJAIBpQDQAgAykDCCAbfCEAIAMpAxAgG3whCCAaIQcgEiEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCyATIAZCAoZ8IBA4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhCAhYCAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQgIWAgAALIARC4AB8JICAgIAAC68PBAl+BH8DfQx+IAApAxghAyAAKQMIIQQCQAJAAkAgACkDACIFKQNQQgBSDQAgBCkDUEIAUg0AIAMpA1BQDQELIAIgAVgNAQNAIAUpAzAhBgJAIAUpAxgiB1ANACAFKQMIIAdCA4YiCHxCeHwhACAFKQMQIAh8Qnh8IQggASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAGQgGGfC4BACIMQf8HcSENIAxBgICAgHhxIQ4CQCAMQf//A3EiD0EKdkEfcSIMRQ0AAkAgDEEfRw0AIA4gD0ENdHJBgICA/AdyviEQDAQLIAxBF3RBgICAwANqIA5yIA1BDXRyviEQDAMLAkAgDUUNAEGAgICYBCANZyIMQRd0ayAOciAPIAxBamp0QQ50QYCA/wNxciEOCyAOviEQDAILIAUpAwAgBkIBhnwvAQBBEHS+IRAMAQsgBSkDACAGQgKGfCoCACEQCyAEKQMwIQYCQCAEKQMYIgdQDQAgBCkDCCAHQgOGIgh8Qnh8IQAgBCkDECAIfEJ4fCEIIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgBkIBhnwuAQAiDEH/B3EhDSAMQYCAgIB4cSEOAkAgDEH//wNxIg9BCnZBH3EiDEUNAAJAIAxBH0cNACAOIA9BDXRyQYCAgPwHcr4hEQwECyAMQRd0QYCAgMADaiAOciANQQ10cr4hEQwDCwJAIA1FDQBBgICAmAQgDWciDEEXdGsgDnIgDyAMQWpqdEEOdEGAgP8DcXIhDgsgDr4hEQwCCyAEKQMAIAZCAYZ8LwEAQRB0viERDAELIAQpAwAgBkIChnwqAgAhEQsgAykDMCEGAkAgAykDGCIHUA0AIAMpAwggB0IDhiIIfEJ4fCEAIAMpAxAgCHxCeHwhCCABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAZCAYZ8LgEAIgxB/wdxIQ0gDEGAgICAeHEhDgJAIAxB//8DcSIPQQp2QR9xIgxFDQACQCAMQR9HDQAgDiAPQQ10ckGAgID8B3K+IRIMBAsgDEEXdEGAgIDAA2ogDnIgDUENdHK+IRIMAwsCQCANRQ0AQYCAgJgEIA1nIgxBF3RrIA5yIA8gDEFqanRBDnRBgID/A3FyIQ4LIA6+IRIMAgsgAykDACAGQgGGfC8BAEEQdL4hEgwBCyADKQMAIAZCAoZ8KgIAIRILIAMgBkMAAAAAIBEgEEMAAAAAXRsgEpIQlICAgAAgAUIBfCIBIAJSDQAMAgsLAkAgBS0AQA0AIAQtAEANACADLQBADQAgAiABWA0BIAFCf4UhBiADKQMAIQAgBCkDACEJIAUpAwAhCAJAIAIgAX1CAYNQDQAgACABQgKGIgd8IgpDAAAAACAJIAd8KgIAIAggB3wqAgBDAAAAAF0bIAoqAgCSOAIAIAFCAXwhAQsgBkIAIAJ9UQ0BIAIgAX0hBiAIIAFCAoYiB3whCCAJIAd8IQkgACAHfCEAA0AgAEMAAAAAIAkqAgAgCCoCAEMAAAAAXRsgACoCAJI4AgAgAEIEfCIHQwAAAAAgCUIEfCoCACAIQgR8KgIAQwAAAABdGyAHKgIAkjgCACAIQgh8IQggCUIIfCEJIABCCHwhACAGQn58IgZCAFINAAwCCwsgAiABWA0AIAMpAzAhEyADKQMAIRQgBCkDMCEVIAQpAwAhFiAFKQMwIRcgBSkDACEYIAUpAxgiGVAhDCAEKQMYIhpQIQ4gAykDGCIbQn98QgOGIRwgGkJ/fEIDhiEdIBlCf3xCA4YhHgNAIBchBgJAIAwNACAFKQMIIB58IQAgBSkDECAefCEIIBkhByAXIQYgASEJA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBnwhBiAAQnh8IQAgCEJ4fCEIIAshCSAHQn98IgdCAFINAAsLIBggBkIChnwqAgAhECAVIQYCQCAODQAgBCkDCCAdfCEAIAQpAxAgHXwhCCAaIQcgFSEGIAEhCQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAZ8IQYgAEJ4fCEAIAhCeHwhCCALIQkgB0J/fCIHQgBSDQALC0MAAAAAIBYgBkIChnwqAgAgEEMAAAAAXRshECATIQYCQCAbUA0AIAMpAwggHHwhACADKQMQIBx8IQggGyEHIBMhBiABIQkDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAGfCEGIABCeHwhACAIQnh8IQggCyEJIAdCf3wiB0IAUg0ACwsgFCAGQgKGfCIAIBAgACoCAJI4AgAgAUIBfCIBIAJSDQALCwvHAgIBfgJ8I4CAgIAAQuAAfSIEJICAgIAAIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDMCAEIAM4AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEAIAQgAjcDICACKQMgIQICQAJAQgAtAMDEhICAgICAgABFDQAgAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEFAkAgAlANACAEQgh8QgAgAhCChYCAAAsQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAJQDQAgBEIIfEIAIAIQgoWAgAALIARC4AB8JICAgIAAC7gNBQF9CX4EfwJ9DH4gACoCICEDIAApAxghBCAAKQMIIQUCQAJAAkAgACkDACIGKQNQQgBSDQAgBSkDUEIAUg0AIAQpA1BQDQELIAIgAVgNAQNAIAYpAzAhBwJAIAYpAxgiCFANACAGKQMIIAhCA4YiCXxCeHwhACAGKQMQIAl8Qnh8IQkgASEKA0AgCSkDACAKIAogACkDACILgCIMIAt+fX4gB3whByAAQnh8IQAgCUJ4fCEJIAwhCiAIQn98IghCAFINAAsLAkACQCAGKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBikDACAHQgGGfC4BACINQf8HcSEOIA1BgICAgHhxIQ8CQCANQf//A3EiEEEKdkEfcSINRQ0AAkAgDUEfRw0AIA8gEEENdHJBgICA/AdyviERDAQLIA1BF3RBgICAwANqIA9yIA5BDXRyviERDAMLAkAgDkUNAEGAgICYBCAOZyINQRd0ayAPciAQIA1Bamp0QQ50QYCA/wNxciEPCyAPviERDAILIAYpAwAgB0IBhnwvAQBBEHS+IREMAQsgBikDACAHQgKGfCoCACERCyAFKQMwIQcCQCAFKQMYIghQDQAgBSkDCCAIQgOGIgl8Qnh8IQAgBSkDECAJfEJ4fCEJIAEhCgNAIAkpAwAgCiAKIAApAwAiC4AiDCALfn1+IAd8IQcgAEJ4fCEAIAlCeHwhCSAMIQogCEJ/fCIIQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgB0IBhnwuAQAiDUH/B3EhDiANQYCAgIB4cSEPAkAgDUH//wNxIhBBCnZBH3EiDUUNAAJAIA1BH0cNACAPIBBBDXRyQYCAgPwHcr4hEgwECyANQRd0QYCAgMADaiAPciAOQQ10cr4hEgwDCwJAIA5FDQBBgICAmAQgDmciDUEXdGsgD3IgECANQWpqdEEOdEGAgP8DcXIhDwsgD74hEgwCCyAFKQMAIAdCAYZ8LwEAQRB0viESDAELIAUpAwAgB0IChnwqAgAhEgsgBCkDMCEHAkAgBCkDGCIIUA0AIAQpAwggCEIDhiIJfEJ4fCEAIAQpAxAgCXxCeHwhCSABIQoDQCAJKQMAIAogCiAAKQMAIguAIgwgC359fiAHfCEHIABCeHwhACAJQnh8IQkgDCEKIAhCf3wiCEIAUg0ACwsgBCAHIANDAACAPyARQwAAAABdGyASlBCUgICAACABQgF8IgEgAlINAAwCCwsCQCAGLQBADQAgBS0AQA0AIAQtAEANACACIAFYDQEgAUJ/hSEHIAQpAwAhCiAFKQMAIQkgBikDACEAAkAgAiABfUIBg1ANACAKIAFCAoYiCHwgCSAIfCoCACADQwAAgD8gACAIfCoCAEMAAAAAXRuUOAIAIAFCAXwhAQsgB0IAIAJ9UQ0BIAIgAX0hByAAIAFCAoYiCHwhACAJIAh8IQkgCiAIfCEKA0AgCiAJKgIAIANDAACAPyAAKgIAQwAAAABdG5Q4AgAgCkIEfCAJQgR8KgIAIANDAACAPyAAQgR8KgIAQwAAAABdG5Q4AgAgAEIIfCEAIAlCCHwhCSAKQgh8IQogB0J+fCIHQgBSDQAMAgsLIAIgAVgNACAEKQMwIRMgBCkDACEUIAUpAzAhFSAFKQMAIRYgBikDMCEXIAYpAwAhGCAGKQMYIhlQIQ0gBSkDGCIaUCEPIAQpAxgiG0J/fEIDhiEcIBpCf3xCA4YhHSAZQn98QgOGIR4DQCAXIQcCQCANDQAgBikDCCAefCEAIAYpAxAgHnwhCSAZIQggFyEHIAEhCgNAIAkpAwAgCiAKIAApAwAiC4AiDCALfn1+IAd8IQcgAEJ4fCEAIAlCeHwhCSAMIQogCEJ/fCIIQgBSDQALCyAYIAdCAoZ8KgIAIREgFSEHAkAgDw0AIAUpAwggHXwhACAFKQMQIB18IQkgGiEIIBUhByABIQoDQCAJKQMAIAogCiAAKQMAIguAIgwgC359fiAHfCEHIABCeHwhACAJQnh8IQkgDCEKIAhCf3wiCEIAUg0ACwsgA0MAAIA/IBFDAAAAAF0bIBYgB0IChnwqAgCUIREgEyEHAkAgG1ANACAEKQMIIBx8IQAgBCkDECAcfCEJIBshCCATIQcgASEKA0AgCSkDACAKIAogACkDACILgCIMIAt+fX4gB3whByAAQnh8IQAgCUJ4fCEJIAwhCiAIQn98IghCAFINAAsLIBQgB0IChnwgETgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEISFgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhCEhYCAAAsgBELgAHwkgICAgAALxw8FAX0JfgR/A30MfiAAKgIgIQMgACkDGCEEIAApAwghBQJAAkACQCAAKQMAIgYpA1BCAFINACAFKQNQQgBSDQAgBCkDUFANAQsgAiABWA0BA0AgBikDMCEHAkAgBikDGCIIUA0AIAYpAwggCEIDhiIJfEJ4fCEAIAYpAxAgCXxCeHwhCSABIQoDQCAJKQMAIAogCiAAKQMAIguAIgwgC359fiAHfCEHIABCeHwhACAJQnh8IQkgDCEKIAhCf3wiCEIAUg0ACwsCQAJAIAYpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIAdCAYZ8LgEAIg1B/wdxIQ4gDUGAgICAeHEhDwJAIA1B//8DcSIQQQp2QR9xIg1FDQACQCANQR9HDQAgDyAQQQ10ckGAgID8B3K+IREMBAsgDUEXdEGAgIDAA2ogD3IgDkENdHK+IREMAwsCQCAORQ0AQYCAgJgEIA5nIg1BF3RrIA9yIBAgDUFqanRBDnRBgID/A3FyIQ8LIA++IREMAgsgBikDACAHQgGGfC8BAEEQdL4hEQwBCyAGKQMAIAdCAoZ8KgIAIRELIAUpAzAhBwJAIAUpAxgiCFANACAFKQMIIAhCA4YiCXxCeHwhACAFKQMQIAl8Qnh8IQkgASEKA0AgCSkDACAKIAogACkDACILgCIMIAt+fX4gB3whByAAQnh8IQAgCUJ4fCEJIAwhCiAIQn98IghCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAHQgGGfC4BACINQf8HcSEOIA1BgICAgHhxIQ8CQCANQf//A3EiEEEKdkEfcSINRQ0AAkAgDUEfRw0AIA8gEEENdHJBgICA/AdyviESDAQLIA1BF3RBgICAwANqIA9yIA5BDXRyviESDAMLAkAgDkUNAEGAgICYBCAOZyINQRd0ayAPciAQIA1Bamp0QQ50QYCA/wNxciEPCyAPviESDAILIAUpAwAgB0IBhnwvAQBBEHS+IRIMAQsgBSkDACAHQgKGfCoCACESCyAEKQMwIQcCQCAEKQMYIghQDQAgBCkDCCAIQgOGIgl8Qnh8IQAgBCkDECAJfEJ4fCEJIAEhCgNAIAkpAwAgCiAKIAApAwAiC4AiDCALfn1+IAd8IQcgAEJ4fCEAIAlCeHwhCSAMIQogCEJ/fCIIQgBSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgB0IBhnwuAQAiDUH/B3EhDiANQYCAgIB4cSEPAkAgDUH//wNxIhBBCnZBH3EiDUUNAAJAIA1BH0cNACAPIBBBDXRyQYCAgPwHcr4hEwwECyANQRd0QYCAgMADaiAPciAOQQ10cr4hEwwDCwJAIA5FDQBBgICAmAQgDmciDUEXdGsgD3IgECANQWpqdEEOdEGAgP8DcXIhDwsgD74hEwwCCyAEKQMAIAdCAYZ8LwEAQRB0viETDAELIAQpAwAgB0IChnwqAgAhEwsgBCAHIANDAACAPyARQwAAAABdGyASlCATkhCUgICAACABQgF8IgEgAlINAAwCCwsCQCAGLQBADQAgBS0AQA0AIAQtAEANACACIAFYDQEgAUJ/hSEHIAQpAwAhACAFKQMAIQogBikDACEJAkAgAiABfUIBg1ANACAAIAFCAoYiCHwiCyAKIAh8KgIAIANDAACAPyAJIAh8KgIAQwAAAABdG5QgCyoCAJI4AgAgAUIBfCEBCyAHQgAgAn1RDQEgAiABfSEHIAkgAUIChiIIfCEJIAogCHwhCiAAIAh8IQADQCAAIAoqAgAgA0MAAIA/IAkqAgBDAAAAAF0blCAAKgIAkjgCACAAQgR8IgggCkIEfCoCACADQwAAgD8gCUIEfCoCAEMAAAAAXRuUIAgqAgCSOAIAIAlCCHwhCSAKQgh8IQogAEIIfCEAIAdCfnwiB0IAUg0ADAILCyACIAFYDQAgBCkDMCEUIAQpAwAhFSAFKQMwIRYgBSkDACEXIAYpAzAhGCAGKQMAIRkgBikDGCIaUCENIAUpAxgiG1AhDyAEKQMYIhxCf3xCA4YhHSAbQn98QgOGIR4gGkJ/fEIDhiEfA0AgGCEHAkAgDQ0AIAYpAwggH3whACAGKQMQIB98IQkgGiEIIBghByABIQoDQCAJKQMAIAogCiAAKQMAIguAIgwgC359fiAHfCEHIABCeHwhACAJQnh8IQkgDCEKIAhCf3wiCEIAUg0ACwsgGSAHQgKGfCoCACERIBYhBwJAIA8NACAFKQMIIB58IQAgBSkDECAefCEJIBshCCAWIQcgASEKA0AgCSkDACAKIAogACkDACILgCIMIAt+fX4gB3whByAAQnh8IQAgCUJ4fCEJIAwhCiAIQn98IghCAFINAAsLIANDAACAPyARQwAAAABdGyAXIAdCAoZ8KgIAlCERIBQhBwJAIBxQDQAgBCkDCCAdfCEAIAQpAxAgHXwhCSAcIQggFCEHIAEhCgNAIAkpAwAgCiAKIAApAwAiC4AiDCALfn1+IAd8IQcgAEJ4fCEAIAlCeHwhCSAMIQogCEJ/fCIIQgBSDQALCyAVIAdCAoZ8IgAgESAAKgIAkjgCACABQgF8IgEgAlINAAsLC8cCAgF+AnwjgICAgABC4AB9IgQkgICAgAAgBEI4fEIANwMAIARCwAB8QgA3AwAgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwMwIAQgAzgCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQAgBCACNwMgIAIpAyAhAgJAAkBCAC0AwMSEgICAgICAAEUNACAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUCQCACUA0AIARCCHxCACACEIaFgIAACxCBgICAACEGQgBCACsD0MSEgICAgICAACAGIAWhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgAlANACAEQgh8QgAgAhCGhYCAAAsgBELgAHwkgICAgAAL8AUDD34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMIIQQgACkDACEFIAApAyhCeHwhBiAAKQMwQnh8IQcDQCADKQMwIQggBCkDMCEJIAUpAzAhCgJAIAMpAxgiC1ANACAGIAtCA4YiDHwhACAHIAx8IQ0gAykDCCAMfEJ4fCEOIAMpAxAgDHxCeHwhDCABIQ8DQCAMKQMAIA8gDyAOKQMAIhCAIhEgEH59Ig9+IAh8IQggDSkDACAPfiAJfCEJIAApAwAgD34gCnwhCiAOQnh8IQ4gAEJ4fCEAIA1CeHwhDSAMQnh8IQwgESEPIAtCf3wiC0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIApCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRYMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRYMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRYMAgsgBSkDACAKQgGGfC8BAEEQdL4hFgwBCyAFKQMAIApCAoZ8KgIAIRYLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAJQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEXDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEXDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEXDAILIAQpAwAgCUIBhnwvAQBBEHS+IRcMAQsgBCkDACAJQgKGfCoCACEXCyADIAggFiAXkhCUgICAACABQgF8IgEgAlINAAsLC9sEAg5+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgAikDGCIFQgOGIgZCD3xCcIMiB30iCCIDJICAgIAAIAMgB30iCSSAgICAAAJAIAVQDQAgACkDGCIDQn98IQogASkDGCIHQn98IQsgCCAGQnh8IgZ8IQwgCSAGfCENIANCA4ZCeHwhDiAHQgOGQnh8IQ9CACEDIAUhBwNAQgAhEAJAIAUgCiAHIgZ8Vg0AQgAhECAAKQMIIA58IAN8KQMAQgFRDQAgACkDECAOfCADfCkDACEQCyAGQn98IQcgDCADfCAQNwMAQgAhEAJAIAUgCyAGfFYNACABKQMIIA98IAN8KQMAQgFRDQAgASkDECAPfCADfCkDACEQCyANIAN8IBA3AwAgA0J4fCEDIAdCAFINAAsLIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDQCAEIAk3AzggBCAINwMwIARBADYCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQcgBCACNwMgIAIpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAHQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIRECQCADUA0AIARCCHxCACADEIiFgIAACxCBgICAACESQgBCACsD0MSEgICAgICAACASIBGhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCIhYCAAAsgBELgAHwkgICAgAAL4QcDD34EfwN9AkAgASACWg0AIAApAxghAyAAKQMIIQQgACkDACEFIAApAyhCeHwhBiAAKQMwQnh8IQcDQCADKQMwIQggBCkDMCEJIAUpAzAhCgJAIAMpAxgiC1ANACAGIAtCA4YiDHwhACAHIAx8IQ0gAykDCCAMfEJ4fCEOIAMpAxAgDHxCeHwhDCABIQ8DQCAMKQMAIA8gDyAOKQMAIhCAIhEgEH59Ig9+IAh8IQggDSkDACAPfiAJfCEJIAApAwAgD34gCnwhCiAOQnh8IQ4gAEJ4fCEAIA1CeHwhDSAMQnh8IQwgESEPIAtCf3wiC0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIApCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRYMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRYMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRYMAgsgBSkDACAKQgGGfC8BAEEQdL4hFgwBCyAFKQMAIApCAoZ8KgIAIRYLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAJQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEXDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEXDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEXDAILIAQpAwAgCUIBhnwvAQBBEHS+IRcMAQsgBCkDACAJQgKGfCoCACEXCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgCEIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hGAwECyASQRd0QYCAgMADaiAUciATQQ10cr4hGAwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hGAwCCyADKQMAIAhCAYZ8LwEAQRB0viEYDAELIAMpAwAgCEIChnwqAgAhGAsgAyAIIBYgF5IgGJIQlICAgAAgAUIBfCIBIAJSDQALCwvbBAIOfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAIpAxgiBUIDhiIGQg98QnCDIgd9IggiAySAgICAACADIAd9IgkkgICAgAACQCAFUA0AIAApAxgiA0J/fCEKIAEpAxgiB0J/fCELIAggBkJ4fCIGfCEMIAkgBnwhDSADQgOGQnh8IQ4gB0IDhkJ4fCEPQgAhAyAFIQcDQEIAIRACQCAFIAogByIGfFYNAEIAIRAgACkDCCAOfCADfCkDAEIBUQ0AIAApAxAgDnwgA3wpAwAhEAsgBkJ/fCEHIAwgA3wgEDcDAEIAIRACQCAFIAsgBnxWDQAgASkDCCAPfCADfCkDAEIBUQ0AIAEpAxAgD3wgA3wpAwAhEAsgDSADfCAQNwMAIANCeHwhAyAHQgBSDQALCyAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3A0AgBCAJNwM4IAQgCDcDMCAEQQA2AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEHIAQgAjcDICACKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgB0IAUg0AQgBCATcDyMSEgICAgICAABCBgICAACERAkAgA1ANACAEQgh8QgAgAxCKhYCAAAsQgYCAgAAhEkIAQgArA9DEhICAgICAgAAgEiARoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQioWAgAALIARC4AB8JICAgIAAC/AFAw9+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMoQnh8IQYgACkDMEJ4fCEHA0AgAykDMCEIIAQpAzAhCSAFKQMwIQoCQCADKQMYIgtQDQAgBiALQgOGIgx8IQAgByAMfCENIAMpAwggDHxCeHwhDiADKQMQIAx8Qnh8IQwgASEPA0AgDCkDACAPIA8gDikDACIQgCIRIBB+fSIPfiAIfCEIIA0pAwAgD34gCXwhCSAAKQMAIA9+IAp8IQogDkJ4fCEOIABCeHwhACANQnh8IQ0gDEJ4fCEMIBEhDyALQn98IgtCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAKQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEWDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEWDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEWDAILIAUpAwAgCkIBhnwvAQBBEHS+IRYMAQsgBSkDACAKQgKGfCoCACEWCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCUIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hFwwECyASQRd0QYCAgMADaiAUciATQQ10cr4hFwwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hFwwCCyAEKQMAIAlCAYZ8LwEAQRB0viEXDAELIAQpAwAgCUIChnwqAgAhFwsgAyAIIBYgF5MQlICAgAAgAUIBfCIBIAJSDQALCwvbBAIOfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAIpAxgiBUIDhiIGQg98QnCDIgd9IggiAySAgICAACADIAd9IgkkgICAgAACQCAFUA0AIAApAxgiA0J/fCEKIAEpAxgiB0J/fCELIAggBkJ4fCIGfCEMIAkgBnwhDSADQgOGQnh8IQ4gB0IDhkJ4fCEPQgAhAyAFIQcDQEIAIRACQCAFIAogByIGfFYNAEIAIRAgACkDCCAOfCADfCkDAEIBUQ0AIAApAxAgDnwgA3wpAwAhEAsgBkJ/fCEHIAwgA3wgEDcDAEIAIRACQCAFIAsgBnxWDQAgASkDCCAPfCADfCkDAEIBUQ0AIAEpAxAgD3wgA3wpAwAhEAsgDSADfCAQNwMAIANCeHwhAyAHQgBSDQALCyAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3A0AgBCAJNwM4IAQgCDcDMCAEQQA2AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEHIAQgAjcDICACKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgB0IAUg0AQgBCATcDyMSEgICAgICAABCBgICAACERAkAgA1ANACAEQgh8QgAgAxCMhYCAAAsQgYCAgAAhEkIAQgArA9DEhICAgICAgAAgEiARoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQjIWAgAALIARC4AB8JICAgIAAC+EHAw9+BH8DfQJAIAEgAloNACAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMoQnh8IQYgACkDMEJ4fCEHA0AgAykDMCEIIAQpAzAhCSAFKQMwIQoCQCADKQMYIgtQDQAgBiALQgOGIgx8IQAgByAMfCENIAMpAwggDHxCeHwhDiADKQMQIAx8Qnh8IQwgASEPA0AgDCkDACAPIA8gDikDACIQgCIRIBB+fSIPfiAIfCEIIA0pAwAgD34gCXwhCSAAKQMAIA9+IAp8IQogDkJ4fCEOIABCeHwhACANQnh8IQ0gDEJ4fCEMIBEhDyALQn98IgtCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAKQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEWDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEWDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEWDAILIAUpAwAgCkIBhnwvAQBBEHS+IRYMAQsgBSkDACAKQgKGfCoCACEWCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCUIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hFwwECyASQRd0QYCAgMADaiAUciATQQ10cr4hFwwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hFwwCCyAEKQMAIAlCAYZ8LwEAQRB0viEXDAELIAQpAwAgCUIChnwqAgAhFwsCQAJAIAMpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyADKQMAIAhCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRgMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRgMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRgMAgsgAykDACAIQgGGfC8BAEEQdL4hGAwBCyADKQMAIAhCAoZ8KgIAIRgLIAMgCCAWIBeTIBiSEJSAgIAAIAFCAXwiASACUg0ACwsL2wQCDn4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyACKQMYIgVCA4YiBkIPfEJwgyIHfSIIIgMkgICAgAAgAyAHfSIJJICAgIAAAkAgBVANACAAKQMYIgNCf3whCiABKQMYIgdCf3whCyAIIAZCeHwiBnwhDCAJIAZ8IQ0gA0IDhkJ4fCEOIAdCA4ZCeHwhD0IAIQMgBSEHA0BCACEQAkAgBSAKIAciBnxWDQBCACEQIAApAwggDnwgA3wpAwBCAVENACAAKQMQIA58IAN8KQMAIRALIAZCf3whByAMIAN8IBA3AwBCACEQAkAgBSALIAZ8Vg0AIAEpAwggD3wgA3wpAwBCAVENACABKQMQIA98IAN8KQMAIRALIA0gA3wgEDcDACADQnh8IQMgB0IAUg0ACwsgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwNAIAQgCTcDOCAEIAg3AzAgBEEANgIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhByAEIAI3AyAgAikDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAdCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhEQJAIANQDQAgBEIIfEIAIAMQjoWAgAALEIGAgIAAIRJCAEIAKwPQxISAgICAgIAAIBIgEaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEI6FgIAACyAEQuAAfCSAgICAAAvwBQMPfgR/An0CQCABIAJaDQAgACkDGCEDIAApAwghBCAAKQMAIQUgACkDKEJ4fCEGIAApAzBCeHwhBwNAIAMpAzAhCCAEKQMwIQkgBSkDMCEKAkAgAykDGCILUA0AIAYgC0IDhiIMfCEAIAcgDHwhDSADKQMIIAx8Qnh8IQ4gAykDECAMfEJ4fCEMIAEhDwNAIAwpAwAgDyAPIA4pAwAiEIAiESAQfn0iD34gCHwhCCANKQMAIA9+IAl8IQkgACkDACAPfiAKfCEKIA5CeHwhDiAAQnh8IQAgDUJ4fCENIAxCeHwhDCARIQ8gC0J/fCILQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgCkIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hFgwECyASQRd0QYCAgMADaiAUciATQQ10cr4hFgwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hFgwCCyAFKQMAIApCAYZ8LwEAQRB0viEWDAELIAUpAwAgCkIChnwqAgAhFgsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAlCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRcMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRcMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRcMAgsgBCkDACAJQgGGfC8BAEEQdL4hFwwBCyAEKQMAIAlCAoZ8KgIAIRcLIAMgCCAWIBeUEJSAgIAAIAFCAXwiASACUg0ACwsL2wQCDn4CfCOAgICAAELgAH0iAyEEIAMkgICAgAAgAyACKQMYIgVCA4YiBkIPfEJwgyIHfSIIIgMkgICAgAAgAyAHfSIJJICAgIAAAkAgBVANACAAKQMYIgNCf3whCiABKQMYIgdCf3whCyAIIAZCeHwiBnwhDCAJIAZ8IQ0gA0IDhkJ4fCEOIAdCA4ZCeHwhD0IAIQMgBSEHA0BCACEQAkAgBSAKIAciBnxWDQBCACEQIAApAwggDnwgA3wpAwBCAVENACAAKQMQIA58IAN8KQMAIRALIAZCf3whByAMIAN8IBA3AwBCACEQAkAgBSALIAZ8Vg0AIAEpAwggD3wgA3wpAwBCAVENACABKQMQIA98IAN8KQMAIRALIA0gA3wgEDcDACADQnh8IQMgB0IAUg0ACwsgBELIAHxCADcDACAEQtAAfEIANwMAIARC2AB8QgA3AwAgBEIANwNAIAQgCTcDOCAEIAg3AzAgBEEANgIoIARCADcDGCAEIAE3AxAgBCAANwMIQgApA8jEhICAgICAgAAhByAEIAI3AyAgAikDICEDAkACQEIALQDAxISAgICAgIAARQ0AIAdCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhEQJAIANQDQAgBEIIfEIAIAMQkIWAgAALEIGAgIAAIRJCAEIAKwPQxISAgICAgIAAIBIgEaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyADUA0AIARCCHxCACADEJCFgIAACyAEQuAAfCSAgICAAAvhBwMPfgR/A30CQCABIAJaDQAgACkDGCEDIAApAwghBCAAKQMAIQUgACkDKEJ4fCEGIAApAzBCeHwhBwNAIAMpAzAhCCAEKQMwIQkgBSkDMCEKAkAgAykDGCILUA0AIAYgC0IDhiIMfCEAIAcgDHwhDSADKQMIIAx8Qnh8IQ4gAykDECAMfEJ4fCEMIAEhDwNAIAwpAwAgDyAPIA4pAwAiEIAiESAQfn0iD34gCHwhCCANKQMAIA9+IAl8IQkgACkDACAPfiAKfCEKIA5CeHwhDiAAQnh8IQAgDUJ4fCENIAxCeHwhDCARIQ8gC0J/fCILQgBSDQALCwJAAkAgBSkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgCkIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hFgwECyASQRd0QYCAgMADaiAUciATQQ10cr4hFgwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hFgwCCyAFKQMAIApCAYZ8LwEAQRB0viEWDAELIAUpAwAgCkIChnwqAgAhFgsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAlCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRcMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRcMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRcMAgsgBCkDACAJQgGGfC8BAEEQdL4hFwwBCyAEKQMAIAlCAoZ8KgIAIRcLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAIQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEYDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEYDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEYDAILIAMpAwAgCEIBhnwvAQBBEHS+IRgMAQsgAykDACAIQgKGfCoCACEYCyADIAggFiAXlCAYkhCUgICAACABQgF8IgEgAlINAAsLC9sEAg5+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgAikDGCIFQgOGIgZCD3xCcIMiB30iCCIDJICAgIAAIAMgB30iCSSAgICAAAJAIAVQDQAgACkDGCIDQn98IQogASkDGCIHQn98IQsgCCAGQnh8IgZ8IQwgCSAGfCENIANCA4ZCeHwhDiAHQgOGQnh8IQ9CACEDIAUhBwNAQgAhEAJAIAUgCiAHIgZ8Vg0AQgAhECAAKQMIIA58IAN8KQMAQgFRDQAgACkDECAOfCADfCkDACEQCyAGQn98IQcgDCADfCAQNwMAQgAhEAJAIAUgCyAGfFYNACABKQMIIA98IAN8KQMAQgFRDQAgASkDECAPfCADfCkDACEQCyANIAN8IBA3AwAgA0J4fCEDIAdCAFINAAsLIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDQCAEIAk3AzggBCAINwMwIARBADYCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQcgBCACNwMgIAIpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAHQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIRECQCADUA0AIARCCHxCACADEJKFgIAACxCBgICAACESQgBCACsD0MSEgICAgICAACASIBGhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCShYCAAAsgBELgAHwkgICAgAAL8AUDD34EfwJ9AkAgASACWg0AIAApAxghAyAAKQMIIQQgACkDACEFIAApAyhCeHwhBiAAKQMwQnh8IQcDQCADKQMwIQggBCkDMCEJIAUpAzAhCgJAIAMpAxgiC1ANACAGIAtCA4YiDHwhACAHIAx8IQ0gAykDCCAMfEJ4fCEOIAMpAxAgDHxCeHwhDCABIQ8DQCAMKQMAIA8gDyAOKQMAIhCAIhEgEH59Ig9+IAh8IQggDSkDACAPfiAJfCEJIAApAwAgD34gCnwhCiAOQnh8IQ4gAEJ4fCEAIA1CeHwhDSAMQnh8IQwgESEPIAtCf3wiC0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIApCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRYMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRYMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRYMAgsgBSkDACAKQgGGfC8BAEEQdL4hFgwBCyAFKQMAIApCAoZ8KgIAIRYLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAJQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEXDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEXDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEXDAILIAQpAwAgCUIBhnwvAQBBEHS+IRcMAQsgBCkDACAJQgKGfCoCACEXCyADIAggFiAXlRCUgICAACABQgF8IgEgAlINAAsLC9sEAg5+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgAikDGCIFQgOGIgZCD3xCcIMiB30iCCIDJICAgIAAIAMgB30iCSSAgICAAAJAIAVQDQAgACkDGCIDQn98IQogASkDGCIHQn98IQsgCCAGQnh8IgZ8IQwgCSAGfCENIANCA4ZCeHwhDiAHQgOGQnh8IQ9CACEDIAUhBwNAQgAhEAJAIAUgCiAHIgZ8Vg0AQgAhECAAKQMIIA58IAN8KQMAQgFRDQAgACkDECAOfCADfCkDACEQCyAGQn98IQcgDCADfCAQNwMAQgAhEAJAIAUgCyAGfFYNACABKQMIIA98IAN8KQMAQgFRDQAgASkDECAPfCADfCkDACEQCyANIAN8IBA3AwAgA0J4fCEDIAdCAFINAAsLIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDQCAEIAk3AzggBCAINwMwIARBADYCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQcgBCACNwMgIAIpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAHQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIRECQCADUA0AIARCCHxCACADEJSFgIAACxCBgICAACESQgBCACsD0MSEgICAgICAACASIBGhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCUhYCAAAsgBELgAHwkgICAgAAL4QcDD34EfwN9AkAgASACWg0AIAApAxghAyAAKQMIIQQgACkDACEFIAApAyhCeHwhBiAAKQMwQnh8IQcDQCADKQMwIQggBCkDMCEJIAUpAzAhCgJAIAMpAxgiC1ANACAGIAtCA4YiDHwhACAHIAx8IQ0gAykDCCAMfEJ4fCEOIAMpAxAgDHxCeHwhDCABIQ8DQCAMKQMAIA8gDyAOKQMAIhCAIhEgEH59Ig9+IAh8IQggDSkDACAPfiAJfCEJIAApAwAgD34gCnwhCiAOQnh8IQ4gAEJ4fCEAIA1CeHwhDSAMQnh8IQwgESEPIAtCf3wiC0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIApCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRYMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRYMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRYMAgsgBSkDACAKQgGGfC8BAEEQdL4hFgwBCyAFKQMAIApCAoZ8KgIAIRYLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAJQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEXDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEXDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEXDAILIAQpAwAgCUIBhnwvAQBBEHS+IRcMAQsgBCkDACAJQgKGfCoCACEXCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgCEIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hGAwECyASQRd0QYCAgMADaiAUciATQQ10cr4hGAwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hGAwCCyADKQMAIAhCAYZ8LwEAQRB0viEYDAELIAMpAwAgCEIChnwqAgAhGAsgAyAIIBYgF5UgGJIQlICAgAAgAUIBfCIBIAJSDQALCwvbBAIOfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAIpAxgiBUIDhiIGQg98QnCDIgd9IggiAySAgICAACADIAd9IgkkgICAgAACQCAFUA0AIAApAxgiA0J/fCEKIAEpAxgiB0J/fCELIAggBkJ4fCIGfCEMIAkgBnwhDSADQgOGQnh8IQ4gB0IDhkJ4fCEPQgAhAyAFIQcDQEIAIRACQCAFIAogByIGfFYNAEIAIRAgACkDCCAOfCADfCkDAEIBUQ0AIAApAxAgDnwgA3wpAwAhEAsgBkJ/fCEHIAwgA3wgEDcDAEIAIRACQCAFIAsgBnxWDQAgASkDCCAPfCADfCkDAEIBUQ0AIAEpAxAgD3wgA3wpAwAhEAsgDSADfCAQNwMAIANCeHwhAyAHQgBSDQALCyAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3A0AgBCAJNwM4IAQgCDcDMCAEQQA2AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEHIAQgAjcDICACKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgB0IAUg0AQgBCATcDyMSEgICAgICAABCBgICAACERAkAgA1ANACAEQgh8QgAgAxCWhYCAAAsQgYCAgAAhEkIAQgArA9DEhICAgICAgAAgEiARoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQloWAgAALIARC4AB8JICAgIAAC/gFAw9+BH8CfQJAIAEgAloNACAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMoQnh8IQYgACkDMEJ4fCEHA0AgAykDMCEIIAQpAzAhCSAFKQMwIQoCQCADKQMYIgtQDQAgBiALQgOGIgx8IQAgByAMfCENIAMpAwggDHxCeHwhDiADKQMQIAx8Qnh8IQwgASEPA0AgDCkDACAPIA8gDikDACIQgCIRIBB+fSIPfiAIfCEIIA0pAwAgD34gCXwhCSAAKQMAIA9+IAp8IQogDkJ4fCEOIABCeHwhACANQnh8IQ0gDEJ4fCEMIBEhDyALQn98IgtCAFINAAsLAkACQCAFKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAKQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEWDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEWDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEWDAILIAUpAwAgCkIBhnwvAQBBEHS+IRYMAQsgBSkDACAKQgKGfCoCACEWCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgCUIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hFwwECyASQRd0QYCAgMADaiAUciATQQ10cr4hFwwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hFwwCCyAEKQMAIAlCAYZ8LwEAQRB0viEXDAELIAQpAwAgCUIChnwqAgAhFwsgAyAIIBa7IBe7EI6AgIAAthCUgICAACABQgF8IgEgAlINAAsLC9sEAg5+AnwjgICAgABC4AB9IgMhBCADJICAgIAAIAMgAikDGCIFQgOGIgZCD3xCcIMiB30iCCIDJICAgIAAIAMgB30iCSSAgICAAAJAIAVQDQAgACkDGCIDQn98IQogASkDGCIHQn98IQsgCCAGQnh8IgZ8IQwgCSAGfCENIANCA4ZCeHwhDiAHQgOGQnh8IQ9CACEDIAUhBwNAQgAhEAJAIAUgCiAHIgZ8Vg0AQgAhECAAKQMIIA58IAN8KQMAQgFRDQAgACkDECAOfCADfCkDACEQCyAGQn98IQcgDCADfCAQNwMAQgAhEAJAIAUgCyAGfFYNACABKQMIIA98IAN8KQMAQgFRDQAgASkDECAPfCADfCkDACEQCyANIAN8IBA3AwAgA0J4fCEDIAdCAFINAAsLIARCyAB8QgA3AwAgBELQAHxCADcDACAEQtgAfEIANwMAIARCADcDQCAEIAk3AzggBCAINwMwIARBADYCKCAEQgA3AxggBCABNwMQIAQgADcDCEIAKQPIxISAgICAgIAAIQcgBCACNwMgIAIpAyAhAwJAAkBCAC0AwMSEgICAgICAAEUNACAHQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIRECQCADUA0AIARCCHxCACADEJiFgIAACxCBgICAACESQgBCACsD0MSEgICAgICAACASIBGhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgA1ANACAEQgh8QgAgAxCYhYCAAAsgBELgAHwkgICAgAAL6gcDD34EfwN9AkAgASACWg0AIAApAxghAyAAKQMIIQQgACkDACEFIAApAyhCeHwhBiAAKQMwQnh8IQcDQCADKQMwIQggBCkDMCEJIAUpAzAhCgJAIAMpAxgiC1ANACAGIAtCA4YiDHwhACAHIAx8IQ0gAykDCCAMfEJ4fCEOIAMpAxAgDHxCeHwhDCABIQ8DQCAMKQMAIA8gDyAOKQMAIhCAIhEgEH59Ig9+IAh8IQggDSkDACAPfiAJfCEJIAApAwAgD34gCnwhCiAOQnh8IQ4gAEJ4fCEAIA1CeHwhDSAMQnh8IQwgESEPIAtCf3wiC0IAUg0ACwsCQAJAIAUpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIApCAYZ8LgEAIhJB/wdxIRMgEkGAgICAeHEhFAJAIBJB//8DcSIVQQp2QR9xIhJFDQACQCASQR9HDQAgFCAVQQ10ckGAgID8B3K+IRYMBAsgEkEXdEGAgIDAA2ogFHIgE0ENdHK+IRYMAwsCQCATRQ0AQYCAgJgEIBNnIhJBF3RrIBRyIBUgEkFqanRBDnRBgID/A3FyIRQLIBS+IRYMAgsgBSkDACAKQgGGfC8BAEEQdL4hFgwBCyAFKQMAIApCAoZ8KgIAIRYLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACAJQgGGfC4BACISQf8HcSETIBJBgICAgHhxIRQCQCASQf//A3EiFUEKdkEfcSISRQ0AAkAgEkEfRw0AIBQgFUENdHJBgICA/AdyviEXDAQLIBJBF3RBgICAwANqIBRyIBNBDXRyviEXDAMLAkAgE0UNAEGAgICYBCATZyISQRd0ayAUciAVIBJBamp0QQ50QYCA/wNxciEUCyAUviEXDAILIAQpAwAgCUIBhnwvAQBBEHS+IRcMAQsgBCkDACAJQgKGfCoCACEXCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgCEIBhnwuAQAiEkH/B3EhEyASQYCAgIB4cSEUAkAgEkH//wNxIhVBCnZBH3EiEkUNAAJAIBJBH0cNACAUIBVBDXRyQYCAgPwHcr4hGAwECyASQRd0QYCAgMADaiAUciATQQ10cr4hGAwDCwJAIBNFDQBBgICAmAQgE2ciEkEXdGsgFHIgFSASQWpqdEEOdEGAgP8DcXIhFAsgFL4hGAwCCyADKQMAIAhCAYZ8LwEAQRB0viEYDAELIAMpAwAgCEIChnwqAgAhGAsgAyAIIBa7IBe7EI6AgIAAIBi7oLYQlICAgAAgAUIBfCIBIAJSDQALCwvbBAIOfgJ8I4CAgIAAQuAAfSIDIQQgAySAgICAACADIAIpAxgiBUIDhiIGQg98QnCDIgd9IggiAySAgICAACADIAd9IgkkgICAgAACQCAFUA0AIAApAxgiA0J/fCEKIAEpAxgiB0J/fCELIAggBkJ4fCIGfCEMIAkgBnwhDSADQgOGQnh8IQ4gB0IDhkJ4fCEPQgAhAyAFIQcDQEIAIRACQCAFIAogByIGfFYNAEIAIRAgACkDCCAOfCADfCkDAEIBUQ0AIAApAxAgDnwgA3wpAwAhEAsgBkJ/fCEHIAwgA3wgEDcDAEIAIRACQCAFIAsgBnxWDQAgASkDCCAPfCADfCkDAEIBUQ0AIAEpAxAgD3wgA3wpAwAhEAsgDSADfCAQNwMAIANCeHwhAyAHQgBSDQALCyAEQsgAfEIANwMAIARC0AB8QgA3AwAgBELYAHxCADcDACAEQgA3A0AgBCAJNwM4IAQgCDcDMCAEQQA2AiggBEIANwMYIAQgATcDECAEIAA3AwhCACkDyMSEgICAgICAACEHIAQgAjcDICACKQMgIQMCQAJAQgAtAMDEhICAgICAgABFDQAgB0IAUg0AQgBCATcDyMSEgICAgICAABCBgICAACERAkAgA1ANACAEQgh8QgAgAxCahYCAAAsQgYCAgAAhEkIAQgArA9DEhICAgICAgAAgEiARoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIANQDQAgBEIIfEIAIAMQmoWAgAALIARC4AB8JICAgIAAC8cICgN+An8HfgF/BH4BfwN+An0CfwF9AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMIIQwgACkDACENIAApA0AiDqciD0F/aiIHrUIDhiEQA0AgAykDMCERIAwpAzAhEiANKQMwIRMCQCADKAIYIgZBf2oiFEF/TA0AIAMpAwggFK0iBUIDhiIJfCEAIAwpAxAgCXwhCCADKQMQIAl8IQkgDSkDECAOIAV8QgOGfCEFIAEhCgNAIAkpAwAgCiAKIAApAwAiC4AiFSALfn0iCn4gEXwhESAIKQMAIAp+IBJ8IRIgBSkDACAKfiATfCETIABCeHwhACAFQnh8IQUgCEJ4fCEIIAlCeHwhCSAVIQogBkF/aiIGQQBKDQALCyANKQNQIRYgDCkDUCEXQwAAAAAhGEIAIRUDQCATIQUCQCAHQX9MDQAgDSkDCCAQfCEAIA0pAxAgEHwhCCAPIQYgFSEJIBMhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgF0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgEkIBhnwvAQBBEHS+IRkMAgsgDCkDACASQgGGfC4BACIGQYCAgIB4cSEUAkACQAJAIAZB//8DcSIaQQp2QR9xIhtBH0YNACAGQf8HcSEGIBsNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBRyIBogBkFqanRBDnRBgID/A3FyviEZDAQLIBQgGkENdHJBgICA/AdyviEZDAMLIBtBF3RBgICAwANqIBRyIAZBDXRyIRQLIBS+IRkMAQsgDCkDACASQgKGfCoCACEZCwJAAkAgFkJ/fCIAQgFWDQACQAJAIACnDgIBAAELIA0pAwAgBUIBhnwvAQBBEHS+IRwMAgsgDSkDACAFQgGGfC4BACIGQYCAgIB4cSEUAkACQAJAIAZB//8DcSIaQQp2QR9xIhtBH0YNACAGQf8HcSEGIBsNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBRyIBogBkFqanRBDnRBgID/A3FyviEcDAQLIBQgGkENdHJBgICA/AdyviEcDAMLIBtBF3RBgICAwANqIBRyIAZBDXRyIRQLIBS+IRwMAQsgDSkDACAFQgKGfCoCACEcCyAYIBkgHJKSIRggFUIBfCIVIARSDQALIAMgESAYEJSAgIAAIAFCAXwiASACUg0ACwsLjwQCCH4CfCOAgICAAELgAH0iAySAgICAAEIBIQRCASEFAkACQCABKQMgQgFRDQAgACkDGCACKQMYfSIFUEUNAEIBIQRCACEFDAELIAVCA4MhBiAAKQMIIQcCQAJAIAVCf3xCA1oNAEIAIQgMAQsgBUJ8gyEJQgEhBEIAIQggByEKA0AgCkIYfCkDACAKQhB8KQMAIApCCHwpAwAgCikDACAEfn5+fiEEIApCIHwhCiAJIAhCBHwiCFINAAsLIAZQDQAgByAIQgOGfCEKA0AgCikDACAEfiEEIApCCHwhCiAGQn98IgZCAFINAAsLIANCOHxCADcDACADQsAAfEIANwMAIANCADcDMCADQQA2AiggA0IANwMYIAMgATcDECADIAA3AwggA0IANwNYIAMgBDcDUCADIAU3A0hCACkDyMSEgICAgICAACEEIAMgAjcDICACKQMgIQoCQAJAQgAtAMDEhICAgICAgABFDQAgBEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACELAkAgClANACADQgh8QgAgChCchYCAAAsQgYCAgAAhDEIAQgArA9DEhICAgICAgAAgDCALoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIApQDQAgA0IIfEIAIAoQnIWAgAALIANC4AB8JICAgIAAC68JCQV+An8EfgJ/Bn4BfQJ+An8CfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwghBSAAKQMAIQYgACkDQCIHpyIIQX9qIgmtQgOGIQoDQCAEKQMwIQsgBSkDMCEMIAYpAzAhDQJAIAQoAhgiDkF/aiIPQQBIDQAgBCkDECAPrSIQQgOGIhF8IQAgBSkDECARfCESIAQpAwggEXwhESAGKQMQIAcgEHxCA4Z8IRAgASETA0AgACkDACATIBMgESkDACIUgCIVIBR+fSITfiALfCELIBIpAwAgE34gDHwhDCAQKQMAIBN+IA18IQ0gAEJ4fCEAIBJCeHwhEiAQQnh8IRAgEUJ4fCERIBUhEyAOQX9qIg5BAEoNAAsLAkACQCADUEUNAEMAAAAAIRYMAQsgBikDUCEXIAUpA1AhGEMAAAAAIRZCACEVA0AgDSEQAkAgCUEASA0AIAYpAxAgCnwhACAGKQMIIAp8IRIgCCEOIBUhESANIRADQCAAKQMAIBEgESASKQMAIhOAIhQgE359fiAQfCEQIABCeHwhACASQnh8IRIgFCERIA5Bf2oiDkEASg0ACwsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAxCAYZ8LgEAIg5B/wdxIRkgDkGAgICAeHEhDwJAIA5B//8DcSIaQQp2QR9xIg5FDQACQCAOQR9HDQAgDyAaQQ10ckGAgID8B3K+IRsMBAsgDkEXdEGAgIDAA2ogD3IgGUENdHK+IRsMAwsCQCAZRQ0AQYCAgJgEIBlnIg5BF3RrIA9yIBogDkFqanRBDnRBgID/A3FyIQ8LIA++IRsMAgsgBSkDACAMQgGGfC8BAEEQdL4hGwwBCyAFKQMAIAxCAoZ8KgIAIRsLAkACQCAXQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBikDACAQQgGGfC4BACIOQf8HcSEZIA5BgICAgHhxIQ8CQCAOQf//A3EiGkEKdkEfcSIORQ0AAkAgDkEfRw0AIA8gGkENdHJBgICA/AdyviEcDAQLIA5BF3RBgICAwANqIA9yIBlBDXRyviEcDAMLAkAgGUUNAEGAgICYBCAZZyIOQRd0ayAPciAaIA5Bamp0QQ50QYCA/wNxciEPCyAPviEcDAILIAYpAwAgEEIBhnwvAQBBEHS+IRwMAQsgBikDACAQQgKGfCoCACEcCyAWIBsgHJKSIRYgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgC0IBhnwuAQAiDkH/B3EhGSAOQYCAgIB4cSEPAkAgDkH//wNxIhpBCnZBH3EiDkUNAAJAIA5BH0cNACAPIBpBDXRyQYCAgPwHcr4hGwwECyAOQRd0QYCAgMADaiAPciAZQQ10cr4hGwwDCwJAIBlFDQBBgICAmAQgGWciDkEXdGsgD3IgGiAOQWpqdEEOdEGAgP8DcXIhDwsgD74hGwwCCyAEKQMAIAtCAYZ8LwEAQRB0viEbDAELIAQpAwAgC0IChnwqAgAhGwsgBCALIBYgG5IQlICAgAAgAUIBfCIBIAJSDQALCwuPBAIIfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBEIBIQUCQAJAIAEpAyBCAVENACAAKQMYIAIpAxh9IgVQRQ0AQgEhBEIAIQUMAQsgBUIDgyEGIAApAwghBwJAAkAgBUJ/fEIDWg0AQgAhCAwBCyAFQnyDIQlCASEEQgAhCCAHIQoDQCAKQhh8KQMAIApCEHwpAwAgCkIIfCkDACAKKQMAIAR+fn5+IQQgCkIgfCEKIAkgCEIEfCIIUg0ACwsgBlANACAHIAhCA4Z8IQoDQCAKKQMAIAR+IQQgCkIIfCEKIAZCf3wiBkIAUg0ACwsgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMwIANBADYCKCADQgA3AxggAyABNwMQIAMgADcDCCADQgA3A1ggAyAENwNQIAMgBTcDSEIAKQPIxISAgICAgIAAIQQgAyACNwMgIAIpAyAhCgJAAkBCAC0AwMSEgICAgICAAEUNACAEQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQsCQCAKUA0AIANCCHxCACAKEJ6FgIAACxCBgICAACEMQgBCACsD0MSEgICAgICAACAMIAuhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgClANACADQgh8QgAgChCehYCAAAsgA0LgAHwkgICAgAALxwgKA34Cfwd+AX8EfgF/A34CfQJ/AX0CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwghDCAAKQMAIQ0gACkDQCIOpyIPQX9qIgetQgOGIRADQCADKQMwIREgDCkDMCESIA0pAzAhEwJAIAMoAhgiBkF/aiIUQX9MDQAgAykDCCAUrSIFQgOGIgl8IQAgDCkDECAJfCEIIAMpAxAgCXwhCSANKQMQIA4gBXxCA4Z8IQUgASEKA0AgCSkDACAKIAogACkDACILgCIVIAt+fSIKfiARfCERIAgpAwAgCn4gEnwhEiAFKQMAIAp+IBN8IRMgAEJ4fCEAIAVCeHwhBSAIQnh8IQggCUJ4fCEJIBUhCiAGQX9qIgZBAEoNAAsLIA0pA1AhFiAMKQNQIRdDAAAAACEYQgAhFQNAIBMhBQJAIAdBf0wNACANKQMIIBB8IQAgDSkDECAQfCEIIA8hBiAVIQkgEyEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCAXQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACASQgGGfC8BAEEQdL4hGQwCCyAMKQMAIBJCAYZ8LgEAIgZBgICAgHhxIRQCQAJAAkAgBkH//wNxIhpBCnZBH3EiG0EfRg0AIAZB/wdxIQYgGw0BIAZFDQJBgICAmAQgBmciBkEXdGsgFHIgGiAGQWpqdEEOdEGAgP8DcXK+IRkMBAsgFCAaQQ10ckGAgID8B3K+IRkMAwsgG0EXdEGAgIDAA2ogFHIgBkENdHIhFAsgFL4hGQwBCyAMKQMAIBJCAoZ8KgIAIRkLAkACQCAWQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDSkDACAFQgGGfC8BAEEQdL4hHAwCCyANKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRQCQAJAAkAgBkH//wNxIhpBCnZBH3EiG0EfRg0AIAZB/wdxIQYgGw0BIAZFDQJBgICAmAQgBmciBkEXdGsgFHIgGiAGQWpqdEEOdEGAgP8DcXK+IRwMBAsgFCAaQQ10ckGAgID8B3K+IRwMAwsgG0EXdEGAgIDAA2ogFHIgBkENdHIhFAsgFL4hHAwBCyANKQMAIAVCAoZ8KgIAIRwLIBggHCAZk5IhGCAVQgF8IhUgBFINAAsgAyARIBgQlICAgAAgAUIBfCIBIAJSDQALCwuPBAIIfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBEIBIQUCQAJAIAEpAyBCAVENACAAKQMYIAIpAxh9IgVQRQ0AQgEhBEIAIQUMAQsgBUIDgyEGIAApAwghBwJAAkAgBUJ/fEIDWg0AQgAhCAwBCyAFQnyDIQlCASEEQgAhCCAHIQoDQCAKQhh8KQMAIApCEHwpAwAgCkIIfCkDACAKKQMAIAR+fn5+IQQgCkIgfCEKIAkgCEIEfCIIUg0ACwsgBlANACAHIAhCA4Z8IQoDQCAKKQMAIAR+IQQgCkIIfCEKIAZCf3wiBkIAUg0ACwsgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMwIANBADYCKCADQgA3AxggAyABNwMQIAMgADcDCCADQgA3A1ggAyAENwNQIAMgBTcDSEIAKQPIxISAgICAgIAAIQQgAyACNwMgIAIpAyAhCgJAAkBCAC0AwMSEgICAgICAAEUNACAEQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQsCQCAKUA0AIANCCHxCACAKEKCFgIAACxCBgICAACEMQgBCACsD0MSEgICAgICAACAMIAuhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgClANACADQgh8QgAgChCghYCAAAsgA0LgAHwkgICAgAALrwkJBX4CfwR+An8GfgF9An4CfwJ9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDCCEFIAApAwAhBiAAKQNAIgenIghBf2oiCa1CA4YhCgNAIAQpAzAhCyAFKQMwIQwgBikDMCENAkAgBCgCGCIOQX9qIg9BAEgNACAEKQMQIA+tIhBCA4YiEXwhACAFKQMQIBF8IRIgBCkDCCARfCERIAYpAxAgByAQfEIDhnwhECABIRMDQCAAKQMAIBMgEyARKQMAIhSAIhUgFH59IhN+IAt8IQsgEikDACATfiAMfCEMIBApAwAgE34gDXwhDSAAQnh8IQAgEkJ4fCESIBBCeHwhECARQnh8IREgFSETIA5Bf2oiDkEASg0ACwsCQAJAIANQRQ0AQwAAAAAhFgwBCyAGKQNQIRcgBSkDUCEYQwAAAAAhFkIAIRUDQCANIRACQCAJQQBIDQAgBikDECAKfCEAIAYpAwggCnwhEiAIIQ4gFSERIA0hEANAIAApAwAgESARIBIpAwAiE4AiFCATfn1+IBB8IRAgAEJ4fCEAIBJCeHwhEiAUIREgDkF/aiIOQQBKDQALCwJAAkAgGEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgDEIBhnwuAQAiDkH/B3EhGSAOQYCAgIB4cSEPAkAgDkH//wNxIhpBCnZBH3EiDkUNAAJAIA5BH0cNACAPIBpBDXRyQYCAgPwHcr4hGwwECyAOQRd0QYCAgMADaiAPciAZQQ10cr4hGwwDCwJAIBlFDQBBgICAmAQgGWciDkEXdGsgD3IgGiAOQWpqdEEOdEGAgP8DcXIhDwsgD74hGwwCCyAFKQMAIAxCAYZ8LwEAQRB0viEbDAELIAUpAwAgDEIChnwqAgAhGwsCQAJAIBdCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIBBCAYZ8LgEAIg5B/wdxIRkgDkGAgICAeHEhDwJAIA5B//8DcSIaQQp2QR9xIg5FDQACQCAOQR9HDQAgDyAaQQ10ckGAgID8B3K+IRwMBAsgDkEXdEGAgIDAA2ogD3IgGUENdHK+IRwMAwsCQCAZRQ0AQYCAgJgEIBlnIg5BF3RrIA9yIBogDkFqanRBDnRBgID/A3FyIQ8LIA++IRwMAgsgBikDACAQQgGGfC8BAEEQdL4hHAwBCyAGKQMAIBBCAoZ8KgIAIRwLIBYgHCAbk5IhFiAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACALQgGGfC4BACIOQf8HcSEZIA5BgICAgHhxIQ8CQCAOQf//A3EiGkEKdkEfcSIORQ0AAkAgDkEfRw0AIA8gGkENdHJBgICA/AdyviEbDAQLIA5BF3RBgICAwANqIA9yIBlBDXRyviEbDAMLAkAgGUUNAEGAgICYBCAZZyIOQRd0ayAPciAaIA5Bamp0QQ50QYCA/wNxciEPCyAPviEbDAILIAQpAwAgC0IBhnwvAQBBEHS+IRsMAQsgBCkDACALQgKGfCoCACEbCyAEIAsgFiAbkhCUgICAACABQgF8IgEgAlINAAsLC48EAgh+AnwjgICAgABC4AB9IgMkgICAgABCASEEQgEhBQJAAkAgASkDIEIBUQ0AIAApAxggAikDGH0iBVBFDQBCASEEQgAhBQwBCyAFQgODIQYgACkDCCEHAkACQCAFQn98QgNaDQBCACEIDAELIAVCfIMhCUIBIQRCACEIIAchCgNAIApCGHwpAwAgCkIQfCkDACAKQgh8KQMAIAopAwAgBH5+fn4hBCAKQiB8IQogCSAIQgR8IghSDQALCyAGUA0AIAcgCEIDhnwhCgNAIAopAwAgBH4hBCAKQgh8IQogBkJ/fCIGQgBSDQALCyADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AzAgA0EANgIoIANCADcDGCADIAE3AxAgAyAANwMIIANCADcDWCADIAQ3A1AgAyAFNwNIQgApA8jEhICAgICAgAAhBCADIAI3AyAgAikDICEKAkACQEIALQDAxISAgICAgIAARQ0AIARCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhCwJAIApQDQAgA0IIfEIAIAoQooWAgAALEIGAgIAAIQxCAEIAKwPQxISAgICAgIAAIAwgC6GgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAKUA0AIANCCHxCACAKEKKFgIAACyADQuAAfCSAgICAAAvHCAoDfgJ/B34BfwR+AX8DfgJ9An8BfQJAIAEgAloNACAAKQMYIQMCQCAAKQNIIgRQRQ0AA0AgAykDMCEFAkAgAygCGCIGQX9qIgdBAEgNACADKQMQIAetQgOGIgh8IQAgAykDCCAIfCEIIAEhCQNAIAApAwAgCSAJIAgpAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCyADIAVDAAAAABCUgICAACABQgF8IgEgAlINAAwCCwsgACkDCCEMIAApAwAhDSAAKQNAIg6nIg9Bf2oiB61CA4YhEANAIAMpAzAhESAMKQMwIRIgDSkDMCETAkAgAygCGCIGQX9qIhRBf0wNACADKQMIIBStIgVCA4YiCXwhACAMKQMQIAl8IQggAykDECAJfCEJIA0pAxAgDiAFfEIDhnwhBSABIQoDQCAJKQMAIAogCiAAKQMAIguAIhUgC359Igp+IBF8IREgCCkDACAKfiASfCESIAUpAwAgCn4gE3whEyAAQnh8IQAgBUJ4fCEFIAhCeHwhCCAJQnh8IQkgFSEKIAZBf2oiBkEASg0ACwsgDSkDUCEWIAwpA1AhF0MAAAAAIRhCACEVA0AgEyEFAkAgB0F/TA0AIA0pAwggEHwhACANKQMQIBB8IQggDyEGIBUhCSATIQUDQCAIKQMAIAkgCSAAKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsCQAJAIBdCf3wiAEIBVg0AAkACQCAApw4CAQABCyAMKQMAIBJCAYZ8LwEAQRB0viEZDAILIAwpAwAgEkIBhnwuAQAiBkGAgICAeHEhFAJAAkACQCAGQf//A3EiGkEKdkEfcSIbQR9GDQAgBkH/B3EhBiAbDQEgBkUNAkGAgICYBCAGZyIGQRd0ayAUciAaIAZBamp0QQ50QYCA/wNxcr4hGQwECyAUIBpBDXRyQYCAgPwHcr4hGQwDCyAbQRd0QYCAgMADaiAUciAGQQ10ciEUCyAUviEZDAELIAwpAwAgEkIChnwqAgAhGQsCQAJAIBZCf3wiAEIBVg0AAkACQCAApw4CAQABCyANKQMAIAVCAYZ8LwEAQRB0viEcDAILIA0pAwAgBUIBhnwuAQAiBkGAgICAeHEhFAJAAkACQCAGQf//A3EiGkEKdkEfcSIbQR9GDQAgBkH/B3EhBiAbDQEgBkUNAkGAgICYBCAGZyIGQRd0ayAUciAaIAZBamp0QQ50QYCA/wNxcr4hHAwECyAUIBpBDXRyQYCAgPwHcr4hHAwDCyAbQRd0QYCAgMADaiAUciAGQQ10ciEUCyAUviEcDAELIA0pAwAgBUIChnwqAgAhHAsgGCAZIByUkiEYIBVCAXwiFSAEUg0ACyADIBEgGBCUgICAACABQgF8IgEgAlINAAsLC48EAgh+AnwjgICAgABC4AB9IgMkgICAgABCASEEQgEhBQJAAkAgASkDIEIBUQ0AIAApAxggAikDGH0iBVBFDQBCASEEQgAhBQwBCyAFQgODIQYgACkDCCEHAkACQCAFQn98QgNaDQBCACEIDAELIAVCfIMhCUIBIQRCACEIIAchCgNAIApCGHwpAwAgCkIQfCkDACAKQgh8KQMAIAopAwAgBH5+fn4hBCAKQiB8IQogCSAIQgR8IghSDQALCyAGUA0AIAcgCEIDhnwhCgNAIAopAwAgBH4hBCAKQgh8IQogBkJ/fCIGQgBSDQALCyADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AzAgA0EANgIoIANCADcDGCADIAE3AxAgAyAANwMIIANCADcDWCADIAQ3A1AgAyAFNwNIQgApA8jEhICAgICAgAAhBCADIAI3AyAgAikDICEKAkACQEIALQDAxISAgICAgIAARQ0AIARCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhCwJAIApQDQAgA0IIfEIAIAoQpIWAgAALEIGAgIAAIQxCAEIAKwPQxISAgICAgIAAIAwgC6GgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAKUA0AIANCCHxCACAKEKSFgIAACyADQuAAfCSAgICAAAuvCQkFfgJ/BH4CfwZ+AX0CfgJ/An0CQCABIAJaDQAgACkDSCEDIAApAxghBCAAKQMIIQUgACkDACEGIAApA0AiB6ciCEF/aiIJrUIDhiEKA0AgBCkDMCELIAUpAzAhDCAGKQMwIQ0CQCAEKAIYIg5Bf2oiD0EASA0AIAQpAxAgD60iEEIDhiIRfCEAIAUpAxAgEXwhEiAEKQMIIBF8IREgBikDECAHIBB8QgOGfCEQIAEhEwNAIAApAwAgEyATIBEpAwAiFIAiFSAUfn0iE34gC3whCyASKQMAIBN+IAx8IQwgECkDACATfiANfCENIABCeHwhACASQnh8IRIgEEJ4fCEQIBFCeHwhESAVIRMgDkF/aiIOQQBKDQALCwJAAkAgA1BFDQBDAAAAACEWDAELIAYpA1AhFyAFKQNQIRhDAAAAACEWQgAhFQNAIA0hEAJAIAlBAEgNACAGKQMQIAp8IQAgBikDCCAKfCESIAghDiAVIREgDSEQA0AgACkDACARIBEgEikDACITgCIUIBN+fX4gEHwhECAAQnh8IQAgEkJ4fCESIBQhESAOQX9qIg5BAEoNAAsLAkACQCAYQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAMQgGGfC4BACIOQf8HcSEZIA5BgICAgHhxIQ8CQCAOQf//A3EiGkEKdkEfcSIORQ0AAkAgDkEfRw0AIA8gGkENdHJBgICA/AdyviEbDAQLIA5BF3RBgICAwANqIA9yIBlBDXRyviEbDAMLAkAgGUUNAEGAgICYBCAZZyIOQRd0ayAPciAaIA5Bamp0QQ50QYCA/wNxciEPCyAPviEbDAILIAUpAwAgDEIBhnwvAQBBEHS+IRsMAQsgBSkDACAMQgKGfCoCACEbCwJAAkAgF0J/fCIAQgFWDQACQAJAIACnDgIAAQALIAYpAwAgEEIBhnwuAQAiDkH/B3EhGSAOQYCAgIB4cSEPAkAgDkH//wNxIhpBCnZBH3EiDkUNAAJAIA5BH0cNACAPIBpBDXRyQYCAgPwHcr4hHAwECyAOQRd0QYCAgMADaiAPciAZQQ10cr4hHAwDCwJAIBlFDQBBgICAmAQgGWciDkEXdGsgD3IgGiAOQWpqdEEOdEGAgP8DcXIhDwsgD74hHAwCCyAGKQMAIBBCAYZ8LwEAQRB0viEcDAELIAYpAwAgEEIChnwqAgAhHAsgFiAbIByUkiEWIBVCAXwiFSADUg0ACwsCQAJAIAQpA1BCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIAtCAYZ8LgEAIg5B/wdxIRkgDkGAgICAeHEhDwJAIA5B//8DcSIaQQp2QR9xIg5FDQACQCAOQR9HDQAgDyAaQQ10ckGAgID8B3K+IRsMBAsgDkEXdEGAgIDAA2ogD3IgGUENdHK+IRsMAwsCQCAZRQ0AQYCAgJgEIBlnIg5BF3RrIA9yIBogDkFqanRBDnRBgID/A3FyIQ8LIA++IRsMAgsgBCkDACALQgGGfC8BAEEQdL4hGwwBCyAEKQMAIAtCAoZ8KgIAIRsLIAQgCyAWIBuSEJSAgIAAIAFCAXwiASACUg0ACwsLjwQCCH4CfCOAgICAAELgAH0iAySAgICAAEIBIQRCASEFAkACQCABKQMgQgFRDQAgACkDGCACKQMYfSIFUEUNAEIBIQRCACEFDAELIAVCA4MhBiAAKQMIIQcCQAJAIAVCf3xCA1oNAEIAIQgMAQsgBUJ8gyEJQgEhBEIAIQggByEKA0AgCkIYfCkDACAKQhB8KQMAIApCCHwpAwAgCikDACAEfn5+fiEEIApCIHwhCiAJIAhCBHwiCFINAAsLIAZQDQAgByAIQgOGfCEKA0AgCikDACAEfiEEIApCCHwhCiAGQn98IgZCAFINAAsLIANCOHxCADcDACADQsAAfEIANwMAIANCADcDMCADQQA2AiggA0IANwMYIAMgATcDECADIAA3AwggA0IANwNYIAMgBDcDUCADIAU3A0hCACkDyMSEgICAgICAACEEIAMgAjcDICACKQMgIQoCQAJAQgAtAMDEhICAgICAgABFDQAgBEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACELAkAgClANACADQgh8QgAgChCmhYCAAAsQgYCAgAAhDEIAQgArA9DEhICAgICAgAAgDCALoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIApQDQAgA0IIfEIAIAoQpoWAgAALIANC4AB8JICAgIAAC8cICgN+An8HfgF/BH4BfwN+An0CfwF9AkAgASACWg0AIAApAxghAwJAIAApA0giBFBFDQADQCADKQMwIQUCQCADKAIYIgZBf2oiB0EASA0AIAMpAxAgB61CA4YiCHwhACADKQMIIAh8IQggASEJA0AgACkDACAJIAkgCCkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLIAMgBUMAAAAAEJSAgIAAIAFCAXwiASACUg0ADAILCyAAKQMIIQwgACkDACENIAApA0AiDqciD0F/aiIHrUIDhiEQA0AgAykDMCERIAwpAzAhEiANKQMwIRMCQCADKAIYIgZBf2oiFEF/TA0AIAMpAwggFK0iBUIDhiIJfCEAIAwpAxAgCXwhCCADKQMQIAl8IQkgDSkDECAOIAV8QgOGfCEFIAEhCgNAIAkpAwAgCiAKIAApAwAiC4AiFSALfn0iCn4gEXwhESAIKQMAIAp+IBJ8IRIgBSkDACAKfiATfCETIABCeHwhACAFQnh8IQUgCEJ4fCEIIAlCeHwhCSAVIQogBkF/aiIGQQBKDQALCyANKQNQIRYgDCkDUCEXQwAAAAAhGEIAIRUDQCATIQUCQCAHQX9MDQAgDSkDCCAQfCEAIA0pAxAgEHwhCCAPIQYgFSEJIBMhBQNAIAgpAwAgCSAJIAApAwAiCoAiCyAKfn1+IAV8IQUgAEJ4fCEAIAhCeHwhCCALIQkgBkF/aiIGQQBKDQALCwJAAkAgF0J/fCIAQgFWDQACQAJAIACnDgIBAAELIAwpAwAgEkIBhnwvAQBBEHS+IRkMAgsgDCkDACASQgGGfC4BACIGQYCAgIB4cSEUAkACQAJAIAZB//8DcSIaQQp2QR9xIhtBH0YNACAGQf8HcSEGIBsNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBRyIBogBkFqanRBDnRBgID/A3FyviEZDAQLIBQgGkENdHJBgICA/AdyviEZDAMLIBtBF3RBgICAwANqIBRyIAZBDXRyIRQLIBS+IRkMAQsgDCkDACASQgKGfCoCACEZCwJAAkAgFkJ/fCIAQgFWDQACQAJAIACnDgIBAAELIA0pAwAgBUIBhnwvAQBBEHS+IRwMAgsgDSkDACAFQgGGfC4BACIGQYCAgIB4cSEUAkACQAJAIAZB//8DcSIaQQp2QR9xIhtBH0YNACAGQf8HcSEGIBsNASAGRQ0CQYCAgJgEIAZnIgZBF3RrIBRyIBogBkFqanRBDnRBgID/A3FyviEcDAQLIBQgGkENdHJBgICA/AdyviEcDAMLIBtBF3RBgICAwANqIBRyIAZBDXRyIRQLIBS+IRwMAQsgDSkDACAFQgKGfCoCACEcCyAYIBwgGZWSIRggFUIBfCIVIARSDQALIAMgESAYEJSAgIAAIAFCAXwiASACUg0ACwsLjwQCCH4CfCOAgICAAELgAH0iAySAgICAAEIBIQRCASEFAkACQCABKQMgQgFRDQAgACkDGCACKQMYfSIFUEUNAEIBIQRCACEFDAELIAVCA4MhBiAAKQMIIQcCQAJAIAVCf3xCA1oNAEIAIQgMAQsgBUJ8gyEJQgEhBEIAIQggByEKA0AgCkIYfCkDACAKQhB8KQMAIApCCHwpAwAgCikDACAEfn5+fiEEIApCIHwhCiAJIAhCBHwiCFINAAsLIAZQDQAgByAIQgOGfCEKA0AgCikDACAEfiEEIApCCHwhCiAGQn98IgZCAFINAAsLIANCOHxCADcDACADQsAAfEIANwMAIANCADcDMCADQQA2AiggA0IANwMYIAMgATcDECADIAA3AwggA0IANwNYIAMgBDcDUCADIAU3A0hCACkDyMSEgICAgICAACEEIAMgAjcDICACKQMgIQoCQAJAQgAtAMDEhICAgICAgABFDQAgBEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACELAkAgClANACADQgh8QgAgChCohYCAAAsQgYCAgAAhDEIAQgArA9DEhICAgICAgAAgDCALoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIApQDQAgA0IIfEIAIAoQqIWAgAALIANC4AB8JICAgIAAC68JCQV+An8EfgJ/Bn4BfQJ+An8CfQJAIAEgAloNACAAKQNIIQMgACkDGCEEIAApAwghBSAAKQMAIQYgACkDQCIHpyIIQX9qIgmtQgOGIQoDQCAEKQMwIQsgBSkDMCEMIAYpAzAhDQJAIAQoAhgiDkF/aiIPQQBIDQAgBCkDECAPrSIQQgOGIhF8IQAgBSkDECARfCESIAQpAwggEXwhESAGKQMQIAcgEHxCA4Z8IRAgASETA0AgACkDACATIBMgESkDACIUgCIVIBR+fSITfiALfCELIBIpAwAgE34gDHwhDCAQKQMAIBN+IA18IQ0gAEJ4fCEAIBJCeHwhEiAQQnh8IRAgEUJ4fCERIBUhEyAOQX9qIg5BAEoNAAsLAkACQCADUEUNAEMAAAAAIRYMAQsgBikDUCEXIAUpA1AhGEMAAAAAIRZCACEVA0AgDSEQAkAgCUEASA0AIAYpAxAgCnwhACAGKQMIIAp8IRIgCCEOIBUhESANIRADQCAAKQMAIBEgESASKQMAIhOAIhQgE359fiAQfCEQIABCeHwhACASQnh8IRIgFCERIA5Bf2oiDkEASg0ACwsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAFKQMAIAxCAYZ8LgEAIg5B/wdxIRkgDkGAgICAeHEhDwJAIA5B//8DcSIaQQp2QR9xIg5FDQACQCAOQR9HDQAgDyAaQQ10ckGAgID8B3K+IRsMBAsgDkEXdEGAgIDAA2ogD3IgGUENdHK+IRsMAwsCQCAZRQ0AQYCAgJgEIBlnIg5BF3RrIA9yIBogDkFqanRBDnRBgID/A3FyIQ8LIA++IRsMAgsgBSkDACAMQgGGfC8BAEEQdL4hGwwBCyAFKQMAIAxCAoZ8KgIAIRsLAkACQCAXQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBikDACAQQgGGfC4BACIOQf8HcSEZIA5BgICAgHhxIQ8CQCAOQf//A3EiGkEKdkEfcSIORQ0AAkAgDkEfRw0AIA8gGkENdHJBgICA/AdyviEcDAQLIA5BF3RBgICAwANqIA9yIBlBDXRyviEcDAMLAkAgGUUNAEGAgICYBCAZZyIOQRd0ayAPciAaIA5Bamp0QQ50QYCA/wNxciEPCyAPviEcDAILIAYpAwAgEEIBhnwvAQBBEHS+IRwMAQsgBikDACAQQgKGfCoCACEcCyAWIBwgG5WSIRYgFUIBfCIVIANSDQALCwJAAkAgBCkDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgC0IBhnwuAQAiDkH/B3EhGSAOQYCAgIB4cSEPAkAgDkH//wNxIhpBCnZBH3EiDkUNAAJAIA5BH0cNACAPIBpBDXRyQYCAgPwHcr4hGwwECyAOQRd0QYCAgMADaiAPciAZQQ10cr4hGwwDCwJAIBlFDQBBgICAmAQgGWciDkEXdGsgD3IgGiAOQWpqdEEOdEGAgP8DcXIhDwsgD74hGwwCCyAEKQMAIAtCAYZ8LwEAQRB0viEbDAELIAQpAwAgC0IChnwqAgAhGwsgBCALIBYgG5IQlICAgAAgAUIBfCIBIAJSDQALCwuPBAIIfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBEIBIQUCQAJAIAEpAyBCAVENACAAKQMYIAIpAxh9IgVQRQ0AQgEhBEIAIQUMAQsgBUIDgyEGIAApAwghBwJAAkAgBUJ/fEIDWg0AQgAhCAwBCyAFQnyDIQlCASEEQgAhCCAHIQoDQCAKQhh8KQMAIApCEHwpAwAgCkIIfCkDACAKKQMAIAR+fn5+IQQgCkIgfCEKIAkgCEIEfCIIUg0ACwsgBlANACAHIAhCA4Z8IQoDQCAKKQMAIAR+IQQgCkIIfCEKIAZCf3wiBkIAUg0ACwsgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMwIANBADYCKCADQgA3AxggAyABNwMQIAMgADcDCCADQgA3A1ggAyAENwNQIAMgBTcDSEIAKQPIxISAgICAgIAAIQQgAyACNwMgIAIpAyAhCgJAAkBCAC0AwMSEgICAgICAAEUNACAEQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQsCQCAKUA0AIANCCHxCACAKEKqFgIAACxCBgICAACEMQgBCACsD0MSEgICAgICAACAMIAuhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgClANACADQgh8QgAgChCqhYCAAAsgA0LgAHwkgICAgAAL0AgKA34Cfwd+AX8EfgF/A34CfQJ/AX0CQCABIAJaDQAgACkDGCEDAkAgACkDSCIEUEUNAANAIAMpAzAhBQJAIAMoAhgiBkF/aiIHQQBIDQAgAykDECAHrUIDhiIIfCEAIAMpAwggCHwhCCABIQkDQCAAKQMAIAkgCSAIKQMAIgqAIgsgCn59fiAFfCEFIABCeHwhACAIQnh8IQggCyEJIAZBf2oiBkEASg0ACwsgAyAFQwAAAAAQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAApAwghDCAAKQMAIQ0gACkDQCIOpyIPQX9qIgetQgOGIRADQCADKQMwIREgDCkDMCESIA0pAzAhEwJAIAMoAhgiBkF/aiIUQX9MDQAgAykDCCAUrSIFQgOGIgl8IQAgDCkDECAJfCEIIAMpAxAgCXwhCSANKQMQIA4gBXxCA4Z8IQUgASEKA0AgCSkDACAKIAogACkDACILgCIVIAt+fSIKfiARfCERIAgpAwAgCn4gEnwhEiAFKQMAIAp+IBN8IRMgAEJ4fCEAIAVCeHwhBSAIQnh8IQggCUJ4fCEJIBUhCiAGQX9qIgZBAEoNAAsLIA0pA1AhFiAMKQNQIRdDAAAAACEYQgAhFQNAIBMhBQJAIAdBf0wNACANKQMIIBB8IQAgDSkDECAQfCEIIA8hBiAVIQkgEyEFA0AgCCkDACAJIAkgACkDACIKgCILIAp+fX4gBXwhBSAAQnh8IQAgCEJ4fCEIIAshCSAGQX9qIgZBAEoNAAsLAkACQCAXQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDCkDACASQgGGfC8BAEEQdL4hGQwCCyAMKQMAIBJCAYZ8LgEAIgZBgICAgHhxIRQCQAJAAkAgBkH//wNxIhpBCnZBH3EiG0EfRg0AIAZB/wdxIQYgGw0BIAZFDQJBgICAmAQgBmciBkEXdGsgFHIgGiAGQWpqdEEOdEGAgP8DcXK+IRkMBAsgFCAaQQ10ckGAgID8B3K+IRkMAwsgG0EXdEGAgIDAA2ogFHIgBkENdHIhFAsgFL4hGQwBCyAMKQMAIBJCAoZ8KgIAIRkLAkACQCAWQn98IgBCAVYNAAJAAkAgAKcOAgEAAQsgDSkDACAFQgGGfC8BAEEQdL4hHAwCCyANKQMAIAVCAYZ8LgEAIgZBgICAgHhxIRQCQAJAAkAgBkH//wNxIhpBCnZBH3EiG0EfRg0AIAZB/wdxIQYgGw0BIAZFDQJBgICAmAQgBmciBkEXdGsgFHIgGiAGQWpqdEEOdEGAgP8DcXK+IRwMBAsgFCAaQQ10ckGAgID8B3K+IRwMAwsgG0EXdEGAgIDAA2ogFHIgBkENdHIhFAsgFL4hHAwBCyANKQMAIAVCAoZ8KgIAIRwLIBy7IBm7EI6AgIAAIBi7oLYhGCAVQgF8IhUgBFINAAsgAyARIBgQlICAgAAgAUIBfCIBIAJSDQALCwuPBAIIfgJ8I4CAgIAAQuAAfSIDJICAgIAAQgEhBEIBIQUCQAJAIAEpAyBCAVENACAAKQMYIAIpAxh9IgVQRQ0AQgEhBEIAIQUMAQsgBUIDgyEGIAApAwghBwJAAkAgBUJ/fEIDWg0AQgAhCAwBCyAFQnyDIQlCASEEQgAhCCAHIQoDQCAKQhh8KQMAIApCEHwpAwAgCkIIfCkDACAKKQMAIAR+fn5+IQQgCkIgfCEKIAkgCEIEfCIIUg0ACwsgBlANACAHIAhCA4Z8IQoDQCAKKQMAIAR+IQQgCkIIfCEKIAZCf3wiBkIAUg0ACwsgA0I4fEIANwMAIANCwAB8QgA3AwAgA0IANwMwIANBADYCKCADQgA3AxggAyABNwMQIAMgADcDCCADQgA3A1ggAyAENwNQIAMgBTcDSEIAKQPIxISAgICAgIAAIQQgAyACNwMgIAIpAyAhCgJAAkBCAC0AwMSEgICAgICAAEUNACAEQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQsCQCAKUA0AIANCCHxCACAKEKyFgIAACxCBgICAACEMQgBCACsD0MSEgICAgICAACAMIAuhoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgClANACADQgh8QgAgChCshYCAAAsgA0LgAHwkgICAgAALuAkJBX4CfwR+An8GfgF9An4CfwJ9AkAgASACWg0AIAApA0ghAyAAKQMYIQQgACkDCCEFIAApAwAhBiAAKQNAIgenIghBf2oiCa1CA4YhCgNAIAQpAzAhCyAFKQMwIQwgBikDMCENAkAgBCgCGCIOQX9qIg9BAEgNACAEKQMQIA+tIhBCA4YiEXwhACAFKQMQIBF8IRIgBCkDCCARfCERIAYpAxAgByAQfEIDhnwhECABIRMDQCAAKQMAIBMgEyARKQMAIhSAIhUgFH59IhN+IAt8IQsgEikDACATfiAMfCEMIBApAwAgE34gDXwhDSAAQnh8IQAgEkJ4fCESIBBCeHwhECARQnh8IREgFSETIA5Bf2oiDkEASg0ACwsCQAJAIANQRQ0AQwAAAAAhFgwBCyAGKQNQIRcgBSkDUCEYQwAAAAAhFkIAIRUDQCANIRACQCAJQQBIDQAgBikDECAKfCEAIAYpAwggCnwhEiAIIQ4gFSERIA0hEANAIAApAwAgESARIBIpAwAiE4AiFCATfn1+IBB8IRAgAEJ4fCEAIBJCeHwhEiAUIREgDkF/aiIOQQBKDQALCwJAAkAgGEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgDEIBhnwuAQAiDkH/B3EhGSAOQYCAgIB4cSEPAkAgDkH//wNxIhpBCnZBH3EiDkUNAAJAIA5BH0cNACAPIBpBDXRyQYCAgPwHcr4hGwwECyAOQRd0QYCAgMADaiAPciAZQQ10cr4hGwwDCwJAIBlFDQBBgICAmAQgGWciDkEXdGsgD3IgGiAOQWpqdEEOdEGAgP8DcXIhDwsgD74hGwwCCyAFKQMAIAxCAYZ8LwEAQRB0viEbDAELIAUpAwAgDEIChnwqAgAhGwsCQAJAIBdCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIBBCAYZ8LgEAIg5B/wdxIRkgDkGAgICAeHEhDwJAIA5B//8DcSIaQQp2QR9xIg5FDQACQCAOQR9HDQAgDyAaQQ10ckGAgID8B3K+IRwMBAsgDkEXdEGAgIDAA2ogD3IgGUENdHK+IRwMAwsCQCAZRQ0AQYCAgJgEIBlnIg5BF3RrIA9yIBogDkFqanRBDnRBgID/A3FyIQ8LIA++IRwMAgsgBikDACAQQgGGfC8BAEEQdL4hHAwBCyAGKQMAIBBCAoZ8KgIAIRwLIBy7IBu7EI6AgIAAIBa7oLYhFiAVQgF8IhUgA1INAAsLAkACQCAEKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBCkDACALQgGGfC4BACIOQf8HcSEZIA5BgICAgHhxIQ8CQCAOQf//A3EiGkEKdkEfcSIORQ0AAkAgDkEfRw0AIA8gGkENdHJBgICA/AdyviEbDAQLIA5BF3RBgICAwANqIA9yIBlBDXRyviEbDAMLAkAgGUUNAEGAgICYBCAZZyIOQRd0ayAPciAaIA5Bamp0QQ50QYCA/wNxciEPCyAPviEbDAILIAQpAwAgC0IBhnwvAQBBEHS+IRsMAQsgBCkDACALQgKGfCoCACEbCyAEIAsgFiAbkhCUgICAACABQgF8IgEgAlINAAsLC48EAgh+AnwjgICAgABC4AB9IgMkgICAgABCASEEQgEhBQJAAkAgASkDIEIBUQ0AIAApAxggAikDGH0iBVBFDQBCASEEQgAhBQwBCyAFQgODIQYgACkDCCEHAkACQCAFQn98QgNaDQBCACEIDAELIAVCfIMhCUIBIQRCACEIIAchCgNAIApCGHwpAwAgCkIQfCkDACAKQgh8KQMAIAopAwAgBH5+fn4hBCAKQiB8IQogCSAIQgR8IghSDQALCyAGUA0AIAcgCEIDhnwhCgNAIAopAwAgBH4hBCAKQgh8IQogBkJ/fCIGQgBSDQALCyADQjh8QgA3AwAgA0LAAHxCADcDACADQgA3AzAgA0EANgIoIANCADcDGCADIAE3AxAgAyAANwMIIANCADcDWCADIAQ3A1AgAyAFNwNIQgApA8jEhICAgICAgAAhBCADIAI3AyAgAikDICEKAkACQEIALQDAxISAgICAgIAARQ0AIARCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhCwJAIApQDQAgA0IIfEIAIAoQroWAgAALEIGAgIAAIQxCAEIAKwPQxISAgICAgIAAIAwgC6GgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAKUA0AIANCCHxCACAKEK6FgIAACyADQuAAfCSAgICAAAuQEwUXfgJ/AX0DfwJ9IAApAwAiAykDCCADKQMYIgRCf3wiBUIDhnwpAwAhBiAAKQNQIQcgACkDGCEIIAApAwghCQJAAkAgAykDUEIAUg0AIAkpA1BCAFINACAIKQNQQgBSDQAgASACWg0BIAZQDQEgCCkDGCIAQn58IQogAEIDhiAIKQMQIgt8Qnh8KQMAIQwgCCkDMCENIAkpAxgiDkJ+fCEPIAMpAxAiECAFQgOGfCkDACERIA5CA4YgCSkDECISfEJ4fCkDACETIAgpAwAhFCAJKQMAIRUgAykDACEFIAkpAzAhCSADKQMwIQgCQCAEQgJUDQAgBkIBgyEWIAZCfoMhFyAGQn98IQYgEiAPQgOGfCEYIAsgCkIDhnwhCiAQIARCfnxCA4Z8KQMAIRkgAEICVCEaIA5CAlQhGwNAIAEgASAHgCIAIAd+fSEOQgAhBAJAIBoNACAKKQMAIQQLIBQgBCAAfiANfCAMIA5+fEIChnwhBCATIA5+IQMgGSAAfiAIfCEOAkACQCAbDQAgBCoCACEcIBgpAwAhD0IAIQACQCAGUA0AA0AgBCAFIA4gESAAfnxCAoZ8KgIAIBUgDyAAfiAJfCADfEIChnwqAgCUIBySIhw4AgAgBCAFIA4gESAAQgGEIhB+fEIChnwqAgAgFSAPIBB+IAl8IAN8QgKGfCoCAJQgHJIiHDgCACAXIABCAnwiAFINAAsLIBZQDQEgBCAFIA4gESAAfnxCAoZ8KgIAIBUgDyAAfiAJfCADfEIChnwqAgCUIBySOAIADAELIBUgCSADfEIChnwhAyAEKgIAIRxCACEAAkAgBlANAANAIAQgBSAOIBEgAH58QgKGfCoCACADKgIAlCAckiIcOAIAIAQgBSAOIBEgAEIBhH58QgKGfCoCACADKgIAlCAckiIcOAIAIBcgAEICfCIAUg0ACwsgFlANACAEIAUgDiARIAB+fEIChnwqAgAgAyoCAJQgHJI4AgALIAFCAXwiASACUg0ADAMLCwJAIA5CAVYNACAIQgKGIQ8gEUIDhiEXIAZCfoMhECAGQgGDIRYgCCARfEIChiEZIAsgCkIDhnwhGCAAQgJUIRogBkIBUSEbA0AgASABIAeAIgMgB359IQBCACEEQgAhDgJAIBoNACAYKQMAIQ4LIBQgDiADfiANfCAMIAB+fEIChnwiDioCACEcIBUgCSATIAB+fEIChnwhAwJAIBsNAEIAIQQgBSEAA0AgDiAAIA98KgIAIAMqAgCUIBySIhw4AgAgDiAAIBl8KgIAIAMqAgCUIBySIhw4AgAgACAXfCEAIBAgBEICfCIEUg0ACwsCQCAWUA0AIA4gBSAIIBEgBH58QgKGfCoCACADKgIAlCAckjgCAAsgAUIBfCIBIAJSDQAMAwsLIAhCAoYhFyARQgOGIRAgBkJ+gyEZIAZCAYMhGCAIIBF8QgKGIRYgCyAKQgOGfCEKIBIgD0IDhnwpAwAhDyAAQgJUIRogBkIBUSEbA0AgASABIAeAIgMgB359IQRCACEAQgAhDgJAIBoNACAKKQMAIQ4LIBQgDiADfiANfCAMIAR+fEIChnwiDioCACEcIBMgBH4hAwJAIBsNAEIAIQAgBSEEA0AgDiAEIBd8KgIAIBUgDyAAfiAJfCADfEIChnwqAgCUIBySIhw4AgAgDiAEIBZ8KgIAIBUgDyAAQgGEfiAJfCADfEIChnwqAgCUIBySIhw4AgAgBCAQfCEEIBkgAEICfCIAUg0ACwsCQCAYUA0AIA4gBSAIIBEgAH58QgKGfCoCACAVIA8gAH4gCXwgA3xCAoZ8KgIAlCAckjgCAAsgAUIBfCIBIAJSDQAMAgsLIAEgAloNACAGUCEdA0AgASABIAeAIhEgB359IQAgCCkDECEEIAgpAzAhFUIAIQUCQCAIKQMYIg5CAlQNACAOQgOGIAR8QnB8KQMAIQULIAUgEX4gFXwgDkIDhiAEfEJ4fCkDACAAfnwhGAJAAkAgCCkDUEJ/fCIEQgFWDQACQAJAIASnDgIAAQALIAgpAwAgGEIBhnwuAQAiGkH/B3EhHiAaQYCAgIB4cSEbAkAgGkH//wNxIh9BCnZBH3EiGkUNAAJAIBpBH0cNACAbIB9BDXRyQYCAgPwHcr4hHAwECyAaQRd0QYCAgMADaiAbciAeQQ10cr4hHAwDCwJAIB5FDQBBgICAmAQgHmciGkEXdGsgG3IgHyAaQWpqdEEOdEGAgP8DcXIhGwsgG74hHAwCCyAIKQMAIBhCAYZ8LwEAQRB0viEcDAELIAgpAwAgGEIChnwqAgAhHAsCQCAdDQAgCSkDGCIVQgOGIAkpAxB8IgRCcHwhEyADKQMYIg9CA4YgAykDEHwiBUJwfCEUIARCeHwpAwAgAH4hFyAFQnh8KQMAIRAgCSkDUCEZIAMpA1AhFiAJKQMwIQwgAykDMCENQgAhAANAQgAhBAJAIA9CAlQNACAUKQMAIQQLIBAgAH4hBSAEIBF+IA18IQ5CACEEAkAgFUICVA0AIBMpAwAhBAsgDiAFfCEFIAQgAH4gDHwhBAJAAkAgFkJ/fCIOQgFWDQACQAJAIA6nDgIAAQALIAMpAwAgBUIBhnwuAQAiGkH/B3EhHiAaQYCAgIB4cSEbAkAgGkH//wNxIh9BCnZBH3EiGkUNAAJAIBpBH0cNACAbIB9BDXRyQYCAgPwHcr4hIAwECyAaQRd0QYCAgMADaiAbciAeQQ10cr4hIAwDCwJAIB5FDQBBgICAmAQgHmciGkEXdGsgG3IgHyAaQWpqdEEOdEGAgP8DcXIhGwsgG74hIAwCCyADKQMAIAVCAYZ8LwEAQRB0viEgDAELIAMpAwAgBUIChnwqAgAhIAsgBCAXfCEEAkACQCAZQn98IgVCAVYNAAJAAkAgBacOAgABAAsgCSkDACAEQgGGfC4BACIaQf8HcSEeIBpBgICAgHhxIRsCQCAaQf//A3EiH0EKdkEfcSIaRQ0AAkAgGkEfRw0AIBsgH0ENdHJBgICA/AdyviEhDAQLIBpBF3RBgICAwANqIBtyIB5BDXRyviEhDAMLAkAgHkUNAEGAgICYBCAeZyIaQRd0ayAbciAfIBpBamp0QQ50QYCA/wNxciEbCyAbviEhDAILIAkpAwAgBEIBhnwvAQBBEHS+ISEMAQsgCSkDACAEQgKGfCoCACEhCyAcICAgIZSSIRwgBiAAQgF8IgBSDQALCyAIIBggHBCUgICAACABQgF8IgEgAlINAAsLC/YCAgN+AnwjgICAgABC4AB9IgQkgICAgABCASEFAkAgAw0AIAApAxhCA4YgACkDCHxCcHwpAwAhBQsgASkDGEIDhiABKQMIfEJ4fCkDACEGIARCOHxCADcDACAEQsAAfEIANwMAIARCyAB8QgA3AwAgBELQAHxCADcDACAEQgA3AzAgBEEANgIoIAQgAjcDICAEQgA3AxggBCABNwMQIAQgADcDCCAEIAY3A1ggBiAFfiEBAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBwJAIAFQDQAgBEIIfEIAIAEQsIWAgAALEIGAgIAAIQhCAEIAKwPQxISAgICAgIAAIAggB6GgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyABUA0AIARCCHxCACABELCFgIAACyAEQuAAfCSAgICAAAvYBQEOfiABKQMYIgNCA4YhBCABKQMIIQUgA0J+fCEGIAApAxgiB0IDhiEIIAApAwghCUIBIQpCASELAkAgB0J+fCIMUA0AIAxCA4MhDQJAAkAgB0J9fEIDWg0AQgEhC0IAIQ4MAQsgDEJ8gyEPQgEhC0IAIQ4gCSEHA0AgB0IYfCkDACAHQhB8KQMAIAdCCHwpAwAgBykDACALfn5+fiELIAdCIHwhByAPIA5CBHwiDlINAAsLIA1QDQAgCSAOQgOGfCEHA0AgBykDACALfiELIAdCCHwhByANQn98Ig1CAFINAAsLIAQgBXwhBCAGQgOGIRAgCCAJfCEIIAxCA4YhDAJAIAZQDQAgBkIDgyENAkACQCADQn18QgNaDQBCASEKQgAhDgwBCyAGQnyDIQ9CASEKQgAhDiAFIQcDQCAHQhh8KQMAIAdCEHwpAwAgB0IIfCkDACAHKQMAIAp+fn5+IQogB0IgfCEHIA8gDkIEfCIOUg0ACwsgDVANACAFIA5CA4Z8IQcDQCAHKQMAIAp+IQogB0IIfCEHIA1Cf3wiDUIAUg0ACwsgBEJ4fCEHIAUgEHwhDSAIQnh8IQ4gCSAMfCEPQgAhBgJAIAIpAxgiBUIDVA0AIAVCA4YgAikDEHxCaHwpAwAhBgsgBykDACEFIA0pAwAhCSAOKQMAIQwgDykDACEDIAJDAAAAABCcgICAACAAIAApAxhCfnxCABCzhYCAACEHIAEgASkDGEJ+fEIAELOFgIAAIQ0gAiACKQMYQn58QgAQs4WAgAAhDgJAIAsgCiALIApWGyIPUA0AIAwgA35CACALQgFWGyELIAUgCX5CACAKQgFWGyEKA0AgByANIA5BABCxhYCAACAHIAcpAzAgC3w3AzAgDSANKQMwIAp8NwMwIA4gDikDMCAGfDcDMCAPQn98Ig9QRQ0ACwsgBxC0hYCAACANELSFgIAAIA4QtIWAgAAL5QMBCH4gACkDGCEDQgFC2AAQ9YWAgAAiBCAAKQMANwMAIARCASADIAF9IgUgAyABURsiBkIDhiIHEPKFgIAAIgg3AwggBCAHEPKFgIAAIgk3AxACQAJAIAMgAVINACAJQgE3AwAgCEIBNwMADAELIAggACkDCCABQgOGIgp8IAf8CgAAIAkgACkDECAKfCAH/AoAAAsgBCAGNwMYQgAhBwJAIANQDQBCASEHIAMgAVgNACAFQgODIQggACkDCCEKAkACQCADIAFCf4V8QgNaDQBCASEHDAELIAVCfIMhCSAKIAFCA4Z8IQNCASEHA0AgA0IYfCkDACADQhB8KQMAIANCCHwpAwAgAykDACAHfn5+fiEHIANCIHwhAyABQgR8IQEgCUJ8fCIJQgBSDQALCyAIUA0AIAogAUIDhnwhAwNAIAMpAwAgB34hByADQgh8IQMgCEJ/fCIIQgBSDQALCyAEIAc3AyAgBCAANwNIIARBAToAQCAEIAApAyg3AyggBCAAKQNQNwNQIAQgACkDMCACfDcDMCAEIAZCBIZC2AB8IgM3AzhCiMSEgICAgICAAEKIxISAgICAgIAAKQMIQgF8NwMIQgBCACkDiMSEgICAgICAACADfDcDiMSEgICAgICAACAEC5cDAwR+AX8CfkIAQgApA4jEhICAgICAgAAgACkDOH03A4jEhICAgICAgABCiMSEgICAgICAAEKIxISAgICAgIAAKQMIQn98NwMIAkAgAC0AQA0AIAApAwAhAQJAAkACQEIEQgIgACkDUFAbIAApAyh+QgN8IgJCFFQNAEJ+IQMgAkICiEJ/fCIEIQIDQCADQgF8IQMgAkIDViEFIAJCAYghAiAFDQALQojEhICAgICAgAApAxAgBCADiEIBfCADhkIChnwiBkKIxISAgICAgIAAKQMYVg0BQn4hA0J8IQcgBCECA0AgB0IEfCEHIANCAXwhAyACQgNWIQUgAkIBiCECIAUNAAsgBCADiCAHfCECDAILQgAhAkKIxISAgICAgIAAKQMQQhB8IgZCiMSEgICAgICAACkDGFgNAQsgARD0hYCAAAwBCyABQuDEhICAgICAgAAgAkIDhnwiAikDADcDAEKIxISAgICAgIAAIAY3AxAgAiABNwMACyAAKQMIEPSFgIAAIAApAxAQ9IWAgAAgABD0hYCAAAvFBQEPfiABKQMYIgNCA4YhBCABKQMIIQUgA0J+fCEGIAApAxgiB0IDhiEIIAApAwghCUIBIQpCASELAkAgB0J+fCIMUA0AIAxCA4MhDQJAAkAgB0J9fEIDWg0AQgEhC0IAIQ4MAQsgDEJ8gyEPQgEhC0IAIQ4gCSEHA0AgB0IYfCkDACAHQhB8KQMAIAdCCHwpAwAgBykDACALfn5+fiELIAdCIHwhByAPIA5CBHwiDlINAAsLIA1QDQAgCSAOQgOGfCEHA0AgBykDACALfiELIAdCCHwhByANQn98Ig1CAFINAAsLIAQgBXwhBCAGQgOGIRAgCCAJfCEIIAxCA4YhEQJAIAZQDQAgBkIDgyENAkACQCADQn18QgNaDQBCASEKQgAhDgwBCyAGQnyDIQ9CASEKQgAhDiAFIQcDQCAHQhh8KQMAIAdCEHwpAwAgB0IIfCkDACAHKQMAIAp+fn5+IQogB0IgfCEHIA8gDkIEfCIOUg0ACwsgDVANACAFIA5CA4Z8IQcDQCAHKQMAIAp+IQogB0IIfCEHIA1Cf3wiDUIAUg0ACwsgBEJ4fCEHIAUgEHwhDSAIQnh8IQ4gCSARfCEPQgAhBgJAIAIpAxgiBUIDVA0AIAVCA4YgAikDEHxCaHwpAwAhBgsgBykDACEFIA0pAwAhCSAOKQMAIQMgDykDACEEIAAgDEIAELOFgIAAIQcgASABKQMYQn58QgAQs4WAgAAhDSACIAIpAxhCfnxCABCzhYCAACEOAkAgCyAKIAsgClYbIg9QDQAgAyAEfkIAIAtCAVYbIQsgBSAJfkIAIApCAVYbIQoDQCAHIA0gDkEAELGFgIAAIAcgBykDMCALfDcDMCANIA0pAzAgCnw3AzAgDiAOKQMwIAZ8NwMwIA9Cf3wiD1BFDQALCyAHELSFgIAAIA0QtIWAgAAgDhC0hYCAAAv/BwISfgJ8I4CAgIAAQuAAfSIDJICAgIAAIAApAxgiBEJ/fCIFQgOGIQYgACkDCCEHQgEhCEIBIQkCQCAFUA0AIAVCA4MhCgJAAkAgBEJ+fEIDWg0AQgEhCUIAIQQMAQsgBUJ8gyELQgEhCUIAIQQgByEFA0AgBUIYfCkDACAFQhB8KQMAIAVCCHwpAwAgBSkDACAJfn5+fiEJIAVCIHwhBSALIARCBHwiBFINAAsLIApQDQAgByAEQgOGfCEFA0AgBSkDACAJfiEJIAVCCHwhBSAKQn98IgpCAFINAAsLIAcgBnwhBiABKQMYIgRCA4YgASkDCCIHfEJ4fCEMIAcgBEJ+fCIFQgOGfCENAkAgBVANACAFQgODIQoCQAJAIARCfXxCA1oNAEIBIQhCACEEDAELIAVCfIMhC0IBIQhCACEEIAchBQNAIAVCGHwpAwAgBUIQfCkDACAFQgh8KQMAIAUpAwAgCH5+fn4hCCAFQiB8IQUgCyAEQgR8IgRSDQALCyAKUA0AIAcgBEIDhnwhBQNAIAUpAwAgCH4hCCAFQgh8IQUgCkJ/fCIKQgBSDQALCyAMKQMAIQ4gDSkDACEEIAYpAwAhDyACQwAAAAAQnICAgAAgACAAKQMYQn98QgAQs4WAgAAhACABIAEpAxhCfnxCABCzhYCAACEFIAIgAikDGCIKQn58QgAgCkIBVhtCABCzhYCAACECAkAgCVANACAIUA0AIA4gBH4hDUIAKQPIxISAgICAgIAAIQcgA0IwfCIMQgh8IRAgDEIQfCERIAxCGHwhEiAMQiB8IRNCACEGQgAhFEIAIQsDQCAIIQFCACEEA0AgBSAENwMwIAAgBjcDMCACIAs3AzAgBSkDGEIDhiAFKQMIfEJ4fCkDACEKIAxCADcDACAQQgA3AwAgEUIANwMAIBJCADcDACATQgA3AwAgA0EANgIoIAMgAjcDICADQgA3AxggAyAFNwMQIAMgADcDCCADIAo3A1gCQAJAQgAtAMDEhICAgICAgABFDQAgB0IAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEVAkAgClANACADQgh8QgAgChCwhYCAAAsQgYCAgAAhFkIAQgArA9DEhICAgICAgAAgFiAVoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98Igc3A8jEhICAgICAgAAMAQsgClANACADQgh8QgAgChCwhYCAAEIAKQPIxISAgICAgIAAIQcLIAsgDnwhCyAEIA18IQQgAUJ/fCIBQgBSDQALIAYgD3whBiAUQgF8IhQgCVINAAsLIAAQtIWAgAAgBRC0hYCAACACELSFgIAAIANC4AB8JICAgIAAC+wHAhJ+AnwjgICAgABC4AB9IgMkgICAgAAgACkDGCIEQn98IgVCA4YhBiAAKQMIIQdCASEIQgEhCQJAIAVQDQAgBUIDgyEKAkACQCAEQn58QgNaDQBCASEJQgAhCwwBCyAFQnyDIQxCASEJQgAhCyAHIQQDQCAEQhh8KQMAIARCEHwpAwAgBEIIfCkDACAEKQMAIAl+fn5+IQkgBEIgfCEEIAwgC0IEfCILUg0ACwsgClANACAHIAtCA4Z8IQQDQCAEKQMAIAl+IQkgBEIIfCEEIApCf3wiCkIAUg0ACwsgByAGfCEGIAEpAxgiC0IDhiABKQMIIgd8Qnh8IQ0gByALQn58IgRCA4Z8IQ4CQCAEUA0AIARCA4MhCgJAAkAgC0J9fEIDWg0AQgEhCEIAIQsMAQsgBEJ8gyEMQgEhCEIAIQsgByEEA0AgBEIYfCkDACAEQhB8KQMAIARCCHwpAwAgBCkDACAIfn5+fiEIIARCIHwhBCAMIAtCBHwiC1INAAsLIApQDQAgByALQgOGfCEEA0AgBCkDACAIfiEIIARCCHwhBCAKQn98IgpCAFINAAsLIA0pAwAhDSAOKQMAIQsgBikDACEPIAAgBUIAELOFgIAAIQAgASABKQMYQn58QgAQs4WAgAAhBCACIAIpAxgiCkJ+fEIAIApCAVYbQgAQs4WAgAAhBQJAIAlQDQAgCFANACANIAt+IQ5CACkDyMSEgICAgICAACECIANCMHwiBkIIfCEQIAZCEHwhESAGQhh8IRIgBkIgfCETQgAhB0IAIRRCACEMA0AgCCEBQgAhCwNAIAQgCzcDMCAAIAc3AzAgBSAMNwMwIAQpAxhCA4YgBCkDCHxCeHwpAwAhCiAGQgA3AwAgEEIANwMAIBFCADcDACASQgA3AwAgE0IANwMAIANBADYCKCADIAU3AyAgA0IANwMYIAMgBDcDECADIAA3AwggAyAKNwNYAkACQEIALQDAxISAgICAgIAARQ0AIAJCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhFQJAIApQDQAgA0IIfEIAIAoQsIWAgAALEIGAgIAAIRZCAEIAKwPQxISAgICAgIAAIBYgFaGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fCICNwPIxISAgICAgIAADAELIApQDQAgA0IIfEIAIAoQsIWAgABCACkDyMSEgICAgICAACECCyAMIA18IQwgCyAOfCELIAFCf3wiAUIAUg0ACyAHIA98IQcgFEIBfCIUIAlSDQALCyAAELSFgIAAIAQQtIWAgAAgBRC0hYCAACADQuAAfCSAgICAAAvHCwcLfgF/Bn4BfQp+BH8DfSAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMQIQYCQAJAIAApAygiB1ANACABIAJaDQEgACkDOCEIIAApAzAhCUIAIAYpAxgiCn0hCyAKQn+FIQwgACkDSCINUCEOA0AgAykDMCEPIAYpAzAhECAEKQMwIREgBSkDMCESIAEhEyAKIQACQANAIABCA4YhFAJAA0ACQCAAQgBSDQAgDkUNAkMAAAAAIRUMBAtCASEWAkAgACADKQMYIhd8Qn98IApUDQAgAykDCCAMIAB8IBd8QgOGfCkDACEWCyAAQn98IQAgFEJ4fCEUIBZCAVENAAsgCCAUfCkDACATIBMgBikDCCAUfCkDACIWgCIXIBZ+fSIWfiAPfCEPIAYpAxAgFHwpAwAgFn4gEHwhECAJIBR8KQMAIBZ+IBF8IREgByAUfCkDACAWfiASfCESIBchEwwBCwsgBikDUCEYIAQpA1AhGSAFKQNQIRpDAAAAACEVQgAhGwNAIBshFCASIRwgESEdIBAhHiAKIQADQCAUIR8gAEJ/fCEXIABCA4ZCeHwhFANAIBQhFgJAIBciAEJ/Ug0AAkACQCAaQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAcQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEkDAQLICBBF3RBgICAwANqICJyICFBDXRyviEkDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEkDAILIAUpAwAgHEIBhnwvAQBBEHS+ISQMAQsgBSkDACAcQgKGfCoCACEkCwJAAkAgGUJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgHUIBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJQwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJQwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJQwCCyAEKQMAIB1CAYZ8LwEAQRB0viElDAELIAQpAwAgHUIChnwqAgAhJQsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIB5CAYZ8LgEAIiBB/wdxISEgIEGAgICAeHEhIgJAICBB//8DcSIjQQp2QR9xIiBFDQACQCAgQR9HDQAgIiAjQQ10ckGAgID8B3K+ISYMBAsgIEEXdEGAgIDAA2ogInIgIUENdHK+ISYMAwsCQCAhRQ0AQYCAgJgEICFnIiBBF3RrICJyICMgIEFqanRBDnRBgID/A3FyISILICK+ISYMAgsgBikDACAeQgGGfC8BAEEQdL4hJgwBCyAGKQMAIB5CAoZ8KgIAISYLIBUgJCAmlCAlICWUlZMhFSAbQgF8IhsgDVINAwwECwJAIAAgAykDGCITfCAKVA0AIBZCeHwhFCAAQn98IRcgAykDCCALIAB8IBN8QgOGfCkDAEIBUg0BCwsgBikDECAWfCkDACAfIB8gBikDCCAWfCkDACIXgCIUIBd+fSIXfiAefCEeIAkgFnwpAwAgF34gHXwhHSAHIBZ8KQMAIBd+IBx8IRwMAAsLCyADIA8gFRCUgICAACABQgF8IgEgAlINAAwCCwsgASACWg0AIAIgAX0hEyAFKQMAIAFCAoYiF3whACAEKQMAIBd8IRYgBikDACAXfCEUIAMpAwAgF3whFwNAIBcgACoCACAUKgIAjJQgFioCACIlICWUlTgCACAAQgR8IQAgFkIEfCEWIBRCBHwhFCAXQgR8IRcgE0J/fCITUEUNAAsLC5UHBAp+AX8BfgJ8I4CAgIAAQuAAfSIEJICAgIAAIAMpAyAhBSACKQMgIQYgBCACKQMYIgdCA4ZCD3xCcIMiCH0iCSIKJICAgIAAIAogCH0iCyIKJICAgIAAIAogCH0iDCSAgICAACAEIg1COHxCADcDACANQsAAfEIANwMAIA1CyAB8QgA3AwAgDUIANwMwIA1BADYCKCANIAM3AyAgDSACNwMYIA0gATcDECANIAA3AwggDUIANwNYIA0gBiAFgDcDUEEBIQ4CQCAFIAApAyBSDQAgASkDICAFUiAGIAVSciEOCwJAAkAgACkDUEIAUg0AIAEpA1BCAFINACACKQNQQgBSDQAgDiADKQNQQgBScg0AIAAtAEANACABLQBADQAgAi0AQA0AIAMtAEBFDQELAkAgB1ANACAAKQMYIgJCf3whDyACQgOGQnh8IQggB0IDhiAJfEJ4fCECIAchBANAIAQiCkJ/fCEEQgAhBgJAIA8gCnwgB1QNAEIAIQYgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhBgsgAiAGNwMAIAhCeHwhCCACQnh8IQIgBEIAUg0ACyABKQMYIgJCf3whDyACQgOGQnh8IQggB0IDhiALfEJ4fCECIAchBANAIAQiCkJ/fCEEQgAhBgJAIA8gCnwgB1QNAEIAIQYgASkDCCAIfCkDAEIBUQ0AIAEpAxAgCHwpAwAhBgsgAiAGNwMAIAhCeHwhCCACQnh8IQIgBEIAUg0ACyADKQMYIgJCf3whDyACQgOGQnh8IQggB0IDhiAMfEJ4fCECIAchBANAIAQiCkJ/fCEEQgAhBgJAIA8gCnwgB1QNAEIAIQYgAykDCCAIfCkDAEIBUQ0AIAMpAxAgCHwpAwAhBgsgAiAGNwMAIAhCeHwhCCACQnh8IQIgBEIAUg0ACwsgDSAMNwNAIA0gCzcDOCANIAk3AzALAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhEAJAIAVQDQAgDUIIfEIAIAUQuIWAgAALEIGAgIAAIRFCAEIAKwPQxISAgICAgIAAIBEgEKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAFUA0AIA1CCHxCACAFELiFgIAACyANQuAAfCSAgICAAAu9DQcLfgF/Bn4BfQp+BH8DfSAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMQIQYCQAJAIAApAygiB1ANACABIAJaDQEgACkDOCEIIAApAzAhCUIAIAYpAxgiCn0hCyAKQn+FIQwgACkDSCINUCEOA0AgAykDMCEPIAYpAzAhECAEKQMwIREgBSkDMCESIAEhEyAKIQACQANAIABCA4YhFAJAA0ACQCAAQgBSDQAgDkUNAkMAAAAAIRUMBAtCASEWAkAgACADKQMYIhd8Qn98IApUDQAgAykDCCAMIAB8IBd8QgOGfCkDACEWCyAAQn98IQAgFEJ4fCEUIBZCAVENAAsgCCAUfCkDACATIBMgBikDCCAUfCkDACIWgCIXIBZ+fSIWfiAPfCEPIAYpAxAgFHwpAwAgFn4gEHwhECAJIBR8KQMAIBZ+IBF8IREgByAUfCkDACAWfiASfCESIBchEwwBCwsgBikDUCEYIAQpA1AhGSAFKQNQIRpDAAAAACEVQgAhGwNAIBshFCASIRwgESEdIBAhHiAKIQADQCAUIR8gAEJ/fCEXIABCA4ZCeHwhFANAIBQhFgJAIBciAEJ/Ug0AAkACQCAaQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAcQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEkDAQLICBBF3RBgICAwANqICJyICFBDXRyviEkDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEkDAILIAUpAwAgHEIBhnwvAQBBEHS+ISQMAQsgBSkDACAcQgKGfCoCACEkCwJAAkAgGUJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgHUIBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJQwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJQwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJQwCCyAEKQMAIB1CAYZ8LwEAQRB0viElDAELIAQpAwAgHUIChnwqAgAhJQsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIB5CAYZ8LgEAIiBB/wdxISEgIEGAgICAeHEhIgJAICBB//8DcSIjQQp2QR9xIiBFDQACQCAgQR9HDQAgIiAjQQ10ckGAgID8B3K+ISYMBAsgIEEXdEGAgIDAA2ogInIgIUENdHK+ISYMAwsCQCAhRQ0AQYCAgJgEICFnIiBBF3RrICJyICMgIEFqanRBDnRBgID/A3FyISILICK+ISYMAgsgBikDACAeQgGGfC8BAEEQdL4hJgwBCyAGKQMAIB5CAoZ8KgIAISYLIBUgJCAmlCAlICWUlZMhFSAbQgF8IhsgDVENBAwDCwJAIAAgAykDGCITfCAKVA0AIBZCeHwhFCAAQn98IRcgAykDCCALIAB8IBN8QgOGfCkDAEIBUg0BCwsgBikDECAWfCkDACAfIB8gBikDCCAWfCkDACIXgCIUIBd+fSIXfiAefCEeIAkgFnwpAwAgF34gHXwhHSAHIBZ8KQMAIBd+IBx8IRwMAAsLCwJAAkAgAykDUEJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAMpAwAgD0IBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJQwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJQwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJQwCCyADKQMAIA9CAYZ8LwEAQRB0viElDAELIAMpAwAgD0IChnwqAgAhJQsgAyAPIBUgJZIQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAEgAloNACACIAF9IRMgBSkDACABQgKGIgB8IRYgBCkDACAAfCEUIAYpAwAgAHwhFyADKQMAIAB8IQADQCAAIAAqAgAgFioCACAXKgIAlCAUKgIAIiUgJZSVkzgCACAWQgR8IRYgFEIEfCEUIBdCBHwhFyAAQgR8IQAgE0J/fCITUEUNAAsLC5UHBAp+AX8BfgJ8I4CAgIAAQuAAfSIEJICAgIAAIAMpAyAhBSACKQMgIQYgBCACKQMYIgdCA4ZCD3xCcIMiCH0iCSIKJICAgIAAIAogCH0iCyIKJICAgIAAIAogCH0iDCSAgICAACAEIg1COHxCADcDACANQsAAfEIANwMAIA1CyAB8QgA3AwAgDUIANwMwIA1BADYCKCANIAM3AyAgDSACNwMYIA0gATcDECANIAA3AwggDUIANwNYIA0gBiAFgDcDUEEBIQ4CQCAFIAApAyBSDQAgASkDICAFUiAGIAVSciEOCwJAAkAgACkDUEIAUg0AIAEpA1BCAFINACACKQNQQgBSDQAgDiADKQNQQgBScg0AIAAtAEANACABLQBADQAgAi0AQA0AIAMtAEBFDQELAkAgB1ANACAAKQMYIgJCf3whDyACQgOGQnh8IQggB0IDhiAJfEJ4fCECIAchBANAIAQiCkJ/fCEEQgAhBgJAIA8gCnwgB1QNAEIAIQYgACkDCCAIfCkDAEIBUQ0AIAApAxAgCHwpAwAhBgsgAiAGNwMAIAhCeHwhCCACQnh8IQIgBEIAUg0ACyABKQMYIgJCf3whDyACQgOGQnh8IQggB0IDhiALfEJ4fCECIAchBANAIAQiCkJ/fCEEQgAhBgJAIA8gCnwgB1QNAEIAIQYgASkDCCAIfCkDAEIBUQ0AIAEpAxAgCHwpAwAhBgsgAiAGNwMAIAhCeHwhCCACQnh8IQIgBEIAUg0ACyADKQMYIgJCf3whDyACQgOGQnh8IQggB0IDhiAMfEJ4fCECIAchBANAIAQiCkJ/fCEEQgAhBgJAIA8gCnwgB1QNAEIAIQYgAykDCCAIfCkDAEIBUQ0AIAMpAxAgCHwpAwAhBgsgAiAGNwMAIAhCeHwhCCACQnh8IQIgBEIAUg0ACwsgDSAMNwNAIA0gCzcDOCANIAk3AzALAkACQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhEAJAIAVQDQAgDUIIfEIAIAUQuoWAgAALEIGAgIAAIRFCAEIAKwPQxISAgICAgIAAIBEgEKGgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAFUA0AIA1CCHxCACAFELqFgIAACyANQuAAfCSAgICAAAvpCwcLfgF/Bn4BfQp+BH8DfSAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMQIQYCQAJAIAApAygiB1ANACABIAJaDQEgACkDOCEIIAApAzAhCUIAIAYpAxgiCn0hCyAKQn+FIQwgACkDSCINUCEOA0AgAykDMCEPIAYpAzAhECAEKQMwIREgBSkDMCESIAEhEyAKIQACQANAIABCA4YhFAJAA0ACQCAAQgBSDQAgDkUNAkMAAAAAIRUMBAtCASEWAkAgACADKQMYIhd8Qn98IApUDQAgAykDCCAMIAB8IBd8QgOGfCkDACEWCyAAQn98IQAgFEJ4fCEUIBZCAVENAAsgCCAUfCkDACATIBMgBikDCCAUfCkDACIWgCIXIBZ+fSIWfiAPfCEPIAYpAxAgFHwpAwAgFn4gEHwhECAJIBR8KQMAIBZ+IBF8IREgByAUfCkDACAWfiASfCESIBchEwwBCwsgBikDUCEYIAQpA1AhGSAFKQNQIRpDAAAAACEVQgAhGwNAIBshFCASIRwgESEdIBAhHiAKIQADQCAUIR8gAEJ/fCEXIABCA4ZCeHwhFANAIBQhFgJAIBciAEJ/Ug0AAkACQCAaQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAcQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEkDAQLICBBF3RBgICAwANqICJyICFBDXRyviEkDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEkDAILIAUpAwAgHEIBhnwvAQBBEHS+ISQMAQsgBSkDACAcQgKGfCoCACEkCwJAAkAgGUJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgHUIBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJQwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJQwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJQwCCyAEKQMAIB1CAYZ8LwEAQRB0viElDAELIAQpAwAgHUIChnwqAgAhJQsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIB5CAYZ8LgEAIiBB/wdxISEgIEGAgICAeHEhIgJAICBB//8DcSIjQQp2QR9xIiBFDQACQCAgQR9HDQAgIiAjQQ10ckGAgID8B3K+ISYMBAsgIEEXdEGAgIDAA2ogInIgIUENdHK+ISYMAwsCQCAhRQ0AQYCAgJgEICFnIiBBF3RrICJyICMgIEFqanRBDnRBgID/A3FyISILICK+ISYMAgsgBikDACAeQgGGfC8BAEEQdL4hJgwBCyAGKQMAIB5CAoZ8KgIAISYLICS7ICVDAACAv5K7EI6AgIAAICUgJpS7oiAVu6C2IRUgG0IBfCIbIA1SDQMMBAsCQCAAIAMpAxgiE3wgClQNACAWQnh8IRQgAEJ/fCEXIAMpAwggCyAAfCATfEIDhnwpAwBCAVINAQsLIAYpAxAgFnwpAwAgHyAfIAYpAwggFnwpAwAiF4AiFCAXfn0iF34gHnwhHiAJIBZ8KQMAIBd+IB18IR0gByAWfCkDACAXfiAcfCEcDAALCwsgAyAPIBUQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAEgAloNACACIAF9IRMgBSkDACABQgKGIhd8IQAgBCkDACAXfCEWIAYpAwAgF3whFCADKQMAIBd8IRcDQCAUKgIAISUgFyAAKgIAuyAWKgIAIhVDAACAv5K7EI6AgIAAIBUgJZS7orY4AgAgAEIEfCEAIBZCBHwhFiAUQgR8IRQgF0IEfCEXIBNCf3wiE1BFDQALCwuVBwQKfgF/AX4CfCOAgICAAELgAH0iBCSAgICAACADKQMgIQUgAikDICEGIAQgAikDGCIHQgOGQg98QnCDIgh9IgkiCiSAgICAACAKIAh9IgsiCiSAgICAACAKIAh9IgwkgICAgAAgBCINQjh8QgA3AwAgDULAAHxCADcDACANQsgAfEIANwMAIA1CADcDMCANQQA2AiggDSADNwMgIA0gAjcDGCANIAE3AxAgDSAANwMIIA1CADcDWCANIAYgBYA3A1BBASEOAkAgBSAAKQMgUg0AIAEpAyAgBVIgBiAFUnIhDgsCQAJAIAApA1BCAFINACABKQNQQgBSDQAgAikDUEIAUg0AIA4gAykDUEIAUnINACAALQBADQAgAS0AQA0AIAItAEANACADLQBARQ0BCwJAIAdQDQAgACkDGCICQn98IQ8gAkIDhkJ4fCEIIAdCA4YgCXxCeHwhAiAHIQQDQCAEIgpCf3whBEIAIQYCQCAPIAp8IAdUDQBCACEGIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQYLIAIgBjcDACAIQnh8IQggAkJ4fCECIARCAFINAAsgASkDGCICQn98IQ8gAkIDhkJ4fCEIIAdCA4YgC3xCeHwhAiAHIQQDQCAEIgpCf3whBEIAIQYCQCAPIAp8IAdUDQBCACEGIAEpAwggCHwpAwBCAVENACABKQMQIAh8KQMAIQYLIAIgBjcDACAIQnh8IQggAkJ4fCECIARCAFINAAsgAykDGCICQn98IQ8gAkIDhkJ4fCEIIAdCA4YgDHxCeHwhAiAHIQQDQCAEIgpCf3whBEIAIQYCQCAPIAp8IAdUDQBCACEGIAMpAwggCHwpAwBCAVENACADKQMQIAh8KQMAIQYLIAIgBjcDACAIQnh8IQggAkJ4fCECIARCAFINAAsLIA0gDDcDQCANIAs3AzggDSAJNwMwCwJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIRACQCAFUA0AIA1CCHxCACAFELyFgIAACxCBgICAACERQgBCACsD0MSEgICAgICAACARIBChoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBVANACANQgh8QgAgBRC8hYCAAAsgDULgAHwkgICAgAAL4Q0HC34BfwZ+AX0KfgR/A30gACkDGCEDIAApAwghBCAAKQMAIQUgACkDECEGAkACQCAAKQMoIgdQDQAgASACWg0BIAApAzghCCAAKQMwIQlCACAGKQMYIgp9IQsgCkJ/hSEMIAApA0giDVAhDgNAIAMpAzAhDyAGKQMwIRAgBCkDMCERIAUpAzAhEiABIRMgCiEAAkADQCAAQgOGIRQCQANAAkAgAEIAUg0AIA5FDQJDAAAAACEVDAQLQgEhFgJAIAAgAykDGCIXfEJ/fCAKVA0AIAMpAwggDCAAfCAXfEIDhnwpAwAhFgsgAEJ/fCEAIBRCeHwhFCAWQgFRDQALIAggFHwpAwAgEyATIAYpAwggFHwpAwAiFoAiFyAWfn0iFn4gD3whDyAGKQMQIBR8KQMAIBZ+IBB8IRAgCSAUfCkDACAWfiARfCERIAcgFHwpAwAgFn4gEnwhEiAXIRMMAQsLIAYpA1AhGCAEKQNQIRkgBSkDUCEaQwAAAAAhFUIAIRsDQCAbIRQgEiEcIBEhHSAQIR4gCiEAA0AgFCEfIABCf3whFyAAQgOGQnh8IRQDQCAUIRYCQCAXIgBCf1INAAJAAkAgGkJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgHEIBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJAwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJAwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJAwCCyAFKQMAIBxCAYZ8LwEAQRB0viEkDAELIAUpAwAgHEIChnwqAgAhJAsCQAJAIBlCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIB1CAYZ8LgEAIiBB/wdxISEgIEGAgICAeHEhIgJAICBB//8DcSIjQQp2QR9xIiBFDQACQCAgQR9HDQAgIiAjQQ10ckGAgID8B3K+ISUMBAsgIEEXdEGAgIDAA2ogInIgIUENdHK+ISUMAwsCQCAhRQ0AQYCAgJgEICFnIiBBF3RrICJyICMgIEFqanRBDnRBgID/A3FyISILICK+ISUMAgsgBCkDACAdQgGGfC8BAEEQdL4hJQwBCyAEKQMAIB1CAoZ8KgIAISULAkACQCAYQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBikDACAeQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEmDAQLICBBF3RBgICAwANqICJyICFBDXRyviEmDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEmDAILIAYpAwAgHkIBhnwvAQBBEHS+ISYMAQsgBikDACAeQgKGfCoCACEmCyAkuyAlQwAAgL+SuxCOgICAACAlICaUu6IgFbugtiEVIBtCAXwiGyANUQ0EDAMLAkAgACADKQMYIhN8IApUDQAgFkJ4fCEUIABCf3whFyADKQMIIAsgAHwgE3xCA4Z8KQMAQgFSDQELCyAGKQMQIBZ8KQMAIB8gHyAGKQMIIBZ8KQMAIheAIhQgF359Ihd+IB58IR4gCSAWfCkDACAXfiAdfCEdIAcgFnwpAwAgF34gHHwhHAwACwsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAPQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviElDAQLICBBF3RBgICAwANqICJyICFBDXRyviElDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviElDAILIAMpAwAgD0IBhnwvAQBBEHS+ISUMAQsgAykDACAPQgKGfCoCACElCyADIA8gFSAlkhCUgICAACABQgF8IgEgAlINAAwCCwsgASACWg0AIAIgAX0hEyAFKQMAIAFCAoYiAHwhFiAEKQMAIAB8IRQgBikDACAAfCEXIAMpAwAgAHwhAANAIBcqAgAhJSAAIBYqAgC7IBQqAgAiFUMAAIC/krsQjoCAgAAgFSAllLuiIAAqAgC7oLY4AgAgFkIEfCEWIBRCBHwhFCAXQgR8IRcgAEIEfCEAIBNCf3wiE1BFDQALCwuVBwQKfgF/AX4CfCOAgICAAELgAH0iBCSAgICAACADKQMgIQUgAikDICEGIAQgAikDGCIHQgOGQg98QnCDIgh9IgkiCiSAgICAACAKIAh9IgsiCiSAgICAACAKIAh9IgwkgICAgAAgBCINQjh8QgA3AwAgDULAAHxCADcDACANQsgAfEIANwMAIA1CADcDMCANQQA2AiggDSADNwMgIA0gAjcDGCANIAE3AxAgDSAANwMIIA1CADcDWCANIAYgBYA3A1BBASEOAkAgBSAAKQMgUg0AIAEpAyAgBVIgBiAFUnIhDgsCQAJAIAApA1BCAFINACABKQNQQgBSDQAgAikDUEIAUg0AIA4gAykDUEIAUnINACAALQBADQAgAS0AQA0AIAItAEANACADLQBARQ0BCwJAIAdQDQAgACkDGCICQn98IQ8gAkIDhkJ4fCEIIAdCA4YgCXxCeHwhAiAHIQQDQCAEIgpCf3whBEIAIQYCQCAPIAp8IAdUDQBCACEGIAApAwggCHwpAwBCAVENACAAKQMQIAh8KQMAIQYLIAIgBjcDACAIQnh8IQggAkJ4fCECIARCAFINAAsgASkDGCICQn98IQ8gAkIDhkJ4fCEIIAdCA4YgC3xCeHwhAiAHIQQDQCAEIgpCf3whBEIAIQYCQCAPIAp8IAdUDQBCACEGIAEpAwggCHwpAwBCAVENACABKQMQIAh8KQMAIQYLIAIgBjcDACAIQnh8IQggAkJ4fCECIARCAFINAAsgAykDGCICQn98IQ8gAkIDhkJ4fCEIIAdCA4YgDHxCeHwhAiAHIQQDQCAEIgpCf3whBEIAIQYCQCAPIAp8IAdUDQBCACEGIAMpAwggCHwpAwBCAVENACADKQMQIAh8KQMAIQYLIAIgBjcDACAIQnh8IQggAkJ4fCECIARCAFINAAsLIA0gDDcDQCANIAs3AzggDSAJNwMwCwJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIRACQCAFUA0AIA1CCHxCACAFEL6FgIAACxCBgICAACERQgBCACsD0MSEgICAgICAACARIBChoDkD0MSEgICAgICAAEIAQgApA8jEhICAgICAgABCf3w3A8jEhICAgICAgAAMAQsgBVANACANQgh8QgAgBRC+hYCAAAsgDULgAHwkgICAgAAL9QsIC34BfwZ+AX0KfgR/A30CfCAAKQMYIQMgACkDCCEEIAApAwAhBSAAKQMQIQYCQAJAIAApAygiB1ANACABIAJaDQEgACkDOCEIIAApAzAhCUIAIAYpAxgiCn0hCyAKQn+FIQwgACkDSCINUCEOA0AgAykDMCEPIAYpAzAhECAEKQMwIREgBSkDMCESIAEhEyAKIQACQANAIABCA4YhFAJAA0ACQCAAQgBSDQAgDkUNAkMAAAAAIRUMBAtCASEWAkAgACADKQMYIhd8Qn98IApUDQAgAykDCCAMIAB8IBd8QgOGfCkDACEWCyAAQn98IQAgFEJ4fCEUIBZCAVENAAsgCCAUfCkDACATIBMgBikDCCAUfCkDACIWgCIXIBZ+fSIWfiAPfCEPIAYpAxAgFHwpAwAgFn4gEHwhECAJIBR8KQMAIBZ+IBF8IREgByAUfCkDACAWfiASfCESIBchEwwBCwsgBikDUCEYIAQpA1AhGSAFKQNQIRpDAAAAACEVQgAhGwNAIBshFCASIRwgESEdIBAhHiAKIQADQCAUIR8gAEJ/fCEXIABCA4ZCeHwhFANAIBQhFgJAIBciAEJ/Ug0AAkACQCAaQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBSkDACAcQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEkDAQLICBBF3RBgICAwANqICJyICFBDXRyviEkDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEkDAILIAUpAwAgHEIBhnwvAQBBEHS+ISQMAQsgBSkDACAcQgKGfCoCACEkCwJAAkAgGUJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAQpAwAgHUIBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJQwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJQwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJQwCCyAEKQMAIB1CAYZ8LwEAQRB0viElDAELIAQpAwAgHUIChnwqAgAhJQsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAGKQMAIB5CAYZ8LgEAIiBB/wdxISEgIEGAgICAeHEhIgJAICBB//8DcSIjQQp2QR9xIiBFDQACQCAgQR9HDQAgIiAjQQ10ckGAgID8B3K+ISYMBAsgIEEXdEGAgIDAA2ogInIgIUENdHK+ISYMAwsCQCAhRQ0AQYCAgJgEICFnIiBBF3RrICJyICMgIEFqanRBDnRBgID/A3FyISILICK+ISYMAgsgBikDACAeQgGGfC8BAEEQdL4hJgwBCyAGKQMAIB5CAoZ8KgIAISYLICS7IicgJbsQjoCAgAAhKCAnEICAgIAAICggJruioiAVu6C2IRUgG0IBfCIbIA1SDQMMBAsCQCAAIAMpAxgiE3wgClQNACAWQnh8IRQgAEJ/fCEXIAMpAwggCyAAfCATfEIDhnwpAwBCAVINAQsLIAYpAxAgFnwpAwAgHyAfIAYpAwggFnwpAwAiF4AiFCAXfn0iF34gHnwhHiAJIBZ8KQMAIBd+IB18IR0gByAWfCkDACAXfiAcfCEcDAALCwsgAyAPIBUQlICAgAAgAUIBfCIBIAJSDQAMAgsLIAEgAloNACACIAF9IRMgBSkDACABQgKGIhd8IQAgBCkDACAXfCEWIAYpAwAgF3whFCADKQMAIBd8IRcDQCAUKgIAIRUgACoCALsiJyAWKgIAuxCOgICAACEoIBcgJxCAgICAACAoIBW7oqK2OAIAIABCBHwhACAWQgR8IRYgFEIEfCEUIBdCBHwhFyATQn98IhNQRQ0ACwsLlQcECn4BfwF+AnwjgICAgABC4AB9IgQkgICAgAAgAykDICEFIAIpAyAhBiAEIAIpAxgiB0IDhkIPfEJwgyIIfSIJIgokgICAgAAgCiAIfSILIgokgICAgAAgCiAIfSIMJICAgIAAIAQiDUI4fEIANwMAIA1CwAB8QgA3AwAgDULIAHxCADcDACANQgA3AzAgDUEANgIoIA0gAzcDICANIAI3AxggDSABNwMQIA0gADcDCCANQgA3A1ggDSAGIAWANwNQQQEhDgJAIAUgACkDIFINACABKQMgIAVSIAYgBVJyIQ4LAkACQCAAKQNQQgBSDQAgASkDUEIAUg0AIAIpA1BCAFINACAOIAMpA1BCAFJyDQAgAC0AQA0AIAEtAEANACACLQBADQAgAy0AQEUNAQsCQCAHUA0AIAApAxgiAkJ/fCEPIAJCA4ZCeHwhCCAHQgOGIAl8Qnh8IQIgByEEA0AgBCIKQn98IQRCACEGAkAgDyAKfCAHVA0AQgAhBiAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACEGCyACIAY3AwAgCEJ4fCEIIAJCeHwhAiAEQgBSDQALIAEpAxgiAkJ/fCEPIAJCA4ZCeHwhCCAHQgOGIAt8Qnh8IQIgByEEA0AgBCIKQn98IQRCACEGAkAgDyAKfCAHVA0AQgAhBiABKQMIIAh8KQMAQgFRDQAgASkDECAIfCkDACEGCyACIAY3AwAgCEJ4fCEIIAJCeHwhAiAEQgBSDQALIAMpAxgiAkJ/fCEPIAJCA4ZCeHwhCCAHQgOGIAx8Qnh8IQIgByEEA0AgBCIKQn98IQRCACEGAkAgDyAKfCAHVA0AQgAhBiADKQMIIAh8KQMAQgFRDQAgAykDECAIfCkDACEGCyACIAY3AwAgCEJ4fCEIIAJCeHwhAiAEQgBSDQALCyANIAw3A0AgDSALNwM4IA0gCTcDMAsCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEQAkAgBVANACANQgh8QgAgBRDAhYCAAAsQgYCAgAAhEUIAQgArA9DEhICAgICAgAAgESAQoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAVQDQAgDUIIfEIAIAUQwIWAgAALIA1C4AB8JICAgIAAC+0NCAt+AX8GfgF9Cn4EfwN9AnwgACkDGCEDIAApAwghBCAAKQMAIQUgACkDECEGAkACQCAAKQMoIgdQDQAgASACWg0BIAApAzghCCAAKQMwIQlCACAGKQMYIgp9IQsgCkJ/hSEMIAApA0giDVAhDgNAIAMpAzAhDyAGKQMwIRAgBCkDMCERIAUpAzAhEiABIRMgCiEAAkADQCAAQgOGIRQCQANAAkAgAEIAUg0AIA5FDQJDAAAAACEVDAQLQgEhFgJAIAAgAykDGCIXfEJ/fCAKVA0AIAMpAwggDCAAfCAXfEIDhnwpAwAhFgsgAEJ/fCEAIBRCeHwhFCAWQgFRDQALIAggFHwpAwAgEyATIAYpAwggFHwpAwAiFoAiFyAWfn0iFn4gD3whDyAGKQMQIBR8KQMAIBZ+IBB8IRAgCSAUfCkDACAWfiARfCERIAcgFHwpAwAgFn4gEnwhEiAXIRMMAQsLIAYpA1AhGCAEKQNQIRkgBSkDUCEaQwAAAAAhFUIAIRsDQCAbIRQgEiEcIBEhHSAQIR4gCiEAA0AgFCEfIABCf3whFyAAQgOGQnh8IRQDQCAUIRYCQCAXIgBCf1INAAJAAkAgGkJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgHEIBhnwuAQAiIEH/B3EhISAgQYCAgIB4cSEiAkAgIEH//wNxIiNBCnZBH3EiIEUNAAJAICBBH0cNACAiICNBDXRyQYCAgPwHcr4hJAwECyAgQRd0QYCAgMADaiAiciAhQQ10cr4hJAwDCwJAICFFDQBBgICAmAQgIWciIEEXdGsgInIgIyAgQWpqdEEOdEGAgP8DcXIhIgsgIr4hJAwCCyAFKQMAIBxCAYZ8LwEAQRB0viEkDAELIAUpAwAgHEIChnwqAgAhJAsCQAJAIBlCf3wiAEIBVg0AAkACQCAApw4CAAEACyAEKQMAIB1CAYZ8LgEAIiBB/wdxISEgIEGAgICAeHEhIgJAICBB//8DcSIjQQp2QR9xIiBFDQACQCAgQR9HDQAgIiAjQQ10ckGAgID8B3K+ISUMBAsgIEEXdEGAgIDAA2ogInIgIUENdHK+ISUMAwsCQCAhRQ0AQYCAgJgEICFnIiBBF3RrICJyICMgIEFqanRBDnRBgID/A3FyISILICK+ISUMAgsgBCkDACAdQgGGfC8BAEEQdL4hJQwBCyAEKQMAIB1CAoZ8KgIAISULAkACQCAYQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgBikDACAeQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEmDAQLICBBF3RBgICAwANqICJyICFBDXRyviEmDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEmDAILIAYpAwAgHkIBhnwvAQBBEHS+ISYMAQsgBikDACAeQgKGfCoCACEmCyAkuyInICW7EI6AgIAAISggJxCAgICAACAoICa7oqIgFbugtiEVIBtCAXwiGyANUQ0EDAMLAkAgACADKQMYIhN8IApUDQAgFkJ4fCEUIABCf3whFyADKQMIIAsgAHwgE3xCA4Z8KQMAQgFSDQELCyAGKQMQIBZ8KQMAIB8gHyAGKQMIIBZ8KQMAIheAIhQgF359Ihd+IB58IR4gCSAWfCkDACAXfiAdfCEdIAcgFnwpAwAgF34gHHwhHAwACwsLAkACQCADKQNQQn98IgBCAVYNAAJAAkAgAKcOAgABAAsgAykDACAPQgGGfC4BACIgQf8HcSEhICBBgICAgHhxISICQCAgQf//A3EiI0EKdkEfcSIgRQ0AAkAgIEEfRw0AICIgI0ENdHJBgICA/AdyviEkDAQLICBBF3RBgICAwANqICJyICFBDXRyviEkDAMLAkAgIUUNAEGAgICYBCAhZyIgQRd0ayAiciAjICBBamp0QQ50QYCA/wNxciEiCyAiviEkDAILIAMpAwAgD0IBhnwvAQBBEHS+ISQMAQsgAykDACAPQgKGfCoCACEkCyADIA8gFSAkkhCUgICAACABQgF8IgEgAlINAAwCCwsgASACWg0AIAIgAX0hEyAFKQMAIAFCAoYiAHwhFiAEKQMAIAB8IRQgBikDACAAfCEXIAMpAwAgAHwhAANAIBcqAgAhFSAWKgIAuyInIBQqAgC7EI6AgIAAISggACAnEICAgIAAICggFbuioiAAKgIAu6C2OAIAIBZCBHwhFiAUQgR8IRQgF0IEfCEXIABCBHwhACATQn98IhNQRQ0ACwsLlQcECn4BfwF+AnwjgICAgABC4AB9IgQkgICAgAAgAykDICEFIAIpAyAhBiAEIAIpAxgiB0IDhkIPfEJwgyIIfSIJIgokgICAgAAgCiAIfSILIgokgICAgAAgCiAIfSIMJICAgIAAIAQiDUI4fEIANwMAIA1CwAB8QgA3AwAgDULIAHxCADcDACANQgA3AzAgDUEANgIoIA0gAzcDICANIAI3AxggDSABNwMQIA0gADcDCCANQgA3A1ggDSAGIAWANwNQQQEhDgJAIAUgACkDIFINACABKQMgIAVSIAYgBVJyIQ4LAkACQCAAKQNQQgBSDQAgASkDUEIAUg0AIAIpA1BCAFINACAOIAMpA1BCAFJyDQAgAC0AQA0AIAEtAEANACACLQBADQAgAy0AQEUNAQsCQCAHUA0AIAApAxgiAkJ/fCEPIAJCA4ZCeHwhCCAHQgOGIAl8Qnh8IQIgByEEA0AgBCIKQn98IQRCACEGAkAgDyAKfCAHVA0AQgAhBiAAKQMIIAh8KQMAQgFRDQAgACkDECAIfCkDACEGCyACIAY3AwAgCEJ4fCEIIAJCeHwhAiAEQgBSDQALIAEpAxgiAkJ/fCEPIAJCA4ZCeHwhCCAHQgOGIAt8Qnh8IQIgByEEA0AgBCIKQn98IQRCACEGAkAgDyAKfCAHVA0AQgAhBiABKQMIIAh8KQMAQgFRDQAgASkDECAIfCkDACEGCyACIAY3AwAgCEJ4fCEIIAJCeHwhAiAEQgBSDQALIAMpAxgiAkJ/fCEPIAJCA4ZCeHwhCCAHQgOGIAx8Qnh8IQIgByEEA0AgBCIKQn98IQRCACEGAkAgDyAKfCAHVA0AQgAhBiADKQMIIAh8KQMAQgFRDQAgAykDECAIfCkDACEGCyACIAY3AwAgCEJ4fCEIIAJCeHwhAiAEQgBSDQALCyANIAw3A0AgDSALNwM4IA0gCTcDMAsCQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEQAkAgBVANACANQgh8QgAgBRDChYCAAAsQgYCAgAAhEUIAQgArA9DEhICAgICAgAAgESAQoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAVQDQAgDUIIfEIAIAUQwoWAgAALIA1C4AB8JICAgIAAC/8GBgR+AX0FfgZ/AX0IfgJAIAEgAloNACAAQhh8IQMgACkDECEEIAApAwAiBSkDICEGA0BDAAAAACEHAkAgBCABfiIIIAggBHwiACAGIAAgBlQbIglaDQAgBSkDUCEKIAUpAzAhCwJAIAUpAxgiDEIAUg0AAkAgCkJ/fCIAQgFWDQACQAJAIACnDgIAAQALIAUpAwAgC0IBhnwuAQAiDUGAgICAeHEiDiANQf//A3EiD0ENdHJBgICA/AdyIRAgD0EKdkEfcSIRQRd0IA5yIA1B/wdxIg1BDXRyQYCAgMADaiESAkAgDUUNACAOIA1nIg1BF3RrIA8gDUFqanRBDnRBgID/A3FyQYCAgJgEaiEOQwAAAAAhBwNAIA4hDQJAIBFFDQAgECENIBFBH0YNACASIQ0LIAcgDb6SIQcgCEIBfCIIIAlUDQAMBQsLQwAAAAAhBwNAIA4hDQJAIBFFDQAgECENIBFBH0YNACASIQ0LIAcgDb6SIQcgCEIBfCIIIAlUDQAMBAsLIAUpAwAgC0IBhnwvAQBBEHS+IRNDAAAAACEHA0AgByATkiEHIAhCAXwiCCAJVA0ADAMLCyAFKQMAIAtCAoZ8KgIAIRNDAAAAACEHA0AgByATkiEHIAhCAXwiCCAJVA0ADAILCyAFKQMIIAxCA4YiAHxCeHwhFCAFKQMQIAB8Qnh8IRVDAAAAACEHA0AgFCEAIBUhFiAMIRcgCyEYIAghGQNAIBYpAwAgGSAZIAApAwAiGoAiGyAafn1+IBh8IRggAEJ4fCEAIBZCeHwhFiAbIRkgF0J/fCIXUEUNAAsCQAJAAkAgCkJ/fCIAQgFWDQACQCAApw4CAAIACyAFKQMAIBhCAYZ8LgEAIg1B/wdxIRAgDUGAgICAeHEhEQJAIA1B//8DcSIOQQp2QR9xIg1FDQACQCANQR9HDQAgESAOQQ10ckGAgID8B3K+IRMMBAsgDUEXdEGAgIDAA2ogEXIgEEENdHK+IRMMAwsCQCAQRQ0AQYCAgJgEIBBnIg1BF3RrIBFyIA4gDUFqanRBDnRBgID/A3FyIRELIBG+IRMMAgsgBSkDACAYQgKGfCoCACETDAELIAUpAwAgGEIBhnwvAQBBEHS+IRMLIAcgE5IhByAIQgF8IgggCVQNAAsLIAMgAUIChnwgBzgCACABQgF8IgEgAlINAAsLC6AEBgR+AX0HfgF9Bn4EfwJAIAEgAloNACAAQhh8IQMgACkDECEEIAApAwAiBSkDICEGA0BDAAAAACEHAkAgBCABfiIIIAggBHwiACAGIAAgBlQbIglaDQAgBSkDUCEKIAUpAxghCyAFKQMwIQxDAAAAACEHIAghDQNAIA0gCH0iDrUhDyAMIRACQCALUA0AIAUpAwggC0IDhiIRfEJ4fCEAIAUpAxAgEXxCeHwhESALIRIgDCEQIA0hEwNAIBEpAwAgEyATIAApAwAiFIAiFSAUfn1+IBB8IRAgAEJ4fCEAIBFCeHwhESAVIRMgEkJ/fCISUEUNAAsLIAcgD5QhBwJAAkACQCAKQn98IgBCAVYNAAJAIACnDgIAAgALIAUpAwAgEEIBhnwuAQAiFkH/B3EhFyAWQYCAgIB4cSEYAkAgFkH//wNxIhlBCnZBH3EiFkUNAAJAIBZBH0cNACAYIBlBDXRyQYCAgPwHcr4hDwwECyAWQRd0QYCAgMADaiAYciAXQQ10cr4hDwwDCwJAIBdFDQBBgICAmAQgF2ciFkEXdGsgGHIgGSAWQWpqdEEOdEGAgP8DcXIhGAsgGL4hDwwCCyAFKQMAIBBCAoZ8KgIAIQ8MAQsgBSkDACAQQgGGfC8BAEEQdL4hDwsgByAPkiAOQgF8tZUhByANQgF8Ig0gCVQNAAsLIAMgAUIChnwgBzgCACABQgF8IgEgAlINAAsLC+IDBQJ+AX8CfAF9An4jgICAgABCoAJ9IgEkgICAgAAgAUIgfEEAQoAC/AsAIAEgADcDCCABQgFCwAAgACkDICICQoCAAlQiAxsiADcDECABIAIgAHxCf3xCAEIGIAMbiDcDGAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQQgAUIIfEIAIAAQxIWAgAAQgYCAgAAhBUIAQgArA9DEhICAgICAgAAgBSAEoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAFCCHxCACAAEMSFgIAACwJAAkAgASkDECIAUEUNAEMAAAAAIQYMAQsgAEIDgyECAkACQCAAQn98QgNaDQBDAAAAACEGQgAhBwwBCyAAQnyDIQggAUIsfCEAQwAAAAAhBkIAIQcDQCAGIABCdHwqAgCSIABCeHwqAgCSIABCfHwqAgCSIAAqAgCSIQYgAEIQfCEAIAggB0IEfCIHUg0ACwsgAlANACAHQgKGIAFCCHx8Qhh8IQADQCAGIAAqAgCSIQYgAEIEfCEAIAJCf3wiAkIAUg0ACwsgAUKgAnwkgICAgAAgBguhAwkCfgF/AX4CfAF+AX0BfgF9AX4jgICAgABCoAJ9IgEkgICAgAAgAUIgfEEAQoAC/AsAIAEgADcDCCABQgFCwAAgACkDICICQoCAAlQiAxsiBDcDECABIAIgBHxCf3xCAEIGIAMbiDcDGAJAAkBCAC0AwMSEgICAgICAAEUNAEIAKQPIxISAgICAgIAAQgBSDQBCAEIBNwPIxISAgICAgIAAEIGAgIAAIQUgAUIIfEIAIAQQxYWAgAAQgYCAgAAhBkIAQgArA9DEhICAgICAgAAgBiAFoaA5A9DEhICAgICAgABCAEIAKQPIxISAgICAgIAAQn98NwPIxISAgICAgIAADAELIAFCCHxCACAEEMWFgIAACwJAAkAgASkDECIHUEUNAEMAAAAAIQgMAQsgAUIgfCEEIAApAyAiCbUhCkMAAAAAIQhCACECIAEpAxgiCyEAA0AgCCAEKgIAIAkgACAJIABUGyACfLUgCpWUkiEIIARCBHwhBCACIAt9IQIgACALfCEAIAdCf3wiB1BFDQALCyABQqACfCSAgICAACAIC0cDAX0CfgF9QwAAgAAhAQJAIAApAyAiAlANAEIAIQMDQCAAIAMQkoCAgAAiBCABIAQgAV4bIQEgAiADQgF8IgNSDQALCyABC0cDAX0CfgF9Q///f38hAQJAIAApAyAiAlANAEIAIQMDQCAAIAMQkoCAgAAiBCABIAQgAV0bIQEgAiADQgF8IgNSDQALCyABCwoAIAAQxoWAgAALCgAgABDHhYCAAAtkBQJ+AX0BfgF9AX8CQAJAIAApAyAiAVBFDQBCACECDAELQwAAgAAhA0IAIQRCACECA0AgACAEEJKAgIAAIgUgAyAFIANeIgYbIQMgBCACIAYbIQIgASAEQgF8IgRSDQALCyACC2QFAn4BfQF+AX0BfwJAAkAgACkDICIBUEUNAEIAIQIMAQtD//9/fyEDQgAhBEIAIQIDQCAAIAQQkoCAgAAiBSADIAUgA10iBhshAyAEIAIgBhshAiABIARCAXwiBFINAAsLIAILFwAgASABKQMwIAAQxoWAgAAQlICAgAALFwAgASABKQMwIAAQx4WAgAAQlICAgAALwwgFAX4BfQh+BH8BfiOAgICAAEIQfSIEJICAgIAAIAQgAzYCDCACQwAAAE+U/AAhA0QAAAAAAADwP0QAAAAAAADwPyACu6GjtiEFAkACQAJAIAApA1BCAFINACABKQNQUA0BCyAAKQMgUA0BQgAhBgNAIAApAzAhBwJAIAApAxgiCFANACAAKQMIIAhCA4YiCXxCeHwhCiAAKQMQIAl8Qnh8IQkgBiELA0AgCSkDACALIAsgCikDACIMgCINIAx+fX4gB3whByAKQnh8IQogCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAAKQNQQn98IgpCAVYNAAJAAkAgCqcOAgABAAsgACkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviECDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviECDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviECDAILIAApAwAgB0IBhnwvAQBBEHS+IQIMAQsgACkDACAHQgKGfCoCACECCyABKQMwIQcCQCABKQMYIghQDQAgASkDCCAIQgOGIgl8Qnh8IQogASkDECAJfEJ4fCEJIAYhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn1+IAd8IQcgCkJ4fCEKIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCyABIAdDAAAAACACIAWUIARCDHwQ8YWAgAAgA0gbEJSAgIAAIAZCAXwiBiAAKQMgVA0ADAILCwJAIAAtAEANACABLQBADQAgACkDIFANAUIAIQpCACEJA0AgACkDACAKfCoCACECIARCDHwQ8YWAgAAhDiABKQMAIAp8QwAAAAAgAiAFlCAOIANIGzgCACAKQgR8IQogCUIBfCIJIAApAyBUDQAMAgsLIAApAyBQDQBCACEGA0AgACkDMCEHIAApAwAhEgJAIAApAxgiCFANACAAKQMIIAhCA4YiCXxCeHwhCiAAKQMQIAl8Qnh8IQkgBiELA0AgCSkDACALIAsgCikDACIMgCINIAx+fX4gB3whByAKQnh8IQogCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLQwAAAAAgEiAHQgKGfCoCACAFlCAEQgx8EPGFgIAAIANIGyECIAEpAzAhByABKQMAIRICQCABKQMYIghQDQAgASkDCCAIQgOGIgl8Qnh8IQogASkDECAJfEJ4fCEJIAYhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn1+IAd8IQcgCkJ4fCEKIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCyASIAdCAoZ8IAI4AgAgBkIBfCIGIAApAyBUDQALCyAEQhB8JICAgIAAC8YKBgF+AX0IfgR/AX0BfiOAgICAAEIQfSIEJICAgIAAIAQgAzYCDCACQwAAAE+U/AAhA0QAAAAAAADwP0QAAAAAAADwPyACu6GjtiEFAkACQAJAIAApA1BCAFINACABKQNQUA0BCyAAKQMgUA0BQgAhBgNAIAApAzAhBwJAIAApAxgiCFANACAAKQMIIAhCA4YiCXxCeHwhCiAAKQMQIAl8Qnh8IQkgBiELA0AgCSkDACALIAsgCikDACIMgCINIAx+fX4gB3whByAKQnh8IQogCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLAkACQCAAKQNQQn98IgpCAVYNAAJAAkAgCqcOAgABAAsgACkDACAHQgGGfC4BACIOQf8HcSEPIA5BgICAgHhxIRACQCAOQf//A3EiEUEKdkEfcSIORQ0AAkAgDkEfRw0AIBAgEUENdHJBgICA/AdyviECDAQLIA5BF3RBgICAwANqIBByIA9BDXRyviECDAMLAkAgD0UNAEGAgICYBCAPZyIOQRd0ayAQciARIA5Bamp0QQ50QYCA/wNxciEQCyAQviECDAILIAApAwAgB0IBhnwvAQBBEHS+IQIMAQsgACkDACAHQgKGfCoCACECCyABKQMwIQcCQCABKQMYIghQDQAgASkDCCAIQgOGIgl8Qnh8IQogASkDECAJfEJ4fCEJIAYhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn1+IAd8IQcgCkJ4fCEKIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCwJAAkAgASkDUEJ/fCIKQgFWDQACQAJAIAqnDgIAAQALIAEpAwAgB0IBhnwuAQAiDkH/B3EhDyAOQYCAgIB4cSEQAkAgDkH//wNxIhFBCnZBH3EiDkUNAAJAIA5BH0cNACAQIBFBDXRyQYCAgPwHcr4hEgwECyAOQRd0QYCAgMADaiAQciAPQQ10cr4hEgwDCwJAIA9FDQBBgICAmAQgD2ciDkEXdGsgEHIgESAOQWpqdEEOdEGAgP8DcXIhEAsgEL4hEgwCCyABKQMAIAdCAYZ8LwEAQRB0viESDAELIAEpAwAgB0IChnwqAgAhEgsgASAHIBJDAAAAACACIAWUIARCDHwQ8YWAgAAgA0gbkhCUgICAACAGQgF8IgYgACkDIFQNAAwCCwsCQCAALQBADQAgAS0AQA0AIAApAyBQDQFCACEKQgAhCQNAIAApAwAgCnwqAgAhAiAEQgx8EPGFgIAAIQ4gASkDACAKfCILIAsqAgBDAAAAACACIAWUIA4gA0gbkjgCACAKQgR8IQogCUIBfCIJIAApAyBUDQAMAgsLIAApAyBQDQBCACEGA0AgACkDMCEHIAApAwAhEwJAIAApAxgiCFANACAAKQMIIAhCA4YiCXxCeHwhCiAAKQMQIAl8Qnh8IQkgBiELA0AgCSkDACALIAsgCikDACIMgCINIAx+fX4gB3whByAKQnh8IQogCUJ4fCEJIA0hCyAIQn98IghCAFINAAsLQwAAAAAgEyAHQgKGfCoCACAFlCAEQgx8EPGFgIAAIANIGyECIAEpAzAhByABKQMAIRMCQCABKQMYIghQDQAgASkDCCAIQgOGIgl8Qnh8IQogASkDECAJfEJ4fCEJIAYhCwNAIAkpAwAgCyALIAopAwAiDIAiDSAMfn1+IAd8IQcgCkJ4fCEKIAlCeHwhCSANIQsgCEJ/fCIIQgBSDQALCyATIAdCAoZ8IgogAiAKKgIAkjgCACAGQgF8IgYgACkDIFQNAAsLIARCEHwkgICAgAAL8x4JBn4Bfwh+BH0FfgN/AX0BfgZ9IAApAwAiAykDICEEQgAhBQJAIAMpAwgiBkICVA0AQgAhBSAGIQcDQCAHIAV8QgGIIgggByAEIAhCA4Z8KQMAIAFWIgkbIgcgBSAIIAkbIgV9QgFWDQALCwJAIAUgBloNAEIAIAF9IQogAEIQfCELIAQgBkIDhnwpAwBCAoYhDANAIAQgBUIDhiIIfCkDACIHIAJaDQFCACENQgAhDgJAIAMpAygiBlANACAGKQMAIgYgDHwgB0IChiIPfCEOIAYgD3whDQsgBUIBfCEFAkAgAykDACIGQgJWDQBCACABIAd9Ig8gDyABVhshECACIAQgBUIDhnwpAwAiDyAPIAJWGyIPIAd9IRECQAJAAkAgBqcOAwABAgALIAsqAgAhEiAAKQMAIgZCyAB8KgIAIRMgBkI8fCoCACEUIAZCOHwqAgAhFSADKQMYIAh8KQMAIRYCQAJAIAMpAxAgCHwpAwAiFykDUEIAUg0AIBYpA1BCAFINACAXLQBADQAgFi0AQEUNAQsgECARWg0DA0AgFykDMCEPAkAgFykDGCIYUA0AIBcpAwggGEIDhiIIfEJ4fCEHIBcpAxAgCHxCeHwhCCAQIQYDQCAIKQMAIAYgBiAHKQMAIhmAIhogGX59fiAPfCEPIAdCeHwhByAIQnh8IQggGiEGIBhCf3wiGEIAUg0ACwsCQAJAIBcpA1BCf3wiB0IBVg0AAkACQCAHpw4CAAEACyAXKQMAIA9CAYZ8LgEAIglB/wdxIRsgCUGAgICAeHEhHAJAIAlB//8DcSIdQQp2QR9xIglFDQACQCAJQR9HDQAgHCAdQQ10ckGAgID8B3K+IR4MBAsgCUEXdEGAgIDAA2ogHHIgG0ENdHK+IR4MAwsCQCAbRQ0AQYCAgJgEIBtnIglBF3RrIBxyIB0gCUFqanRBDnRBgID/A3FyIRwLIBy+IR4MAgsgFykDACAPQgGGfC8BAEEQdL4hHgwBCyAXKQMAIA9CAoZ8KgIAIR4LIBYpAzAhGAJAIBYpAxgiGVANACAWKQMIIBlCA4YiCHxCeHwhByAWKQMQIAh8Qnh8IQggECEGA0AgCCkDACAGIAYgBykDACIagCIfIBp+fX4gGHwhGCAHQnh8IQcgCEJ4fCEIIB8hBiAZQn98IhlCAFINAAsLAkACQCAWKQNQQn98IgdCAVYNAAJAAkAgB6cOAgABAAsgFikDACAYQgGGfC4BACIJQf8HcSEbIAlBgICAgHhxIRwCQCAJQf//A3EiHUEKdkEfcSIJRQ0AAkAgCUEfRw0AIBwgHUENdHJBgICA/AdyviEgDAQLIAlBF3RBgICAwANqIBxyIBtBDXRyviEgDAMLAkAgG0UNAEGAgICYBCAbZyIJQRd0ayAcciAdIAlBamp0QQ50QYCA/wNxciEcCyAcviEgDAILIBYpAwAgGEIBhnwvAQBBEHS+ISAMAQsgFikDACAYQgKGfCoCACEgCyATIB6UIBIgIJSSISACQCANUA0AIA0gEEIChnwiByAgIBQgByoCAJSSIiA4AgALIBcgDyAeIBUgIJSTEJSAgIAAIBBCAXwiECARUg0ADAQLCyAQIBFaDQIgFikDACEGIBcpAwAhCAJAIA1QDQAgCCABQgKGIhl8IAcgASAHIAFUGyIfQgKGIhp9IQggBiAZfCAafSEYIA0gGXwgGn0hBiAKIA98IB98IAd9IQcDQCAGIBMgCCoCACIglCASIBgqAgCUkiAUIAYqAgCUkiIeOAIAIAggICAVIB6UkzgCACAIQgR8IQggGEIEfCEYIAZCBHwhBiAHQn98IgdQRQ0ADAQLCyAIIAFCAoYiGHwgByABIAcgAVQbIhlCAoYiGn0hCCAGIBh8IBp9IQYgCiAPfCAZfCAHfSEHA0AgCCAIKgIAIiAgFSATICCUIBIgBioCAJSSlJM4AgAgCEIEfCEIIAZCBHwhBiAHQn98IgdQRQ0ADAMLCyALKgIAIRUgAykDGCAIfCkDACEWIAAqAgwhFCAAKgIIISEgACkDACIGKgJIISIgBioCRCEjIAYqAkAhEiAGKgI8IRMCQAJAIAMpAxAgCHwpAwAiFykDUEIAUg0AIBYpA1BCAFINACAXLQBADQAgFi0AQEUNAQsgECARWg0CQwAAgD8gEpMhJEMAAIA/IBOTISUDQCAXKQMwIQ8CQCAXKQMYIhhQDQAgFykDCCAYQgOGIgh8Qnh8IQcgFykDECAIfEJ4fCEIIBAhBgNAIAgpAwAgBiAGIAcpAwAiGYAiGiAZfn1+IA98IQ8gB0J4fCEHIAhCeHwhCCAaIQYgGEJ/fCIYQgBSDQALCwJAAkAgFykDUEJ/fCIHQgFWDQACQAJAIAenDgIAAQALIBcpAwAgD0IBhnwuAQAiCUH/B3EhGyAJQYCAgIB4cSEcAkAgCUH//wNxIh1BCnZBH3EiCUUNAAJAIAlBH0cNACAcIB1BDXRyQYCAgPwHcr4hHgwECyAJQRd0QYCAgMADaiAcciAbQQ10cr4hHgwDCwJAIBtFDQBBgICAmAQgG2ciCUEXdGsgHHIgHSAJQWpqdEEOdEGAgP8DcXIhHAsgHL4hHgwCCyAXKQMAIA9CAYZ8LwEAQRB0viEeDAELIBcpAwAgD0IChnwqAgAhHgsgFikDMCEYAkAgFikDGCIZUA0AIBYpAwggGUIDhiIIfEJ4fCEHIBYpAxAgCHxCeHwhCCAQIQYDQCAIKQMAIAYgBiAHKQMAIhqAIh8gGn59fiAYfCEYIAdCeHwhByAIQnh8IQggHyEGIBlCf3wiGUIAUg0ACwsCQAJAIBYpA1BCf3wiB0IBVg0AAkACQCAHpw4CAAEACyAWKQMAIBhCAYZ8LgEAIglB/wdxIRsgCUGAgICAeHEhHAJAIAlB//8DcSIdQQp2QR9xIglFDQACQCAJQR9HDQAgHCAdQQ10ckGAgID8B3K+ISAMBAsgCUEXdEGAgIDAA2ogHHIgG0ENdHK+ISAMAwsCQCAbRQ0AQYCAgJgEIBtnIglBF3RrIBxyIB0gCUFqanRBDnRBgID/A3FyIRwLIBy+ISAMAgsgFikDACAYQgGGfC8BAEEQdL4hIAwBCyAWKQMAIBhCAoZ8KgIAISALIA0gEEIChiIIfCIHIBMgByoCAJQgJSAiIB6UIBUgIJSSIiCUkjgCACAOIAh8IgggEiAIKgIAlCAgICQgIJSUkiIgOAIAIBcgDyAeICEgByoCAJQgIyAgkSAUlZKVkxCUgICAACAQQgF8IhAgEVINAAwDCwsgECARWg0BIBcpAwAgAUIChiIYfCAHIAEgByABVBsiH0IChiIafSEGIBYpAwAgGHwgGn0hGSANIBh8IBp9IQggDiAYfCAafSEYIAogD3wgH3wgB30hB0MAAIA/IBKTISRDAACAPyATkyElA0AgCCATIAgqAgCUICUgIiAGKgIAIh6UIBUgGSoCAJSSIiCUkjgCACAYIBIgGCoCAJQgICAkICCUlJIiIDgCACAGIB4gISAIKgIAlCAjICCRIBSVkpWTOAIAIAZCBHwhBiAZQgR8IRkgCEIEfCEIIBhCBHwhGCAHQn98IgdQRQ0ADAILCyALKgIAIRUgAykDGCAIfCkDACEWIAAqAgwhFCAAKgIIISEgACkDACIGKgJIISAgBioCRCEiIAYqAkAhEiAGKgI8IRMgBioCOCEeAkACQCADKQMQIAh8KQMAIhcpA1BCAFINACAWKQNQQgBSDQAgFy0AQA0AIBYtAEBFDQELIBAgEVoNAUMAAIA/IBKTISNDAACAPyATkyEkIB4gIJQhJQNAIBcpAzAhDwJAIBcpAxgiGFANACAXKQMIIBhCA4YiCHxCeHwhByAXKQMQIAh8Qnh8IQggECEGA0AgCCkDACAGIAYgBykDACIZgCIaIBl+fX4gD3whDyAHQnh8IQcgCEJ4fCEIIBohBiAYQn98IhhCAFINAAsLAkACQCAXKQNQQn98IgdCAVYNAAJAAkAgB6cOAgABAAsgFykDACAPQgGGfC4BACIJQf8HcSEbIAlBgICAgHhxIRwCQCAJQf//A3EiHUEKdkEfcSIJRQ0AAkAgCUEfRw0AIBwgHUENdHJBgICA/AdyviEeDAQLIAlBF3RBgICAwANqIBxyIBtBDXRyviEeDAMLAkAgG0UNAEGAgICYBCAbZyIJQRd0ayAcciAdIAlBamp0QQ50QYCA/wNxciEcCyAcviEeDAILIBcpAwAgD0IBhnwvAQBBEHS+IR4MAQsgFykDACAPQgKGfCoCACEeCyAWKQMwIRgCQCAWKQMYIhlQDQAgFikDCCAZQgOGIgh8Qnh8IQcgFikDECAIfEJ4fCEIIBAhBgNAIAgpAwAgBiAGIAcpAwAiGoAiHyAafn1+IBh8IRggB0J4fCEHIAhCeHwhCCAfIQYgGUJ/fCIZQgBSDQALCwJAAkAgFikDUEJ/fCIHQgFWDQACQAJAIAenDgIAAQALIBYpAwAgGEIBhnwuAQAiCUH/B3EhGyAJQYCAgIB4cSEcAkAgCUH//wNxIh1BCnZBH3EiCUUNAAJAIAlBH0cNACAcIB1BDXRyQYCAgPwHcr4hIAwECyAJQRd0QYCAgMADaiAcciAbQQ10cr4hIAwDCwJAIBtFDQBBgICAmAQgG2ciCUEXdGsgHHIgHSAJQWpqdEEOdEGAgP8DcXIhHAsgHL4hIAwCCyAWKQMAIBhCAYZ8LwEAQRB0viEgDAELIBYpAwAgGEIChnwqAgAhIAsgDSAQQgKGIgh8IgcgEyAHKgIAlCAkIBUgIJQiIJSSOAIAIA4gCHwiCCAgICMgIJSUIBIgCCoCAJSSIiA4AgAgFyAPIB4gJSAelJMgISAHKgIAlCAiICCRIBSVkpWTEJSAgIAAIBBCAXwiECARUg0ADAILCyAQIBFaDQAgFykDACABQgKGIhh8IAcgASAHIAFUGyIfQgKGIhp9IQYgFikDACAYfCAafSEZIA0gGHwgGn0hCCAOIBh8IBp9IRggCiAPfCAffCAHfSEHQwAAgD8gEpMhI0MAAIA/IBOTISQgHiAglCElA0AgBioCACEgIAggEyAIKgIAlCAkIBUgGSoCAJQiHpSSOAIAIBggHiAjIB6UlCASIBgqAgCUkiIeOAIAIAYgICAlICCUkyAhIAgqAgCUICIgHpEgFJWSlZM4AgAgBkIEfCEGIBlCBHwhGSAIQgR8IQggGEIEfCEYIAdCf3wiB0IAUg0ACwsgBSADKQMIVA0ACwsLuxQMCH4BfwN+AX8BfAh+AXwEfgN/AX0gfCB9AkAgASACWg0AIAApAwAiAykDICIEIAMpAwgiBUIDhnwpAwAhBiAAQhB8IQcgACkDCCIIIAFCAXx+IQkgCCABfiEKIAVCAlQhCwNAIAggAX4hDEIAIQ0CQCALDQBCACENIAUhAANAIAAgDXxCAYgiDiAAIAQgDkIDhnwpAwAgDFYiDxsiACANIA4gDxsiDX1CAVYNAAsLRAAAAAAAAAAAIRACQCANIAVaDQAgDCAIfCIAIAYgACAGVBshEUQAAAAAAAAAACEQA0AgBCANQgOGIgB8KQMAIhIgEVoNAUIAIAwgEn0iDiAOIAxWGyETIBEgBCANQgF8Ig1CA4Z8KQMAIhQgESAUVBsiFSASfSEWAkACQAJAIAMpAxggAHwpAwAiFykDUCIYQgBSDQAgFy0AQEUNAQtEAAAAAAAAAAAhGSATIBZaDQEgFykDGCEaIBcpAzAhG0QAAAAAAAAAACEZA0AgGyEUAkAgGlANACAXKQMIIBpCA4YiDnxCeHwhACAXKQMQIA58Qnh8IQ4gGiEVIBshFCATIRIDQCAOKQMAIBIgEiAAKQMAIhyAIh0gHH59fiAUfCEUIABCeHwhACAOQnh8IQ4gHSESIBVCf3wiFUIAUg0ACwsCQAJAIBhCf3wiAEIBVg0AAkACQCAApw4CAAEACyAXKQMAIBRCAYZ8LgEAIg9B/wdxIR4gD0GAgICAeHEhHwJAIA9B//8DcSIgQQp2QR9xIg9FDQACQCAPQR9HDQAgHyAgQQ10ckGAgID8B3K+ISEMBAsgD0EXdEGAgIDAA2ogH3IgHkENdHK+ISEMAwsCQCAeRQ0AQYCAgJgEIB5nIg9BF3RrIB9yICAgD0FqanRBDnRBgID/A3FyIR8LIB++ISEMAgsgFykDACAUQgGGfC8BAEEQdL4hIQwBCyAXKQMAIBRCAoZ8KgIAISELIBkgISAhlLugIRkgE0IBfCITIBZSDQAMAgsLIBcpAwAhHEQAAAAAAAAAACEZRAAAAAAAAAAAISJEAAAAAAAAAAAhI0QAAAAAAAAAACEkRAAAAAAAAAAAISVEAAAAAAAAAAAhJkQAAAAAAAAAACEnRAAAAAAAAAAAIShEAAAAAAAAAAAhKUQAAAAAAAAAACEqRAAAAAAAAAAAIStEAAAAAAAAAAAhLEQAAAAAAAAAACEtRAAAAAAAAAAAIS5EAAAAAAAAAAAhL0QAAAAAAAAAACEwRAAAAAAAAAAAITFEAAAAAAAAAAAhMkQAAAAAAAAAACEzRAAAAAAAAAAAITREAAAAAAAAAAAhNUQAAAAAAAAAACE2RAAAAAAAAAAAITdEAAAAAAAAAAAhOEQAAAAAAAAAACE5RAAAAAAAAAAAITpEAAAAAAAAAAAhO0QAAAAAAAAAACE8RAAAAAAAAAAAIT1EAAAAAAAAAAAhPkQAAAAAAAAAACE/RAAAAAAAAAAAIUBEAAAAAAAAAAAhQQJAIBNCIHwgFlYNACAcIApCAoZ8IBIgCiASIApUGyIOQgKGfSEAQgAgDn0hDkMAAAAAISFDAAAAACFCQwAAAAAhQ0MAAAAAIURDAAAAACFFQwAAAAAhRkMAAAAAIUdDAAAAACFIQwAAAAAhSUMAAAAAIUpDAAAAACFLQwAAAAAhTEMAAAAAIU1DAAAAACFOQwAAAAAhT0MAAAAAIVBDAAAAACFRQwAAAAAhUkMAAAAAIVNDAAAAACFUQwAAAAAhVUMAAAAAIVZDAAAAACFXQwAAAAAhWEMAAAAAIVlDAAAAACFaQwAAAAAhW0MAAAAAIVxDAAAAACFdQwAAAAAhXkMAAAAAIV9DAAAAACFgA0AgISAAKgIAImEgYZSSISEgYCAAQvwAfCoCACJhIGGUkiFgIF8gAEL4AHwqAgAiYSBhlJIhXyBeIABC9AB8KgIAImEgYZSSIV4gXSAAQvAAfCoCACJhIGGUkiFdIFwgAELsAHwqAgAiYSBhlJIhXCBbIABC6AB8KgIAImEgYZSSIVsgWiAAQuQAfCoCACJhIGGUkiFaIFkgAELgAHwqAgAiYSBhlJIhWSBYIABC3AB8KgIAImEgYZSSIVggVyAAQtgAfCoCACJhIGGUkiFXIFYgAELUAHwqAgAiYSBhlJIhViBVIABC0AB8KgIAImEgYZSSIVUgVCAAQswAfCoCACJhIGGUkiFUIFMgAELIAHwqAgAiYSBhlJIhUyBSIABCxAB8KgIAImEgYZSSIVIgUSAAQsAAfCoCACJhIGGUkiFRIFAgAEI8fCoCACJhIGGUkiFQIE8gAEI4fCoCACJhIGGUkiFPIE4gAEI0fCoCACJhIGGUkiFOIE0gAEIwfCoCACJhIGGUkiFNIEwgAEIsfCoCACJhIGGUkiFMIEsgAEIofCoCACJhIGGUkiFLIEogAEIkfCoCACJhIGGUkiFKIEkgAEIgfCoCACJhIGGUkiFJIEggAEIcfCoCACJhIGGUkiFIIEcgAEIYfCoCACJhIGGUkiFHIEYgAEIUfCoCACJhIGGUkiFGIEUgAEIQfCoCACJhIGGUkiFFIEQgAEIMfCoCACJhIGGUkiFEIEMgAEIIfCoCACJhIGGUkiFDIEIgAEIEfCoCACJhIGGUkiFCIABCgAF8IQAgCiAOQiB8Ig58IhNCIHwgFlgNAAsgYLshQSBfuyFAIF67IT8gXbshPiBcuyE9IFu7ITwgWrshOyBZuyE6IFi7ITkgV7shOCBWuyE3IFW7ITYgVLshNSBTuyE0IFK7ITMgUbshMiBQuyExIE+7ITAgTrshLyBNuyEuIEy7IS0gS7shLCBKuyErIEm7ISogSLshKSBHuyEoIEa7IScgRbshJiBEuyElIEO7ISQgQrshIyAhuyEiCwJAIBMgFloNACAVIBNCf4V8IBJ9IR0CQAJAIBUgEyASfCIAfUIDg1BFDQBEAAAAAAAAAAAhGQwBCyAUIAYgFCAGVBsiDiAJIA4gCVQbpyAAp2utQgODIQ4gHCATQgKGfCEARAAAAAAAAAAAIRkDQCATQgF8IRMgGSAAKgIAIiEgIZS7oCEZIABCBHwhACAOQn98Ig5CAFINAAsLIB1CA1QNACATIBJ8IBQgBiAUIAZUGyIAIAkgACAJVBt9IQ4gHCATQgKGfCEAA0AgGSAAKgIAIiEgIZS7oCAAQgR8KgIAIiEgIZS7oCAAQgh8KgIAIiEgIZS7oCAAQgx8KgIAIiEgIZS7oCEZIABCEHwhACAOQgR8Ig5QRQ0ACwsgQSBAID8gPiA9IDwgOyA6IDkgOCA3IDYgNSA0IDMgMiAxIDAgLyAuIC0gLCArICogKSAoICcgJiAlICQgIyAiIBmgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoCEZCyAQIBmgIRAgDSAFUg0ACwsgByABQgOGfCAQOQMAIAkgCHwhCSAKIAh8IQogAUIBfCIBIAJSDQALCwteAQF+QgFC2AAQ9YWAgAAiAiABNwMIIAIgADcDACACIAFCCBD1hYCAADcDECACIAFCCBD1hYCAADcDGCABQgF8QggQ9YWAgAAhASACQYCAgPwDNgJMIAIgATcDICACCysAIAApAxAQ9IWAgAAgACkDGBD0hYCAACAAKQMgEPSFgIAAIAAQ9IWAgAALPAAgACkDECABQgOGIgF8IAI3AwAgACkDGCABfCADNwMAIAApAyAgAXwiAEIIfCACKQMgIAApAwB8NwMACwkAIAAgATcDKAslACAAIAU4AkggACAEOAJEIAAgAzgCQCAAIAI4AjwgACABOAI4CxAAIAAgAjgCTCAAIAE4AlALBwAgACoCVAuaBwgBfgJ9AX4BfwF+AnwCfgF9I4CAgIAAQrAEfSIBJICAgIAAIAEgADcDCCABQYCAgPwDNgIUIAEgACoCODgCECABIAAqAkwiAjgCGEMAAAAAIQMCQAJAIAAqAlBDAAAAAF5FDQAgACkDICAAKQMIQgOGfCkDACEEIAFCMHxBAEKABPwLACABIAA3AyAgASAEQgFCwAAgBEKAgAJUIgUbIgZ8Qn98QgBCBiAFG4giBDcDKAJAIARQDQACQAJAQgAtAMDEhICAgICAgABFDQBCACkDyMSEgICAgICAAEIAUg0AQgBCATcDyMSEgICAgICAABCBgICAACEHIAFCIHxCACAGENOFgIAAEIGAgIAAIQhCAEIAKwPQxISAgICAgIAAIAggB6GgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyABQiB8QgAgBhDThYCAAAsgBkIBgyEEAkACQCAGQn98QgNaDQBEAAAAAAAAAAAhB0IAIQkMAQsgBkLAAIMhCiABQsgAfCEGRAAAAAAAAAAAIQdCACEJA0AgByAGQmh8KwMAoCAGQnB8KwMAoCAGQnh8KwMAoCAGKwMAoCEHIAZCIHwhBiAKIAlCBHwiCVINAAsLAkAgBFANACAJQgOGIAFCIHx8QhB8IQYDQCAHIAYrAwCgIQcgBkIIfCEGIARCf3wiBEIAUg0ACwsgACoCTIsgB5+2lCEDCyAAIAM4AlQgA4siC0MAAIB/XiALQwAAgH9dckEBRw0BIAMgACoCUCILXkUNACABIAIgCyADQ703hjWSlZQ4AhgLIAAgACkDMEIBfCIGNwMwAkAgACkDAFANACAAKgI8IAa1IgMQj4CAgAAhAiABIAAqAjhDAACAPyACk5U4AhAgAUMAAIA/IAAqAkAgAxCPgICAAJOROAIUCyAAKQMgIAApAwhCA4Z8KQMAIQYCQEIALQDAxISAgICAgIAARQ0AQgApA8jEhICAgICAgABCAFINAEIAQgE3A8jEhICAgICAgAAQgYCAgAAhBwJAIAZQDQAgAUIIfEIAIAYQ0oWAgAALEIGAgIAAIQhCAEIAKwPQxISAgICAgIAAIAggB6GgOQPQxISAgICAgIAAQgBCACkDyMSEgICAgICAAEJ/fDcDyMSEgICAgICAAAwBCyAGUA0AIAFCCHxCACAGENKFgIAACyABQrAEfCSAgICAAAtqAQR+QgAhAANAAkBC4MSEgICAgICAACAAQgOGfCIBKQMAIgJQDQADQCACKQMAIQMgAhD0hYCAACADIQIgA0IAUg0ACwsgAUIANwMAIABCAXwiAEKAAlINAAtCiMSEgICAgICAAEIANwMQC5ABAQN+QojEhICAgICAgAAgADcDGAJAQojEhICAgICAgAApAxAgAFgNAEIAIQEDQAJAQuDEhICAgICAgAAgAUIDhnwiAikDACIAUA0AA0AgACkDACEDIAAQ9IWAgAAgAyEAIANCAFINAAsLIAJCADcDACABQgF8IgFCgAJSDQALQojEhICAgICAgABCADcDEAsLDgAgACABQgAQ34WAgAALnQQCBn4Bf0IBQtgAEPWFgIAAIQMCQAJAAkACQEIEQgIgAlAbIAF+IgRCA3wiBUIUVA0AQn4hBkJ8IQcgBUICiEJ/fCIIIQUDQCAHQgR8IQcgBkIBfCEGIAVCA1YhCSAFQgGIIQUgCQ0AC0LgxISAgICAgIAAIAggBoggB3xCA4Z8IgUpAwAiB0IAUg0BQn4hBiAIIQUDQCAGQgF8IQYgBUIDViEJIAVCAYghBSAJDQALIAggBohCAXwgBoZCAoYQ8oWAgAAhBwwDCwJAQgApA+DEhICAgICAgAAiB1BFDQBCEBDyhYCAACEHDAMLQgAgBykDADcD4MSEgICAgICAAEJwIQUMAQsgBSAHKQMANwMAQn4hBiAIIQUDQCAGQgF8IQYgBUIDViEJIAVCAYghBSAJDQALIAggBohCf4UgBoZCAoYhBQtCiMSEgICAgICAAEKIxISAgICAgIAAKQMQIAV8NwMQQojEhICAgICAgABCiMSEgICAgICAACkDIEIBfDcDIAsgAyAHNwMAIAMgAEIDhiIFEPKFgIAANwMIIAUQ8oWAgAAhBSADIAI3A1AgAyABNwMoIAMgATcDICADIAA3AxggAyAFNwMQIAMgAEIEhiAEfELYAHwiBTcDOEIAQgApA4jEhICAgICAgAAgBXw3A4jEhICAgICAgABCiMSEgICAgICAAEKIxISAgICAgIAAKQMIQgF8NwMIIAMLyQEBAn5CAULYABD1hYCAACICIAApAwA3AwAgAiABQgOGIgMQ8oWAgAA3AwggAxDyhYCAACEDIAIgATcDGCACIAM3AxAgAiAANwNIIAJBAToAQCACIAFCBIZC2AB8IgE3AzggAiAAKQMgNwMgIAIgACkDKDcDKCACIAApAzA3AzAgAiAAKQNQNwNQQgBCACkDiMSEgICAgICAACABfDcDiMSEgICAgICAAEKIxISAgICAgIAAQojEhICAgICAgAApAwhCAXw3AwggAgvkCQMIfgR/AX0gASkDCCAAKQMIIAApAxhCA4b8CgAAIAEpAxAgACkDECAAKQMYQgOG/AoAACABIAApAyA3AyAgAUEAOgBAIAFCADcDSCABIAApAxgiAjcDGCABIAApAzA3AzAgASAAKQMgIgM3AygCQAJAAkAgAC0AQEUNAAJAIANQDQBCACEEA0AgACkDMCEFAkAgACkDGCIGUA0AIAApAwggBkIDhiIHfEJ4fCECIAApAxAgB3xCeHwhAyABKQMIIAd8Qnh8IQcgBCEIA0AgBykDACEJIAMpAwAgCCACKQMAgn4gBXwhBSACQnh8IQIgA0J4fCEDIAdCeHwhByAIIAmAIQggBkJ/fCIGQgBSDQALCwJAAkAgACkDUEJ/fCICQgFWDQACQAJAIAKnDgIAAQALIAApAwAgBUIBhnwuAQAiCkH/B3EhCyAKQYCAgIB4cSEMAkAgCkH//wNxIg1BCnZBH3EiCkUNAAJAIApBH0cNACAMIA1BDXRyQYCAgPwHcr4hDgwECyAKQRd0QYCAgMADaiAMciALQQ10cr4hDgwDCwJAIAtFDQBBgICAmAQgC2ciCkEXdGsgDHIgDSAKQWpqdEEOdEGAgP8DcXIhDAsgDL4hDgwCCyAAKQMAIAVCAYZ8LwEAQRB0viEODAELIAApAwAgBUIChnwqAgAhDgsgASAEIA4QlICAgAAgBEIBfCIEIAApAyBUDQALIAEpAxghAgtCACEDIAFCADcDMCACUA0BIAEpAxAiBCECA0AgAkIBNwMAIAJCCHwhAiADQgF8IgMgASkDGCIHVA0ACyAHQgJUDQECQCAHQgJSDQAgBEIBNwMIIAQgASkDCCkDCDcDAA8LIAdCf3wiA0IDgyEGIAEpAwghAEIBIQUCQCAHQn58IghCA1QNACADQnyDIQkgACAHQgOGIgN8QmB8IQIgBCADfEJYfCEDQgEhBQNAIANCGHwgAkIYfCkDACAFfiIHNwMAIANCEHwgAkIQfCkDACAHfiIHNwMAIANCCHwgAkIIfCkDACAHfiIHNwMAIAMgAikDACAHfiIFNwMAIAJCYHwhAiADQmB8IQMgCEJ8fCEIIAlCfHwiCVBFDQALIAhCAXwhAwsgBlANASAEIAhCA4Z8IQIDQCACIAAgA0IDhnwpAwAgBX4iBTcDACACQnh8IQIgCCIDQn98IQggAyEDIAZCf3wiBkIAUg0ADAILCyAAKQNQIgggASkDUFENASADUA0AQgAhB0IAIQNCACECA0ACQAJAIAhCf3wiCEIBVg0AAkACQCAIpw4CAAEACyAAKQMAIAN8LgEAIgpB/wdxIQsgCkGAgICAeHEhDAJAIApB//8DcSINQQp2QR9xIgpFDQACQCAKQR9HDQAgDCANQQ10ckGAgID8B3K+IQ4MBAsgCkEXdEGAgIDAA2ogDHIgC0ENdHK+IQ4MAwsCQCALRQ0AQYCAgJgEIAtnIgpBF3RrIAxyIA0gCkFqanRBDnRBgID/A3FyIQwLIAy+IQ4MAgsgACkDACADfC8BAEEQdL4hDgwBCyAAKQMAIAd8KgIAIQ4LIAEgAiAOEJSAgIAAIAJCAXwiAiAAKQMgWg0BIAdCBHwhByADQgJ8IQMgACkDUCEIDAALCw8LIAEpAwAgACkDAEIEQgIgCFAbIAN+/AoAAAsNAEKIxISAgICAgIAACzABAX9BASEBAkBCABDwhYCAACAAfCIAEO+FgIAAWA0AIAAQkICAgABBAEchAQsgAQsFAELeAgsrAQF+QgAhAQJAIABC3QJWDQAgAEIDhkKAgISAgICAgIAAfCkDACEBCyABCw0AIABCwAAQ9YWAgAALCgAgABD0hYCAAAvyBAMDfgF/Bn4CQCAAKQMAIgFCCVYNACAAKQMIQgOGQvCVhICAgICAgAB8KQMAIQICQAJAAkACQAJAAkACQAJAAkAgAacOCgABAgMEBAUGBwgACyAAKQMQIAApAyggACoCOCACpxGAgICAAAAPCyAAKQMQIAApAxggACkDKCACpxGBgICAAAAPCyAAKQMQIAApAyggAqcRgoCAgAAADwsgACkDKCAAKgI4IAKnEYOAgIAAAA8LIAApAxgpAwAgACkDMEIChnwiAygCACEEAkAgAUIFUg0AIAMgBEHtnJmOBGxBueAAaiIENgIACyAAKQMQIAApAyggACoCOCAEIAKnEYSAgIAAAA8LIAApAxAgAqcRhYCAgAAAIQUgACkDKCIGKQNIIgIpAzAhBwJAIAIpAxgiCFANACACKQMIIAhCA4ZCeHwiA3whASACKQMQIAN8IQIgBSEDA0AgAikDACADIAMgASkDACIJgCIKIAl+fX4gB3whByABQnh8IQEgAkJ4fCECIAohAyAIQn98IghCAFINAAsLIAYgBzcDMCAAKQMYIglQDQMgCSkDSCIBKQMwIQICQCABKQMYIgNQDQAgASkDCCADQgOGQnh8Igd8IQAgASkDECAHfCEBA0AgASkDACAFIAUgACkDACIHgCIIIAd+fX4gAnwhAiAAQnh8IQAgAUJ4fCEBIAghBSADQn98IgNCAFINAAsLIAkgAjcDMA8LIAApAxAgACkDGCAAKQMoIAAqAjggAqcRhoCAgAAADwsgACkDMCACpxGHgICAAAAPCyAAKQMQIAApAxggACkDICAAKQMoIAKnEYiAgIAAAAsLKAACQCABUA0AA0AgABDohYCAACAAQsAAfCEAIAFCf3wiAVBFDQALCwvVBAMCfgF/A34CQAJAAkACQCAAKQMAQn18IgJCBVYNAEIBIQNBASEEQn8hBUIAIQZCACEHAkACQCACpw4GBQIAAQIEBQsCQAJAIAApAxAiBlBFDQBCACEGDAELIAYpAyghAiAGKQNQIQMgBikDACEGIAFBADoAECABIAY3AwAgASAGIAJCBEICIANQG358NwMIQgEhBgtBASEEIAApAxgiAlBFDQIMBAsCQAJAIAApAxAiBlBFDQBCACEGDAELIAYpAyghAiAGKQNQIQMgBikDACEGIAFBADoAECABIAY3AwAgASAGIAJCBEICIANQG358NwMIQgEhBgtBASEEIAApAxgiAlBFDQEMAwsCQAJAIAApAxAiBlBFDQBCACEGDAELIAYpAyghAiAGKQNQIQMgBikDACEGIAFBADoAECABIAY3AwAgASAGIAJCBEICIANQG358NwMIQgEhBgsCQCAAKQMYIgJQDQAgAikDKCEFIAIpA1AhByACKQMAIQIgASAGQhh+fCIDQQA6ABAgAyACNwMAIAMgAiAFQgRCAiAHUBt+fDcDCCAGQgF8IQYLQQAhBCAAKQMgIgJQDQILIAIpAwAiB0IEQgIgAikDUFAbIAIpAyh+fCEFIAZCAXwhAwsgASAGQhh+fCIGIAQ6ABAgBiAFNwMIIAYgBzcDACADIQYLAkAgACkDKCIAUA0AIAApAyghAiAAKQNQIQMgACkDACEAIAEgBkIYfnwiAUEBOgAQIAEgADcDACABIAAgAkIEQgIgA1Abfnw3AwggBkIBfCEGCyAGC8MRBgV+AX8QfgF/BX4HfSOAgICAAEIQfSICJICAgIAAQgFCwAAQ9YWAgAAiAyABNwMAIAMgAUIBfCIEQggQ9YWAgAA3AwggAyAEQggQ9YWAgAA3AxAgAyAEQgQQ9YWAgAA3AyAgAyAEQggQ9YWAgAA3AzAgAyAEQggQ9YWAgAA3AzggBEL4AH4Q8oWAgAAhBSAEQgOGEPKFgIAAIQYCQAJAAkAgAVAiBw0AIAAhCCAFIQkgBiEKIAEhCwNAIAogCCAJEOqFgIAANwMAIAhCwAB8IQggCUL4AHwhCSAKQgh8IQogC0J/fCILUEUNAAsgBEIEhhDyhYCAACEMIAdFDQFCACENDAILQgAhDSAEQgSGEPKFgIAAIQwMAQsgBUKIf3whDiACQgh8QgR8IQ9CACENQgAhEANAIA9BADoAACACQQA2AggCQCAQUA0AIAYgEEIDhnwiESkDACISUA0AIAUgEEL4AH58IRMgDiEUIBAhFSASIRYDQCAVQn98IRUCQCASUA0AIAYgFUIDhnwhF0EAIRhCACEZA0ACQCACQgh8IBl8IhotAAANACAXKQMAIglQDQACQAJAIBMgGUIYfnwiCy0AEA0AIBQhCANAAkAgCEIQfC0AAEUNACALKQMAIgogCEIIfCkDACIbWg0AIAgpAwAiHCALKQMIIh1aDQBBASEYIBwgClYNACAdIBtYDQMLIAhCGHwhCCAJQn98IglQRQ0ADAMLCyALKQMAIQogFCEIA0ACQCAKIAhCCHwpAwAiG1oNACAIKQMAIhwgCykDCCIdWg0AQQEhGCAIQhB8LQAARQ0AIBwgClYNACAdIBtYDQILIAhCGHwhCCAJQn98IglCAFINAAwCCwtBASEYIBpBAToAACAWQn98IRYLIBlCAXwiGSASUg0ACyAYQQFxRQ0AAkAgDSAEUg0AIA1CAYYhBCAMIA1CBYYQ9oWAgAAhDAsgDCANQgSGfCIIIBA3AwggCCAVNwMAIA1CAXwhDQsgFVANASAWUA0BIBRCiH98IRQgESkDACESDAALCyAOQvgAfCEOIBBCAXwiECABUg0ACwsgAyANQgOGQgh8EPKFgIAAIhw3AxgCQCANUCIYDQAgDUIBgyEdIAMpAwghCiADKQMQIQtCACEJAkAgDUIBUQ0AIA1CfoMhGUIAIQkgDCEIA0AgCCkDAEIDhiALfEIIfCIbIBspAwBCAXw3AwAgCiAIQgh8KQMAQgOGfCIbIBspAwBCAXw3AwAgCEIQfCkDAEIDhiALfEIIfCIbIBspAwBCAXw3AwAgCiAIQhh8KQMAQgOGfCIbIBspAwBCAXw3AwAgCEIgfCEIIBkgCUICfCIJUg0ACwsgHVANACAMIAlCBIZ8IggpAwBCA4YgC3xCCHwiCSAJKQMAQgF8NwMAIAogCCkDCEIDhnwiCCAIKQMAQgF8NwMACwJAIAcNACABQgODIQogAykDECIdKQMAIQlCACELAkAgAUJ/fEIDVA0AIB1CEHwhCCABQnyDIRlCACELA0AgCEJ4fCIbIBspAwAgCXwiCTcDACAIIAgpAwAgCXwiCTcDACAIQgh8IhsgGykDACAJfCIJNwMAIAhCEHwiGyAbKQMAIAl8Igk3AwAgCEIgfCEIIBkgC0IEfCILUg0ACwsgClANACALQgOGIB18Qgh8IQgDQCAIIAgpAwAgCXwiCTcDACAIQgh8IQggCkJ/fCIKQgBSDQALCwJAIBgNACANQgGDIRogAykDMCEKIAMpAxAhC0IAIQkCQCANQgFRDQAgDUJ+gyESQgAhCSAMIQgDQCAIQgh8KQMAIRsgCyAIKQMAQgOGIhl8KQMAIR0gCiAZfCIZIBkpAwAiGUIBfDcDACAcIBkgHXxCA4Z8IBs3AwAgCEIYfCkDACEbIAsgCEIQfCkDAEIDhiIZfCkDACEdIAogGXwiGSAZKQMAIhlCAXw3AwAgHCAZIB18QgOGfCAbNwMAIAhCIHwhCCASIAlCAnwiCVINAAsLIBpQDQAgDCAJQgSGfCIIKQMIIQkgCyAIKQMAQgOGIgh8KQMAIQsgCiAIfCIIIAgpAwAiCEIBfDcDACAcIAggC3xCA4Z8IAk3AwALQwAAAAAhHkMAAAAAIR8CQCAHDQAgAykDECIdIAFCA4Z8KQMAIRkgAykDICEJQwAAAAAhH0MAAAAAIR4DQEMAAAAAISACQCAZIB0gAUJ/fCIBQgOGfCkDACIbWA0AIBkgG0J/hXwhEgJAAkAgGSAbfUIDgyILUEUNAEMAAAAAISAgGyEKDAELIBwgG0IDhnwhCEMAAAAAISAgGyEKA0AgCSAIKQMAQgKGfCoCACIhICAgISAgXhshICAIQgh8IQggCkIBfCEKIAtCf3wiC0IAUg0ACwsgEkIDVA0AIBkgCn0hCyAcIApCA4Z8IQgDQCAJIAhCGHwpAwBCAoZ8KgIAIiEgCSAIQhB8KQMAQgKGfCoCACIiIAkgCEIIfCkDAEIChnwqAgAiIyAJIAgpAwBCAoZ8KgIAIiQgICAkICBeGyIgICMgIF4bIiAgIiAgXhsiICAhICBeGyEgIAhCIHwhCCALQnx8IgtQRQ0ACwsCQAJAIAAgAUIGhnwiCCkDKCILUEUNAEMAAIA/ISEMAQsgCykDILUhIQsCQCAIKQMQIgpQDQAgISAKKQMgtSIiXUUNACAiISELAkAgCCkDICIZUA0AICEgGSkDILUiIl1FDQAgIiEhCyAIKQMIIRkCQCAIKQMAQghSDQAgCCkDMCIIKQMgIAgpAwhCA4Z8KQMAtSEhCwJAIBlCA1YNACALKQMgtSAKKQMYQgOGIAopAwh8Qnh8KQMAtZQhIQsgCSABQgKGfCAgICGSIiA4AgAgICAfICAgH14bIR8gHiAhkiEeIBshGSABUEUNAAsLIAMgHiAflUMAAIA/IB9DAAAAAF4bOAIoIAwQ9IWAgAAgBRD0hYCAACAGEPSFgIAAIAJCEHwkgICAgAAgAwtMACAAKQMIEPSFgIAAIAApAxAQ9IWAgAAgACkDGBD0hYCAACAAKQMgEPSFgIAAIAApAzAQ9IWAgAAgACkDOBD0hYCAACAAEPSFgIAACwcAIAAqAigLLgACQCABKQMAIgFQDQADQCAAEOiFgIAAIABCwAB8IQAgAUJ/fCIBQgBSDQALCwsHAD8AQhCGC4oBAQN+AkBCACkD4NSEgICAgICAACIBQgBSDQBCAEKA2YSAgICAgIAAQg98QnCDIgE3A+DUhICAgICAgAALIAEgAHwhAkJ/IQMCQAJAIABCAVMNACACIAFUDQELAkAgAj8AQhCGWA0AIAIQkICAgABFDQELQgAgAjcD4NSEgICAgICAACABIQMLIAMLTQEBfyAAIAAoAgBB7ZyZjgRsQbngAGoiATYCACABQQt2IAFzIgFBB3RBgK2x6XlxIAFzIgFBD3RBgICY/n5xIAFzIgFBE3YgAUEBdnMLpggDAX4BfwV+QgAhAQJAIABCAFMiAg0AQj9CACAAQh98QnCDIgBCICAAQiBWGyACGyIDeX0iBCEBAkADQAJAIAFCA4ZC8NSEgICAgICAAHwpAwAiAFANAANAIAApAwBCcIMiBSADWg0DIAApAwgiAEIAUg0ACwsgAUIBfCIBQsAAUg0ACwJAQgApA/DYhICAgICAgAAiBkIAUg0AAkBCACkD4NSEgICAgICAACIAQgBSDQBCAEKA2YSAgICAgIAAQg98QnCDIgA3A+DUhICAgICAgAALAkACQAJAIAA/AEIQhlgNACAAEJCAgIAARQ0BC0IAIAA3A+DUhICAgICAgAAgACEFDAELQgApA+DUhICAgICAgAAhAEJ/IQULQgAhAUIAIAV9Qg+DIgZCEIQhBwJAIABCAFINAEIAQoDZhICAgICAgABCD3xCcIMiADcD4NSEgICAgICAAAsgACAHfCIHIABUDQICQCAHPwBCEIZYDQAgBxCQgICAAEUNAwtCACEBQgAgBzcD4NSEgICAgICAACAAQn9RDQIgBSAGfCIAQgE3AwAgAEIBNwMIQgAgAEIIfCIGNwPw2ISAgICAgIAACyADQoCABCADQoCABFYbIQACQEIAKQPg1ISAgICAgIAAIgVCAFINAEIAQoDZhICAgICAgABCD3xCcIMiBTcD4NSEgICAgICAAAsgBSAAfCEHQgAhAQJAIABCAVMNACAHIAVUDQILAkAgBz8AQhCGWA0AIAcQkICAgABFDQILQgAhAUIAIAc3A+DUhICAgICAgAAgBUJ/UQ0BIAYgADcDACAGIAB8Qnh8IAA3AwBCACAGIAYpAwBCcIN8IgA3A/DYhICAgICAgAAgAEIBNwMAIAYQ84WAgAAiAEIANwMQIABCPyAAKQMAQnCDeX1CA4ZC8NSEgICAgICAAHwiBSkDADcDCAJAIAUpAwAiAVANACABIAA3AxALIAUgADcDAANAAkAgBEIDhkLw1ISAgICAgIAAfCkDACIAUA0AA0AgACkDAEJwgyIFIANaDQMgACkDCCIAQgBSDQALC0IAIQEgBEIBfCIEQsAAUg0ADAILC0I/IAV5fUIDhkLw1ISAgICAgIAAfCAAKQMQIgFCCHwgAVAbIAApAwg3AwACQCAAKQMIIgFQDQAgASAAKQMQNwMQCyAAQgh8IQECQCAFIAN9IgRCIFQNACAAIANCAYQiBTcDACAAIAN8Qnh8IAU3AwAgACAAKQMAQnCDfCIAIAQ3AwAgACAEfEJ4fCAENwMAIABCADcDECAAQj8gACkDAEJwg3l9QgOGQvDUhICAgICAgAB8IgMpAwA3AwgCQCADKQMAIgVQDQAgBSAANwMQCyADIAA3AwAgAQ8LIAAgBUIBhCIDNwMAIAAgBXxCeHwgAzcDAAsgAQuiAgEEfgJAIAAgACkDAEJwgyIBfCICKQMAIgOnQQFxDQBCPyADQnCDIgN5fUIDhkLw1ISAgICAgIAAfCACKQMQIgRCCHwgBFAbIAIpAwg3AwACQCACKQMIIgRQDQAgBCACKQMQNwMQCyAAIAMgAXwiAjcDACAAIAJ8Qnh8IAI3AwALAkAgAEJ4fCkDACICp0EBcUUNACAADwsgACACQnCDfSICKQMIIQECQAJAIAIpAxAiA1ANACADQgh8IQMMAQtCPyACKQMAQnCDeX1CA4ZC8NSEgICAgICAAHwhAwsgAyABNwMAAkAgAikDCCIBUA0AIAEgAikDEDcDEAsgAiAAKQMAQnCDIAIpAwBCcIN8IgA3AwAgAiAAfEJ4fCAANwMAIAILfAECfgJAIABQDQAgAEJ4fCIAIAApAwBCcIMiATcDACAAIAF8Qnh8IAE3AwAgABDzhYCAACIAQgA3AxAgAEI/IAApAwBCcIN5fUIDhkLw1ISAgICAgIAAfCIBKQMANwMIAkAgASkDACICUA0AIAIgADcDEAsgASAANwMACwtwAQJ+I4CAgIAAQhB9IgIkgICAgAACQAJAIAFQDQBCACEDIAIgAUIAIABCABD6hYCAACACKQMIQgBSDQELAkAgASAAfiIBEPKFgIAAIgNQRQ0AQgAhAwwBCyADQQAgAfwLAAsgAkIQfCSAgICAACADC9YCAQR+AkAgAEIAUg0AIAEQ8oWAgAAPCyAAQnh8IgIpAwBCcIMhAwJAIAFCAFINACACIAM3AwAgAiADfEJ4fCADNwMAIAIQ84WAgAAiAUIANwMQIAFCPyABKQMAQnCDeX1CA4ZC8NSEgICAgICAAHwiACkDADcDCAJAIAApAwAiA1ANACADIAE3AxALIAAgATcDAEIADwtCACEEAkAgAUIAUw0AAkAgAUIffEJwgyIFQiAgBUIgVhsgA1YNACAADwsgARDyhYCAACIFUA0AIAUgACADQnB8IgMgASADIAFUG/wKAAAgAiACKQMAQnCDIgE3AwAgAiABfEJ4fCABNwMAIAIQ84WAgAAiAUIANwMQIAFCPyABKQMAQnCDeX1CA4ZC8NSEgICAgICAAHwiACkDADcDCAJAIAApAwAiA1ANACADIAE3AxALIAAgATcDACAFIQQLIAQLCgAgACSAgICAAAsaAQF+I4CAgIAAIAB9QnCDIgEkgICAgAAgAQsIACOAgICAAAt1AQF+IAAgBCABfiACIAN+fCADQiCIIgQgAUIgiCICfnwgA0L/////D4MiAyABQv////8PgyIBfiIFQiCIIAMgAn58IgNCIIh8IANC/////w+DIAQgAX58IgNCIIh8NwMIIAAgA0IghiAFQv////8Pg4Q3AwALC75EAgBCgIAEC4ZE5xcBAAAAAABhHQEAAAAAAGQXAQAAAAAA/hwBAAAAAACEFwEAAAAAAHcXAQAAAAAA7BUBAAAAAADgFQEAAAAAAKYXAQAAAAAAlxcBAAAAAADuFwEAAAAAALoXAQAAAAAA1BoBAAAAAABAIQEAAAAAAOkaAQAAAAAAXSEBAAAAAAB0GgEAAAAAAMAgAQAAAAAAvBkBAAAAAADIHwEAAAAAALQZAQAAAAAAvB8BAAAAAADjIQEAAAAAAKchAQAAAAAA7CEBAAAAAAC0IQEAAAAAANohAQAAAAAAmiEBAAAAAABsGQEAAAAAAFwfAQAAAAAAgxkBAAAAAAB7HwEAAAAAAAQZAQAAAAAA1B4BAAAAAAA8GAEAAAAAAMwdAQAAAAAAMxgBAAAAAAC/HQEAAAAAAEkXAQAAAAAA1xwBAAAAAABMGgEAAAAAAIggAQAAAAAADBoBAAAAAAAwIAEAAAAAAGwaAQAAAAAAtCABAAAAAABAGgEAAAAAAHggAQAAAAAAABoBAAAAAAAgIAEAAAAAAGAaAQAAAAAApCABAAAAAACmGgEAAAAAAAIhAQAAAAAAmhoBAAAAAADyIAEAAAAAALIaAQAAAAAAEiEBAAAAAAApGgEAAAAAAFkgAQAAAAAAvhoBAAAAAAAiIQEAAAAAAPQaAQAAAAAAbCEBAAAAAAAAGwEAAAAAAHwhAQAAAAAA5RkBAAAAAAD9HwEAAAAAAPQZAQAAAAAAECABAAAAAAB8GgEAAAAAAMwgAQAAAAAAHxoBAAAAAABLIAEAAAAAABcaAQAAAAAAPyABAAAAAABUGgEAAAAAAJQgAQAAAAAAyRoBAAAAAAAxIQEAAAAAAKcZAQAAAAAAqx8BAAAAAACIGgEAAAAAANwgAQAAAAAA2RkBAAAAAADtHwEAAAAAAMcZAQAAAAAA1x8BAAAAAAAxGgEAAAAAAGUgAQAAAAAA3BoBAAAAAABMIQEAAAAAAEkaAQAAAAAAhSABAAAAAAAJGgEAAAAAAC0gAQAAAAAAaRoBAAAAAACxIAEAAAAAAD0aAQAAAAAAdSABAAAAAAD9GQEAAAAAAB0gAQAAAAAAXRoBAAAAAAChIAEAAAAAAKMaAQAAAAAA/yABAAAAAACXGgEAAAAAAO8gAQAAAAAArxoBAAAAAAAPIQEAAAAAALsaAQAAAAAAHyEBAAAAAADxGgEAAAAAAGkhAQAAAAAA/RoBAAAAAAB5IQEAAAAAAOIZAQAAAAAA+h8BAAAAAADxGQEAAAAAAA0gAQAAAAAAFBoBAAAAAAA8IAEAAAAAAMYaAQAAAAAALiEBAAAAAACFGgEAAAAAANkgAQAAAAAA1hkBAAAAAADqHwEAAAAAAMQZAQAAAAAA1B8BAAAAAADRFwEAAAAAAD8dAQAAAAAAcBcBAAAAAAASHQEAAAAAAOAXAQAAAAAAVh0BAAAAAADJFwEAAAAAADMdAQAAAAAAaBcBAAAAAAAGHQEAAAAAANgXAQAAAAAASh0BAAAAAAAOGAEAAAAAAIodAQAAAAAABhgBAAAAAAB+HQEAAAAAABYYAQAAAAAAlh0BAAAAAACzFwEAAAAAACgdAQAAAAAAChsBAAAAAACKIQEAAAAAAB4YAQAAAAAAoh0BAAAAAAD1IQEAAAAAAMEhAQAAAAAA/SEBAAAAAADNIQEAAAAAAFEXAQAAAAAA4xwBAAAAAABcFwEAAAAAAPIcAQAAAAAAkBcBAAAAAAAdHQEAAAAAAPgXAQAAAAAAbB0BAAAAAABBFwEAAAAAAMscAQAAAAAAMxcBAAAAAAC5HAEAAAAAANgYAQAAAAAAmB4BAAAAAACSGAEAAAAAADoeAQAAAAAA+xgBAAAAAADHHgEAAAAAAMsYAQAAAAAAhx4BAAAAAACFGAEAAAAAACkeAQAAAAAA7hgBAAAAAAC2HgEAAAAAADoZAQAAAAAAGh8BAAAAAAAtGQEAAAAAAAkfAQAAAAAARxkBAAAAAAArHwEAAAAAALIYAQAAAAAAZh4BAAAAAABUGQEAAAAAADwfAQAAAAAAjxkBAAAAAACLHwEAAAAAAJwZAQAAAAAAnB8BAAAAAABoGAEAAAAAAAQeAQAAAAAAeBgBAAAAAAAYHgEAAAAAAA0ZAQAAAAAA4R4BAAAAAACnGAEAAAAAAFceAQAAAAAAnhgBAAAAAABKHgEAAAAAAOEYAQAAAAAApR4BAAAAAABgGQEAAAAAAEwfAQAAAAAAJRgBAAAAAACtHQEAAAAAABoZAQAAAAAA8h4BAAAAAABbGAEAAAAAAPMdAQAAAAAASBgBAAAAAADcHQEAAAAAALsYAQAAAAAAcx4BAAAAAAB1GQEAAAAAAGkfAQAAAAAA1RgBAAAAAACVHgEAAAAAAI8YAQAAAAAANx4BAAAAAAD4GAEAAAAAAMQeAQAAAAAAyBgBAAAAAACEHgEAAAAAAIIYAQAAAAAAJh4BAAAAAADrGAEAAAAAALMeAQAAAAAANxkBAAAAAAAXHwEAAAAAACoZAQAAAAAABh8BAAAAAABEGQEAAAAAACgfAQAAAAAAURkBAAAAAAA5HwEAAAAAAIwZAQAAAAAAiB8BAAAAAACZGQEAAAAAAJkfAQAAAAAAZRgBAAAAAAABHgEAAAAAAHUYAQAAAAAAFR4BAAAAAACbGAEAAAAAAEceAQAAAAAAXRkBAAAAAABJHwEAAAAAABcZAQAAAAAA7x4BAAAAAABYGAEAAAAAAPAdAQAAAAAARRgBAAAAAADZHQEAAAAAAI0WAQAAAAAA2xsBAAAAAABNFgEAAAAAAIMbAQAAAAAArRYBAAAAAAAHHAEAAAAAAIEWAQAAAAAAyxsBAAAAAABBFgEAAAAAAHMbAQAAAAAAoRYBAAAAAAD3GwEAAAAAAN8WAQAAAAAASRwBAAAAAADTFgEAAAAAADkcAQAAAAAA6xYBAAAAAABZHAEAAAAAAGoWAQAAAAAArBsBAAAAAAD3FgEAAAAAAGkcAQAAAAAAHRcBAAAAAACbHAEAAAAAACkXAQAAAAAAqxwBAAAAAAAmFgEAAAAAAFAbAQAAAAAANRYBAAAAAABjGwEAAAAAALUWAQAAAAAAExwBAAAAAABgFgEAAAAAAJ4bAQAAAAAAWBYBAAAAAACSGwEAAAAAAJUWAQAAAAAA5xsBAAAAAAACFwEAAAAAAHgcAQAAAAAA+BUBAAAAAAAWGwEAAAAAAMEWAQAAAAAAIxwBAAAAAAAaFgEAAAAAAEAbAQAAAAAACBYBAAAAAAAqGwEAAAAAAHIWAQAAAAAAuBsBAAAAAAANFwEAAAAAAIccAQAAAAAAihYBAAAAAADYGwEAAAAAAEoWAQAAAAAAgBsBAAAAAACqFgEAAAAAAAQcAQAAAAAAfhYBAAAAAADIGwEAAAAAAD4WAQAAAAAAcBsBAAAAAACeFgEAAAAAAPQbAQAAAAAA3BYBAAAAAABGHAEAAAAAANAWAQAAAAAANhwBAAAAAADoFgEAAAAAAFYcAQAAAAAA9BYBAAAAAABmHAEAAAAAABoXAQAAAAAAmBwBAAAAAAAmFwEAAAAAAKgcAQAAAAAAIxYBAAAAAABNGwEAAAAAADIWAQAAAAAAYBsBAAAAAABVFgEAAAAAAI8bAQAAAAAA/xYBAAAAAAB1HAEAAAAAAL4WAQAAAAAAIBwBAAAAAAAXFgEAAAAAAD0bAQAAAAAABRYBAAAAAAAnGwEAAAAAAAEAAAAAAAAAAgAAAAAAAAADAAAAAAAAAAQAAAAAAAAABQAAAAAAAAAGAAAAAAAAAAcAAAAAAAAACAAAAAAAAAAJAAAAAAAAAAoAAAAAAAAACwAAAAAAAAAMAAAAAAAAAA0AAAAAAAAADgAAAAAAAAAPAAAAAAAAABAAAAAAAAAAEQAAAAAAAAASAAAAAAAAABMAAAAAAAAAFAAAAAAAAAAVAAAAAAAAABYAAAAAAAAAFwAAAAAAAAAYAAAAAAAAABkAAAAAAAAAGgAAAAAAAAAbAAAAAAAAABwAAAAAAAAAHQAAAAAAAAAeAAAAAAAAAB8AAAAAAAAAIAAAAAAAAAAhAAAAAAAAACIAAAAAAAAAIwAAAAAAAAAkAAAAAAAAACUAAAAAAAAAJgAAAAAAAAAnAAAAAAAAACgAAAAAAAAAKQAAAAAAAAAqAAAAAAAAACsAAAAAAAAALAAAAAAAAAAtAAAAAAAAAC4AAAAAAAAALwAAAAAAAAAwAAAAAAAAADEAAAAAAAAAMgAAAAAAAAAzAAAAAAAAADQAAAAAAAAANQAAAAAAAAA2AAAAAAAAADcAAAAAAAAAOAAAAAAAAAA5AAAAAAAAADoAAAAAAAAAOwAAAAAAAAA8AAAAAAAAAD0AAAAAAAAAPgAAAAAAAAA/AAAAAAAAAEAAAAAAAAAAQQAAAAAAAABCAAAAAAAAAEMAAAAAAAAARAAAAAAAAABFAAAAAAAAAEYAAAAAAAAARwAAAAAAAABIAAAAAAAAAEkAAAAAAAAASgAAAAAAAABLAAAAAAAAAEwAAAAAAAAATQAAAAAAAABOAAAAAAAAAE8AAAAAAAAAUAAAAAAAAABRAAAAAAAAAFIAAAAAAAAAUwAAAAAAAABUAAAAAAAAAFUAAAAAAAAAVgAAAAAAAABXAAAAAAAAAFgAAAAAAAAAWQAAAAAAAABaAAAAAAAAAFsAAAAAAAAAXAAAAAAAAABdAAAAAAAAAF4AAAAAAAAAXwAAAAAAAABgAAAAAAAAAGEAAAAAAAAAYgAAAAAAAABjAAAAAAAAAGQAAAAAAAAAZQAAAAAAAABmAAAAAAAAAGcAAAAAAAAAaAAAAAAAAABpAAAAAAAAAGoAAAAAAAAAawAAAAAAAABsAAAAAAAAAG0AAAAAAAAAbgAAAAAAAABvAAAAAAAAAHAAAAAAAAAAcQAAAAAAAAByAAAAAAAAAHMAAAAAAAAAdAAAAAAAAAB1AAAAAAAAAHYAAAAAAAAAdwAAAAAAAAB4AAAAAAAAAHkAAAAAAAAAegAAAAAAAAB7AAAAAAAAAHwAAAAAAAAAfQAAAAAAAAB+AAAAAAAAAH8AAAAAAAAAgAAAAAAAAACBAAAAAAAAAIIAAAAAAAAAgwAAAAAAAACEAAAAAAAAAIUAAAAAAAAAhgAAAAAAAACHAAAAAAAAAIgAAAAAAAAAiQAAAAAAAACKAAAAAAAAAIsAAAAAAAAAjAAAAAAAAACNAAAAAAAAAI4AAAAAAAAAjwAAAAAAAACQAAAAAAAAAJEAAAAAAAAAkgAAAAAAAACTAAAAAAAAAJQAAAAAAAAAlQAAAAAAAACWAAAAAAAAAJcAAAAAAAAAmAAAAAAAAACZAAAAAAAAAJoAAAAAAAAAmwAAAAAAAACcAAAAAAAAAJ0AAAAAAAAAngAAAAAAAACfAAAAAAAAAKAAAAAAAAAAoQAAAAAAAACiAAAAAAAAAKMAAAAAAAAApAAAAAAAAAClAAAAAAAAAKYAAAAAAAAApwAAAAAAAACoAAAAAAAAAKkAAAAAAAAAqgAAAAAAAACrAAAAAAAAAKwAAAAAAAAArQAAAAAAAACuAAAAAAAAAK8AAAAAAAAAsAAAAAAAAACxAAAAAAAAALIAAAAAAAAAswAAAAAAAAC0AAAAAAAAALUAAAAAAAAAtgAAAAAAAAC3AAAAAAAAALgAAAAAAAAAuQAAAAAAAAC6AAAAAAAAALsAAAAAAAAAvAAAAAAAAAC9AAAAAAAAAL4AAAAAAAAAvwAAAAAAAADAAAAAAAAAAMEAAAAAAAAAwgAAAAAAAADDAAAAAAAAAMQAAAAAAAAAxQAAAAAAAADGAAAAAAAAAMcAAAAAAAAAyAAAAAAAAADJAAAAAAAAAMoAAAAAAAAAywAAAAAAAADMAAAAAAAAAM0AAAAAAAAAzgAAAAAAAADPAAAAAAAAANAAAAAAAAAA0QAAAAAAAADSAAAAAAAAANMAAAAAAAAA1AAAAAAAAADVAAAAAAAAANYAAAAAAAAA1wAAAAAAAADYAAAAAAAAANkAAAAAAAAA2gAAAAAAAADbAAAAAAAAANwAAAAAAAAA3QAAAAAAAADeAAAAAAAAAN8AAAAAAAAA4AAAAAAAAADhAAAAAAAAAOIAAAAAAAAA4wAAAAAAAADkAAAAAAAAAOUAAAAAAAAA5gAAAAAAAADnAAAAAAAAAOgAAAAAAAAA6QAAAAAAAADqAAAAAAAAAOsAAAAAAAAA7AAAAAAAAADtAAAAAAAAAO4AAAAAAAAA7wAAAAAAAADwAAAAAAAAAPEAAAAAAAAA8gAAAAAAAADzAAAAAAAAAPQAAAAAAAAA9QAAAAAAAAD2AAAAAAAAAPcAAAAAAAAA+AAAAAAAAAD5AAAAAAAAAPoAAAAAAAAA+wAAAAAAAAD8AAAAAAAAAP0AAAAAAAAA/gAAAAAAAAD/AAAAAAAAAAABAAAAAAAAAQEAAAAAAAACAQAAAAAAAAMBAAAAAAAABAEAAAAAAAAFAQAAAAAAAAYBAAAAAAAABwEAAAAAAAAIAQAAAAAAAAkBAAAAAAAACgEAAAAAAAALAQAAAAAAAAwBAAAAAAAADQEAAAAAAAAOAQAAAAAAAA8BAAAAAAAAEAEAAAAAAAARAQAAAAAAABIBAAAAAAAAEwEAAAAAAAAUAQAAAAAAABUBAAAAAAAAFgEAAAAAAAAXAQAAAAAAABgBAAAAAAAAGQEAAAAAAAAaAQAAAAAAABsBAAAAAAAAHAEAAAAAAAAdAQAAAAAAAB4BAAAAAAAAHwEAAAAAAAAgAQAAAAAAACEBAAAAAAAAIgEAAAAAAAAjAQAAAAAAACQBAAAAAAAAJQEAAAAAAAAmAQAAAAAAACcBAAAAAAAAKAEAAAAAAAApAQAAAAAAACoBAAAAAAAAKwEAAAAAAAAsAQAAAAAAAC0BAAAAAAAALgEAAAAAAAAvAQAAAAAAADABAAAAAAAAMQEAAAAAAAAyAQAAAAAAADMBAAAAAAAANAEAAAAAAAA1AQAAAAAAADYBAAAAAAAANwEAAAAAAAA4AQAAAAAAADkBAAAAAAAAOgEAAAAAAAA7AQAAAAAAADwBAAAAAAAAPQEAAAAAAAA+AQAAAAAAAD8BAAAAAAAAQAEAAAAAAABBAQAAAAAAAEIBAAAAAAAAQwEAAAAAAABEAQAAAAAAAEUBAAAAAAAARgEAAAAAAABHAQAAAAAAAEgBAAAAAAAASQEAAAAAAABKAQAAAAAAAEsBAAAAAAAATAEAAAAAAABNAQAAAAAAAE4BAAAAAAAATwEAAAAAAABQAQAAAAAAAFEBAAAAAAAAUgEAAAAAAABTAQAAAAAAAFQBAAAAAAAAVQEAAAAAAABWAQAAAAAAAFcBAAAAAAAAWAEAAAAAAABZAQAAAAAAAFoBAAAAAAAAWwEAAAAAAABcAQAAAAAAAF0BAAAAAAAAXgEAAAAAAABtYXhfcmVkX2lkeABtaW5fcmVkX2lkeABpZGVudGl0eV9wcncAZGZfbGVha3lfcmVsdV9wcncAZGZfcmVsdV9wcncAZGZfaW52c3FydF9wcncAZGZfc3FydF9wcncAZGZfYWNvc19wcncAZGZfY29zX3BydwBkZl9hYnNfcHJ3AGZsb29yX3BydwBleHBfcHJ3AGJpbnN0ZXBfcHJ3AGRmX2FzaW5fcHJ3AGRmX3Npbl9wcncAc2lnbl9wcncAZGZfYXRhbl9wcncAZGZfdGFuX3BydwBjZWlsX3BydwBkZl9yZWNpcHJvY2FsX3BydwBkZl9jb3NoX3BydwBkZl9zaW5oX3BydwBkZl90YW5oX3BydwBkZl9sb2dfcHJ3AGRmX25lZ2F0ZV9wcncAbG9naXN0aWNfcHJ3AGRmX2xvZzJfcHJ3AGRmX2xvZzEwX3BydwBid19sZWFreV9yZWx1AGJ3X3JlbHUAZHJvcG91dABid19pbnZzcXJ0AGJ3X3NxcnQAZG90AGJ3X2Fjb3MAYndfY29zAG1lYW5fcmVkX3RucwBzdW1fcmVkX3RucwBid19hYnMAY29udmVydF90ZW5zb3IAY2xvbmVfdGVuc29yAGJ3X2V4cABvcHRpbWl6ZXJfc3RlcABid19hc2luAGJ3X3NpbgBid19hdGFuAGJ3X3RhbgBtYXRtdWwAaW5pdF9maWxsAGJ3X3JlY2lwcm9jYWwAYndfY29zaABid19zaW5oAGJ3X3RhbmgAYndfbG9nAGlkZW50aXR5X2RicmMAcG93X2RicmMAZGl2X2RicmMAZGZfbGVha3lfcmVsdV9kYnJjAGRmX3JlbHVfZGJyYwBkZl9pbnZzcXJ0X2RicmMAZGZfc3FydF9kYnJjAGRmX2Fjb3NfZGJyYwBkZl9jb3NfZGJyYwBkZl9hYnNfZGJyYwBmbG9vcl9kYnJjAGV4cF9kYnJjAGJpbnN0ZXBfZGJyYwBkZl9hc2luX2RicmMAZGZfc2luX2RicmMAc2lnbl9kYnJjAGRmX2F0YW5fZGJyYwBkZl90YW5fZGJyYwBtdWxfZGJyYwBjZWlsX2RicmMAZGZfcmVjaXByb2NhbF9kYnJjAGRmX2Nvc2hfZGJyYwBkZl9zaW5oX2RicmMAZGZfdGFuaF9kYnJjAGRmX2xvZ19kYnJjAGRmX25lZ2F0ZV9kYnJjAGFkZF9kYnJjAGxvZ2lzdGljX2RicmMAc3ViX2RicmMAZGZfbG9nMl9kYnJjAGRmX2xvZzEwX2RicmMAaWRlbnRpdHlfYnJjAHBvd19icmMAZGl2X2JyYwBkZl9sZWFreV9yZWx1X2JyYwBkZl9yZWx1X2JyYwBkZl9pbnZzcXJ0X2JyYwBkZl9zcXJ0X2JyYwBkZl9hY29zX2JyYwBkZl9jb3NfYnJjAGRmX2Fic19icmMAZmxvb3JfYnJjAGV4cF9icmMAYmluc3RlcF9icmMAZGZfYXNpbl9icmMAZGZfc2luX2JyYwBzaWduX2JyYwBkZl9hdGFuX2JyYwBkZl90YW5fYnJjAG11bF9icmMAY2VpbF9icmMAZGZfcmVjaXByb2NhbF9icmMAZGZfY29zaF9icmMAZGZfc2luaF9icmMAZGZfdGFuaF9icmMAZGZfbG9nX2JyYwBkZl9uZWdhdGVfYnJjAGFkZF9icmMAbG9naXN0aWNfYnJjAHN1Yl9icmMAZGZfbG9nMl9icmMAZGZfbG9nMTBfYnJjAGJ3X2xvZ2lzdGljAGlkZW50aXR5X3Byd19hY2MAZGZfbGVha3lfcmVsdV9wcndfYWNjAGRmX3JlbHVfcHJ3X2FjYwBkZl9pbnZzcXJ0X3Byd19hY2MAZGZfc3FydF9wcndfYWNjAGRmX2Fjb3NfcHJ3X2FjYwBkZl9jb3NfcHJ3X2FjYwBkZl9hYnNfcHJ3X2FjYwBmbG9vcl9wcndfYWNjAGV4cF9wcndfYWNjAGJpbnN0ZXBfcHJ3X2FjYwBkZl9hc2luX3Byd19hY2MAZGZfc2luX3Byd19hY2MAc2lnbl9wcndfYWNjAGRmX2F0YW5fcHJ3X2FjYwBkZl90YW5fcHJ3X2FjYwBjZWlsX3Byd19hY2MAZGZfcmVjaXByb2NhbF9wcndfYWNjAGRmX2Nvc2hfcHJ3X2FjYwBkZl9zaW5oX3Byd19hY2MAZGZfdGFuaF9wcndfYWNjAGRmX2xvZ19wcndfYWNjAGRmX25lZ2F0ZV9wcndfYWNjAGxvZ2lzdGljX3Byd19hY2MAZGZfbG9nMl9wcndfYWNjAGRmX2xvZzEwX3Byd19hY2MAYndfbGVha3lfcmVsdV9hY2MAYndfcmVsdV9hY2MAZHJvcG91dF9hY2MAYndfaW52c3FydF9hY2MAYndfc3FydF9hY2MAZG90X2FjYwBid19hY29zX2FjYwBid19jb3NfYWNjAGJ3X2Fic19hY2MAYndfZXhwX2FjYwBid19hc2luX2FjYwBid19zaW5fYWNjAGJ3X2F0YW5fYWNjAGJ3X3Rhbl9hY2MAbWF0bXVsX2FjYwBid19yZWNpcHJvY2FsX2FjYwBid19jb3NoX2FjYwBid19zaW5oX2FjYwBid190YW5oX2FjYwBid19sb2dfYWNjAGlkZW50aXR5X2RicmNfYWNjAHBvd19kYnJjX2FjYwBkaXZfZGJyY19hY2MAZGZfbGVha3lfcmVsdV9kYnJjX2FjYwBkZl9yZWx1X2RicmNfYWNjAGRmX2ludnNxcnRfZGJyY19hY2MAZGZfc3FydF9kYnJjX2FjYwBkZl9hY29zX2RicmNfYWNjAGRmX2Nvc19kYnJjX2FjYwBkZl9hYnNfZGJyY19hY2MAZmxvb3JfZGJyY19hY2MAZXhwX2RicmNfYWNjAGJpbnN0ZXBfZGJyY19hY2MAZGZfYXNpbl9kYnJjX2FjYwBkZl9zaW5fZGJyY19hY2MAc2lnbl9kYnJjX2FjYwBkZl9hdGFuX2RicmNfYWNjAGRmX3Rhbl9kYnJjX2FjYwBtdWxfZGJyY19hY2MAY2VpbF9kYnJjX2FjYwBkZl9yZWNpcHJvY2FsX2RicmNfYWNjAGRmX2Nvc2hfZGJyY19hY2MAZGZfc2luaF9kYnJjX2FjYwBkZl90YW5oX2RicmNfYWNjAGRmX2xvZ19kYnJjX2FjYwBkZl9uZWdhdGVfZGJyY19hY2MAYWRkX2RicmNfYWNjAGxvZ2lzdGljX2RicmNfYWNjAHN1Yl9kYnJjX2FjYwBkZl9sb2cyX2RicmNfYWNjAGRmX2xvZzEwX2RicmNfYWNjAGlkZW50aXR5X2JyY19hY2MAcG93X2JyY19hY2MAZGl2X2JyY19hY2MAZGZfbGVha3lfcmVsdV9icmNfYWNjAGRmX3JlbHVfYnJjX2FjYwBkZl9pbnZzcXJ0X2JyY19hY2MAZGZfc3FydF9icmNfYWNjAGRmX2Fjb3NfYnJjX2FjYwBkZl9jb3NfYnJjX2FjYwBkZl9hYnNfYnJjX2FjYwBmbG9vcl9icmNfYWNjAGV4cF9icmNfYWNjAGJpbnN0ZXBfYnJjX2FjYwBkZl9hc2luX2JyY19hY2MAZGZfc2luX2JyY19hY2MAc2lnbl9icmNfYWNjAGRmX2F0YW5fYnJjX2FjYwBkZl90YW5fYnJjX2FjYwBtdWxfYnJjX2FjYwBjZWlsX2JyY19hY2MAZGZfcmVjaXByb2NhbF9icmNfYWNjAGRmX2Nvc2hfYnJjX2FjYwBkZl9zaW5oX2JyY19hY2MAZGZfdGFuaF9icmNfYWNjAGRmX2xvZ19icmNfYWNjAGRmX25lZ2F0ZV9icmNfYWNjAGFkZF9icmNfYWNjAGxvZ2lzdGljX2JyY19hY2MAc3ViX2JyY19hY2MAZGZfbG9nMl9icmNfYWNjAGRmX2xvZzEwX2JyY19hY2MAYndfbG9naXN0aWNfYWNjAGJ3X3Bvd19iX2FjYwBid19kaXZfYl9hY2MAYndfcG93X2FfYWNjAGJ3X2xvZzJfYWNjAGJ3X2xvZzEwX2FjYwBid19wb3dfYgBid19kaXZfYgBid19wb3dfYQBid19sb2cyAGJ3X2xvZzEwAABCiMQECygAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAEAAAAAAAAAAAAAAAA";return f}var wasmBinaryFile;function getBinarySync(file){if(file==wasmBinaryFile&&wasmBinary){return new Uint8Array(wasmBinary)}var binary=tryParseAsDataURI(file);if(binary){return binary}if(readBinary){return readBinary(file)}throw"both async and sync fetching of the wasm failed"}function getBinaryPromise(binaryFile){return Promise.resolve().then(()=>getBinarySync(binaryFile))}function instantiateArrayBuffer(binaryFile,imports,receiver){return getBinaryPromise(binaryFile).then(binary=>WebAssembly.instantiate(binary,imports)).then(receiver,reason=>{err(`failed to asynchronously prepare wasm: ${reason}`);abort(reason)})}function instantiateAsync(binary,binaryFile,imports,callback){return instantiateArrayBuffer(binaryFile,imports,callback)}function getWasmImports(){return{env:wasmImports}}function createWasm(){var info=getWasmImports();function receiveInstance(instance,module){wasmExports=instance.exports;wasmMemory=wasmExports["memory"];updateMemoryViews();addOnInit(wasmExports["__wasm_call_ctors"]);removeRunDependency("wasm-instantiate");return wasmExports}addRunDependency("wasm-instantiate");function receiveInstantiationResult(result){receiveInstance(result["instance"])}if(Module["instantiateWasm"]){try{return Module["instantiateWasm"](info,receiveInstance)}catch(e){err(`Module.instantiateWasm callback failed with error: ${e}`);return false}}if(!wasmBinaryFile)wasmBinaryFile=findWasmBinary();instantiateAsync(wasmBinary,wasmBinaryFile,info,receiveInstantiationResult);return{}}function ExitStatus(status){this.name="ExitStatus";this.message=`Program terminated with exit(${status})`;this.status=status}var callRuntimeCallbacks=callbacks=>{while(callbacks.length>0){callbacks.shift()(Module)}};function getValue(ptr,type="i8"){if(type.endsWith("*"))type="*";switch(type){case"i1":return HEAP8[ptr];case"i8":return HEAP8[ptr];case"i16":return HEAP16[ptr>>1];case"i32":return HEAP32[ptr>>2];case"i64":abort("to do getValue(i64) use WASM_BIGINT");case"float":return HEAPF32[ptr>>2];case"double":return HEAPF64[ptr>>3];case"*":return HEAPU32[ptr>>2];default:abort(`invalid type for getValue: ${type}`)}}var noExitRuntime=Module["noExitRuntime"]||true;function setValue(ptr,value,type="i8"){if(type.endsWith("*"))type="*";switch(type){case"i1":HEAP8[ptr]=value;break;case"i8":HEAP8[ptr]=value;break;case"i16":HEAP16[ptr>>1]=value;break;case"i32":HEAP32[ptr>>2]=value;break;case"i64":abort("to do setValue(i64) use WASM_BIGINT");case"float":HEAPF32[ptr>>2]=value;break;case"double":HEAPF64[ptr>>3]=value;break;case"*":HEAPU32[ptr>>2]=value;break;default:abort(`invalid type for setValue: ${type}`)}}var stackRestore=val=>__emscripten_stack_restore(val);var stackSave=()=>_emscripten_stack_get_current();var __emscripten_memcpy_js=(dest,src,num)=>HEAPU8.copyWithin(dest,src,src+num);var getHeapMax=()=>17179869184;var growMemory=size=>{var b=wasmMemory.buffer;var pages=(size-b.byteLength+65535)/65536;try{wasmMemory.grow(pages);updateMemoryViews();return 1}catch(e){}};var _emscripten_resize_heap=requestedSize=>{var oldSize=HEAPU8.length;requestedSize=Number(requestedSize);var maxHeapSize=getHeapMax();if(requestedSize>maxHeapSize){return false}var alignUp=(x,multiple)=>x+(multiple-x%multiple)%multiple;for(var cutDown=1;cutDown<=4;cutDown*=2){var overGrownHeapSize=oldSize*(1+.2/cutDown);overGrownHeapSize=Math.min(overGrownHeapSize,requestedSize+100663296);var newSize=Math.min(maxHeapSize,alignUp(Math.max(requestedSize,overGrownHeapSize),65536));var replacement=growMemory(newSize);if(replacement){return true}}return false};var getCFunc=ident=>{var func=Module["_"+ident];return func};var writeArrayToMemory=(array,buffer)=>{HEAP8.set(array,buffer)};var lengthBytesUTF8=str=>{var len=0;for(var i=0;i<str.length;++i){var c=str.charCodeAt(i);if(c<=127){len++}else if(c<=2047){len+=2}else if(c>=55296&&c<=57343){len+=4;++i}else{len+=3}}return len};var stringToUTF8Array=(str,heap,outIdx,maxBytesToWrite)=>{if(!(maxBytesToWrite>0))return 0;var startIdx=outIdx;var endIdx=outIdx+maxBytesToWrite-1;for(var i=0;i<str.length;++i){var u=str.charCodeAt(i);if(u>=55296&&u<=57343){var u1=str.charCodeAt(++i);u=65536+((u&1023)<<10)|u1&1023}if(u<=127){if(outIdx>=endIdx)break;heap[outIdx++]=u}else if(u<=2047){if(outIdx+1>=endIdx)break;heap[outIdx++]=192|u>>6;heap[outIdx++]=128|u&63}else if(u<=65535){if(outIdx+2>=endIdx)break;heap[outIdx++]=224|u>>12;heap[outIdx++]=128|u>>6&63;heap[outIdx++]=128|u&63}else{if(outIdx+3>=endIdx)break;heap[outIdx++]=240|u>>18;heap[outIdx++]=128|u>>12&63;heap[outIdx++]=128|u>>6&63;heap[outIdx++]=128|u&63}}heap[outIdx]=0;return outIdx-startIdx};var stringToUTF8=(str,outPtr,maxBytesToWrite)=>stringToUTF8Array(str,HEAPU8,outPtr,maxBytesToWrite);var stackAlloc=sz=>__emscripten_stack_alloc(sz);var stringToUTF8OnStack=str=>{var size=lengthBytesUTF8(str)+1;var ret=stackAlloc(size);stringToUTF8(str,ret,size);return ret};var UTF8Decoder=typeof TextDecoder!="undefined"?new TextDecoder("utf8"):undefined;var UTF8ArrayToString=(heapOrArray,idx,maxBytesToRead)=>{var endIdx=idx+maxBytesToRead;var endPtr=idx;while(heapOrArray[endPtr]&&!(endPtr>=endIdx))++endPtr;if(endPtr-idx>16&&heapOrArray.buffer&&UTF8Decoder){return UTF8Decoder.decode(heapOrArray.subarray(idx,endPtr))}var str="";while(idx<endPtr){var u0=heapOrArray[idx++];if(!(u0&128)){str+=String.fromCharCode(u0);continue}var u1=heapOrArray[idx++]&63;if((u0&224)==192){str+=String.fromCharCode((u0&31)<<6|u1);continue}var u2=heapOrArray[idx++]&63;if((u0&240)==224){u0=(u0&15)<<12|u1<<6|u2}else{u0=(u0&7)<<18|u1<<12|u2<<6|heapOrArray[idx++]&63}if(u0<65536){str+=String.fromCharCode(u0)}else{var ch=u0-65536;str+=String.fromCharCode(55296|ch>>10,56320|ch&1023)}}return str};var UTF8ToString=(ptr,maxBytesToRead)=>ptr?UTF8ArrayToString(HEAPU8,ptr,maxBytesToRead):"";var ccall=(ident,returnType,argTypes,args,opts)=>{var toC={string:str=>{var ret=0;if(str!==null&&str!==undefined&&str!==0){ret=stringToUTF8OnStack(str)}return ret},array:arr=>{var ret=stackAlloc(arr.length);writeArrayToMemory(arr,ret);return ret}};function convertReturnValue(ret){if(typeof ret==="bigint")ret=Number(ret);if(returnType==="string"){return UTF8ToString(ret)}if(returnType==="boolean")return Boolean(ret);return ret}var func=getCFunc(ident);var cArgs=[];var stack=0;if(args){for(var i=0;i<args.length;i++){var converter=toC[argTypes[i]];if(converter){if(stack===0)stack=stackSave();cArgs[i]=converter(args[i])}else{cArgs[i]=args[i]}}}var ret=func(...cArgs);function onDone(ret){if(stack!==0)stackRestore(stack);return convertReturnValue(ret)}ret=onDone(ret);return ret};var cwrap=(ident,returnType,argTypes,opts)=>{var numericArgs=!argTypes||argTypes.every(type=>type==="number"||type==="boolean");var numericRet=returnType!=="string";if(numericRet&&numericArgs&&!opts){return getCFunc(ident)}return(...args)=>ccall(ident,returnType,argTypes,args,opts)};var _emscripten_get_now=()=>performance.now();var wasmImports={emscripten_resize_heap:_emscripten_resize_heap,emscripten_get_now:_emscripten_get_now,powf:Math.pow,exp:Math.exp,log:Math.log,log10:Math.log10,log2:Math.log2,sin:Math.sin,cos:Math.cos,tan:Math.tan,asin:Math.asin,acos:Math.acos,atan:Math.atan,sinh:Math.sinh,cosh:Math.cosh,tanh:Math.tanh,pow:Math.pow};var wasmExports=createWasm();var ___wasm_call_ctors=()=>(___wasm_call_ctors=wasmExports["d"])();var _create_tensor=Module["_create_tensor"]=(a0,a1)=>wasmExports["create_tensor"](BigInt(a0),BigInt(a1));var _create_tensor_dtype=Module["_create_tensor_dtype"]=(a0,a1,a2)=>wasmExports["create_tensor_dtype"](BigInt(a0),BigInt(a1),BigInt(a2));var _free_tensor=Module["_free_tensor"]=(a0)=>wasmExports["free_tensor"](BigInt(a0));var _convert_tensor=Module["_convert_tensor"]=(a0,a1)=>wasmExports["convert_tensor"](BigInt(a0),BigInt(a1));var _clone_tensor=Module["_clone_tensor"]=(a0,a1)=>wasmExports["clone_tensor"](BigInt(a0),BigInt(a1));var _create_view=Module["_create_view"]=(a0,a1,a2)=>wasmExports["create_view"](BigInt(a0),BigInt(a1),BigInt(a2));var _create_reshape_view=Module["_create_reshape_view"]=(a0,a1)=>wasmExports["create_reshape_view"](BigInt(a0),BigInt(a1));var _shift_view=Module["_shift_view"]=(a0,a1)=>wasmExports["shift_view"](BigInt(a0),BigInt(a1));var _init_uniform=Module["_init_uniform"]=(a0,a1,a2,a3)=>wasmExports["init_uniform"](BigInt(a0),a1,a2,a3);var _init_normal=Module["_init_normal"]=(a0,a1,a2,a3)=>wasmExports["init_normal"](BigInt(a0),a1,a2,a3);var _init_fill=Module["_init_fill"]=(a0,a1)=>wasmExports["init_fill"](BigInt(a0),a1);var _matmul=Module["_matmul"]=(a0,a1,a2)=>wasmExports["matmul"](BigInt(a0),BigInt(a1),BigInt(a2));var _matmul_acc=Module["_matmul_acc"]=(a0,a1,a2)=>wasmExports["matmul_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _dot=Module["_dot"]=(a0,a1,a2)=>wasmExports["dot"](BigInt(a0),BigInt(a1),BigInt(a2));var _dot_acc=Module["_dot_acc"]=(a0,a1,a2)=>wasmExports["dot_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _max_red_idx=Module["_max_red_idx"]=(a0)=>wasmExports["max_red_idx"](BigInt(a0));var _min_red_idx=Module["_min_red_idx"]=(a0)=>wasmExports["min_red_idx"](BigInt(a0));var _max_red_scl=Module["_max_red_scl"]=(a0)=>wasmExports["max_red_scl"](BigInt(a0));var _min_red_scl=Module["_min_red_scl"]=(a0)=>wasmExports["min_red_scl"](BigInt(a0));var _sum_red_scl=Module["_sum_red_scl"]=(a0)=>wasmExports["sum_red_scl"](BigInt(a0));var _mean_red_scl=Module["_mean_red_scl"]=(a0)=>wasmExports["mean_red_scl"](BigInt(a0));var _sum_red_tns=Module["_sum_red_tns"]=(a0,a1)=>wasmExports["sum_red_tns"](BigInt(a0),BigInt(a1));var _mean_red_tns=Module["_mean_red_tns"]=(a0,a1)=>wasmExports["mean_red_tns"](BigInt(a0),BigInt(a1));var _get_mgmt_ptr=Module["_get_mgmt_ptr"]=()=>wasmExports["get_mgmt_ptr"]();var _pool_trim=Module["_pool_trim"]=()=>wasmExports["pool_trim"]();var _set_pool_limit=Module["_set_pool_limit"]=(a0)=>wasmExports["set_pool_limit"](BigInt(a0));var _reserve_memory=Module["_reserve_memory"]=(a0)=>wasmExports["reserve_memory"](BigInt(a0));var _create_program=Module["_create_program"]=(a0)=>wasmExports["create_program"](BigInt(a0));var _free_program=Module["_free_program"]=(a0)=>wasmExports["free_program"](BigInt(a0));var _run_program=Module["_run_program"]=(a0,a1)=>wasmExports["run_program"](BigInt(a0),BigInt(a1));var _get_nops=Module["_get_nops"]=()=>wasmExports["get_nops"]();var _get_op_name=Module["_get_op_name"]=(a0)=>wasmExports["get_op_name"](BigInt(a0));var _plan_program=Module["_plan_program"]=(a0,a1)=>wasmExports["plan_program"](BigInt(a0),BigInt(a1));var _free_schedule=Module["_free_schedule"]=(a0)=>wasmExports["free_schedule"](BigInt(a0));var _run_schedule=Module["_run_schedule"]=(a0,a1)=>wasmExports["run_schedule"](BigInt(a0),BigInt(a1));var _get_parallelism=Module["_get_parallelism"]=(a0)=>wasmExports["get_parallelism"](BigInt(a0));var _create_optimizer=Module["_create_optimizer"]=(a0,a1)=>wasmExports["create_optimizer"](BigInt(a0),BigInt(a1));var _free_optimizer=Module["_free_optimizer"]=(a0)=>wasmExports["free_optimizer"](BigInt(a0));var _set_optimizer_param=Module["_set_optimizer_param"]=(a0,a1,a2,a3)=>wasmExports["set_optimizer_param"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _set_optimizer_state=Module["_set_optimizer_state"]=(a0,a1)=>wasmExports["set_optimizer_state"](BigInt(a0),BigInt(a1));var _set_optimizer_hparams=Module["_set_optimizer_hparams"]=(a0,a1,a2,a3,a4,a5)=>wasmExports["set_optimizer_hparams"](BigInt(a0),a1,a2,a3,a4,a5);var _set_optimizer_grad_clipping=Module["_set_optimizer_grad_clipping"]=(a0,a1,a2)=>wasmExports["set_optimizer_grad_clipping"](BigInt(a0),a1,a2);var _get_optimizer_grad_norm=Module["_get_optimizer_grad_norm"]=(a0)=>wasmExports["get_optimizer_grad_norm"](BigInt(a0));var _optimizer_step=Module["_optimizer_step"]=(a0)=>wasmExports["optimizer_step"](BigInt(a0));var _set_num_threads=Module["_set_num_threads"]=(a0)=>wasmExports["set_num_threads"](BigInt(a0));var _get_num_threads=Module["_get_num_threads"]=()=>wasmExports["get_num_threads"]();var _set_profiling=Module["_set_profiling"]=(a0)=>wasmExports["set_profiling"](a0);var _get_kernel_time=Module["_get_kernel_time"]=()=>wasmExports["get_kernel_time"]();var _add_brc=Module["_add_brc"]=(a0,a1,a2)=>wasmExports["add_brc"](BigInt(a0),BigInt(a1),BigInt(a2));var _add_brc_acc=Module["_add_brc_acc"]=(a0,a1,a2)=>wasmExports["add_brc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _sub_brc=Module["_sub_brc"]=(a0,a1,a2)=>wasmExports["sub_brc"](BigInt(a0),BigInt(a1),BigInt(a2));var _sub_brc_acc=Module["_sub_brc_acc"]=(a0,a1,a2)=>wasmExports["sub_brc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _mul_brc=Module["_mul_brc"]=(a0,a1,a2)=>wasmExports["mul_brc"](BigInt(a0),BigInt(a1),BigInt(a2));var _mul_brc_acc=Module["_mul_brc_acc"]=(a0,a1,a2)=>wasmExports["mul_brc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _div_brc=Module["_div_brc"]=(a0,a1,a2)=>wasmExports["div_brc"](BigInt(a0),BigInt(a1),BigInt(a2));var _div_brc_acc=Module["_div_brc_acc"]=(a0,a1,a2)=>wasmExports["div_brc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _pow_brc=Module["_pow_brc"]=(a0,a1,a2)=>wasmExports["pow_brc"](BigInt(a0),BigInt(a1),BigInt(a2));var _pow_brc_acc=Module["_pow_brc_acc"]=(a0,a1,a2)=>wasmExports["pow_brc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _bw_div_b=Module["_bw_div_b"]=(a0,a1,a2,a3)=>wasmExports["bw_div_b"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _bw_div_b_acc=Module["_bw_div_b_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_div_b_acc"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _bw_pow_a=Module["_bw_pow_a"]=(a0,a1,a2,a3)=>wasmExports["bw_pow_a"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _bw_pow_a_acc=Module["_bw_pow_a_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_pow_a_acc"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _bw_pow_b=Module["_bw_pow_b"]=(a0,a1,a2,a3)=>wasmExports["bw_pow_b"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _bw_pow_b_acc=Module["_bw_pow_b_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_pow_b_acc"](BigInt(a0),BigInt(a1),BigInt(a2),BigInt(a3));var _add_dbrc=Module["_add_dbrc"]=(a0,a1,a2)=>wasmExports["add_dbrc"](BigInt(a0),BigInt(a1),BigInt(a2));var _add_dbrc_acc=Module["_add_dbrc_acc"]=(a0,a1,a2)=>wasmExports["add_dbrc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _sub_dbrc=Module["_sub_dbrc"]=(a0,a1,a2)=>wasmExports["sub_dbrc"](BigInt(a0),BigInt(a1),BigInt(a2));var _sub_dbrc_acc=Module["_sub_dbrc_acc"]=(a0,a1,a2)=>wasmExports["sub_dbrc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _mul_dbrc=Module["_mul_dbrc"]=(a0,a1,a2)=>wasmExports["mul_dbrc"](BigInt(a0),BigInt(a1),BigInt(a2));var _mul_dbrc_acc=Module["_mul_dbrc_acc"]=(a0,a1,a2)=>wasmExports["mul_dbrc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _div_dbrc=Module["_div_dbrc"]=(a0,a1,a2)=>wasmExports["div_dbrc"](BigInt(a0),BigInt(a1),BigInt(a2));var _div_dbrc_acc=Module["_div_dbrc_acc"]=(a0,a1,a2)=>wasmExports["div_dbrc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _pow_dbrc=Module["_pow_dbrc"]=(a0,a1,a2)=>wasmExports["pow_dbrc"](BigInt(a0),BigInt(a1),BigInt(a2));var _pow_dbrc_acc=Module["_pow_dbrc_acc"]=(a0,a1,a2)=>wasmExports["pow_dbrc_acc"](BigInt(a0),BigInt(a1),BigInt(a2));var _dropout=Module["_dropout"]=(a0,a1,a2,a3)=>wasmExports["dropout"](BigInt(a0),BigInt(a1),a2,a3);var _dropout_acc=Module["_dropout_acc"]=(a0,a1,a2,a3)=>wasmExports["dropout_acc"](BigInt(a0),BigInt(a1),a2,a3);var _sin_brc=Module["_sin_brc"]=(a0,a1,a2)=>wasmExports["sin_brc"](BigInt(a0),BigInt(a1),a2);var _sin_brc_acc=Module["_sin_brc_acc"]=(a0,a1,a2)=>wasmExports["sin_brc_acc"](BigInt(a0),BigInt(a1),a2);var _cos_brc=Module["_cos_brc"]=(a0,a1,a2)=>wasmExports["cos_brc"](BigInt(a0),BigInt(a1),a2);var _cos_brc_acc=Module["_cos_brc_acc"]=(a0,a1,a2)=>wasmExports["cos_brc_acc"](BigInt(a0),BigInt(a1),a2);var _tan_brc=Module["_tan_brc"]=(a0,a1,a2)=>wasmExports["tan_brc"](BigInt(a0),BigInt(a1),a2);var _tan_brc_acc=Module["_tan_brc_acc"]=(a0,a1,a2)=>wasmExports["tan_brc_acc"](BigInt(a0),BigInt(a1),a2);var _asin_brc=Module["_asin_brc"]=(a0,a1,a2)=>wasmExports["asin_brc"](BigInt(a0),BigInt(a1),a2);var _asin_brc_acc=Module["_asin_brc_acc"]=(a0,a1,a2)=>wasmExports["asin_brc_acc"](BigInt(a0),BigInt(a1),a2);var _acos_brc=Module["_acos_brc"]=(a0,a1,a2)=>wasmExports["acos_brc"](BigInt(a0),BigInt(a1),a2);var _acos_brc_acc=Module["_acos_brc_acc"]=(a0,a1,a2)=>wasmExports["acos_brc_acc"](BigInt(a0),BigInt(a1),a2);var _atan_brc=Module["_atan_brc"]=(a0,a1,a2)=>wasmExports["atan_brc"](BigInt(a0),BigInt(a1),a2);var _atan_brc_acc=Module["_atan_brc_acc"]=(a0,a1,a2)=>wasmExports["atan_brc_acc"](BigInt(a0),BigInt(a1),a2);var _sinh_brc=Module["_sinh_brc"]=(a0,a1,a2)=>wasmExports["sinh_brc"](BigInt(a0),BigInt(a1),a2);var _sinh_brc_acc=Module["_sinh_brc_acc"]=(a0,a1,a2)=>wasmExports["sinh_brc_acc"](BigInt(a0),BigInt(a1),a2);var _cosh_brc=Module["_cosh_brc"]=(a0,a1,a2)=>wasmExports["cosh_brc"](BigInt(a0),BigInt(a1),a2);var _cosh_brc_acc=Module["_cosh_brc_acc"]=(a0,a1,a2)=>wasmExports["cosh_brc_acc"](BigInt(a0),BigInt(a1),a2);var _tanh_brc=Module["_tanh_brc"]=(a0,a1,a2)=>wasmExports["tanh_brc"](BigInt(a0),BigInt(a1),a2);var _tanh_brc_acc=Module["_tanh_brc_acc"]=(a0,a1,a2)=>wasmExports["tanh_brc_acc"](BigInt(a0),BigInt(a1),a2);var _exp_brc=Module["_exp_brc"]=(a0,a1,a2)=>wasmExports["exp_brc"](BigInt(a0),BigInt(a1),a2);var _exp_brc_acc=Module["_exp_brc_acc"]=(a0,a1,a2)=>wasmExports["exp_brc_acc"](BigInt(a0),BigInt(a1),a2);var _log_brc=Module["_log_brc"]=(a0,a1,a2)=>wasmExports["log_brc"](BigInt(a0),BigInt(a1),a2);var _log_brc_acc=Module["_log_brc_acc"]=(a0,a1,a2)=>wasmExports["log_brc_acc"](BigInt(a0),BigInt(a1),a2);var _log2_brc=Module["_log2_brc"]=(a0,a1,a2)=>wasmExports["log2_brc"](BigInt(a0),BigInt(a1),a2);var _log2_brc_acc=Module["_log2_brc_acc"]=(a0,a1,a2)=>wasmExports["log2_brc_acc"](BigInt(a0),BigInt(a1),a2);var _log10_brc=Module["_log10_brc"]=(a0,a1,a2)=>wasmExports["log10_brc"](BigInt(a0),BigInt(a1),a2);var _log10_brc_acc=Module["_log10_brc_acc"]=(a0,a1,a2)=>wasmExports["log10_brc_acc"](BigInt(a0),BigInt(a1),a2);var _invsqrt_brc=Module["_invsqrt_brc"]=(a0,a1,a2)=>wasmExports["invsqrt_brc"](BigInt(a0),BigInt(a1),a2);var _invsqrt_brc_acc=Module["_invsqrt_brc_acc"]=(a0,a1,a2)=>wasmExports["invsqrt_brc_acc"](BigInt(a0),BigInt(a1),a2);var _sqrt_brc=Module["_sqrt_brc"]=(a0,a1,a2)=>wasmExports["sqrt_brc"](BigInt(a0),BigInt(a1),a2);var _sqrt_brc_acc=Module["_sqrt_brc_acc"]=(a0,a1,a2)=>wasmExports["sqrt_brc_acc"](BigInt(a0),BigInt(a1),a2);var _ceil_brc=Module["_ceil_brc"]=(a0,a1,a2)=>wasmExports["ceil_brc"](BigInt(a0),BigInt(a1),a2);var _ceil_brc_acc=Module["_ceil_brc_acc"]=(a0,a1,a2)=>wasmExports["ceil_brc_acc"](BigInt(a0),BigInt(a1),a2);var _floor_brc=Module["_floor_brc"]=(a0,a1,a2)=>wasmExports["floor_brc"](BigInt(a0),BigInt(a1),a2);var _floor_brc_acc=Module["_floor_brc_acc"]=(a0,a1,a2)=>wasmExports["floor_brc_acc"](BigInt(a0),BigInt(a1),a2);var _abs_brc=Module["_abs_brc"]=(a0,a1,a2)=>wasmExports["abs_brc"](BigInt(a0),BigInt(a1),a2);var _abs_brc_acc=Module["_abs_brc_acc"]=(a0,a1,a2)=>wasmExports["abs_brc_acc"](BigInt(a0),BigInt(a1),a2);var _sign_brc=Module["_sign_brc"]=(a0,a1,a2)=>wasmExports["sign_brc"](BigInt(a0),BigInt(a1),a2);var _sign_brc_acc=Module["_sign_brc_acc"]=(a0,a1,a2)=>wasmExports["sign_brc_acc"](BigInt(a0),BigInt(a1),a2);var _negate_brc=Module["_negate_brc"]=(a0,a1,a2)=>wasmExports["negate_brc"](BigInt(a0),BigInt(a1),a2);var _negate_brc_acc=Module["_negate_brc_acc"]=(a0,a1,a2)=>wasmExports["negate_brc_acc"](BigInt(a0),BigInt(a1),a2);var _identity_brc=Module["_identity_brc"]=(a0,a1,a2)=>wasmExports["identity_brc"](BigInt(a0),BigInt(a1),a2);var _identity_brc_acc=Module["_identity_brc_acc"]=(a0,a1,a2)=>wasmExports["identity_brc_acc"](BigInt(a0),BigInt(a1),a2);var _reciprocal_brc=Module["_reciprocal_brc"]=(a0,a1,a2)=>wasmExports["reciprocal_brc"](BigInt(a0),BigInt(a1),a2);var _reciprocal_brc_acc=Module["_reciprocal_brc_acc"]=(a0,a1,a2)=>wasmExports["reciprocal_brc_acc"](BigInt(a0),BigInt(a1),a2);var _relu_brc=Module["_relu_brc"]=(a0,a1,a2)=>wasmExports["relu_brc"](BigInt(a0),BigInt(a1),a2);var _relu_brc_acc=Module["_relu_brc_acc"]=(a0,a1,a2)=>wasmExports["relu_brc_acc"](BigInt(a0),BigInt(a1),a2);var _leaky_relu_brc=Module["_leaky_relu_brc"]=(a0,a1,a2)=>wasmExports["leaky_relu_brc"](BigInt(a0),BigInt(a1),a2);var _leaky_relu_brc_acc=Module["_leaky_relu_brc_acc"]=(a0,a1,a2)=>wasmExports["leaky_relu_brc_acc"](BigInt(a0),BigInt(a1),a2);var _binstep_brc=Module["_binstep_brc"]=(a0,a1,a2)=>wasmExports["binstep_brc"](BigInt(a0),BigInt(a1),a2);var _binstep_brc_acc=Module["_binstep_brc_acc"]=(a0,a1,a2)=>wasmExports["binstep_brc_acc"](BigInt(a0),BigInt(a1),a2);var _logistic_brc=Module["_logistic_brc"]=(a0,a1,a2)=>wasmExports["logistic_brc"](BigInt(a0),BigInt(a1),a2);var _logistic_brc_acc=Module["_logistic_brc_acc"]=(a0,a1,a2)=>wasmExports["logistic_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_sin_brc=Module["_df_sin_brc"]=(a0,a1,a2)=>wasmExports["df_sin_brc"](BigInt(a0),BigInt(a1),a2);var _df_sin_brc_acc=Module["_df_sin_brc_acc"]=(a0,a1,a2)=>wasmExports["df_sin_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_cos_brc=Module["_df_cos_brc"]=(a0,a1,a2)=>wasmExports["df_cos_brc"](BigInt(a0),BigInt(a1),a2);var _df_cos_brc_acc=Module["_df_cos_brc_acc"]=(a0,a1,a2)=>wasmExports["df_cos_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_tan_brc=Module["_df_tan_brc"]=(a0,a1,a2)=>wasmExports["df_tan_brc"](BigInt(a0),BigInt(a1),a2);var _df_tan_brc_acc=Module["_df_tan_brc_acc"]=(a0,a1,a2)=>wasmExports["df_tan_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_asin_brc=Module["_df_asin_brc"]=(a0,a1,a2)=>wasmExports["df_asin_brc"](BigInt(a0),BigInt(a1),a2);var _df_asin_brc_acc=Module["_df_asin_brc_acc"]=(a0,a1,a2)=>wasmExports["df_asin_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_acos_brc=Module["_df_acos_brc"]=(a0,a1,a2)=>wasmExports["df_acos_brc"](BigInt(a0),BigInt(a1),a2);var _df_acos_brc_acc=Module["_df_acos_brc_acc"]=(a0,a1,a2)=>wasmExports["df_acos_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_atan_brc=Module["_df_atan_brc"]=(a0,a1,a2)=>wasmExports["df_atan_brc"](BigInt(a0),BigInt(a1),a2);var _df_atan_brc_acc=Module["_df_atan_brc_acc"]=(a0,a1,a2)=>wasmExports["df_atan_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_sinh_brc=Module["_df_sinh_brc"]=(a0,a1,a2)=>wasmExports["df_sinh_brc"](BigInt(a0),BigInt(a1),a2);var _df_sinh_brc_acc=Module["_df_sinh_brc_acc"]=(a0,a1,a2)=>wasmExports["df_sinh_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_cosh_brc=Module["_df_cosh_brc"]=(a0,a1,a2)=>wasmExports["df_cosh_brc"](BigInt(a0),BigInt(a1),a2);var _df_cosh_brc_acc=Module["_df_cosh_brc_acc"]=(a0,a1,a2)=>wasmExports["df_cosh_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_tanh_brc=Module["_df_tanh_brc"]=(a0,a1,a2)=>wasmExports["df_tanh_brc"](BigInt(a0),BigInt(a1),a2);var _df_tanh_brc_acc=Module["_df_tanh_brc_acc"]=(a0,a1,a2)=>wasmExports["df_tanh_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_log_brc=Module["_df_log_brc"]=(a0,a1,a2)=>wasmExports["df_log_brc"](BigInt(a0),BigInt(a1),a2);var _df_log_brc_acc=Module["_df_log_brc_acc"]=(a0,a1,a2)=>wasmExports["df_log_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_log2_brc=Module["_df_log2_brc"]=(a0,a1,a2)=>wasmExports["df_log2_brc"](BigInt(a0),BigInt(a1),a2);var _df_log2_brc_acc=Module["_df_log2_brc_acc"]=(a0,a1,a2)=>wasmExports["df_log2_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_log10_brc=Module["_df_log10_brc"]=(a0,a1,a2)=>wasmExports["df_log10_brc"](BigInt(a0),BigInt(a1),a2);var _df_log10_brc_acc=Module["_df_log10_brc_acc"]=(a0,a1,a2)=>wasmExports["df_log10_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_invsqrt_brc=Module["_df_invsqrt_brc"]=(a0,a1,a2)=>wasmExports["df_invsqrt_brc"](BigInt(a0),BigInt(a1),a2);var _df_invsqrt_brc_acc=Module["_df_invsqrt_brc_acc"]=(a0,a1,a2)=>wasmExports["df_invsqrt_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_sqrt_brc=Module["_df_sqrt_brc"]=(a0,a1,a2)=>wasmExports["df_sqrt_brc"](BigInt(a0),BigInt(a1),a2);var _df_sqrt_brc_acc=Module["_df_sqrt_brc_acc"]=(a0,a1,a2)=>wasmExports["df_sqrt_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_abs_brc=Module["_df_abs_brc"]=(a0,a1,a2)=>wasmExports["df_abs_brc"](BigInt(a0),BigInt(a1),a2);var _df_abs_brc_acc=Module["_df_abs_brc_acc"]=(a0,a1,a2)=>wasmExports["df_abs_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_negate_brc=Module["_df_negate_brc"]=(a0,a1,a2)=>wasmExports["df_negate_brc"](BigInt(a0),BigInt(a1),a2);var _df_negate_brc_acc=Module["_df_negate_brc_acc"]=(a0,a1,a2)=>wasmExports["df_negate_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_reciprocal_brc=Module["_df_reciprocal_brc"]=(a0,a1,a2)=>wasmExports["df_reciprocal_brc"](BigInt(a0),BigInt(a1),a2);var _df_reciprocal_brc_acc=Module["_df_reciprocal_brc_acc"]=(a0,a1,a2)=>wasmExports["df_reciprocal_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_relu_brc=Module["_df_relu_brc"]=(a0,a1,a2)=>wasmExports["df_relu_brc"](BigInt(a0),BigInt(a1),a2);var _df_relu_brc_acc=Module["_df_relu_brc_acc"]=(a0,a1,a2)=>wasmExports["df_relu_brc_acc"](BigInt(a0),BigInt(a1),a2);var _df_leaky_relu_brc=Module["_df_leaky_relu_brc"]=(a0,a1,a2)=>wasmExports["df_leaky_relu_brc"](BigInt(a0),BigInt(a1),a2);var _df_leaky_relu_brc_acc=Module["_df_leaky_relu_brc_acc"]=(a0,a1,a2)=>wasmExports["df_leaky_relu_brc_acc"](BigInt(a0),BigInt(a1),a2);var _bw_sin=Module["_bw_sin"]=(a0,a1,a2,a3)=>wasmExports["bw_sin"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_sin_acc=Module["_bw_sin_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_sin_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_cos=Module["_bw_cos"]=(a0,a1,a2,a3)=>wasmExports["bw_cos"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_cos_acc=Module["_bw_cos_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_cos_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_tan=Module["_bw_tan"]=(a0,a1,a2,a3)=>wasmExports["bw_tan"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_tan_acc=Module["_bw_tan_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_tan_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_asin=Module["_bw_asin"]=(a0,a1,a2,a3)=>wasmExports["bw_asin"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_asin_acc=Module["_bw_asin_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_asin_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_acos=Module["_bw_acos"]=(a0,a1,a2,a3)=>wasmExports["bw_acos"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_acos_acc=Module["_bw_acos_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_acos_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_atan=Module["_bw_atan"]=(a0,a1,a2,a3)=>wasmExports["bw_atan"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_atan_acc=Module["_bw_atan_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_atan_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_sinh=Module["_bw_sinh"]=(a0,a1,a2,a3)=>wasmExports["bw_sinh"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_sinh_acc=Module["_bw_sinh_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_sinh_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_cosh=Module["_bw_cosh"]=(a0,a1,a2,a3)=>wasmExports["bw_cosh"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_cosh_acc=Module["_bw_cosh_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_cosh_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_tanh=Module["_bw_tanh"]=(a0,a1,a2,a3)=>wasmExports["bw_tanh"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_tanh_acc=Module["_bw_tanh_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_tanh_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_exp=Module["_bw_exp"]=(a0,a1,a2,a3)=>wasmExports["bw_exp"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_exp_acc=Module["_bw_exp_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_exp_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_logistic=Module["_bw_logistic"]=(a0,a1,a2,a3)=>wasmExports["bw_logistic"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_logistic_acc=Module["_bw_logistic_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_logistic_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_log=Module["_bw_log"]=(a0,a1,a2,a3)=>wasmExports["bw_log"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_log_acc=Module["_bw_log_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_log_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_log2=Module["_bw_log2"]=(a0,a1,a2,a3)=>wasmExports["bw_log2"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_log2_acc=Module["_bw_log2_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_log2_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_log10=Module["_bw_log10"]=(a0,a1,a2,a3)=>wasmExports["bw_log10"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_log10_acc=Module["_bw_log10_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_log10_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_invsqrt=Module["_bw_invsqrt"]=(a0,a1,a2,a3)=>wasmExports["bw_invsqrt"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_invsqrt_acc=Module["_bw_invsqrt_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_invsqrt_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_sqrt=Module["_bw_sqrt"]=(a0,a1,a2,a3)=>wasmExports["bw_sqrt"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_sqrt_acc=Module["_bw_sqrt_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_sqrt_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_abs=Module["_bw_abs"]=(a0,a1,a2,a3)=>wasmExports["bw_abs"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_abs_acc=Module["_bw_abs_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_abs_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_reciprocal=Module["_bw_reciprocal"]=(a0,a1,a2,a3)=>wasmExports["bw_reciprocal"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_reciprocal_acc=Module["_bw_reciprocal_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_reciprocal_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_relu=Module["_bw_relu"]=(a0,a1,a2,a3)=>wasmExports["bw_relu"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_relu_acc=Module["_bw_relu_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_relu_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_leaky_relu=Module["_bw_leaky_relu"]=(a0,a1,a2,a3)=>wasmExports["bw_leaky_relu"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _bw_leaky_relu_acc=Module["_bw_leaky_relu_acc"]=(a0,a1,a2,a3)=>wasmExports["bw_leaky_relu_acc"](BigInt(a0),BigInt(a1),BigInt(a2),a3);var _sin_dbrc=Module["_sin_dbrc"]=(a0,a1,a2)=>wasmExports["sin_dbrc"](BigInt(a0),BigInt(a1),a2);var _sin_dbrc_acc=Module["_sin_dbrc_acc"]=(a0,a1,a2)=>wasmExports["sin_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _cos_dbrc=Module["_cos_dbrc"]=(a0,a1,a2)=>wasmExports["cos_dbrc"](BigInt(a0),BigInt(a1),a2);var _cos_dbrc_acc=Module["_cos_dbrc_acc"]=(a0,a1,a2)=>wasmExports["cos_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _tan_dbrc=Module["_tan_dbrc"]=(a0,a1,a2)=>wasmExports["tan_dbrc"](BigInt(a0),BigInt(a1),a2);var _tan_dbrc_acc=Module["_tan_dbrc_acc"]=(a0,a1,a2)=>wasmExports["tan_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _asin_dbrc=Module["_asin_dbrc"]=(a0,a1,a2)=>wasmExports["asin_dbrc"](BigInt(a0),BigInt(a1),a2);var _asin_dbrc_acc=Module["_asin_dbrc_acc"]=(a0,a1,a2)=>wasmExports["asin_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _acos_dbrc=Module["_acos_dbrc"]=(a0,a1,a2)=>wasmExports["acos_dbrc"](BigInt(a0),BigInt(a1),a2);var _acos_dbrc_acc=Module["_acos_dbrc_acc"]=(a0,a1,a2)=>wasmExports["acos_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _atan_dbrc=Module["_atan_dbrc"]=(a0,a1,a2)=>wasmExports["atan_dbrc"](BigInt(a0),BigInt(a1),a2);var _atan_dbrc_acc=Module["_atan_dbrc_acc"]=(a0,a1,a2)=>wasmExports["atan_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _sinh_dbrc=Module["_sinh_dbrc"]=(a0,a1,a2)=>wasmExports["sinh_dbrc"](BigInt(a0),BigInt(a1),a2);var _sinh_dbrc_acc=Module["_sinh_dbrc_acc"]=(a0,a1,a2)=>wasmExports["sinh_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _cosh_dbrc=Module["_cosh_dbrc"]=(a0,a1,a2)=>wasmExports["cosh_dbrc"](BigInt(a0),BigInt(a1),a2);var _cosh_dbrc_acc=Module["_cosh_dbrc_acc"]=(a0,a1,a2)=>wasmExports["cosh_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _tanh_dbrc=Module["_tanh_dbrc"]=(a0,a1,a2)=>wasmExports["tanh_dbrc"](BigInt(a0),BigInt(a1),a2);var _tanh_dbrc_acc=Module["_tanh_dbrc_acc"]=(a0,a1,a2)=>wasmExports["tanh_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _exp_dbrc=Module["_exp_dbrc"]=(a0,a1,a2)=>wasmExports["exp_dbrc"](BigInt(a0),BigInt(a1),a2);var _exp_dbrc_acc=Module["_exp_dbrc_acc"]=(a0,a1,a2)=>wasmExports["exp_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _log_dbrc=Module["_log_dbrc"]=(a0,a1,a2)=>wasmExports["log_dbrc"](BigInt(a0),BigInt(a1),a2);var _log_dbrc_acc=Module["_log_dbrc_acc"]=(a0,a1,a2)=>wasmExports["log_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _log2_dbrc=Module["_log2_dbrc"]=(a0,a1,a2)=>wasmExports["log2_dbrc"](BigInt(a0),BigInt(a1),a2);var _log2_dbrc_acc=Module["_log2_dbrc_acc"]=(a0,a1,a2)=>wasmExports["log2_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _log10_dbrc=Module["_log10_dbrc"]=(a0,a1,a2)=>wasmExports["log10_dbrc"](BigInt(a0),BigInt(a1),a2);var _log10_dbrc_acc=Module["_log10_dbrc_acc"]=(a0,a1,a2)=>wasmExports["log10_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _invsqrt_dbrc=Module["_invsqrt_dbrc"]=(a0,a1,a2)=>wasmExports["invsqrt_dbrc"](BigInt(a0),BigInt(a1),a2);var _invsqrt_dbrc_acc=Module["_invsqrt_dbrc_acc"]=(a0,a1,a2)=>wasmExports["invsqrt_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _sqrt_dbrc=Module["_sqrt_dbrc"]=(a0,a1,a2)=>wasmExports["sqrt_dbrc"](BigInt(a0),BigInt(a1),a2);var _sqrt_dbrc_acc=Module["_sqrt_dbrc_acc"]=(a0,a1,a2)=>wasmExports["sqrt_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _ceil_dbrc=Module["_ceil_dbrc"]=(a0,a1,a2)=>wasmExports["ceil_dbrc"](BigInt(a0),BigInt(a1),a2);var _ceil_dbrc_acc=Module["_ceil_dbrc_acc"]=(a0,a1,a2)=>wasmExports["ceil_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _floor_dbrc=Module["_floor_dbrc"]=(a0,a1,a2)=>wasmExports["floor_dbrc"](BigInt(a0),BigInt(a1),a2);var _floor_dbrc_acc=Module["_floor_dbrc_acc"]=(a0,a1,a2)=>wasmExports["floor_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _abs_dbrc=Module["_abs_dbrc"]=(a0,a1,a2)=>wasmExports["abs_dbrc"](BigInt(a0),BigInt(a1),a2);var _abs_dbrc_acc=Module["_abs_dbrc_acc"]=(a0,a1,a2)=>wasmExports["abs_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _sign_dbrc=Module["_sign_dbrc"]=(a0,a1,a2)=>wasmExports["sign_dbrc"](BigInt(a0),BigInt(a1),a2);var _sign_dbrc_acc=Module["_sign_dbrc_acc"]=(a0,a1,a2)=>wasmExports["sign_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _negate_dbrc=Module["_negate_dbrc"]=(a0,a1,a2)=>wasmExports["negate_dbrc"](BigInt(a0),BigInt(a1),a2);var _negate_dbrc_acc=Module["_negate_dbrc_acc"]=(a0,a1,a2)=>wasmExports["negate_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _identity_dbrc=Module["_identity_dbrc"]=(a0,a1,a2)=>wasmExports["identity_dbrc"](BigInt(a0),BigInt(a1),a2);var _identity_dbrc_acc=Module["_identity_dbrc_acc"]=(a0,a1,a2)=>wasmExports["identity_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _reciprocal_dbrc=Module["_reciprocal_dbrc"]=(a0,a1,a2)=>wasmExports["reciprocal_dbrc"](BigInt(a0),BigInt(a1),a2);var _reciprocal_dbrc_acc=Module["_reciprocal_dbrc_acc"]=(a0,a1,a2)=>wasmExports["reciprocal_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _relu_dbrc=Module["_relu_dbrc"]=(a0,a1,a2)=>wasmExports["relu_dbrc"](BigInt(a0),BigInt(a1),a2);var _relu_dbrc_acc=Module["_relu_dbrc_acc"]=(a0,a1,a2)=>wasmExports["relu_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _leaky_relu_dbrc=Module["_leaky_relu_dbrc"]=(a0,a1,a2)=>wasmExports["leaky_relu_dbrc"](BigInt(a0),BigInt(a1),a2);var _leaky_relu_dbrc_acc=Module["_leaky_relu_dbrc_acc"]=(a0,a1,a2)=>wasmExports["leaky_relu_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _binstep_dbrc=Module["_binstep_dbrc"]=(a0,a1,a2)=>wasmExports["binstep_dbrc"](BigInt(a0),BigInt(a1),a2);var _binstep_dbrc_acc=Module["_binstep_dbrc_acc"]=(a0,a1,a2)=>wasmExports["binstep_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _logistic_dbrc=Module["_logistic_dbrc"]=(a0,a1,a2)=>wasmExports["logistic_dbrc"](BigInt(a0),BigInt(a1),a2);var _logistic_dbrc_acc=Module["_logistic_dbrc_acc"]=(a0,a1,a2)=>wasmExports["logistic_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_sin_dbrc=Module["_df_sin_dbrc"]=(a0,a1,a2)=>wasmExports["df_sin_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_sin_dbrc_acc=Module["_df_sin_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_sin_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_cos_dbrc=Module["_df_cos_dbrc"]=(a0,a1,a2)=>wasmExports["df_cos_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_cos_dbrc_acc=Module["_df_cos_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_cos_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_tan_dbrc=Module["_df_tan_dbrc"]=(a0,a1,a2)=>wasmExports["df_tan_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_tan_dbrc_acc=Module["_df_tan_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_tan_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_asin_dbrc=Module["_df_asin_dbrc"]=(a0,a1,a2)=>wasmExports["df_asin_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_asin_dbrc_acc=Module["_df_asin_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_asin_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_acos_dbrc=Module["_df_acos_dbrc"]=(a0,a1,a2)=>wasmExports["df_acos_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_acos_dbrc_acc=Module["_df_acos_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_acos_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_atan_dbrc=Module["_df_atan_dbrc"]=(a0,a1,a2)=>wasmExports["df_atan_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_atan_dbrc_acc=Module["_df_atan_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_atan_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_sinh_dbrc=Module["_df_sinh_dbrc"]=(a0,a1,a2)=>wasmExports["df_sinh_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_sinh_dbrc_acc=Module["_df_sinh_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_sinh_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_cosh_dbrc=Module["_df_cosh_dbrc"]=(a0,a1,a2)=>wasmExports["df_cosh_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_cosh_dbrc_acc=Module["_df_cosh_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_cosh_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_tanh_dbrc=Module["_df_tanh_dbrc"]=(a0,a1,a2)=>wasmExports["df_tanh_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_tanh_dbrc_acc=Module["_df_tanh_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_tanh_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_log_dbrc=Module["_df_log_dbrc"]=(a0,a1,a2)=>wasmExports["df_log_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_log_dbrc_acc=Module["_df_log_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_log_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_log2_dbrc=Module["_df_log2_dbrc"]=(a0,a1,a2)=>wasmExports["df_log2_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_log2_dbrc_acc=Module["_df_log2_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_log2_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_log10_dbrc=Module["_df_log10_dbrc"]=(a0,a1,a2)=>wasmExports["df_log10_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_log10_dbrc_acc=Module["_df_log10_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_log10_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_invsqrt_dbrc=Module["_df_invsqrt_dbrc"]=(a0,a1,a2)=>wasmExports["df_invsqrt_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_invsqrt_dbrc_acc=Module["_df_invsqrt_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_invsqrt_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_sqrt_dbrc=Module["_df_sqrt_dbrc"]=(a0,a1,a2)=>wasmExports["df_sqrt_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_sqrt_dbrc_acc=Module["_df_sqrt_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_sqrt_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_abs_dbrc=Module["_df_abs_dbrc"]=(a0,a1,a2)=>wasmExports["df_abs_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_abs_dbrc_acc=Module["_df_abs_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_abs_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_negate_dbrc=Module["_df_negate_dbrc"]=(a0,a1,a2)=>wasmExports["df_negate_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_negate_dbrc_acc=Module["_df_negate_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_negate_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_reciprocal_dbrc=Module["_df_reciprocal_dbrc"]=(a0,a1,a2)=>wasmExports["df_reciprocal_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_reciprocal_dbrc_acc=Module["_df_reciprocal_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_reciprocal_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_relu_dbrc=Module["_df_relu_dbrc"]=(a0,a1,a2)=>wasmExports["df_relu_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_relu_dbrc_acc=Module["_df_relu_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_relu_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _df_leaky_relu_dbrc=Module["_df_leaky_relu_dbrc"]=(a0,a1,a2)=>wasmExports["df_leaky_relu_dbrc"](BigInt(a0),BigInt(a1),a2);var _df_leaky_relu_dbrc_acc=Module["_df_leaky_relu_dbrc_acc"]=(a0,a1,a2)=>wasmExports["df_leaky_relu_dbrc_acc"](BigInt(a0),BigInt(a1),a2);var _sin_prw=Module["_sin_prw"]=(a0,a1,a2)=>wasmExports["sin_prw"](BigInt(a0),BigInt(a1),a2);var _sin_prw_acc=Module["_sin_prw_acc"]=(a0,a1,a2)=>wasmExports["sin_prw_acc"](BigInt(a0),BigInt(a1),a2);var _cos_prw=Module["_cos_prw"]=(a0,a1,a2)=>wasmExports["cos_prw"](BigInt(a0),BigInt(a1),a2);var _cos_prw_acc=Module["_cos_prw_acc"]=(a0,a1,a2)=>wasmExports["cos_prw_acc"](BigInt(a0),BigInt(a1),a2);var _tan_prw=Module["_tan_prw"]=(a0,a1,a2)=>wasmExports["tan_prw"](BigInt(a0),BigInt(a1),a2);var _tan_prw_acc=Module["_tan_prw_acc"]=(a0,a1,a2)=>wasmExports["tan_prw_acc"](BigInt(a0),BigInt(a1),a2);var _asin_prw=Module["_asin_prw"]=(a0,a1,a2)=>wasmExports["asin_prw"](BigInt(a0),BigInt(a1),a2);var _asin_prw_acc=Module["_asin_prw_acc"]=(a0,a1,a2)=>wasmExports["asin_prw_acc"](BigInt(a0),BigInt(a1),a2);var _acos_prw=Module["_acos_prw"]=(a0,a1,a2)=>wasmExports["acos_prw"](BigInt(a0),BigInt(a1),a2);var _acos_prw_acc=Module["_acos_prw_acc"]=(a0,a1,a2)=>wasmExports["acos_prw_acc"](BigInt(a0),BigInt(a1),a2);var _atan_prw=Module["_atan_prw"]=(a0,a1,a2)=>wasmExports["atan_prw"](BigInt(a0),BigInt(a1),a2);var _atan_prw_acc=Module["_atan_prw_acc"]=(a0,a1,a2)=>wasmExports["atan_prw_acc"](BigInt(a0),BigInt(a1),a2);var _sinh_prw=Module["_sinh_prw"]=(a0,a1,a2)=>wasmExports["sinh_prw"](BigInt(a0),BigInt(a1),a2);var _sinh_prw_acc=Module["_sinh_prw_acc"]=(a0,a1,a2)=>wasmExports["sinh_prw_acc"](BigInt(a0),BigInt(a1),a2);var _cosh_prw=Module["_cosh_prw"]=(a0,a1,a2)=>wasmExports["cosh_prw"](BigInt(a0),BigInt(a1),a2);var _cosh_prw_acc=Module["_cosh_prw_acc"]=(a0,a1,a2)=>wasmExports["cosh_prw_acc"](BigInt(a0),BigInt(a1),a2);var _tanh_prw=Module["_tanh_prw"]=(a0,a1,a2)=>wasmExports["tanh_prw"](BigInt(a0),BigInt(a1),a2);var _tanh_prw_acc=Module["_tanh_prw_acc"]=(a0,a1,a2)=>wasmExports["tanh_prw_acc"](BigInt(a0),BigInt(a1),a2);var _exp_prw=Module["_exp_prw"]=(a0,a1,a2)=>wasmExports["exp_prw"](BigInt(a0),BigInt(a1),a2);var _exp_prw_acc=Module["_exp_prw_acc"]=(a0,a1,a2)=>wasmExports["exp_prw_acc"](BigInt(a0),BigInt(a1),a2);var _log_prw=Module["_log_prw"]=(a0,a1,a2)=>wasmExports["log_prw"](BigInt(a0),BigInt(a1),a2);var _log_prw_acc=Module["_log_prw_acc"]=(a0,a1,a2)=>wasmExports["log_prw_acc"](BigInt(a0),BigInt(a1),a2);var _log2_prw=Module["_log2_prw"]=(a0,a1,a2)=>wasmExports["log2_prw"](BigInt(a0),BigInt(a1),a2);var _log2_prw_acc=Module["_log2_prw_acc"]=(a0,a1,a2)=>wasmExports["log2_prw_acc"](BigInt(a0),BigInt(a1),a2);var _log10_prw=Module["_log10_prw"]=(a0,a1,a2)=>wasmExports["log10_prw"](BigInt(a0),BigInt(a1),a2);var _log10_prw_acc=Module["_log10_prw_acc"]=(a0,a1,a2)=>wasmExports["log10_prw_acc"](BigInt(a0),BigInt(a1),a2);var _invsqrt_prw=Module["_invsqrt_prw"]=(a0,a1,a2)=>wasmExports["invsqrt_prw"](BigInt(a0),BigInt(a1),a2);var _invsqrt_prw_acc=Module["_invsqrt_prw_acc"]=(a0,a1,a2)=>wasmExports["invsqrt_prw_acc"](BigInt(a0),BigInt(a1),a2);var _sqrt_prw=Module["_sqrt_prw"]=(a0,a1,a2)=>wasmExports["sqrt_prw"](BigInt(a0),BigInt(a1),a2);var _sqrt_prw_acc=Module["_sqrt_prw_acc"]=(a0,a1,a2)=>wasmExports["sqrt_prw_acc"](BigInt(a0),BigInt(a1),a2);var _ceil_prw=Module["_ceil_prw"]=(a0,a1,a2)=>wasmExports["ceil_prw"](BigInt(a0),BigInt(a1),a2);var _ceil_prw_acc=Module["_ceil_prw_acc"]=(a0,a1,a2)=>wasmExports["ceil_prw_acc"](BigInt(a0),BigInt(a1),a2);var _floor_prw=Module["_floor_prw"]=(a0,a1,a2)=>wasmExports["floor_prw"](BigInt(a0),BigInt(a1),a2);var _floor_prw_acc=Module["_floor_prw_acc"]=(a0,a1,a2)=>wasmExports["floor_prw_acc"](BigInt(a0),BigInt(a1),a2);var _abs_prw=Module["_abs_prw"]=(a0,a1,a2)=>wasmExports["abs_prw"](BigInt(a0),BigInt(a1),a2);var _abs_prw_acc=Module["_abs_prw_acc"]=(a0,a1,a2)=>wasmExports["abs_prw_acc"](BigInt(a0),BigInt(a1),a2);var _sign_prw=Module["_sign_prw"]=(a0,a1,a2)=>wasmExports["sign_prw"](BigInt(a0),BigInt(a1),a2);var _sign_prw_acc=Module["_sign_prw_acc"]=(a0,a1,a2)=>wasmExports["sign_prw_acc"](BigInt(a0),BigInt(a1),a2);var _negate_prw=Module["_negate_prw"]=(a0,a1,a2)=>wasmExports["negate_prw"](BigInt(a0),BigInt(a1),a2);var _negate_prw_acc=Module["_negate_prw_acc"]=(a0,a1,a2)=>wasmExports["negate_prw_acc"](BigInt(a0),BigInt(a1),a2);var _identity_prw=Module["_identity_prw"]=(a0,a1,a2)=>wasmExports["identity_prw"](BigInt(a0),BigInt(a1),a2);var _identity_prw_acc=Module["_identity_prw_acc"]=(a0,a1,a2)=>wasmExports["identity_prw_acc"](BigInt(a0),BigInt(a1),a2);var _reciprocal_prw=Module["_reciprocal_prw"]=(a0,a1,a2)=>wasmExports["reciprocal_prw"](BigInt(a0),BigInt(a1),a2);var _reciprocal_prw_acc=Module["_reciprocal_prw_acc"]=(a0,a1,a2)=>wasmExports["reciprocal_prw_acc"](BigInt(a0),BigInt(a1),a2);var _relu_prw=Module["_relu_prw"]=(a0,a1,a2)=>wasmExports["relu_prw"](BigInt(a0),BigInt(a1),a2);var _relu_prw_acc=Module["_relu_prw_acc"]=(a0,a1,a2)=>wasmExports["relu_prw_acc"](BigInt(a0),BigInt(a1),a2);var _leaky_relu_prw=Module["_leaky_relu_prw"]=(a0,a1,a2)=>wasmExports["leaky_relu_prw"](BigInt(a0),BigInt(a1),a2);var _leaky_relu_prw_acc=Module["_leaky_relu_prw_acc"]=(a0,a1,a2)=>wasmExports["leaky_relu_prw_acc"](BigInt(a0),BigInt(a1),a2);var _binstep_prw=Module["_binstep_prw"]=(a0,a1,a2)=>wasmExports["binstep_prw"](BigInt(a0),BigInt(a1),a2);var _binstep_prw_acc=Module["_binstep_prw_acc"]=(a0,a1,a2)=>wasmExports["binstep_prw_acc"](BigInt(a0),BigInt(a1),a2);var _logistic_prw=Module["_logistic_prw"]=(a0,a1,a2)=>wasmExports["logistic_prw"](BigInt(a0),BigInt(a1),a2);var _logistic_prw_acc=Module["_logistic_prw_acc"]=(a0,a1,a2)=>wasmExports["logistic_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_sin_prw=Module["_df_sin_prw"]=(a0,a1,a2)=>wasmExports["df_sin_prw"](BigInt(a0),BigInt(a1),a2);var _df_sin_prw_acc=Module["_df_sin_prw_acc"]=(a0,a1,a2)=>wasmExports["df_sin_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_cos_prw=Module["_df_cos_prw"]=(a0,a1,a2)=>wasmExports["df_cos_prw"](BigInt(a0),BigInt(a1),a2);var _df_cos_prw_acc=Module["_df_cos_prw_acc"]=(a0,a1,a2)=>wasmExports["df_cos_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_tan_prw=Module["_df_tan_prw"]=(a0,a1,a2)=>wasmExports["df_tan_prw"](BigInt(a0),BigInt(a1),a2);var _df_tan_prw_acc=Module["_df_tan_prw_acc"]=(a0,a1,a2)=>wasmExports["df_tan_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_asin_prw=Module["_df_asin_prw"]=(a0,a1,a2)=>wasmExports["df_asin_prw"](BigInt(a0),BigInt(a1),a2);var _df_asin_prw_acc=Module["_df_asin_prw_acc"]=(a0,a1,a2)=>wasmExports["df_asin_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_acos_prw=Module["_df_acos_prw"]=(a0,a1,a2)=>wasmExports["df_acos_prw"](BigInt(a0),BigInt(a1),a2);var _df_acos_prw_acc=Module["_df_acos_prw_acc"]=(a0,a1,a2)=>wasmExports["df_acos_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_atan_prw=Module["_df_atan_prw"]=(a0,a1,a2)=>wasmExports["df_atan_prw"](BigInt(a0),BigInt(a1),a2);var _df_atan_prw_acc=Module["_df_atan_prw_acc"]=(a0,a1,a2)=>wasmExports["df_atan_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_sinh_prw=Module["_df_sinh_prw"]=(a0,a1,a2)=>wasmExports["df_sinh_prw"](BigInt(a0),BigInt(a1),a2);var _df_sinh_prw_acc=Module["_df_sinh_prw_acc"]=(a0,a1,a2)=>wasmExports["df_sinh_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_cosh_prw=Module["_df_cosh_prw"]=(a0,a1,a2)=>wasmExports["df_cosh_prw"](BigInt(a0),BigInt(a1),a2);var _df_cosh_prw_acc=Module["_df_cosh_prw_acc"]=(a0,a1,a2)=>wasmExports["df_cosh_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_tanh_prw=Module["_df_tanh_prw"]=(a0,a1,a2)=>wasmExports["df_tanh_prw"](BigInt(a0),BigInt(a1),a2);var _df_tanh_prw_acc=Module["_df_tanh_prw_acc"]=(a0,a1,a2)=>wasmExports["df_tanh_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_log_prw=Module["_df_log_prw"]=(a0,a1,a2)=>wasmExports["df_log_prw"](BigInt(a0),BigInt(a1),a2);var _df_log_prw_acc=Module["_df_log_prw_acc"]=(a0,a1,a2)=>wasmExports["df_log_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_log2_prw=Module["_df_log2_prw"]=(a0,a1,a2)=>wasmExports["df_log2_prw"](BigInt(a0),BigInt(a1),a2);var _df_log2_prw_acc=Module["_df_log2_prw_acc"]=(a0,a1,a2)=>wasmExports["df_log2_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_log10_prw=Module["_df_log10_prw"]=(a0,a1,a2)=>wasmExports["df_log10_prw"](BigInt(a0),BigInt(a1),a2);var _df_log10_prw_acc=Module["_df_log10_prw_acc"]=(a0,a1,a2)=>wasmExports["df_log10_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_invsqrt_prw=Module["_df_invsqrt_prw"]=(a0,a1,a2)=>wasmExports["df_invsqrt_prw"](BigInt(a0),BigInt(a1),a2);var _df_invsqrt_prw_acc=Module["_df_invsqrt_prw_acc"]=(a0,a1,a2)=>wasmExports["df_invsqrt_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_sqrt_prw=Module["_df_sqrt_prw"]=(a0,a1,a2)=>wasmExports["df_sqrt_prw"](BigInt(a0),BigInt(a1),a2);var _df_sqrt_prw_acc=Module["_df_sqrt_prw_acc"]=(a0,a1,a2)=>wasmExports["df_sqrt_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_abs_prw=Module["_df_abs_prw"]=(a0,a1,a2)=>wasmExports["df_abs_prw"](BigInt(a0),BigInt(a1),a2);var _df_abs_prw_acc=Module["_df_abs_prw_acc"]=(a0,a1,a2)=>wasmExports["df_abs_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_negate_prw=Module["_df_negate_prw"]=(a0,a1,a2)=>wasmExports["df_negate_prw"](BigInt(a0),BigInt(a1),a2);var _df_negate_prw_acc=Module["_df_negate_prw_acc"]=(a0,a1,a2)=>wasmExports["df_negate_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_reciprocal_prw=Module["_df_reciprocal_prw"]=(a0,a1,a2)=>wasmExports["df_reciprocal_prw"](BigInt(a0),BigInt(a1),a2);var _df_reciprocal_prw_acc=Module["_df_reciprocal_prw_acc"]=(a0,a1,a2)=>wasmExports["df_reciprocal_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_relu_prw=Module["_df_relu_prw"]=(a0,a1,a2)=>wasmExports["df_relu_prw"](BigInt(a0),BigInt(a1),a2);var _df_relu_prw_acc=Module["_df_relu_prw_acc"]=(a0,a1,a2)=>wasmExports["df_relu_prw_acc"](BigInt(a0),BigInt(a1),a2);var _df_leaky_relu_prw=Module["_df_leaky_relu_prw"]=(a0,a1,a2)=>wasmExports["df_leaky_relu_prw"](BigInt(a0),BigInt(a1),a2);var _df_leaky_relu_prw_acc=Module["_df_leaky_relu_prw_acc"]=(a0,a1,a2)=>wasmExports["df_leaky_relu_prw_acc"](BigInt(a0),BigInt(a1),a2);var __emscripten_stack_restore=(a0)=>wasmExports["_emscripten_stack_restore"](BigInt(a0));var __emscripten_stack_alloc=(a0)=>Number(wasmExports["_emscripten_stack_alloc"](BigInt(a0)));var _emscripten_stack_get_current=()=>Number(wasmExports["emscripten_stack_get_current"]());Module["ccall"]=ccall;Module["cwrap"]=cwrap;Module["setValue"]=setValue;Module["getValue"]=getValue;var calledRun;dependenciesFulfilled=function runCaller(){if(!calledRun)run();if(!calledRun)dependenciesFulfilled=runCaller};function run(){if(runDependencies>0){return}preRun();if(runDependencies>0){return}function doRun(){if(calledRun)return;calledRun=true;Module["calledRun"]=true;if(ABORT)return;initRuntime();if(Module["onRuntimeInitialized"])Module["onRuntimeInitialized"]();postRun()}if(Module["setStatus"]){Module["setStatus"]("Running...");setTimeout(function(){setTimeout(function(){Module["setStatus"]("")},1);doRun()},1)}else{doRun()}}if(Module["preInit"]){if(typeof Module["preInit"]=="function")Module["preInit"]=[Module["preInit"]];while(Module["preInit"].length>0){Module["preInit"].pop()()}}run();
@@ -4,48 +4,79 @@
 #include <stddef.h>
 #include "./util.h"
 #include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
 
 #define get_shape_bwd(a, i) a->shape[a->rank - i - 1]
 #define get_strides_bwd(a, i) a->strides[a->rank - i - 1]
 #define get_ncols(a) get_shape_bwd(a, 0)
 #define get_nrows(a) get_shape_bwd(a, 1)
 #define get_colstride(a) get_strides_bwd(a, 0)
-#define get_rowstride(a) get_strides_bwd(a, 1)
+#define get_rowstride(a) (a->rank > 1 ? get_strides_bwd(a, 1) : 0) // vectors (see dot) have a single row
 
-// we are tearing open a healed wound here
-void mul_mat(struct tensor_t* a, struct tensor_t* b, struct tensor_t* res, bool dot) {
-    size_t nrow_a = dot ? 1 : get_nrows(a); // todo remove redundancy
+// computes the elements [start, end) of the result matrix (in row-major order)
+void mul_mat_range(void* args, size_t start, size_t end) {
+    struct tensor_t *a = ((struct kernel_args_t*)args)->a, *b = ((struct kernel_args_t*)args)->b, *res = ((struct kernel_args_t*)args)->res;
     size_t ncol_a = get_ncols(a);
-    size_t nrow_b = get_nrows(b);
-    size_t ncol_b = get_ncols(b);
-
-    register size_t r, c, i, ires, offset_row, ia, ib;
+    size_t ncol_b = ((struct kernel_args_t*)args)->ncols;
 
-    for (r = 0; r < nrow_a; r++) {
-        for (c = 0; c < ncol_b; c++) {
-            // todo optimization potential: replace multiplications by looped increments
+    register size_t r, c, i, ires, ia, ib;
 
-            ires =  res->offset +
-                    r * get_rowstride(res) +
-                    c * get_colstride(res);
+    // half precision: elements are converted to fp32, the sums are accumulated in fp32
+    if (a->dtype != DTYPE_FP32 || b->dtype != DTYPE_FP32 || res->dtype != DTYPE_FP32) {
+        for (size_t e = start; e < end; e++) {
+            r = e / ncol_b;
+            c = e % ncol_b;
+            ires = res->offset + r * get_rowstride(res) + c * get_colstride(res);
+            float sum = load_elem(res, ires);
 
-            // this loop could be easily parallelized because
-            // of the inherent associativity of the summation
             for (i = 0; i < ncol_a; i++) {
-                ia = a->offset +
-                    r * get_rowstride(a) +
-                    i * get_colstride(a);
+                ia = a->offset + r * get_rowstride(a) + i * get_colstride(a);
+                ib = b->offset + i * get_rowstride(b) + c * get_colstride(b);
+                sum += load_elem(a, ia) * load_elem(b, ib);
+            }
 
-                ib = b->offset +
-                    i * get_rowstride(b) +
-                    c * get_colstride(b);
+            store_elem(res, ires, sum);
+        }
 
-                res->data[ires] += a->data[ia] * b->data[ib];
-            }
+        return;
+    }
+
+    for (size_t e = start; e < end; e++) {
+        r = e / ncol_b;
+        c = e % ncol_b;
+
+        // todo optimization potential: replace multiplications by looped increments
+
+        ires =  res->offset +
+                r * get_rowstride(res) +
+                c * get_colstride(res);
+
+        for (i = 0; i < ncol_a; i++) {
+            ia = a->offset +
+                r * get_rowstride(a) +
+                i * get_colstride(a);
+
+            ib = b->offset +
+                i * get_rowstride(b) +
+                c * get_colstride(b);
+
+            res->data[ires] += a->data[ia] * b->data[ib];
         }
     }
 }
 
+// we are tearing open a healed wound here
+void mul_mat(struct tensor_t* a, struct tensor_t* b, struct tensor_t* res, bool dot) {
+    size_t nrow_a = dot ? 1 : get_nrows(a); // todo remove redundancy
+    size_t ncol_a = get_ncols(a);
+    size_t ncol_b = get_ncols(b);
+
+    // the elements of the result are independent, each of them is a sum of ncol_a products
+    struct kernel_args_t args = { .a = a, .b = b, .res = res, .ncols = ncol_b };
+    parallel_for(nrow_a * ncol_b, ncol_a, mul_mat_range, &args);
+}
+
 
 // pairwise multiplication of the matrices in two tensors
 #define MATMUL_OP(NAME, FILL_DESTINATION)  \
@@ -59,7 +90,7 @@ void NAME(struct tensor_t* a, struct tensor_t* b, struct tensor_t* result) { \
     size_t nmat_b = get_nsubtns(b, 2); \
  \
     /* // size_t stride_res = nrow_a * ncol_b; // todo: think i could replace this by using result->strides    // size_t stride_a = nmat_a > 1 ? nrow_a * ncol_a : 0; */ \
-    size_t stride_res = result->strides[result->rank - 3]; /* // todo: validate (this is what i was talking about above) */ \
+    size_t stride_res = result->rank > 2 ? result->strides[result->rank - 3] : 0; /* // a single matrix has no stride between matrices */ \
     size_t stride_b = nmat_b > 1 ? nrow_b * ncol_b : 0; \
     size_t stride_a = nmat_a > 1 ? nrow_a * ncol_a : 0; \
  \
@@ -104,7 +135,7 @@ void NAME(struct tensor_t* a, struct tensor_t* b, struct tensor_t* result) { \
     /* // Correctly setting the initial view for a and b */ \
     struct tensor_t* view_a = create_view(a, a->rank - 1, 0); \
     struct tensor_t* view_b = create_view(b, b->rank - 2, 0); \
-    struct tensor_t* view_res = create_view(result, result->rank - 2, 0); \
+    struct tensor_t* view_res = create_view(result, result->rank > 1 ? result->rank - 2 : 0, 0); \
  \
     size_t offset_a = 0; \
     size_t offset_b = 0; \
@@ -3,13 +3,18 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include "./half.h"
 
 unsigned int global_seed = 0;
 
 void init_uniform(struct tensor_t* a, float min, float max, unsigned int seed) {
     float range = max - min;
 
-    if (a->isview) for (size_t i = 0; i < a->nelem; i++) {
+    if (a->dtype != DTYPE_FP32) for (size_t i = 0; i < a->nelem; i++) {
+        store_elem(a, get_index(a, i), rand_r(&seed) / (float)RAND_MAX * range + min);
+    }
+
+    else if (a->isview) for (size_t i = 0; i < a->nelem; i++) {
         a->data[get_index(a, i)] = rand_r(&seed) / (float)RAND_MAX * range + min;
     }
 
@@ -19,7 +24,11 @@ void init_uniform(struct tensor_t* a, float min, float max, unsigned int seed) {
 }
 
 void init_normal(struct tensor_t* a, float mean, float std_dev, unsigned int seed) {
-    if (a->isview) for (size_t i = 0; i < a->nelem; i++) {
+    if (a->dtype != DTYPE_FP32) for (size_t i = 0; i < a->nelem; i++) {
+        store_elem(a, get_index(a, i), normal(mean, std_dev, &seed));
+    }
+
+    else if (a->isview) for (size_t i = 0; i < a->nelem; i++) {
         a->data[get_index(a, i)] = normal(mean, std_dev, &seed);
     }
 
@@ -29,7 +38,11 @@ void init_normal(struct tensor_t* a, float mean, float std_dev, unsigned int see
 }
 
 void init_fill(struct tensor_t* a, float value) {
-    if (a->isview) for (size_t i = 0; i < a->nelem; i++) {
+    if (a->dtype != DTYPE_FP32) for (size_t i = 0; i < a->nelem; i++) {
+        store_elem(a, get_index(a, i), value);
+    }
+
+    else if (a->isview) for (size_t i = 0; i < a->nelem; i++) {
         a->data[get_index(a, i)] = value;
     }
 
@@ -1,26 +1,43 @@
 #include "./util.c"
+#include "./half.c"
+#include "./threads.c"
 #include "./init.c"
 
 // unary operations
 #include "./unary_prw.c"
 #include "./unary_brc.c"
 #include "./unary_dbrc.c"
+#include "./unary_bw.c"
 
 // binary operations
 #include "./binary_brc.c"
 #include "./binary_dbrc.c"
 #include "./binary_mat.c"
+#include "./binary_bw.c"
 
 // reduce operations
 #include "./reduce.c"
 
 // misc operations
 #include "./dropout.c"
+#include "./optim.c"
 
+#include "./pool.c"
 #include "./tensor.c"
 #include "./mgmt.c"
+#include "./program.c"
+#include "./schedule.c"
 
-int main() {
+// runs when the wasm module or shared library is loaded, wasm modules may be instantiated
+// without calling main
+__attribute__((constructor)) static void init_core() {
     init_mgmt();
+}
+
+#ifdef __EMSCRIPTEN__
+
+int main() {
     return 0;
 }
+
+#endif
@@ -0,0 +1,246 @@
+// fused optimizer steps ("multi-tensor apply"). a step updates the values and the state of all
+// parameters in one pass, every element is read and written once.
+
+#ifndef CORE_OPTIM_IMPL
+#define CORE_OPTIM_IMPL
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <math.h>
+#include "./util.h"
+#include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
+#include "./optim.h"
+
+struct optim_args_t {
+    struct optimizer_t* opt;
+    float step_size;    // learning rate, divided by the bias correction of the first moment for adam
+    float bc2_sqrt;     // square root of the bias correction of the second moment
+    float grad_coef;    // scale of the gradients, including clipping
+};
+
+// the global norm is reduced in fixed blocks (REDUCE_NBLOCKS, see reduce.c), so it doesn't depend on the number of threads
+struct grad_norm_args_t {
+    struct optimizer_t* opt;
+    size_t block_size;
+    double partial[REDUCE_NBLOCKS];
+};
+
+// last parameter that starts at or before the element i
+static size_t find_param(struct optimizer_t* opt, size_t i) {
+    size_t lo = 0, hi = opt->nparams;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (opt->offsets[mid] <= i) lo = mid;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+// updates the elements [start, end) of one parameter. m and v are its slices of the state rows.
+// UPDATE reads and writes w (value) and reads g (gradient).
+#define OPTIM_UPDATE(NAME, UPDATE)  \
+static void NAME(struct optim_args_t* args, struct tensor_t* value, struct tensor_t* grad, float* m, float* v, size_t start, size_t end) { \
+    struct optimizer_t* opt = args->opt; \
+    float lr = opt->lr, beta1 = opt->beta1, beta2 = opt->beta2, eps = opt->eps, weight_decay = opt->weight_decay; \
+    float step_size = args->step_size, bc2_sqrt = args->bc2_sqrt, grad_coef = args->grad_coef; \
+    (void)lr; (void)beta2; (void)eps; (void)step_size; (void)bc2_sqrt; (void)v;    /* // not every update uses all of them */ \
+ \
+    /* // views and half precision: elements are converted to fp32 for the update */ \
+    if (value->dtype != DTYPE_FP32 || grad->dtype != DTYPE_FP32 || value->isview || grad->isview) { \
+        for (size_t i = start; i < end; i++) { \
+            size_t iw = get_index(value, i); \
+            float w = load_elem(value, iw); \
+            float g = load_elem(grad, get_index(grad, i)) * grad_coef; \
+            UPDATE; \
+            store_elem(value, iw, w); \
+        } \
+ \
+        return; \
+    } \
+ \
+    float* values = value->data; \
+    float* grads = grad->data; \
+ \
+    for (size_t i = start; i < end; i++) { \
+        float w = values[i]; \
+        float g = grads[i] * grad_coef; \
+        UPDATE; \
+        values[i] = w; \
+    } \
+} \
+
+
+OPTIM_UPDATE(sgd_update,
+    g += weight_decay * w;
+    if (m) g = m[i] = beta1 * m[i] + g;
+    w -= lr * g;
+);
+
+OPTIM_UPDATE(adam_update,
+    g += weight_decay * w;
+    m[i] = beta1 * m[i] + (1 - beta1) * g;
+    v[i] = beta2 * v[i] + (1 - beta2) * g * g;
+    w -= step_size * m[i] / (sqrtf(v[i]) / bc2_sqrt + eps);
+);
+
+OPTIM_UPDATE(adamw_update,
+    w -= lr * weight_decay * w;
+    m[i] = beta1 * m[i] + (1 - beta1) * g;
+    v[i] = beta2 * v[i] + (1 - beta2) * g * g;
+    w -= step_size * m[i] / (sqrtf(v[i]) / bc2_sqrt + eps);
+);
+
+// the range covers the elements of all parameters back to back, so it may span several parameters
+void optimizer_range(void* _args, size_t start, size_t end) {
+    struct optim_args_t* args = _args;
+    struct optimizer_t* opt = args->opt;
+    size_t* offsets = opt->offsets;
+    size_t total = offsets[opt->nparams];
+
+    for (size_t p = find_param(opt, start); p < opt->nparams && offsets[p] < end; p++) {
+        size_t first = (start > offsets[p] ? start : offsets[p]) - offsets[p];
+        size_t last = (end < offsets[p + 1] ? end : offsets[p + 1]) - offsets[p];
+        float* m = opt->state ? opt->state->data + offsets[p] : NULL;
+        float* v = opt->state ? opt->state->data + total + offsets[p] : NULL;
+
+        switch (opt->kind) {
+            case OPTIM_SGD:   sgd_update(args, opt->values[p], opt->grads[p], m, v, first, last); break;
+            case OPTIM_ADAM:  adam_update(args, opt->values[p], opt->grads[p], m, v, first, last); break;
+            case OPTIM_ADAMW: adamw_update(args, opt->values[p], opt->grads[p], m, v, first, last); break;
+        }
+    }
+}
+
+// sum of squares of the elements [start, end) of a gradient
+static double sum_squares(struct tensor_t* grad, size_t start, size_t end) {
+    double sum = 0;
+
+    if (grad->dtype != DTYPE_FP32 || grad->isview) {
+        for (size_t i = start; i < end; i++) {
+            float g = load_elem(grad, get_index(grad, i));
+            sum += g * g;
+        }
+
+        return sum;
+    }
+
+    // independent partial sums, a single sum would be bound by the latency of the additions
+    float* grads = grad->data;
+    float lanes[32] = { 0 };
+    size_t i = start;
+
+    for (; i + 32 <= end; i += 32) {
+        for (size_t lane = 0; lane < 32; lane++) lanes[lane] += grads[i + lane] * grads[i + lane];
+    }
+
+    for (; i < end; i++) sum += grads[i] * grads[i];
+    for (size_t lane = 0; lane < 32; lane++) sum += lanes[lane];
+    return sum;
+}
+
+void grad_norm_blocks(void* _args, size_t start, size_t end) {
+    struct grad_norm_args_t* args = _args;
+    struct optimizer_t* opt = args->opt;
+    size_t* offsets = opt->offsets;
+    size_t total = offsets[opt->nparams];
+
+    for (size_t block = start; block < end; block++) {
+        size_t first = block * args->block_size;
+        size_t last = first + args->block_size < total ? first + args->block_size : total;
+        double sum = 0;
+
+        for (size_t p = find_param(opt, first); p < opt->nparams && offsets[p] < last; p++) {
+            size_t from = (first > offsets[p] ? first : offsets[p]) - offsets[p];
+            size_t to = (last < offsets[p + 1] ? last : offsets[p + 1]) - offsets[p];
+            sum += sum_squares(opt->grads[p], from, to);
+        }
+
+        args->partial[block] = sum;
+    }
+}
+
+// global l2 norm over the gradients of all parameters, in one sweep
+static float grad_norm(struct optimizer_t* opt) {
+    size_t total = opt->offsets[opt->nparams];
+    size_t nblocks = total < PARALLEL_MIN_WORK ? 1 : REDUCE_NBLOCKS;
+    struct grad_norm_args_t args = { .opt = opt, .block_size = (total + nblocks - 1) / nblocks };
+    if (args.block_size == 0) return 0;
+
+    parallel_for(nblocks, args.block_size, grad_norm_blocks, &args);
+
+    double sum = 0;
+    for (size_t block = 0; block < nblocks; block++) sum += args.partial[block];
+    return (float)sqrt(sum) * fabsf(opt->grad_scale);
+}
+
+struct optimizer_t* create_optimizer(size_t kind, size_t nparams) {
+    struct optimizer_t* opt = calloc(1, sizeof(struct optimizer_t));
+    opt->kind = kind;
+    opt->nparams = nparams;
+    opt->values = calloc(nparams, sizeof(struct tensor_t*));
+    opt->grads = calloc(nparams, sizeof(struct tensor_t*));
+    opt->offsets = calloc(nparams + 1, sizeof(size_t));
+    opt->grad_scale = 1;
+    return opt;
+}
+
+void free_optimizer(struct optimizer_t* opt) {
+    free(opt->values);
+    free(opt->grads);
+    free(opt->offsets);
+    free(opt);
+}
+
+void set_optimizer_param(struct optimizer_t* opt, size_t i, struct tensor_t* value, struct tensor_t* grad) {
+    opt->values[i] = value;
+    opt->grads[i] = grad;
+    opt->offsets[i + 1] = opt->offsets[i] + value->nelem;
+}
+
+void set_optimizer_state(struct optimizer_t* opt, struct tensor_t* state) {
+    opt->state = state;
+}
+
+void set_optimizer_hparams(struct optimizer_t* opt, float lr, float beta1, float beta2, float eps, float weight_decay) {
+    opt->lr = lr;
+    opt->beta1 = beta1;
+    opt->beta2 = beta2;
+    opt->eps = eps;
+    opt->weight_decay = weight_decay;
+}
+
+void set_optimizer_grad_clipping(struct optimizer_t* opt, float max_grad_norm, float grad_scale) {
+    opt->max_grad_norm = max_grad_norm;
+    opt->grad_scale = grad_scale;
+}
+
+float get_optimizer_grad_norm(struct optimizer_t* opt) {
+    return opt->grad_norm;
+}
+
+// with clipping, the gradients are rescaled by the update itself instead of a separate pass over them.
+// the gradient tensors are left unchanged. steps with a non-finite norm (e.g. overflows with loss scaling) are skipped.
+void optimizer_step(struct optimizer_t* opt) {
+    struct optim_args_t args = { .opt = opt, .step_size = opt->lr, .bc2_sqrt = 1, .grad_coef = opt->grad_scale };
+
+    if (opt->max_grad_norm > 0) {
+        opt->grad_norm = grad_norm(opt);
+        if (!isfinite(opt->grad_norm)) return;
+        if (opt->grad_norm > opt->max_grad_norm) args.grad_coef *= opt->max_grad_norm / (opt->grad_norm + 1e-6f);
+    }
+
+    opt->t++;
+
+    if (opt->kind != OPTIM_SGD) {
+        args.step_size = opt->lr / (1 - powf(opt->beta1, (float)opt->t));
+        args.bc2_sqrt = sqrtf(1 - powf(opt->beta2, (float)opt->t));
+    }
+
+    // adam needs a square root and a division per element
+    parallel_for(opt->offsets[opt->nparams], opt->kind == OPTIM_SGD ? 1 : 4, optimizer_range, &args);
+}
+
+#endif //CORE_OPTIM_IMPL
@@ -0,0 +1,50 @@
+#ifndef CORE_OPTIM
+#define CORE_OPTIM
+
+#include <stddef.h>
+#include "./tensor.h"
+
+// kinds of optimizers. the kind determines the number of state rows.
+enum optim_kind_t {
+    OPTIM_SGD = 0,      // state: momentum buffer (none without momentum)
+    OPTIM_ADAM = 1,     // state: first and second moments, the weight decay is added to the gradient
+    OPTIM_ADAMW = 2,    // like OPTIM_ADAM, but the weight decay is applied to the values directly
+};
+
+// an optimizer over a list of parameters, whose update is a single pass over all of their elements.
+// the state of all parameters is one tensor (owned by js) with one row per state buffer, parameter i
+// owns the elements [offsets[i], offsets[i + 1]) of each row.
+struct optimizer_t {
+    size_t kind;                // enum optim_kind_t
+    size_t nparams;
+    struct tensor_t** values;
+    struct tensor_t** grads;
+    size_t* offsets;
+    struct tensor_t* state;
+    size_t t;                   // number of steps, used for the bias correction of adam
+
+    float lr;
+    float beta1;                // momentum of sgd
+    float beta2;
+    float eps;
+    float weight_decay;
+
+    // gradient clipping and scaling (see optimizer_step)
+    float grad_scale;           // gradients are multiplied by it, e.g. 1 / loss scale
+    float max_grad_norm;        // clips the global norm of the scaled gradients, 0 disables clipping
+    float grad_norm;            // global norm of the scaled gradients in the last step
+};
+
+struct optimizer_t* create_optimizer(size_t kind, size_t nparams);
+void free_optimizer(struct optimizer_t* opt);
+
+// parameters have to be set in order, the offsets of parameter i depend on the parameters before it
+void set_optimizer_param(struct optimizer_t* opt, size_t i, struct tensor_t* value, struct tensor_t* grad);
+void set_optimizer_state(struct optimizer_t* opt, struct tensor_t* state);
+void set_optimizer_hparams(struct optimizer_t* opt, float lr, float beta1, float beta2, float eps, float weight_decay);
+void set_optimizer_grad_clipping(struct optimizer_t* opt, float max_grad_norm, float grad_scale);
+float get_optimizer_grad_norm(struct optimizer_t* opt);
+
+void optimizer_step(struct optimizer_t* opt);
+
+#endif //CORE_OPTIM
@@ -0,0 +1,81 @@
+#include "./pool.h"
+#include "./mgmt.h"
+#include <stdlib.h>
+
+// heads of the free lists. the first bytes of a free buffer hold a pointer
+// to the next free buffer of the same size class.
+float* free_lists[POOL_NCLASSES];
+
+// index of the most significant set bit
+size_t msb(size_t x) {
+    size_t k = 0;
+    while (x >>= 1) k++;
+    return k;
+}
+
+// buffers whose size lies in (4 + m) * 2^(k-2) < nelem <= (5 + m) * 2^(k-2) share the class 4k + m
+size_t pool_class(size_t nelem) {
+    if (nelem <= POOL_MIN_NELEM) return 0;
+
+    size_t k = msb(nelem - 1);
+    return k * 4 + ((nelem - 1) >> (k - 2)) - 4;
+}
+
+// number of elements that are actually allocated for a buffer of nelem elements
+size_t pool_capacity(size_t nelem) {
+    if (nelem <= POOL_MIN_NELEM) return POOL_MIN_NELEM;
+
+    size_t shift = msb(nelem - 1) - 2;
+    return (((nelem - 1) >> shift) + 1) << shift;
+}
+
+// returns a recycled buffer of the same size class if available, allocates a new one otherwise
+float* pool_alloc(size_t nelem) {
+    size_t class = pool_class(nelem);
+    float* ptr = free_lists[class];
+
+    if (ptr == NULL) return (float*)malloc(pool_capacity(nelem) * sizeof(float));
+
+    free_lists[class] = *(float**)ptr;
+    mgmt.pooled -= pool_capacity(nelem) * sizeof(float);
+    mgmt.pool_hits++;
+
+    return ptr;
+}
+
+// hands a buffer that was allocated with pool_alloc(nelem) back to the pool
+void pool_release(float* ptr, size_t nelem) {
+    size_t bytes = pool_capacity(nelem) * sizeof(float);
+
+    if (mgmt.pooled + bytes > mgmt.pool_limit) {
+        free(ptr);
+        return;
+    }
+
+    size_t class = pool_class(nelem);
+    *(float**)ptr = free_lists[class];
+    free_lists[class] = ptr;
+    mgmt.pooled += bytes;
+}
+
+// frees all buffers that are currently held by the pool
+void pool_trim() {
+    for (size_t class = 0; class < POOL_NCLASSES; class++) {
+        float* ptr = free_lists[class];
+
+        while (ptr != NULL) {
+            float* next = *(float**)ptr;
+            free(ptr);
+            ptr = next;
+        }
+
+        free_lists[class] = NULL;
+    }
+
+    mgmt.pooled = 0;
+}
+
+void set_pool_limit(size_t bytes) {
+    mgmt.pool_limit = bytes;
+    if (mgmt.pooled > bytes) pool_trim();
+}
@@ -0,0 +1,251 @@
+#include <stdbool.h>
+#include "./platform.h"
+#include "./threads.h"
+
+// without CORE_THREADS (the default build), everything runs on the calling thread
+#ifndef CORE_THREADS
+
+static void run_parallel(size_t n, size_t cost, range_fn_t fn, void* args) {
+    if (n > 0) fn(args, 0, n);
+}
+
+static bool on_worker_thread() {
+    return false;
+}
+
+size_t set_num_threads(size_t n) {
+    return 1;
+}
+
+size_t get_num_threads() {
+    return 1;
+}
+
+void lock_mgmt() {}
+void unlock_mgmt() {}
+
+#else
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+// chunks of the current job that belong to a thread. the owner takes chunks from the front,
+// idle threads steal from the back. both ends are packed into one word (lo << 32 | hi),
+// so that they can be updated by a single compare-and-swap.
+struct queue_t {
+    _Atomic uint64_t range;
+    char padding[56]; // one queue per cache line
+};
+
+struct thread_pool_t {
+    pthread_t threads[MAX_THREADS];
+    size_t nthreads;              // number of threads, including the calling thread
+    pthread_mutex_t mutex;
+    pthread_cond_t wakeup;
+    size_t generation;            // incremented whenever a job is published
+    size_t spawn_generation;      // generation at which the workers were started
+    bool shutdown;
+
+    // current job
+    range_fn_t fn;
+    void* args;
+    size_t n;
+    size_t chunk_size;
+    struct queue_t queues[MAX_THREADS];
+    _Atomic size_t finished;      // number of finished chunks
+    _Atomic size_t busy;          // number of workers that have not yet left the job
+} thread_pool = { .nthreads = 1, .mutex = PTHREAD_MUTEX_INITIALIZER, .wakeup = PTHREAD_COND_INITIALIZER };
+
+// set while a thread works on a job. kernels that are called from within a job run serially.
+static _Thread_local bool in_job = false;
+
+static bool pop_front(struct queue_t* queue, size_t* chunk) {
+    uint64_t range = atomic_load(&queue->range);
+
+    for (;;) {
+        uint32_t lo = range >> 32, hi = (uint32_t)range;
+        if (lo >= hi) return false;
+
+        if (atomic_compare_exchange_weak(&queue->range, &range, ((uint64_t)(lo + 1) << 32) | hi)) {
+            *chunk = lo;
+            return true;
+        }
+    }
+}
+
+static bool pop_back(struct queue_t* queue, size_t* chunk) {
+    uint64_t range = atomic_load(&queue->range);
+
+    for (;;) {
+        uint32_t lo = range >> 32, hi = (uint32_t)range;
+        if (lo >= hi) return false;
+
+        if (atomic_compare_exchange_weak(&queue->range, &range, ((uint64_t)lo << 32) | (hi - 1))) {
+            *chunk = hi - 1;
+            return true;
+        }
+    }
+}
+
+static void run_chunk(size_t chunk) {
+    size_t start = chunk * thread_pool.chunk_size;
+    size_t end = start + thread_pool.chunk_size < thread_pool.n ? start + thread_pool.chunk_size : thread_pool.n;
+    thread_pool.fn(thread_pool.args, start, end);
+    atomic_fetch_add(&thread_pool.finished, 1);
+}
+
+// works on the own queue first, then steals from the others until all queues are empty
+static void work(size_t id) {
+    size_t chunk;
+
+    while (pop_front(&thread_pool.queues[id], &chunk)) run_chunk(chunk);
+
+    for (size_t i = 1; i < thread_pool.nthreads; i++) {
+        struct queue_t* victim = &thread_pool.queues[(id + i) % thread_pool.nthreads];
+        while (pop_back(victim, &chunk)) run_chunk(chunk);
+    }
+}
+
+static void* worker(void* _id) {
+    size_t id = (size_t)_id;
+    size_t seen = thread_pool.spawn_generation;
+    in_job = true;
+
+    pthread_mutex_lock(&thread_pool.mutex);
+
+    for (;;) {
+        while (thread_pool.generation == seen && !thread_pool.shutdown) pthread_cond_wait(&thread_pool.wakeup, &thread_pool.mutex);
+        if (thread_pool.shutdown) break;
+        seen = thread_pool.generation;
+        pthread_mutex_unlock(&thread_pool.mutex);
+
+        work(id);
+        atomic_fetch_sub(&thread_pool.busy, 1);
+
+        pthread_mutex_lock(&thread_pool.mutex);
+    }
+
+    pthread_mutex_unlock(&thread_pool.mutex);
+    return NULL;
+}
+
+static void run_parallel(size_t n, size_t cost, range_fn_t fn, void* args) {
+    if (n == 0) return;
+    if (cost == 0) cost = 1;
+
+    if (thread_pool.nthreads == 1 || in_job || n * cost < PARALLEL_MIN_WORK) {
+        fn(args, 0, n);
+        return;
+    }
+
+    size_t chunk_size = PARALLEL_CHUNK_WORK / cost;
+    if (chunk_size == 0) chunk_size = 1;
+    size_t nchunks = (n + chunk_size - 1) / chunk_size;
+
+    // workers may still be looking for chunks of the previous job
+    while (atomic_load(&thread_pool.busy) > 0) sched_yield();
+
+    thread_pool.fn = fn;
+    thread_pool.args = args;
+    thread_pool.n = n;
+    thread_pool.chunk_size = chunk_size;
+    atomic_store(&thread_pool.finished, 0);
+    atomic_store(&thread_pool.busy, thread_pool.nthreads - 1);
+
+    // the chunks are distributed evenly, idle threads steal the rest
+    for (size_t i = 0; i < thread_pool.nthreads; i++) {
+        uint64_t lo = nchunks * i / thread_pool.nthreads, hi = nchunks * (i + 1) / thread_pool.nthreads;
+        atomic_store(&thread_pool.queues[i].range, (lo << 32) | hi);
+    }
+
+    pthread_mutex_lock(&thread_pool.mutex);
+    thread_pool.generation++;
+    pthread_cond_broadcast(&thread_pool.wakeup);
+    pthread_mutex_unlock(&thread_pool.mutex);
+
+    // the calling thread is thread 0
+    in_job = true;
+    work(0);
+    in_job = false;
+
+    while (atomic_load(&thread_pool.finished) < nchunks) sched_yield();
+}
+
+static void stop_workers() {
+    pthread_mutex_lock(&thread_pool.mutex);
+    thread_pool.shutdown = true;
+    pthread_cond_broadcast(&thread_pool.wakeup);
+    pthread_mutex_unlock(&thread_pool.mutex);
+
+    for (size_t i = 1; i < thread_pool.nthreads; i++) pthread_join(thread_pool.threads[i], NULL);
+
+    thread_pool.shutdown = false;
+    thread_pool.nthreads = 1;
+}
+
+// returns the number of threads that is actually used
+size_t set_num_threads(size_t n) {
+    if (n < 1) n = 1;
+    if (n > MAX_THREADS) n = MAX_THREADS;
+    if (n == thread_pool.nthreads) return n;
+
+    while (atomic_load(&thread_pool.busy) > 0) sched_yield();
+    stop_workers();
+    thread_pool.spawn_generation = thread_pool.generation;
+
+    for (size_t i = 1; i < n; i++) {
+        if (pthread_create(&thread_pool.threads[i], NULL, worker, (void*)i) != 0) break;
+        thread_pool.nthreads++;
+    }
+
+    return thread_pool.nthreads;
+}
+
+size_t get_num_threads() {
+    return thread_pool.nthreads;
+}
+
+static bool on_worker_thread() {
+    return in_job;
+}
+
+static pthread_mutex_t mgmt_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void lock_mgmt() {
+    pthread_mutex_lock(&mgmt_mutex);
+}
+
+void unlock_mgmt() {
+    pthread_mutex_unlock(&mgmt_mutex);
+}
+
+#endif //CORE_THREADS
+
+// profiling: time spent in kernels in ms. only the outermost parallel_for of the calling thread
+// is measured, nested calls (e.g. kernels of a schedule) are part of it.
+static bool profiling = false;
+static double kernel_time = 0;
+static _Thread_local size_t kernel_depth = 0;
+
+void parallel_for(size_t n, size_t cost, range_fn_t fn, void* args) {
+    if (!profiling || kernel_depth > 0 || on_worker_thread()) {
+        run_parallel(n, cost, fn, args);
+        return;
+    }
+
+    kernel_depth++;
+    double start = platform_now();
+    run_parallel(n, cost, fn, args);
+    kernel_time += platform_now() - start;
+    kernel_depth--;
+}
+
+void set_profiling(int enabled) {
+    profiling = enabled != 0;
+}
+
+double get_kernel_time() {
+    return kernel_time;
+}
@@ -8,22 +8,18 @@
 #include <string.h>
 #include "./util.h"
 #include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
 
 // NOTE: param is an optional floating point value that may or may not be used
 #define BROADCASTING_UNARY_OP(NAME, ASSIGNMENT, RESULT)  \
-void NAME(struct tensor_t *_a, struct tensor_t *res, float param) { \
+void NAME##_range(void* args, size_t start, size_t end) { \
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *res = ((struct kernel_args_t*)args)->res; \
+    size_t* strides_a = ((struct kernel_args_t*)args)->strides_a; \
+    float param = ((struct kernel_args_t*)args)->param; \
     size_t ia, ires, iaxis, remainder, dim; \
-    size_t strides_a[res->rank]; \
- \
-    /* // extend stride arrays of a and with zeros to match rank of result tensor */ \
-    for (dim = res->rank; dim-- > 0;) { \
-        /* // original condition was (res->rank - a->rank > dim) but we cannot safely do */ \
-        /* // subtractions here because size_t would underflow so i reformulated the inequality */ \
-        /* //               [pad with zeros to the left]     [when shape[dim] is 1 we can't step to the next element, so set stride to 0] */ \
-        strides_a[dim] = (res->rank > dim + _a->rank ? 0 : (_a->shape[dim - (res->rank - _a->rank)] == 1 ? 0 : _a->strides[dim - (res->rank - _a->rank)])); \
-    } \
  \
-    for (size_t i = 0; i < res->nelem; i++) { \
+    for (size_t i = start; i < end; i++) { \
         /* // get indices of a and result */ \
         ia = _a->offset; ires = res->offset; remainder = i; \
  \
@@ -35,9 +31,26 @@ void NAME(struct tensor_t *_a, struct tensor_t *res, float param) { \
             ires += iaxis * res->strides[dim]; \
         } \
  \
-        float a = _a->data[_a->offset + ia]; \
-        res->data[ires] ASSIGNMENT RESULT; \
+        /* // elements are converted to fp32 if stored in half precision */ \
+        float a = load_elem(_a, ia); \
+        ASSIGN_ELEM(res, ires, ASSIGNMENT, RESULT); \
+    } \
+} \
+ \
+void NAME(struct tensor_t *_a, struct tensor_t *res, float param) { \
+    size_t dim; \
+    size_t strides_a[res->rank]; \
+ \
+    /* // extend stride arrays of a and with zeros to match rank of result tensor */ \
+    for (dim = res->rank; dim-- > 0;) { \
+        /* // original condition was (res->rank - a->rank > dim) but we cannot safely do */ \
+        /* // subtractions here because size_t would underflow so i reformulated the inequality */ \
+        /* //               [pad with zeros to the left]     [when shape[dim] is 1 we can't step to the next element, so set stride to 0] */ \
+        strides_a[dim] = (res->rank > dim + _a->rank ? 0 : (_a->shape[dim - (res->rank - _a->rank)] == 1 ? 0 : _a->strides[dim - (res->rank - _a->rank)])); \
     } \
+ \
+    struct kernel_args_t args = { .a = _a, .res = res, .param = param, .strides_a = strides_a }; \
+    parallel_for(res->nelem, 1, NAME##_range, &args); \
 } \
 
 
@@ -101,6 +114,9 @@ BROADCASTING_UNARY_OP(sign_brc_acc, +=, SIGN(a))
 BROADCASTING_UNARY_OP(negate_brc, =, -a)
 BROADCASTING_UNARY_OP(negate_brc_acc, +=, -a)
 
+BROADCASTING_UNARY_OP(identity_brc, =, a)
+BROADCASTING_UNARY_OP(identity_brc_acc, +=, a)
+
 BROADCASTING_UNARY_OP(reciprocal_brc, =, 1. / a)
 BROADCASTING_UNARY_OP(reciprocal_brc_acc, +=, 1. / a)
 
@@ -0,0 +1,113 @@
+// fused backward passes of pairwise unary operations: res (+)= grad * f'(x)
+// a is the input x of the operation, or its result y where f' is cheaper to compute from it.
+// b is the gradient of the result, all tensors have the same number of elements.
+
+#ifndef CORE_UNARY_BW
+#define CORE_UNARY_BW
+
+#include <stddef.h>
+#include <math.h>
+#include "./util.h"
+#include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
+
+#define BACKWARD_UNARY_OP(NAME, ASSIGNMENT, RESULT)  \
+void NAME##_range(void* args, size_t start, size_t end) { \
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *_b = ((struct kernel_args_t*)args)->b, *res = ((struct kernel_args_t*)args)->res; \
+    float param = ((struct kernel_args_t*)args)->param; \
+ \
+    /* // half precision: elements are converted to fp32 for the computation */ \
+    if (_a->dtype != DTYPE_FP32 || _b->dtype != DTYPE_FP32 || res->dtype != DTYPE_FP32) { \
+        for (size_t i = start; i < end; i++) { \
+            float a = load_elem(_a, get_index(_a, i)), b = load_elem(_b, get_index(_b, i)); \
+            size_t ires = get_index(res, i); \
+            ASSIGN_ELEM(res, ires, ASSIGNMENT, RESULT); \
+        } \
+ \
+        return; \
+    } \
+ \
+    if (_a->isview || _b->isview || res->isview) { \
+        for (size_t i = start; i < end; i++) { \
+            float a = _a->data[get_index(_a, i)], b = _b->data[get_index(_b, i)]; \
+            res->data[get_index(res, i)] ASSIGNMENT RESULT; \
+        } \
+ \
+        return; \
+    } \
+ \
+    for (size_t i = start; i < end; i++) { \
+        float a = _a->data[i], b = _b->data[i]; \
+        res->data[i] ASSIGNMENT RESULT; \
+    } \
+} \
+ \
+void NAME(struct tensor_t* _a, struct tensor_t* _b, struct tensor_t* res, float param) { \
+    struct kernel_args_t args = { .a = _a, .b = _b, .res = res, .param = param }; \
+    parallel_for(res->nelem, 1, NAME##_range, &args); \
+} \
+
+
+// a = y: tanh, exp, logistic, sqrt. a = x: all others
+BACKWARD_UNARY_OP(bw_sin, =, b * cos(a))
+BACKWARD_UNARY_OP(bw_sin_acc, +=, b * cos(a))
+
+BACKWARD_UNARY_OP(bw_cos, =, b * -sin(a))
+BACKWARD_UNARY_OP(bw_cos_acc, +=, b * -sin(a))
+
+BACKWARD_UNARY_OP(bw_tan, =, b / pow(cos(a), 2.))
+BACKWARD_UNARY_OP(bw_tan_acc, +=, b / pow(cos(a), 2.))
+
+BACKWARD_UNARY_OP(bw_asin, =, b / sqrt(1 - a * a))
+BACKWARD_UNARY_OP(bw_asin_acc, +=, b / sqrt(1 - a * a))
+
+BACKWARD_UNARY_OP(bw_acos, =, -b / sqrt(1 - a * a))
+BACKWARD_UNARY_OP(bw_acos_acc, +=, -b / sqrt(1 - a * a))
+
+BACKWARD_UNARY_OP(bw_atan, =, b / (a * a + 1.))
+BACKWARD_UNARY_OP(bw_atan_acc, +=, b / (a * a + 1.))
+
+BACKWARD_UNARY_OP(bw_sinh, =, b * cosh(a))
+BACKWARD_UNARY_OP(bw_sinh_acc, +=, b * cosh(a))
+
+BACKWARD_UNARY_OP(bw_cosh, =, b * sinh(a))
+BACKWARD_UNARY_OP(bw_cosh_acc, +=, b * sinh(a))
+
+BACKWARD_UNARY_OP(bw_tanh, =, b * (1. - a * a))
+BACKWARD_UNARY_OP(bw_tanh_acc, +=, b * (1. - a * a))
+
+BACKWARD_UNARY_OP(bw_exp, =, b * a)
+BACKWARD_UNARY_OP(bw_exp_acc, +=, b * a)
+
+BACKWARD_UNARY_OP(bw_logistic, =, b * a * (1. - a))
+BACKWARD_UNARY_OP(bw_logistic_acc, +=, b * a * (1. - a))
+
+BACKWARD_UNARY_OP(bw_log, =, b / a)
+BACKWARD_UNARY_OP(bw_log_acc, +=, b / a)
+
+BACKWARD_UNARY_OP(bw_log2, =, b / (a * log(2.)))
+BACKWARD_UNARY_OP(bw_log2_acc, +=, b / (a * log(2.)))
+
+BACKWARD_UNARY_OP(bw_log10, =, b / (a * log(10.)))
+BACKWARD_UNARY_OP(bw_log10_acc, +=, b / (a * log(10.)))
+
+BACKWARD_UNARY_OP(bw_invsqrt, =, -.5 * b / pow(a, 3. / 2.))
+BACKWARD_UNARY_OP(bw_invsqrt_acc, +=, -.5 * b / pow(a, 3. / 2.))
+
+BACKWARD_UNARY_OP(bw_sqrt, =, .5 * b / a)
+BACKWARD_UNARY_OP(bw_sqrt_acc, +=, .5 * b / a)
+
+BACKWARD_UNARY_OP(bw_abs, =, b * (SIGN(a)))
+BACKWARD_UNARY_OP(bw_abs_acc, +=, b * (SIGN(a)))
+
+BACKWARD_UNARY_OP(bw_reciprocal, =, -b / (a * a))
+BACKWARD_UNARY_OP(bw_reciprocal_acc, +=, -b / (a * a))
+
+BACKWARD_UNARY_OP(bw_relu, =, a < 0 ? 0 : b)
+BACKWARD_UNARY_OP(bw_relu_acc, +=, a < 0 ? 0 : b)
+
+BACKWARD_UNARY_OP(bw_leaky_relu, =, a < 0 ? param * b : b)
+BACKWARD_UNARY_OP(bw_leaky_relu_acc, +=, a < 0 ? param * b : b)
+
+#endif //CORE_UNARY_BW
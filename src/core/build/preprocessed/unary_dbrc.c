@@ -8,19 +8,17 @@
 #include <string.h>
 #include "./util.h"
 #include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
 
 #define DEBROADCASTING_UNARY_OP(NAME, ASSIGNMENT, RESULT)  \
-void NAME(struct tensor_t *_a, struct tensor_t *dest, float param) { \
-    size_t diff = dest->nelem == 1 ? _a->rank : _a->rank - dest->rank, n_elem_var_shape = 1; \
- \
-    /* // compute number of elements of the source tensor */ \
-    /* // that sum up to one element of the dest tensor */ \
-    for (size_t i = 0; i < diff; i++) { \
-        n_elem_var_shape *= _a->shape[i]; \
-    } \
+void NAME##_range(void* args, size_t start, size_t end) { \
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *dest = ((struct kernel_args_t*)args)->res; \
+    size_t diff = ((struct kernel_args_t*)args)->diff, n_elem_var_shape = ((struct kernel_args_t*)args)->nvar; \
+    float param = ((struct kernel_args_t*)args)->param; \
  \
-    /* // iterate over all elements in the destination tensor */ \
-    for (size_t i = 0; i < dest->nelem; i++) { \
+    /* // iterate over the elements of the range in the destination tensor */ \
+    for (size_t i = start; i < end; i++) { \
         size_t src_base_coord = _a->offset; \
         size_t remainder = i; \
         size_t dest_coord = dest->offset; \
@@ -48,12 +46,26 @@ void NAME(struct tensor_t *_a, struct tensor_t *dest, float param) { \
                 remainder = remainder / _a->shape[dim]; \
                 src_coord += iaxis * _a->strides[dim]; \
             } \
-            float a = _a->data[src_coord]; \
+            float a = load_elem(_a, src_coord); \
             sum += RESULT; \
         } \
          \
-        dest->data[dest_coord] ASSIGNMENT sum; \
+        ASSIGN_ELEM(dest, dest_coord, ASSIGNMENT, sum); \
+    } \
+} \
+ \
+void NAME(struct tensor_t *_a, struct tensor_t *dest, float param) { \
+    size_t diff = dest->nelem == 1 ? _a->rank : _a->rank - dest->rank, n_elem_var_shape = 1; \
+ \
+    /* // compute number of elements of the source tensor */ \
+    /* // that sum up to one element of the dest tensor */ \
+    for (size_t i = 0; i < diff; i++) { \
+        n_elem_var_shape *= _a->shape[i]; \
     } \
+ \
+    /* // the elements of the destination tensor are independent of each other */ \
+    struct kernel_args_t args = { .a = _a, .res = dest, .param = param, .diff = diff, .nvar = n_elem_var_shape }; \
+    parallel_for(dest->nelem, n_elem_var_shape, NAME##_range, &args); \
 } \
 
 
@@ -117,6 +129,9 @@ DEBROADCASTING_UNARY_OP(sign_dbrc_acc, +=, SIGN(a))
 DEBROADCASTING_UNARY_OP(negate_dbrc, =, -a)
 DEBROADCASTING_UNARY_OP(negate_dbrc_acc, +=, -a)
 
+DEBROADCASTING_UNARY_OP(identity_dbrc, =, a)
+DEBROADCASTING_UNARY_OP(identity_dbrc_acc, +=, a)
+
 DEBROADCASTING_UNARY_OP(reciprocal_dbrc, =, 1. / a)
 DEBROADCASTING_UNARY_OP(reciprocal_dbrc_acc, +=, 1. / a)
 
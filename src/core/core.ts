@@ -0,0 +1,54 @@
+/**
+ * Loads the core.
+ *
+ * The default build targets wasm32, which limits the whole process to 4GB of memory.
+ * Setting the environment variable TALOS_MEMORY64=1 loads the memory64 build instead
+ * (built with `make main64`). It requires a runtime with memory64 support.
+ *
+ * Setting TALOS_THREADS=1 loads the multithreaded build (built with `make main_mt`),
+ * whose kernels can be split across a thread pool (see set_num_threads() in management.ts).
+ *
+ * Setting TALOS_NATIVE=1 loads the native shared library (built with `make native`) through
+ * bun:ffi instead of a wasm module (see native.ts). It is multithreaded and not limited to 4GB.
+ */
+const env: Record<string, string | undefined> = typeof process !== "undefined" ? process.env : {};
+export const memory64 = env.TALOS_MEMORY64 === "1";
+export const threads = env.TALOS_THREADS === "1";
+export const native = env.TALOS_NATIVE === "1";
+
+if (memory64 && threads) throw new Error("There is no core that is both multithreaded and memory64.");
+if (native && (memory64 || threads)) throw new Error("TALOS_NATIVE can't be combined with TALOS_MEMORY64 or TALOS_THREADS, they select wasm builds.");
+
+// size_t (struct fields, shapes, strides) is 64 bits wide in the memory64 and native cores
+export const wide_size_t = memory64 || native;
+
+// eslint-disable-next-line @typescript-eslint/no-explicit-any
+type Module = any;
+
+// the memory64 core returns size_t and pointers as BigInt, js uses numbers for them (exact up to 2^53).
+// emscripten replaces the exports of the module on their first call, so they are wrapped on access.
+function number_results(module: Module): Module {
+    return new Proxy(module, {
+        get(target, key) {
+            const value = target[key];
+            if (typeof key !== "string" || !key.startsWith("_") || typeof value !== "function") return value;
+
+            return (...args: unknown[]) => {
+                const result = value(...args);
+                return typeof result === "bigint" ? Number(result) : result;
+            };
+        },
+    });
+}
+
+const core = native
+    ? (await import("./native.ts")).default
+    : memory64
+    // @ts-ignore: only exists after building the memory64 core
+    ? number_results((await import("./build/index64.js")).default)
+    : threads
+    // @ts-ignore: only exists after building the multithreaded core
+    ? (await import("./build/index_mt.js")).default
+    : (await import("./build/index.js")).default;
+
+export default core;
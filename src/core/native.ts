@@ -0,0 +1,117 @@
+/**
+ * Loads the native core (built with `make native`) through bun:ffi.
+ *
+ * The result has the same shape as the emscripten modules: every export of the core is available
+ * as core._<name>, pointers are plain numbers. There is no linear memory, the tensors live in
+ * native allocations that are viewed through external ArrayBuffers (see core.buffer() and
+ * heap_array() in raw_tensor/layout.ts). size_t and pointers are 64 bits wide.
+ */
+import { dlopen, suffix, toArrayBuffer, type FFIFunction, type Pointer } from "bun:ffi";
+
+type Signature = Pick<FFIFunction, "args" | "returns">;
+
+const TENSOR = "ptr", SIZE = "u64";
+
+// functions that are exported by the wasm builds (see EF in the Makefile)
+const exports: Record<string, Signature> = {
+    create_tensor:       { args: [SIZE, SIZE], returns: "ptr" },
+    create_tensor_dtype: { args: [SIZE, SIZE, SIZE], returns: "ptr" },
+    free_tensor:         { args: [TENSOR], returns: "void" },
+    convert_tensor:      { args: [TENSOR, TENSOR], returns: "void" },
+    clone_tensor:        { args: [TENSOR, TENSOR], returns: "void" },
+    create_view:         { args: [TENSOR, SIZE, SIZE], returns: "ptr" },
+    create_reshape_view: { args: [TENSOR, SIZE], returns: "ptr" },
+    shift_view:          { args: [TENSOR, SIZE], returns: "void" },
+
+    init_uniform: { args: [TENSOR, "f32", "f32", "u32"], returns: "void" },
+    init_normal:  { args: [TENSOR, "f32", "f32", "u32"], returns: "void" },
+    init_fill:    { args: [TENSOR, "f32"], returns: "void" },
+
+    matmul:       { args: [TENSOR, TENSOR, TENSOR], returns: "void" },
+    matmul_acc:   { args: [TENSOR, TENSOR, TENSOR], returns: "void" },
+    dot:          { args: [TENSOR, TENSOR, TENSOR], returns: "void" },
+    dot_acc:      { args: [TENSOR, TENSOR, TENSOR], returns: "void" },
+    max_red_idx:  { args: [TENSOR], returns: "u64_fast" },
+    min_red_idx:  { args: [TENSOR], returns: "u64_fast" },
+    max_red_scl:  { args: [TENSOR], returns: "f32" },
+    min_red_scl:  { args: [TENSOR], returns: "f32" },
+    sum_red_scl:  { args: [TENSOR], returns: "f32" },
+    mean_red_scl: { args: [TENSOR], returns: "f32" },
+    sum_red_tns:  { args: [TENSOR, TENSOR], returns: "void" },
+    mean_red_tns: { args: [TENSOR, TENSOR], returns: "void" },
+
+    get_mgmt_ptr:   { args: [], returns: "ptr" },
+    pool_trim:      { args: [], returns: "void" },
+    set_pool_limit: { args: [SIZE], returns: "void" },
+    reserve_memory: { args: [SIZE], returns: "bool" },
+
+    create_program:  { args: [SIZE], returns: "ptr" },
+    free_program:    { args: ["ptr"], returns: "void" },
+    run_program:     { args: ["ptr", SIZE], returns: "void" },
+    get_nops:        { args: [], returns: "u64_fast" },
+    get_op_name:     { args: [SIZE], returns: "cstring" },
+    plan_program:    { args: ["ptr", SIZE], returns: "ptr" },
+    free_schedule:   { args: ["ptr"], returns: "void" },
+    run_schedule:    { args: ["ptr", "ptr"], returns: "void" },
+    get_parallelism: { args: ["ptr"], returns: "f32" },
+
+    create_optimizer:            { args: [SIZE, SIZE], returns: "ptr" },
+    free_optimizer:              { args: ["ptr"], returns: "void" },
+    set_optimizer_param:         { args: ["ptr", SIZE, TENSOR, TENSOR], returns: "void" },
+    set_optimizer_state:         { args: ["ptr", TENSOR], returns: "void" },
+    set_optimizer_hparams:       { args: ["ptr", "f32", "f32", "f32", "f32", "f32"], returns: "void" },
+    set_optimizer_grad_clipping: { args: ["ptr", "f32", "f32"], returns: "void" },
+    get_optimizer_grad_norm:     { args: ["ptr"], returns: "f32" },
+    optimizer_step:              { args: ["ptr"], returns: "void" },
+
+    set_num_threads: { args: [SIZE], returns: "u64_fast" },
+    get_num_threads: { args: [], returns: "u64_fast" },
+    set_profiling:   { args: ["i32"], returns: "void" },
+    get_kernel_time: { args: [], returns: "f64" },
+};
+
+// signatures of the generated ops, by the macro that generated them (see ops.json, written by the preprocessor)
+const generated: Record<string, Signature> = {
+    BROADCASTING_BINARY_OP:   { args: [TENSOR, TENSOR, TENSOR], returns: "void" },
+    DEBROADCASTING_BINARY_OP: { args: [TENSOR, TENSOR, TENSOR], returns: "void" },
+    PAIRWISE_UNARY_OP:        { args: [TENSOR, TENSOR, "f32"], returns: "void" },
+    BROADCASTING_UNARY_OP:    { args: [TENSOR, TENSOR, "f32"], returns: "void" },
+    DEBROADCASTING_UNARY_OP:  { args: [TENSOR, TENSOR, "f32"], returns: "void" },
+    BACKWARD_UNARY_OP:        { args: [TENSOR, TENSOR, TENSOR, "f32"], returns: "void" },
+    BACKWARD_BINARY_OP:       { args: [TENSOR, TENSOR, TENSOR, TENSOR], returns: "void" },
+    DROPOUT_OP:               { args: [TENSOR, TENSOR, "f32", "u32"], returns: "void" },
+};
+
+const generators: Record<string, string> = await Bun.file(new URL("./build/preprocessed/ops.json", import.meta.url)).json();
+
+const symbols: Record<string, Signature> = { ...exports };
+for (const [op, macro] of Object.entries(generators)) {
+    if (!(macro in generated)) throw new Error(`[core] no ffi signature for ops generated by ${macro} (${op}).`);
+    symbols[op] = generated[macro];
+}
+
+const path = new URL(`./build/libtalos_core.${suffix}`, import.meta.url).pathname;
+const { symbols: fns } = dlopen(path, symbols);
+
+// eslint-disable-next-line @typescript-eslint/no-explicit-any
+const core: Record<string, any> = {
+    native: true,
+
+    // external ArrayBuffer over bytes at ptr. it stays valid until the allocation is freed.
+    buffer: (ptr: number, bytes: number): ArrayBuffer => toArrayBuffer(ptr as Pointer, 0, bytes),
+
+    // the subset of emscripten's ccall that is used by the js side
+    ccall: (name: string, _returns: string, _types: string[], args: number[]) => {
+        const result = fns[name](...args);
+        return typeof result === "object" && result !== null ? result.toString() : result;
+    },
+};
+
+for (const [name, fn] of Object.entries(fns)) {
+    // ffi returns null for null pointers, the wasm builds return 0
+    core[`_${name}`] = symbols[name].returns === "ptr"
+        ? (...args: number[]) => fn(...args) ?? 0
+        : fn;
+}
+
+export default core;
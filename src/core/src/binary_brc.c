@@ -6,22 +6,16 @@
 #include <stddef.h>
 #include <stdio.h>
 #include "./util.h"
+#include "./half.h"
+#include "./threads.h"
 
 #define BROADCASTING_BINARY_OP(NAME, ASSIGNMENT, RESULT) [[[
-void NAME(struct tensor_t *_a, struct tensor_t *_b, struct tensor_t *res) {
+void NAME##_range(void* args, size_t start, size_t end) {
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *_b = ((struct kernel_args_t*)args)->b, *res = ((struct kernel_args_t*)args)->res;
+    size_t *strides_a = ((struct kernel_args_t*)args)->strides_a, *strides_b = ((struct kernel_args_t*)args)->strides_b;
     size_t ia, ib, ires, iaxis, remainder, dim;
-    size_t strides_a[res->rank], strides_b[res->rank];
 
-    // extend stride arrays of a and b with zeros to match rank of result tensor
-    for (dim = res->rank; dim-- > 0;) {
-        // original condition was (res->rank - a->rank > dim) but we cannot safely do
-        // subtractions here because size_t would underflow so i reformulated the inequality
-        //               [pad with zeros to the left]     [when shape[dim] is 1 we can't step to the next element, so set stride to 0]
-        strides_a[dim] = (res->rank > dim + _a->rank ? 0 : (_a->shape[dim - (res->rank - _a->rank)] == 1 ? 0 : _a->strides[dim - (res->rank - _a->rank)]));
-        strides_b[dim] = (res->rank > dim + _b->rank ? 0 : (_b->shape[dim - (res->rank - _b->rank)] == 1 ? 0 : _b->strides[dim - (res->rank - _b->rank)]));
-    }
-
-    for (size_t i = 0; i < res->nelem; i++) {
+    for (size_t i = start; i < end; i++) {
         // get indices of a, b and result
         ia = _a->offset; ib = _b->offset; ires = res->offset; remainder = i;
 
@@ -34,10 +28,28 @@ void NAME(struct tensor_t *_a, struct tensor_t *_b, struct tensor_t *res) {
             ires += iaxis * res->strides[dim];
         }
 
-        float a = _a->data[ia], b = _b->data[ib];
-        res->data[ires] ASSIGNMENT RESULT;
+        // elements are converted to fp32 if stored in half precision
+        float a = load_elem(_a, ia), b = load_elem(_b, ib);
+        ASSIGN_ELEM(res, ires, ASSIGNMENT, RESULT);
     }
 }
+
+void NAME(struct tensor_t *_a, struct tensor_t *_b, struct tensor_t *res) {
+    size_t dim;
+    size_t strides_a[res->rank], strides_b[res->rank];
+
+    // extend stride arrays of a and b with zeros to match rank of result tensor
+    for (dim = res->rank; dim-- > 0;) {
+        // original condition was (res->rank - a->rank > dim) but we cannot safely do
+        // subtractions here because size_t would underflow so i reformulated the inequality
+        //               [pad with zeros to the left]     [when shape[dim] is 1 we can't step to the next element, so set stride to 0]
+        strides_a[dim] = (res->rank > dim + _a->rank ? 0 : (_a->shape[dim - (res->rank - _a->rank)] == 1 ? 0 : _a->strides[dim - (res->rank - _a->rank)]));
+        strides_b[dim] = (res->rank > dim + _b->rank ? 0 : (_b->shape[dim - (res->rank - _b->rank)] == 1 ? 0 : _b->strides[dim - (res->rank - _b->rank)]));
+    }
+
+    struct kernel_args_t args = { .a = _a, .b = _b, .res = res, .strides_a = strides_a, .strides_b = strides_b };
+    parallel_for(res->nelem, 1, NAME##_range, &args);
+}
 ]]]
 
 @GENERATE (BROADCASTING_BINARY_OP) [[[
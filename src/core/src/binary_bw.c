@@ -0,0 +1,109 @@
+// fused backward passes of broadcasting binary operations: res (+)= sum of grad * df/dx
+// a and b are the operands, they are broadcast to the shape of c, which is the gradient of the result.
+// res is the gradient of one operand. its elements are summed over the axes that operand was broadcast along.
+
+#ifndef CORE_BINARY_BW
+#define CORE_BINARY_BW
+
+#include <stddef.h>
+#include <math.h>
+#include "./util.h"
+#include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
+
+// size of axis dim of t when its shape is padded with ones to the given rank
+static inline size_t extended_axis(struct tensor_t* t, size_t rank, size_t dim) {
+    return rank > dim + t->rank ? 1 : t->shape[dim - (rank - t->rank)];
+}
+
+// strides of t, extended with zeros to the given rank (see binary_brc.c)
+static inline void extend_strides(struct tensor_t* t, size_t rank, size_t* strides) {
+    for (size_t dim = rank; dim-- > 0;) {
+        strides[dim] = extended_axis(t, rank, dim) == 1 ? 0 : t->strides[dim - (rank - t->rank)];
+    }
+}
+
+#define BACKWARD_BINARY_OP(NAME, ASSIGNMENT, RESULT) [[[
+void NAME##_range(void* args, size_t start, size_t end) {
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *_b = ((struct kernel_args_t*)args)->b, *_c = ((struct kernel_args_t*)args)->c, *res = ((struct kernel_args_t*)args)->res;
+    size_t *strides_a = ((struct kernel_args_t*)args)->strides_a, *strides_b = ((struct kernel_args_t*)args)->strides_b;
+    size_t *strides_res = ((struct kernel_args_t*)args)->strides_res, nvar = ((struct kernel_args_t*)args)->nvar;
+    size_t rank = _c->rank;
+
+    // pairwise: no broadcasting, no views and all tensors in fp32
+    if (strides_a == NULL) {
+        for (size_t i = start; i < end; i++) {
+            float a = _a->data[i], b = _b->data[i], g = _c->data[i];
+            res->data[i] ASSIGNMENT RESULT;
+        }
+
+        return;
+    }
+
+    for (size_t i = start; i < end; i++) {
+        size_t base_a = _a->offset, base_b = _b->offset, base_c = _c->offset, ires = res->offset, remainder = i;
+
+        // axes of res: the same element of a, b and c for every contribution
+        for (size_t dim = rank; dim-- > 0;) {
+            if (extended_axis(res, rank, dim) == 1) continue;
+            size_t iaxis = remainder % _c->shape[dim];
+            remainder /= _c->shape[dim];
+            base_a += iaxis * strides_a[dim];
+            base_b += iaxis * strides_b[dim];
+            base_c += iaxis * _c->strides[dim];
+            ires += iaxis * strides_res[dim];
+        }
+
+        // axes that res was broadcast along: summed up
+        float sum = 0;
+        for (size_t j = 0; j < nvar; j++) {
+            size_t ia = base_a, ib = base_b, ic = base_c;
+            remainder = j;
+
+            for (size_t dim = rank; dim-- > 0;) {
+                if (extended_axis(res, rank, dim) != 1) continue;
+                size_t iaxis = remainder % _c->shape[dim];
+                remainder /= _c->shape[dim];
+                ia += iaxis * strides_a[dim];
+                ib += iaxis * strides_b[dim];
+                ic += iaxis * _c->strides[dim];
+            }
+
+            // elements are converted to fp32 if stored in half precision
+            float a = load_elem(_a, ia), b = load_elem(_b, ib), g = load_elem(_c, ic);
+            sum += RESULT;
+        }
+
+        ASSIGN_ELEM(res, ires, ASSIGNMENT, sum);
+    }
+}
+
+void NAME(struct tensor_t* _a, struct tensor_t* _b, struct tensor_t* _c, struct tensor_t* res) {
+    size_t rank = _c->rank, nvar = _c->nelem / res->nelem;
+    size_t strides_a[rank], strides_b[rank], strides_res[rank];
+    struct kernel_args_t args = { .a = _a, .b = _b, .c = _c, .res = res, .nvar = nvar };
+
+    bool pairwise = _a->nelem == res->nelem && _b->nelem == res->nelem && _c->nelem == res->nelem;
+    bool fp32 = _a->dtype == DTYPE_FP32 && _b->dtype == DTYPE_FP32 && _c->dtype == DTYPE_FP32 && res->dtype == DTYPE_FP32;
+    if (!pairwise || !fp32 || _a->isview || _b->isview || _c->isview || res->isview) {
+        extend_strides(_a, rank, strides_a);
+        extend_strides(_b, rank, strides_b);
+        extend_strides(res, rank, strides_res);
+        args.strides_a = strides_a;
+        args.strides_b = strides_b;
+        args.strides_res = strides_res;
+    }
+
+    parallel_for(res->nelem, nvar, NAME##_range, &args);
+}
+]]]
+
+// the suffix is the operand whose gradient is computed
+@GENERATE (BACKWARD_BINARY_OP) [[[
+    bw_div_b:     -g * a / (b * b)
+    bw_pow_a:     g * b * pow(a, b - 1)
+    bw_pow_b:     g * pow(a, b) * log(a)
+]]]
+
+#endif //CORE_BINARY_BW
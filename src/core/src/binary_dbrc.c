@@ -3,23 +3,20 @@
 
 #include "float.h"
 #include "util.h"
+#include "half.h"
+#include "threads.h"
 
 // this function sums along the appropriate axis such that a larger tensor a
 // can be "de-broadcasted" into a smaller tensor res.
 // e.g. if a is of shape [5, 2, 9] and be of shape [2, 9], then
 // sum tensor a along the axis of size 5 such that we get a tensor [2, 9]
 #define DEBROADCASTING_BINARY_OP(NAME, ASSIGNMENT, RESULT) [[[
-void NAME(struct tensor_t *_a, struct tensor_t *_b, struct tensor_t *dest) {
-    size_t diff = _b->nelem == 1 ? _b->nelem : _a->rank - dest->rank, n_elem_var_shape = 1;
-
-    // compute number of elements of the source tensor
-    // that sum up to one element of the dest tensor
-    for (size_t i = 0; i < diff; i++) {
-        n_elem_var_shape *= _a->shape[i];
-    }
+void NAME##_range(void* args, size_t start, size_t end) {
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *_b = ((struct kernel_args_t*)args)->b, *dest = ((struct kernel_args_t*)args)->res;
+    size_t diff = ((struct kernel_args_t*)args)->diff, n_elem_var_shape = ((struct kernel_args_t*)args)->nvar;
 
-    // iterate over all elements in the destination tensor
-    for (size_t i = 0; i < dest->nelem; i++) {
+    // iterate over the elements of the range in the destination tensor
+    for (size_t i = start; i < end; i++) {
         size_t src_base_coord = _a->offset;
         size_t remainder = i;
         size_t b_coord = _b->offset;
@@ -49,14 +46,28 @@ void NAME(struct tensor_t *_a, struct tensor_t *_b, struct tensor_t *dest) {
                 remainder = remainder / _a->shape[dim];
                 src_coord += iaxis * _a->strides[dim];
             }
-            float b = _b->data[b_coord];
-            float a = _a->data[src_coord];
+            float b = load_elem(_b, b_coord);
+            float a = load_elem(_a, src_coord);
             sum += RESULT;
         }
         
-        dest->data[dest_coord] ASSIGNMENT sum;
+        ASSIGN_ELEM(dest, dest_coord, ASSIGNMENT, sum);
     }
 }
+
+void NAME(struct tensor_t *_a, struct tensor_t *_b, struct tensor_t *dest) {
+    size_t diff = _b->nelem == 1 ? _b->nelem : _a->rank - dest->rank, n_elem_var_shape = 1;
+
+    // compute number of elements of the source tensor
+    // that sum up to one element of the dest tensor
+    for (size_t i = 0; i < diff; i++) {
+        n_elem_var_shape *= _a->shape[i];
+    }
+
+    // the elements of the destination tensor are independent of each other
+    struct kernel_args_t args = { .a = _a, .b = _b, .res = dest, .diff = diff, .nvar = n_elem_var_shape };
+    parallel_for(dest->nelem, n_elem_var_shape, NAME##_range, &args);
+}
 ]]]
 
 @GENERATE (DEBROADCASTING_BINARY_OP) [[[
@@ -3,6 +3,7 @@
 
 #include <stdlib.h>
 #include "./tensor.h"
+#include "./half.h"
 
 #define DROPOUT_OP(NAME, ASSIGNMENT, RESULT) [[[
 void NAME(struct tensor_t* _a, struct tensor_t* res, float _p, unsigned int seed) {
@@ -12,9 +13,20 @@ void NAME(struct tensor_t* _a, struct tensor_t* res, float _p, unsigned int seed
     // scale inputs that were not set to 0 up by 1 / (1-p)
     float scale = 1. / (1. - _p);
 
+    // half precision: elements are converted to fp32 for the computation
+    if (_a->dtype != DTYPE_FP32 || res->dtype != DTYPE_FP32) {
+        for (size_t i = 0; i < _a->nelem; i++) {
+            float a = load_elem(_a, get_index(_a, i));
+            size_t ires = get_index(res, i);
+            ASSIGN_ELEM(res, ires, ASSIGNMENT, RESULT);
+        }
+
+        return;
+    }
+
     if (_a->isview || res->isview) {
         for (size_t i = 0; i < _a->nelem; i++) {
-            float a = get_index(_a, i);
+            float a = _a->data[get_index(_a, i)];
             res->data[get_index(res, i)] ASSIGNMENT RESULT;
         }
 
@@ -0,0 +1,106 @@
+#include "./half.h"
+#include <string.h>
+
+// conversions between fp32 and the half precision storage types.
+// fp32 -> half conversions round to nearest even.
+
+float fp16_to_fp32(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exp  = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t bits;
+    float f;
+
+    if (exp == 0x1f) bits = sign | 0x7f800000 | (mant << 13);              // inf/nan
+    else if (exp != 0) bits = sign | ((exp + 112) << 23) | (mant << 13);    // normal
+    else if (mant == 0) bits = sign;                                        // zero
+    else {
+        // subnormal: normalize the mantissa
+        exp = 113;
+        while (!(mant & 0x400)) { mant <<= 1; exp--; }
+        bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+    }
+
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+uint16_t fp32_to_fp16(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+
+    uint16_t sign = (bits >> 16) & 0x8000;
+    uint32_t exp  = (bits >> 23) & 0xff;
+    uint32_t mant = bits & 0x7fffff;
+    int32_t e = (int32_t)exp - 127 + 15;
+    uint32_t half, rem, halfway, shift;
+
+    if (exp == 0xff) return sign | 0x7c00 | (mant ? 0x200 : 0);    // inf/nan
+    if (e >= 0x1f) return sign | 0x7c00;                            // overflow
+
+    if (e <= 0) {
+        // subnormal or zero
+        if (e < -10) return sign;
+        mant |= 0x800000;
+        shift = 14 - e;
+        half = mant >> shift;
+        rem = mant & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    } else {
+        half = ((uint32_t)e << 10) | (mant >> 13);
+        rem = mant & 0x1fff;
+        halfway = 0x1000;
+    }
+
+    // a carry into the exponent is correct here, it rounds up to the next power of two (or inf)
+    if (rem > halfway || (rem == halfway && (half & 1))) half++;
+    return sign | half;
+}
+
+float bf16_to_fp32(uint16_t h) {
+    uint32_t bits = (uint32_t)h << 16;
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+uint16_t fp32_to_bf16(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+
+    // keep nans quiet instead of rounding them to inf
+    if ((bits & 0x7fffffff) > 0x7f800000) return (bits >> 16) | 0x40;
+
+    bits += 0x7fff + ((bits >> 16) & 1);
+    return bits >> 16;
+}
+
+// loads the element at index i of the data array as fp32
+float load_elem(struct tensor_t* t, size_t i) {
+    switch (t->dtype) {
+        case DTYPE_FP16: return fp16_to_fp32(((uint16_t*)t->data)[i]);
+        case DTYPE_BF16: return bf16_to_fp32(((uint16_t*)t->data)[i]);
+        default:         return t->data[i];
+    }
+}
+
+// stores an fp32 value at index i of the data array, converting it to the dtype of the tensor
+void store_elem(struct tensor_t* t, size_t i, float value) {
+    switch (t->dtype) {
+        case DTYPE_FP16: ((uint16_t*)t->data)[i] = fp32_to_fp16(value); break;
+        case DTYPE_BF16: ((uint16_t*)t->data)[i] = fp32_to_bf16(value); break;
+        default:         t->data[i] = value;
+    }
+}
+
+// copies the elements of a into res, converting them to the dtype of res
+void convert_tensor(struct tensor_t* a, struct tensor_t* res) {
+    if (!a->isview && !res->isview && a->dtype == res->dtype) {
+        memcpy(res->data, a->data, a->nelem * DTYPE_SIZE(a->dtype));
+        return;
+    }
+
+    for (size_t i = 0; i < a->nelem; i++) {
+        store_elem(res, get_index(res, i), load_elem(a, get_index(a, i)));
+    }
+}
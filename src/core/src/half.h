@@ -0,0 +1,27 @@
+#ifndef CORE_HALF
+#define CORE_HALF
+
+#include <stddef.h>
+#include <stdint.h>
+#include "./tensor.h"
+
+// number of bytes of one element of a dtype
+#define DTYPE_SIZE(dtype) ((dtype) == DTYPE_FP32 ? sizeof(float) : sizeof(uint16_t))
+
+// number of floats needed to store nelem elements of a dtype (data is allocated as float*)
+#define DTYPE_NFLOATS(nelem, dtype) (((nelem) * DTYPE_SIZE(dtype) + sizeof(float) - 1) / sizeof(float))
+
+// applies an assignment (= or +=) to an element of a tensor of any dtype
+#define ASSIGN_ELEM(t, i, ASSIGNMENT, value) { float _elem = load_elem(t, i); _elem ASSIGNMENT (value); store_elem(t, i, _elem); }
+
+float fp16_to_fp32(uint16_t h);
+uint16_t fp32_to_fp16(float f);
+float bf16_to_fp32(uint16_t h);
+uint16_t fp32_to_bf16(float f);
+
+float load_elem(struct tensor_t* t, size_t i);
+void store_elem(struct tensor_t* t, size_t i, float value);
+
+void convert_tensor(struct tensor_t* a, struct tensor_t* res);
+
+#endif //CORE_HALF
@@ -1,4 +1,6 @@
 #include "./mgmt.h"
+#include "./pool.h"
+#include "./platform.h"
 
 struct mgmt_t* get_mgmt_ptr() {
     return &mgmt;
@@ -7,4 +9,13 @@ struct mgmt_t* get_mgmt_ptr() {
 void init_mgmt() {
     mgmt.allocated = 0;
     mgmt.ntensors = 0;
+    mgmt.pooled = 0;
+    mgmt.pool_limit = POOL_DEFAULT_LIMIT;
+    mgmt.pool_hits = 0;
+}
+
+// grows the heap such that at least the specified amount of bytes can be allocated
+// without another memory growth event. returns false if the heap can't grow that large.
+bool reserve_memory(size_t bytes) {
+    return platform_reserve(bytes);
 }
@@ -1,13 +1,20 @@
 #ifndef CORE_MGMT
 #define CORE_MGMT
 
+#include <stddef.h>
+#include <stdbool.h>
+
 struct mgmt_t {
     size_t allocated;  // amount of bytes allocated (only takes tensors into account)
     size_t ntensors; // number registered tensors (should take around 584942 years to overflow at 1Mio increments/s)
+    size_t pooled;     // amount of bytes held by free buffers of the tensor pool
+    size_t pool_limit; // maximum amount of bytes the tensor pool may hold
+    size_t pool_hits;  // number of allocations that were served by the tensor pool
 } mgmt;
 
 void init_mgmt();
 struct mgmt_t* get_mgmt_ptr();
+bool reserve_memory(size_t bytes);
 
 
 #endif//CORE_MGMT
@@ -0,0 +1,53 @@
+#ifndef CORE_PLATFORM
+#define CORE_PLATFORM
+
+// everything that depends on emscripten. the core is built to wasm by default,
+// native builds (make native, see Makefile) are shared libraries for profiling and sanitizers.
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __EMSCRIPTEN__
+
+#include <stdint.h>
+#include <unistd.h>
+#include <emscripten.h>
+#include <emscripten/heap.h>
+
+#define print_js(msg, var) EM_ASM({ console.log(msg, $0); }, var);
+
+// time in ms, for measuring durations
+static inline double platform_now() {
+    return emscripten_get_now();
+}
+
+// grows the heap such that at least the specified amount of bytes can be allocated
+// without another memory growth event. returns false if the heap can't grow that large.
+static inline bool platform_reserve(size_t bytes) {
+    size_t required = (uintptr_t)sbrk(0) + bytes;
+    if (required <= emscripten_get_heap_size()) return true;
+    return emscripten_resize_heap(required);
+}
+
+#else
+
+#include <stdio.h>
+#include <time.h>
+
+#define print_js(msg, var) fprintf(stderr, "%s %f\n", msg, (double)(var));
+
+static inline double platform_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e3 + now.tv_nsec / 1e6;
+}
+
+// native heaps grow on demand
+static inline bool platform_reserve(size_t bytes) {
+    (void)bytes;
+    return true;
+}
+
+#endif //__EMSCRIPTEN__
+
+#endif //CORE_PLATFORM
@@ -0,0 +1,23 @@
+#ifndef CORE_POOL
+#define CORE_POOL
+
+#include <stddef.h>
+
+// data buffers are recycled in size classes. there are four classes per power of two,
+// so a buffer is at most 25% larger than requested. buffers of up to POOL_MIN_NELEM
+// elements share the smallest class.
+#define POOL_MIN_NELEM 4
+#define POOL_NCLASSES (sizeof(size_t) * 8 * 4)
+
+// default upper bound for the amount of memory that is held by free buffers
+#define POOL_DEFAULT_LIMIT (64 * 1024 * 1024)
+
+size_t pool_class(size_t nelem);
+size_t pool_capacity(size_t nelem);
+
+float* pool_alloc(size_t nelem);
+void pool_release(float* ptr, size_t nelem);
+void pool_trim();
+void set_pool_limit(size_t bytes);
+
+#endif //CORE_POOL
@@ -0,0 +1,112 @@
+#include "./program.h"
+#include "./optim.h"
+#include "./util.h"
+#include <stdlib.h>
+
+// kernel signatures, see enum instr_kind_t
+typedef void (*op_fn_t)(void);
+typedef void (*unary_fn_t)(struct tensor_t*, struct tensor_t*, float);
+typedef void (*binary_fn_t)(struct tensor_t*, struct tensor_t*, struct tensor_t*);
+typedef void (*copy_fn_t)(struct tensor_t*, struct tensor_t*);
+typedef void (*fill_fn_t)(struct tensor_t*, float);
+typedef void (*dropout_fn_t)(struct tensor_t*, struct tensor_t*, float, unsigned int);
+typedef size_t (*index_fn_t)(struct tensor_t*);
+typedef void (*backward_fn_t)(struct tensor_t*, struct tensor_t*, struct tensor_t*, float);
+typedef void (*optimizer_fn_t)(struct optimizer_t*);
+typedef void (*backward_binary_fn_t)(struct tensor_t*, struct tensor_t*, struct tensor_t*, struct tensor_t*);
+
+// kernels that are not generated by the preprocessor
+#define BUILTIN_OPS \
+    OP(matmul) OP(matmul_acc) OP(dot) OP(dot_acc) \
+    OP(sum_red_tns) OP(mean_red_tns) OP(min_red_idx) OP(max_red_idx) \
+    OP(clone_tensor) OP(convert_tensor) OP(init_fill) \
+    OP(optimizer_step)
+
+// the op table holds the builtin kernels followed by all generated ones (ops.def is
+// written by the preprocessor). js looks up the indices by name, so the order does not matter.
+#define OP(NAME) (op_fn_t)NAME,
+static const op_fn_t op_table[] = {
+    BUILTIN_OPS
+    #include "./ops.def"
+};
+#undef OP
+
+#define OP(NAME) #NAME,
+static const char* op_names[] = {
+    BUILTIN_OPS
+    #include "./ops.def"
+};
+#undef OP
+
+size_t get_nops() {
+    return sizeof(op_table) / sizeof(op_fn_t);
+}
+
+const char* get_op_name(size_t op) {
+    return op < get_nops() ? op_names[op] : NULL;
+}
+
+struct instr_t* create_program(size_t ninstr) {
+    return calloc(ninstr, sizeof(struct instr_t));
+}
+
+void free_program(struct instr_t* program) {
+    free(program);
+}
+
+// there are no checks, js validates the shapes of all tensors when it records the program
+void run_instr(struct instr_t* instr) {
+    op_fn_t fn = op_table[instr->op];
+    unsigned int* seed;
+    size_t index;
+
+    switch (instr->kind) {
+        case INSTR_UNARY:
+            ((unary_fn_t)fn)(instr->a, instr->dest, instr->param);
+            break;
+
+        case INSTR_BINARY:
+            ((binary_fn_t)fn)(instr->a, instr->b, instr->dest);
+            break;
+
+        case INSTR_COPY:
+            ((copy_fn_t)fn)(instr->a, instr->dest);
+            break;
+
+        case INSTR_FILL:
+            ((fill_fn_t)fn)(instr->dest, instr->param);
+            break;
+
+        // the seeds are kept in the data of tensor b, so the forward and backward
+        // programs of a dropout node use the same mask
+        case INSTR_DROPOUT_RESEED:
+        case INSTR_DROPOUT:
+            seed = (unsigned int*)instr->b->data + instr->aux;
+            if (instr->kind == INSTR_DROPOUT_RESEED) *seed = *seed * 1103515245u + 12345u;
+            ((dropout_fn_t)fn)(instr->a, instr->dest, instr->param, *seed);
+            break;
+
+        case INSTR_SHIFT:
+            index = ((index_fn_t)fn)(instr->a);
+            shift_view(instr->dest, index);
+            if (instr->b) shift_view(instr->b, index);
+            break;
+
+        case INSTR_BACKWARD:
+            ((backward_fn_t)fn)(instr->a, instr->b, instr->dest, instr->param);
+            break;
+
+        case INSTR_OPTIMIZER:
+            ((optimizer_fn_t)fn)((struct optimizer_t*)instr->aux);
+            break;
+
+        case INSTR_BACKWARD_BINARY:
+            ((backward_binary_fn_t)fn)(instr->a, instr->b, instr->c, instr->dest);
+            break;
+    }
+}
+
+// executes the instructions in order
+void run_program(struct instr_t* program, size_t ninstr) {
+    for (size_t i = 0; i < ninstr; i++) run_instr(&program[i]);
+}
@@ -0,0 +1,42 @@
+#ifndef CORE_PROGRAM
+#define CORE_PROGRAM
+
+#include <stddef.h>
+#include "./tensor.h"
+
+// kinds of instructions. the kind determines the signature of the kernel that is called.
+enum instr_kind_t {
+    INSTR_UNARY = 0,          // op(a, dest, param)
+    INSTR_BINARY = 1,         // op(a, b, dest)
+    INSTR_COPY = 2,           // op(a, dest), e.g. reductions into a tensor or clone
+    INSTR_FILL = 3,           // op(dest, param)
+    INSTR_DROPOUT = 4,        // op(a, dest, param, seed), the seed is slot aux of tensor b
+    INSTR_DROPOUT_RESEED = 5, // like INSTR_DROPOUT, but advances the seed first
+    INSTR_SHIFT = 6,          // moves the views dest and b (if set) to the element op(a)
+    INSTR_BACKWARD = 7,       // op(a, b, dest, param), fused backward passes (see unary_bw.c)
+    INSTR_OPTIMIZER = 8,      // op(aux), aux is a struct optimizer_t* (see optim.c)
+    INSTR_BACKWARD_BINARY = 9,// op(a, b, c, dest), fused backward passes (see binary_bw.c)
+};
+
+// a single instruction of a program. all tensors are referenced by pointer,
+// so a program stays valid for as long as the tensors it references.
+struct instr_t {
+    size_t kind;           // enum instr_kind_t
+    size_t op;             // index into the op table (see get_op_name())
+    struct tensor_t* a;
+    struct tensor_t* b;
+    struct tensor_t* c;
+    struct tensor_t* dest;
+    size_t aux;
+    float param;
+};
+
+size_t get_nops();
+const char* get_op_name(size_t op);
+
+struct instr_t* create_program(size_t ninstr);
+void free_program(struct instr_t* program);
+void run_instr(struct instr_t* instr);
+void run_program(struct instr_t* program, size_t ninstr);
+
+#endif //CORE_PROGRAM
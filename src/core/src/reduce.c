@@ -3,6 +3,76 @@
 
 #include "float.h"
 #include "util.h"
+#include "half.h"
+#include "threads.h"
+
+// large tensors are reduced in a fixed number of blocks that are processed in parallel.
+// the number of blocks does not depend on the number of threads, so neither do the results.
+#define REDUCE_NBLOCKS 64
+
+struct reduce_args_t {
+    struct tensor_t* src;
+    size_t nblocks;
+    size_t block_size;
+    float partial[REDUCE_NBLOCKS];
+};
+
+void sum_blocks(void* _args, size_t start, size_t end) {
+    struct reduce_args_t* args = _args;
+
+    for (size_t block = start; block < end; block++) {
+        size_t first = block * args->block_size;
+        size_t last = first + args->block_size < args->src->nelem ? first + args->block_size : args->src->nelem;
+        register float sum = 0;
+
+        for (size_t i = first; i < last; i++) sum += get_item(args->src, i);
+        args->partial[block] = sum;
+    }
+}
+
+// doing this in a way that prevents overflow of float32 and also
+// reduces precision losses but is slightly inefficient
+void mean_blocks(void* _args, size_t start, size_t end) {
+    struct reduce_args_t* args = _args;
+
+    for (size_t block = start; block < end; block++) {
+        size_t first = block * args->block_size;
+        size_t last = first + args->block_size < args->src->nelem ? first + args->block_size : args->src->nelem;
+        register float mean = 0;
+
+        for (size_t i = first; i < last; i++) mean = (mean * (i - first) + get_item(args->src, i)) / (i - first + 1);
+        args->partial[block] = mean;
+    }
+}
+
+struct reduce_args_t reduce_blocks(struct tensor_t* src, range_fn_t fn) {
+    struct reduce_args_t args = { .src = src, .nblocks = src->nelem < PARALLEL_MIN_WORK ? 1 : REDUCE_NBLOCKS };
+    args.block_size = (src->nelem + args.nblocks - 1) / args.nblocks;
+    parallel_for(args.nblocks, args.block_size, fn, &args);
+    return args;
+}
+
+float parallel_sum(struct tensor_t* src) {
+    struct reduce_args_t args = reduce_blocks(src, sum_blocks);
+    float sum = 0;
+
+    for (size_t block = 0; block < args.nblocks; block++) sum += args.partial[block];
+    return sum;
+}
+
+// the means of the blocks are weighted by the number of elements in them
+float parallel_mean(struct tensor_t* src) {
+    struct reduce_args_t args = reduce_blocks(src, mean_blocks);
+    float mean = 0;
+
+    for (size_t block = 0; block < args.nblocks; block++) {
+        size_t first = block * args.block_size;
+        size_t count = first + args.block_size < src->nelem ? args.block_size : src->nelem - first;
+        mean += args.partial[block] * ((float)count / src->nelem);
+    }
+
+    return mean;
+}
 
 // these functions return scalar values directly
 // the in-place reduce operations are implemented below
@@ -30,25 +100,11 @@ float min_red_scl(struct tensor_t* a) {
 }
 
 float sum_red_scl(struct tensor_t* a) {
-    register float sum = 0;
-
-    for (size_t ires = 0; ires < a->nelem; ires++) {
-        sum += get_item(a, ires);
-    }
-
-    return sum;
+    return parallel_sum(a);
 }
 
-// doing this in a way that prevents overflow of float32 and also
-// reduces precision losses but is slightly inefficient
 float mean_red_scl(struct tensor_t* a) {
-    register float mean = 0;
-
-    for (size_t ires = 0; ires < a->nelem; ires++) {
-        mean = (mean * ires + get_item(a, ires)) / (ires + 1);
-    }
-
-    return mean;
+    return parallel_mean(a);
 }
 
 // finds the linear index where the largest element resides 
@@ -84,25 +140,11 @@ size_t min_red_idx(struct tensor_t* src) {
 }
 
 void sum_red_tns(struct tensor_t* src, struct tensor_t* dest) {
-    register float sum = 0;
-
-    for (size_t ires = 0; ires < src->nelem; ires++) {
-        sum += get_item(src, ires);
-    }
-
-    dest->data[get_index(dest, 0)] = sum;
+    store_elem(dest, get_index(dest, 0), parallel_sum(src));
 }
 
-// doing this in a way that prevents overflow of float32 and also
-// reduces precision losses but is slightly inefficient
 void mean_red_tns(struct tensor_t* src, struct tensor_t* dest) {
-    register float mean = 0;
-
-    for (size_t ires = 0; ires < src->nelem; ires++) {
-        mean = (mean * ires + get_item(src, ires)) / (ires + 1);
-    }
-
-    dest->data[get_index(dest, 0)] = mean;
+    store_elem(dest, get_index(dest, 0), parallel_mean(src));
 }
 
 #endif//CORE_REDUCE
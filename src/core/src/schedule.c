@@ -0,0 +1,301 @@
+#include "./schedule.h"
+#include "./threads.h"
+#include "./half.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MAX_ACCESSES 5
+
+// memory accessed by an instruction. tensors are identified by the whole data array of their
+// base tensor, so all views of a tensor conflict (INSTR_SHIFT moves views around at runtime).
+struct access_t {
+    char* start;
+    char* end;
+    bool write;
+};
+
+void add_access(struct access_t* accesses, size_t* naccesses, struct tensor_t* t, bool write) {
+    if (t == NULL) return;
+
+    char* start = (char*)t->data;
+    accesses[(*naccesses)++] = (struct access_t){ start, start + t->ndata * DTYPE_SIZE(t->dtype), write };
+}
+
+size_t get_accesses(struct instr_t* instr, struct access_t* accesses) {
+    size_t naccesses = 0;
+
+    switch (instr->kind) {
+        case INSTR_FILL:
+            break;
+
+        // the seed in tensor b is advanced
+        case INSTR_DROPOUT_RESEED:
+            add_access(accesses, &naccesses, instr->a, false);
+            add_access(accesses, &naccesses, instr->b, true);
+            break;
+
+        // the views dest and b are moved
+        case INSTR_SHIFT:
+            add_access(accesses, &naccesses, instr->a, false);
+            add_access(accesses, &naccesses, instr->b, true);
+            break;
+
+        // an optimizer step updates all parameters, it is ordered like a write to all of the memory
+        case INSTR_OPTIMIZER:
+            accesses[naccesses++] = (struct access_t){ (char*)0, (char*)UINTPTR_MAX, true };
+            break;
+
+        default:
+            add_access(accesses, &naccesses, instr->a, false);
+            add_access(accesses, &naccesses, instr->b, false);
+            add_access(accesses, &naccesses, instr->c, false);
+            break;
+    }
+
+    add_access(accesses, &naccesses, instr->dest, true);
+    return naccesses;
+}
+
+bool overlaps(struct access_t* x, struct access_t* y) {
+    return x->start < y->end && y->start < x->end;
+}
+
+bool covers(struct access_t* x, struct access_t* y) {
+    return x->start <= y->start && y->end <= x->end;
+}
+
+// estimated number of element operations
+float instr_cost(struct instr_t* instr) {
+    op_fn_t fn = op_table[instr->op];
+    float cost = instr->dest ? instr->dest->nelem : 1;
+
+    if (instr->a && instr->a->nelem > cost) cost = instr->a->nelem;
+    if (instr->c && instr->c->nelem > cost) cost = instr->c->nelem;
+
+    if (instr->kind == INSTR_OPTIMIZER) {
+        struct optimizer_t* opt = (struct optimizer_t*)instr->aux;
+        cost = opt->offsets[opt->nparams];
+    }
+
+    // every element of the result is a dot product along the last axis of a
+    if (fn == (op_fn_t)matmul || fn == (op_fn_t)matmul_acc || fn == (op_fn_t)dot || fn == (op_fn_t)dot_acc) {
+        cost = (float)instr->dest->nelem * instr->a->shape[instr->a->rank - 1];
+    }
+
+    return cost;
+}
+
+struct schedule_t* plan_program(struct instr_t* program, size_t ninstr) {
+    struct schedule_t* schedule = calloc(1, sizeof(struct schedule_t));
+    schedule->ninstr = ninstr;
+    schedule->npreds = calloc(ninstr + 1, sizeof(size_t));
+    schedule->succ_start = calloc(ninstr + 1, sizeof(size_t));
+    schedule->priority = calloc(ninstr + 1, sizeof(float));
+    schedule->npending = calloc(ninstr + 1, sizeof(size_t));
+    schedule->ready = calloc(ninstr + 1, sizeof(size_t));
+
+    struct access_t* accesses = malloc((ninstr + 1) * MAX_ACCESSES * sizeof(struct access_t));
+    size_t* naccesses = malloc((ninstr + 1) * sizeof(size_t));
+
+    for (size_t i = 0; i < ninstr; i++) naccesses[i] = get_accesses(&program[i], &accesses[i * MAX_ACCESSES]);
+
+    // edges (pred, instr), found by going back from every instruction. an access needs no further
+    // edges once an earlier write covers it, the instructions before that write are ordered by it.
+    size_t nedges = 0, capacity = ninstr + 1;
+    size_t (*edges)[2] = malloc(capacity * sizeof(size_t[2]));
+
+    for (size_t i = 0; i < ninstr; i++) {
+        struct access_t* own = &accesses[i * MAX_ACCESSES];
+        bool covered[MAX_ACCESSES] = { false };
+        size_t nopen = naccesses[i];
+
+        for (size_t j = i; j-- > 0 && nopen > 0;) {
+            struct access_t* other = &accesses[j * MAX_ACCESSES];
+            bool depends = false;
+
+            for (size_t x = 0; x < naccesses[i]; x++) {
+                if (covered[x]) continue;
+
+                for (size_t y = 0; y < naccesses[j]; y++) {
+                    if (!(own[x].write || other[y].write) || !overlaps(&own[x], &other[y])) continue;
+                    depends = true;
+
+                    if (other[y].write && covers(&other[y], &own[x])) {
+                        covered[x] = true;
+                        nopen--;
+                        break;
+                    }
+                }
+            }
+
+            if (!depends) continue;
+
+            if (nedges == capacity) {
+                capacity *= 2;
+                edges = realloc(edges, capacity * sizeof(size_t[2]));
+            }
+
+            edges[nedges][0] = j;
+            edges[nedges][1] = i;
+            nedges++;
+        }
+    }
+
+    // successor lists
+    schedule->succs = malloc((nedges + 1) * sizeof(size_t));
+
+    for (size_t e = 0; e < nedges; e++) {
+        schedule->succ_start[edges[e][0] + 1]++;
+        schedule->npreds[edges[e][1]]++;
+    }
+
+    for (size_t i = 0; i < ninstr; i++) schedule->succ_start[i + 1] += schedule->succ_start[i];
+
+    // npending is used as a fill counter here
+    for (size_t e = 0; e < nedges; e++) {
+        size_t pred = edges[e][0];
+        schedule->succs[schedule->succ_start[pred] + schedule->npending[pred]++] = edges[e][1];
+    }
+
+    // edges always point forward, so the priorities can be computed back to front
+    float total = 0, critical = 0;
+
+    for (size_t i = ninstr; i-- > 0;) {
+        float longest = 0;
+
+        for (size_t s = schedule->succ_start[i]; s < schedule->succ_start[i + 1]; s++) {
+            float path = schedule->priority[schedule->succs[s]];
+            if (path > longest) longest = path;
+        }
+
+        float cost = instr_cost(&program[i]);
+        schedule->priority[i] = cost + longest;
+        total += cost;
+        if (schedule->priority[i] > critical) critical = schedule->priority[i];
+    }
+
+    schedule->parallelism = critical > 0 ? total / critical : 1;
+
+    free(edges);
+    free(accesses);
+    free(naccesses);
+    return schedule;
+}
+
+void free_schedule(struct schedule_t* schedule) {
+    free(schedule->npreds);
+    free(schedule->succ_start);
+    free(schedule->succs);
+    free(schedule->priority);
+    free(schedule->npending);
+    free(schedule->ready);
+    free(schedule);
+}
+
+float get_parallelism(struct schedule_t* schedule) {
+    return schedule->parallelism;
+}
+
+#ifdef CORE_THREADS
+
+#include <pthread.h>
+#include <sched.h>
+
+struct run_state_t {
+    struct instr_t* program;
+    struct schedule_t* schedule;
+    pthread_mutex_t mutex;
+    size_t nready;
+    size_t ntaken;
+};
+
+void push_ready(struct run_state_t* state, size_t instr) {
+    size_t* heap = state->schedule->ready;
+    float* priority = state->schedule->priority;
+    size_t i = state->nready++;
+
+    for (; i > 0 && priority[heap[(i - 1) / 2]] < priority[instr]; i = (i - 1) / 2) heap[i] = heap[(i - 1) / 2];
+    heap[i] = instr;
+}
+
+size_t pop_ready(struct run_state_t* state) {
+    size_t* heap = state->schedule->ready;
+    float* priority = state->schedule->priority;
+    size_t top = heap[0];
+    size_t last = heap[--state->nready];
+    size_t i = 0;
+
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= state->nready) break;
+        if (child + 1 < state->nready && priority[heap[child + 1]] > priority[heap[child]]) child++;
+        if (priority[heap[child]] <= priority[last]) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+
+    heap[i] = last;
+    return top;
+}
+
+// every thread takes the ready instruction with the longest path to the end of the program
+// until all instructions are taken
+void run_ready(void* _state, size_t start, size_t end) {
+    (void)start; (void)end;   // every thread runs one job, the range is unused
+    struct run_state_t* state = _state;
+    struct schedule_t* schedule = state->schedule;
+
+    for (;;) {
+        pthread_mutex_lock(&state->mutex);
+
+        if (state->ntaken == schedule->ninstr) {
+            pthread_mutex_unlock(&state->mutex);
+            return;
+        }
+
+        if (state->nready == 0) {
+            pthread_mutex_unlock(&state->mutex);
+            sched_yield();
+            continue;
+        }
+
+        size_t instr = pop_ready(state);
+        state->ntaken++;
+        pthread_mutex_unlock(&state->mutex);
+
+        run_instr(&state->program[instr]);
+
+        pthread_mutex_lock(&state->mutex);
+        for (size_t s = schedule->succ_start[instr]; s < schedule->succ_start[instr + 1]; s++) {
+            size_t succ = schedule->succs[s];
+            if (--schedule->npending[succ] == 0) push_ready(state, succ);
+        }
+        pthread_mutex_unlock(&state->mutex);
+    }
+}
+
+#endif //CORE_THREADS
+
+/**
+ * Executes independent instructions concurrently. Instructions that access the same data
+ * (e.g. accumulate into the same gradient) keep their order, so the results are the same
+ * as those of run_program().
+ */
+void run_schedule(struct instr_t* program, struct schedule_t* schedule) {
+#ifdef CORE_THREADS
+    if (get_num_threads() > 1 && schedule->parallelism >= INTER_OP_MIN_PARALLELISM) {
+        struct run_state_t state = { .program = program, .schedule = schedule, .mutex = PTHREAD_MUTEX_INITIALIZER };
+
+        for (size_t i = 0; i < schedule->ninstr; i++) {
+            schedule->npending[i] = schedule->npreds[i];
+            if (schedule->npreds[i] == 0) push_ready(&state, i);
+        }
+
+        // one chunk per thread
+        parallel_for(get_num_threads(), PARALLEL_MIN_WORK, run_ready, &state);
+        return;
+    }
+#endif
+
+    run_program(program, schedule->ninstr);
+}
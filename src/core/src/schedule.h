@@ -0,0 +1,31 @@
+#ifndef CORE_SCHEDULE
+#define CORE_SCHEDULE
+
+#include <stddef.h>
+#include "./program.h"
+
+// programs with less average parallelism (total cost divided by the cost of the critical path)
+// are executed in order, the threads are then used to split up the kernels themselves
+#define INTER_OP_MIN_PARALLELISM 1.5f
+
+// dependency graph of the instructions of a program. two instructions depend on each other
+// if they access the same data and at least one of them writes to it.
+struct schedule_t {
+    size_t ninstr;
+    size_t* npreds;        // number of instructions that have to finish before an instruction can start
+    size_t* succ_start;    // the successors of instruction i are succs[succ_start[i]] to succs[succ_start[i + 1] - 1]
+    size_t* succs;
+    float* priority;       // cost of the longest path from an instruction to the end of the program
+    float parallelism;
+
+    // state of a run
+    size_t* npending;      // number of unfinished predecessors
+    size_t* ready;         // heap of instructions whose predecessors have finished, ordered by priority
+};
+
+struct schedule_t* plan_program(struct instr_t* program, size_t ninstr);
+void free_schedule(struct schedule_t* schedule);
+float get_parallelism(struct schedule_t* schedule);
+void run_schedule(struct instr_t* program, struct schedule_t* schedule);
+
+#endif //CORE_SCHEDULE
@@ -1,15 +1,26 @@
 #include "./tensor.h"
 #include "./util.h"
 #include "./mgmt.h"
+#include "./pool.h"
+#include "./half.h"
+#include "./threads.h"
 
 // creates a tensor and allocates all necessary memory
 // this is how "base-tensors" are created, this means data will be allocated.
 struct tensor_t* create_tensor(size_t rank, size_t nelem) {
+    return create_tensor_dtype(rank, nelem, DTYPE_FP32);
+}
+
+// creates a base-tensor whose elements are stored as the specified dtype
+struct tensor_t* create_tensor_dtype(size_t rank, size_t nelem, size_t dtype) {
     // allocate memory for the struct
-    struct tensor_t* new_tensor = (struct tensor_t*)malloc(sizeof(struct tensor_t));
+    // zero-initialized, so the padding after isview is zero when js reads it as a whole word
+    struct tensor_t* new_tensor = (struct tensor_t*)calloc(1, sizeof(struct tensor_t));
 
     // allocate memory for data/shape/strides
-    new_tensor->data = alloc_farr(nelem);
+    // data buffers are recycled through the tensor pool
+    lock_mgmt();
+    new_tensor->data = pool_alloc(DTYPE_NFLOATS(nelem, dtype));
     new_tensor->shape = alloc_starr(rank);
     new_tensor->strides = alloc_starr(rank);
 
@@ -20,10 +31,12 @@ struct tensor_t* create_tensor(size_t rank, size_t nelem) {
     new_tensor->offset = 0;
     new_tensor->isview = false;
     new_tensor->viewsrc = NULL;
-    new_tensor->size = sizeof(struct tensor_t) + sizeof(size_t) * rank * 2 + sizeof(float) * nelem;
+    new_tensor->dtype = dtype;
+    new_tensor->size = sizeof(struct tensor_t) + sizeof(size_t) * rank * 2 + DTYPE_SIZE(dtype) * nelem;
 
     mgmt.allocated += new_tensor->size;
     mgmt.ntensors++;
+    unlock_mgmt();
 
     return new_tensor;
 }
@@ -38,7 +51,7 @@ struct tensor_t* create_view(struct tensor_t* source, size_t axis, size_t offset
     size_t new_rank = is_scalar ? 1 : source->rank - axis;
 
     // allocate memory for the struct
-    struct tensor_t* new_tensor = (struct tensor_t*)malloc(sizeof(struct tensor_t));
+    struct tensor_t* new_tensor = (struct tensor_t*)calloc(1, sizeof(struct tensor_t));
 
     // assertion: axis may not be larger than rank
 
@@ -65,10 +78,13 @@ struct tensor_t* create_view(struct tensor_t* source, size_t axis, size_t offset
     new_tensor->offset = source->offset + offset;
     new_tensor->isview = true;
     new_tensor->viewsrc = source;
+    new_tensor->dtype = source->dtype;
     new_tensor->size = sizeof(struct tensor_t) + sizeof(size_t) * new_rank * 2;
 
+    lock_mgmt();
     mgmt.allocated += new_tensor->size;
     mgmt.ntensors++;
+    unlock_mgmt();
 
     return new_tensor;
 }
@@ -77,7 +93,7 @@ struct tensor_t* create_view(struct tensor_t* source, size_t axis, size_t offset
 // the shape and strides will not be set here as it is expected that these will be set from js
 struct tensor_t* create_reshape_view(struct tensor_t* source, size_t rank) {
     // allocate memory for the struct
-    struct tensor_t* new_tensor = (struct tensor_t*)malloc(sizeof(struct tensor_t));
+    struct tensor_t* new_tensor = (struct tensor_t*)calloc(1, sizeof(struct tensor_t));
     
     // reference data of source tensor
     new_tensor->data    = source->data;
@@ -93,10 +109,13 @@ struct tensor_t* create_reshape_view(struct tensor_t* source, size_t rank) {
     new_tensor->offset = source->offset;
     new_tensor->isview = true;
     new_tensor->viewsrc = source;
+    new_tensor->dtype = source->dtype;
     new_tensor->size = sizeof(struct tensor_t) + sizeof(size_t) * rank * 2;
 
+    lock_mgmt();
     mgmt.allocated += new_tensor->size;
     mgmt.ntensors++;
+    unlock_mgmt();
 
     return new_tensor;
 }
@@ -121,14 +140,16 @@ void clone_tensor(struct tensor_t* source, struct tensor_t* dest) {
     copy_starr(source->strides, dest->strides, source->rank);
     dest->rank = source->rank;
     dest->nelem = source->nelem;
-    dest->ndata = source->ndata;
+    dest->ndata = source->nelem; // dest holds a contiguous copy, even if source is a view
     dest->offset = source->offset;
     dest->isview = false;
     dest->viewsrc = NULL;
 
     // source tensor is not a view, so we can naively copy the data
+    // (elements are converted if dest uses a different dtype)
     if (!source->isview) {
-        copy_farr(source->data, dest->data, source->nelem);
+        if (source->dtype == dest->dtype) memcpy(dest->data, source->data, source->nelem * DTYPE_SIZE(source->dtype));
+        else for (size_t i = 0; i < source->nelem; i++) store_elem(dest, i, load_elem(source, i));
         return;
     }
 
@@ -152,22 +173,22 @@ void clone_tensor(struct tensor_t* source, struct tensor_t* dest) {
         }
 
         // populate destination tensor
-        dest->data[ires] = source->data[ia];
+        store_elem(dest, ires, load_elem(source, ia));
     }
 
     dest->offset = 0;
     set_row_major(dest);
-
-    mgmt.allocated += dest->size;
-    mgmt.ntensors++;
 }
 
 void free_tensor(struct tensor_t* a) {
-    if (!a->isview) free(a->data);
+    lock_mgmt();
+    mgmt.allocated -= a->size;
+    mgmt.ntensors--;
+
+    // base tensors own a buffer of ndata elements
+    if (!a->isview) pool_release(a->data, DTYPE_NFLOATS(a->ndata, a->dtype));
+    unlock_mgmt();
     free(a->shape);
     free(a->strides);
     free(a);
-
-    mgmt.allocated -= a->size;
-    mgmt.ntensors--;
 }
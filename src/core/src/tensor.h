@@ -6,6 +6,10 @@
 #include <stdbool.h>
 #include "util.h"
 
+// storage type of the elements. computations are always done in fp32,
+// elements of half precision tensors are converted when they are loaded/stored.
+enum dtype_t { DTYPE_FP32 = 0, DTYPE_FP16 = 1, DTYPE_BF16 = 2 };
+
 struct tensor_t {
     float* data;        // array that contains the actual tensor data/values
     size_t* shape;      // tensor shape of the form [..., n_matrices, n_rows, n_cols]
@@ -17,9 +21,11 @@ struct tensor_t {
     size_t size;        // total size of tensor in bytes
     bool isview;        // indicates if this tensor is a view of another tensor
     struct tensor_t* viewsrc; // if this tensor is a view, view_parent will reference the original tensor
+    size_t dtype;       // storage type of the elements (enum dtype_t), data points to uint16_t values for half precision
 };
 
 struct tensor_t* create_tensor(size_t rank, size_t nelem);
+struct tensor_t* create_tensor_dtype(size_t rank, size_t nelem, size_t dtype);
 struct tensor_t* create_view(struct tensor_t* source, size_t axis, size_t offset);
 struct tensor_t* create_reshape_view(struct tensor_t* source, size_t rank);
 void free_tensor(struct tensor_t* a);
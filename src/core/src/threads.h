@@ -0,0 +1,55 @@
+#ifndef CORE_THREAD_POOL
+#define CORE_THREAD_POOL
+
+#include <stddef.h>
+#include "./tensor.h"
+
+// kernels are only split up if they perform at least this amount of work (roughly in element operations).
+// below that, waking up the workers takes longer than the computation.
+#define PARALLEL_MIN_WORK 32768
+
+// amount of work per chunk. chunks are the unit of work stealing, there are
+// usually many more chunks than threads so that idle workers can balance the load.
+#define PARALLEL_CHUNK_WORK 4096
+
+#define MAX_THREADS 64
+
+// processes the items [start, end) of a kernel
+typedef void (*range_fn_t)(void* args, size_t start, size_t end);
+
+// arguments of kernels that are split into ranges. every kernel only uses some of the fields.
+struct kernel_args_t {
+    struct tensor_t* a;
+    struct tensor_t* b;
+    struct tensor_t* c;
+    struct tensor_t* res;
+    float param;
+    size_t* strides_a;   // broadcasting: strides of a and b, extended to the rank of res
+    size_t* strides_b;
+    size_t* strides_res; // backward passes of binary operations: strides of res, extended like strides_a
+    size_t diff;         // debroadcasting: number of leading axes that are summed up
+    size_t nvar;         // debroadcasting: number of source elements per destination element
+    size_t ncols;        // matmul: number of columns of the result
+};
+
+/**
+ * Calls fn for disjoint ranges that cover [0, n). With more than one thread and enough work,
+ * the ranges are processed by the thread pool, otherwise fn(args, 0, n) is called directly.
+ * @param cost Estimated amount of work per item
+ */
+void parallel_for(size_t n, size_t cost, range_fn_t fn, void* args);
+
+size_t set_num_threads(size_t n);
+size_t get_num_threads();
+
+// accumulates the time spent in parallel_for (kernel time, in ms) while enabled.
+// kernels that don't go through parallel_for (initializers, dropout, copies) are not measured.
+void set_profiling(int enabled);
+double get_kernel_time();
+
+// guards the tensor bookkeeping (mgmt counters, tensor pool). kernels that
+// run concurrently (see schedule.c) may create and free temporary views.
+void lock_mgmt();
+void unlock_mgmt();
+
+#endif //CORE_THREAD_POOL
@@ -0,0 +1,76 @@
+// fused backward passes of pairwise unary operations: res (+)= grad * f'(x)
+// a is the input x of the operation, or its result y where f' is cheaper to compute from it.
+// b is the gradient of the result, all tensors have the same number of elements.
+
+#ifndef CORE_UNARY_BW
+#define CORE_UNARY_BW
+
+#include <stddef.h>
+#include <math.h>
+#include "./util.h"
+#include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
+
+#define BACKWARD_UNARY_OP(NAME, ASSIGNMENT, RESULT) [[[
+void NAME##_range(void* args, size_t start, size_t end) {
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *_b = ((struct kernel_args_t*)args)->b, *res = ((struct kernel_args_t*)args)->res;
+    float param = ((struct kernel_args_t*)args)->param;
+
+    // half precision: elements are converted to fp32 for the computation
+    if (_a->dtype != DTYPE_FP32 || _b->dtype != DTYPE_FP32 || res->dtype != DTYPE_FP32) {
+        for (size_t i = start; i < end; i++) {
+            float a = load_elem(_a, get_index(_a, i)), b = load_elem(_b, get_index(_b, i));
+            size_t ires = get_index(res, i);
+            ASSIGN_ELEM(res, ires, ASSIGNMENT, RESULT);
+        }
+
+        return;
+    }
+
+    if (_a->isview || _b->isview || res->isview) {
+        for (size_t i = start; i < end; i++) {
+            float a = _a->data[get_index(_a, i)], b = _b->data[get_index(_b, i)];
+            res->data[get_index(res, i)] ASSIGNMENT RESULT;
+        }
+
+        return;
+    }
+
+    for (size_t i = start; i < end; i++) {
+        float a = _a->data[i], b = _b->data[i];
+        res->data[i] ASSIGNMENT RESULT;
+    }
+}
+
+void NAME(struct tensor_t* _a, struct tensor_t* _b, struct tensor_t* res, float param) {
+    struct kernel_args_t args = { .a = _a, .b = _b, .res = res, .param = param };
+    parallel_for(res->nelem, 1, NAME##_range, &args);
+}
+]]]
+
+// a = y: tanh, exp, logistic, sqrt. a = x: all others
+@GENERATE (BACKWARD_UNARY_OP) [[[
+    bw_sin:           b * cos(a)
+    bw_cos:           b * -sin(a)
+    bw_tan:           b / pow(cos(a), 2.)
+    bw_asin:          b / sqrt(1 - a * a)
+    bw_acos:          -b / sqrt(1 - a * a)
+    bw_atan:          b / (a * a + 1.)
+    bw_sinh:          b * cosh(a)
+    bw_cosh:          b * sinh(a)
+    bw_tanh:          b * (1. - a * a)
+    bw_exp:           b * a
+    bw_logistic:      b * a * (1. - a)
+    bw_log:           b / a
+    bw_log2:          b / (a * log(2.))
+    bw_log10:         b / (a * log(10.))
+    bw_invsqrt:       -.5 * b / pow(a, 3. / 2.)
+    bw_sqrt:          .5 * b / a
+    bw_abs:           b * (SIGN(a))
+    bw_reciprocal:    -b / (a * a)
+    bw_relu:          a < 0 ? 0 : b
+    bw_leaky_relu:    a < 0 ? param * b : b
+]]]
+
+#endif //CORE_UNARY_BW
@@ -8,23 +8,44 @@
 #include <string.h>
 #include "./util.h"
 #include "./tensor.h"
+#include "./half.h"
+#include "./threads.h"
 
 #define PAIRWISE_UNARY_OP(NAME, ASSIGNMENT, RESULT) [[[
-void NAME(struct tensor_t* _a, struct tensor_t* res, float param) {
+void NAME##_range(void* args, size_t start, size_t end) {
+    struct tensor_t *_a = ((struct kernel_args_t*)args)->a, *res = ((struct kernel_args_t*)args)->res;
+    float param = ((struct kernel_args_t*)args)->param;
+
+    // half precision: elements are converted to fp32 for the computation
+    if (_a->dtype != DTYPE_FP32 || res->dtype != DTYPE_FP32) {
+        for (size_t i = start; i < end; i++) {
+            float a = load_elem(_a, get_index(_a, i));
+            size_t ires = get_index(res, i);
+            ASSIGN_ELEM(res, ires, ASSIGNMENT, RESULT);
+        }
+
+        return;
+    }
+
     if (_a->isview || res->isview) {
-        for (size_t i = 0; i < _a->nelem; i++) {
-            float a = get_index(_a, i);
+        for (size_t i = start; i < end; i++) {
+            float a = _a->data[get_index(_a, i)];
             res->data[get_index(res, i)] ASSIGNMENT RESULT;
         }
 
         return;
     }
 
-    for (size_t i = 0; i < _a->nelem; i++) {
+    for (size_t i = start; i < end; i++) {
         float a = _a->data[i];
         res->data[i] ASSIGNMENT RESULT;
     }
 }
+
+void NAME(struct tensor_t* _a, struct tensor_t* res, float param) {
+    struct kernel_args_t args = { .a = _a, .res = res, .param = param };
+    parallel_for(_a->nelem, 1, NAME##_range, &args);
+}
 ]]]
 
 @GENERATE (PAIRWISE_UNARY_OP) [[[
@@ -48,6 +69,7 @@ void NAME(struct tensor_t* _a, struct tensor_t* res, float param) {
     abs_prw:        fabs(a)
     sign_prw:       SIGN(a)
     negate_prw:     -a
+    identity_prw:   a
     reciprocal_prw: 1. / a
     relu_prw:       a < 0 ? 0 : a
     leaky_relu_prw: a < 0 ? param * a : a
@@ -1,5 +1,7 @@
 #include "./util.h"
 #include <math.h>
+#include <stdint.h>
+#include "./half.h"
 
 #define PI 3.1415926535
 
@@ -39,12 +41,12 @@ void free_starr(size_t* ptr) {
 // misc utility functions
 
 float fast_inv_sqrt(float number) {
-    long i;
+    int32_t i; // long is 64 bits wide in the memory64 build
     float x2, y;
     const float threehalfs = 1.5F;
     x2 = number * 0.5F;
     y  = number;
-    i  = *(long*)&y;                       // evil floating point bit level hacking
+    i  = *(int32_t*)&y;                       // evil floating point bit level hacking
     i  = 0x5f3759df - (i >> 1);               // what the fuck?
     y  = *(float*)&i;
     y  = y * (threehalfs - (x2 * y * y));   // 1st iteration
@@ -124,7 +126,7 @@ float get_item(struct tensor_t* a, size_t linear_index) {
         remainder /= a->shape[dim];
     }
 
-    return a->data[ia];
+    return load_elem(a, ia);
 }
 
 // normal distribution based on box-muller transform
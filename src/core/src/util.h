@@ -5,12 +5,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include "./tensor.h"
-
-#include <emscripten.h>
+#include "./platform.h"
 
 #define MAX(A, B) A > B ? A : B
 #define SIGN(x) (x > 0) - (x < 0)
-#define print_js(msg, var) EM_ASM({ console.log(msg, $0); }, var);
 
 // allocation functions
 
@@ -34,5 +32,6 @@ void free_starr(size_t* ptr);
 
 float fast_inv_sqrt(float number);
 size_t get_nsubtns(struct tensor_t *a, size_t n);
+void shift_view(struct tensor_t* src, size_t linear_index);
 
 #endif //CORE_UTIL
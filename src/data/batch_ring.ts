@@ -0,0 +1,78 @@
+/**
+ * Ring of batch buffers in a SharedArrayBuffer, shared by a DataLoader (see loader.ts) and its workers.
+ *
+ * Batch i is written into slot i % depth in round i / depth. Every slot counts the batches
+ * that were written to it and read from it: a batch can be written once the batch of the
+ * previous round was read, and read once it was written.
+ */
+
+enum CONTROL { FILLED, CONSUMED }
+
+// the error flag is checked in this interval while the consumer waits (in ms)
+const POLL_INTERVAL = 100;
+
+export class BatchRing {
+    readonly depth: number;
+    readonly batch_nelem: number;
+
+    private readonly control: Int32Array;
+    private readonly slots: Float32Array[] = [];
+
+    constructor(buffer: SharedArrayBuffer, depth: number, batch_nelem: number) {
+        this.depth = depth;
+        this.batch_nelem = batch_nelem;
+        this.control = new Int32Array(buffer, 0, BatchRing.control_words(depth));
+
+        const offset = BatchRing.control_words(depth) * 4;
+        for (let i = 0; i < depth; i++) this.slots.push(new Float32Array(buffer, offset + i * batch_nelem * 4, batch_nelem));
+    }
+
+    // counters of all slots plus an error flag
+    private static control_words = (depth: number) => 2 * depth + 1;
+
+    static allocate(depth: number, batch_nelem: number): SharedArrayBuffer {
+        return new SharedArrayBuffer((BatchRing.control_words(depth) + depth * batch_nelem) * 4);
+    }
+
+    private counter = (kind: CONTROL, index: number) => kind * this.depth + index % this.depth;
+    private round = (index: number) => Math.floor(index / this.depth);
+    private get error_flag() { return 2 * this.depth; }
+
+    slot(index: number): Float32Array {
+        return this.slots[index % this.depth];
+    }
+
+    // blocks until the slot of batch index can be overwritten (producer side)
+    wait_writable(index: number) {
+        const counter = this.counter(CONTROL.CONSUMED, index);
+
+        for (let count = Atomics.load(this.control, counter); count < this.round(index); count = Atomics.load(this.control, counter))
+            Atomics.wait(this.control, counter, count);
+    }
+
+    // blocks until batch index has been written (consumer side). throws if a producer failed.
+    wait_readable(index: number) {
+        const counter = this.counter(CONTROL.FILLED, index);
+
+        for (let count = Atomics.load(this.control, counter); count <= this.round(index); count = Atomics.load(this.control, counter)) {
+            if (this.failed) throw new Error("A producer of the data loader failed.");
+            Atomics.wait(this.control, counter, count, POLL_INTERVAL);
+        }
+    }
+
+    mark_written = (index: number) => this.advance(this.counter(CONTROL.FILLED, index), index);
+    mark_read    = (index: number) => this.advance(this.counter(CONTROL.CONSUMED, index), index);
+
+    private advance(counter: number, index: number) {
+        Atomics.store(this.control, counter, this.round(index) + 1);
+        Atomics.notify(this.control, counter);
+    }
+
+    fail() {
+        Atomics.store(this.control, this.error_flag, 1);
+    }
+
+    get failed(): boolean {
+        return Atomics.load(this.control, this.error_flag) !== 0;
+    }
+}
@@ -0,0 +1,120 @@
+import { Source } from "../autograd/node_operations.ts";
+import type { RawTensor } from "../raw_tensor/raw_tensor.ts";
+import { BatchRing } from "./batch_ring.ts";
+
+/**
+ * Asynchronous data loading. Producers run on worker threads and fill a ring of batch buffers
+ * (see batch_ring.ts) ahead of time, while the main thread trains on the previous batches.
+ * The workers are at most depth batches ahead of the training loop.
+ *
+ * Taking a batch is a single copy of its buffer into the value of the source node. The value
+ * can't be swapped for the buffer instead, because views of it (e.g. in Matmul) and compiled
+ * programs reference its data.
+ */
+
+// the shape of one sample, the size of a batch and the worker that runs the producer
+export interface LoaderInfo {
+    shape: number[];
+    batch_size: number;
+    rank: number;
+    workers: number;
+}
+
+/**
+ * Writes batch number index into batch, a [batch_size, ...shape] array in row-major order.
+ * Batches are numbered consecutively, every batch is produced exactly once.
+ */
+export type BatchProducer = (batch: Float32Array, index: number) => void | Promise<void>;
+
+// the default export of the module that is passed to DataLoader.create(), every worker imports it
+export type ProducerFactory = (info: LoaderInfo) => BatchProducer | Promise<BatchProducer>;
+
+export interface LoaderOptions {
+    workers?: number;   // defaults to 1
+    depth?: number;     // number of batch buffers, defaults to 2 (double buffering)
+}
+
+export class DataLoader {
+    readonly shape: number[];
+    readonly batch_size: number;
+
+    private readonly ring: BatchRing;
+    private readonly workers: Worker[] = [];
+    private index = 0;
+    private error?: string;
+
+    private constructor(shape: number[], batch_size: number, ring: BatchRing) {
+        this.shape = shape;
+        this.batch_size = batch_size;
+        this.ring = ring;
+    }
+
+    /**
+     * Starts the workers, they begin to produce batches right away.
+     * @param module Module whose default export is a ProducerFactory, e.g. new URL("./mnist.ts", import.meta.url)
+     * @param shape Shape of one sample
+     */
+    static async create(module: string | URL, shape: number[], batch_size: number, { workers = 1, depth = 2 }: LoaderOptions = {}): Promise<DataLoader> {
+        if (workers < 1 || depth < 1 || batch_size < 1)
+            throw new Error(`Invalid data loader configuration (batch size ${batch_size}, ${workers} workers, depth ${depth}).`);
+
+        const batch_nelem = shape.reduce((acc, size) => acc * size, batch_size);
+        const buffer = BatchRing.allocate(depth, batch_nelem);
+        const loader = new DataLoader([...shape], batch_size, new BatchRing(buffer, depth, batch_nelem));
+        const worker_url = new URL("./loader_worker.ts", import.meta.url);
+
+        const started = Array.from({ length: workers }, (_, rank) => new Promise<void>((resolve, reject) => {
+            const worker = new Worker(worker_url);
+            loader.workers.push(worker);
+
+            // errors after the start can only be reported once the training loop yields,
+            // the ring stops the loop in the meantime
+            worker.onmessage = (event: MessageEvent) => {
+                if (event.data.type === "ready") return resolve();
+                loader.error ??= `Worker ${rank}: ${event.data.message}`;
+                reject(new Error(loader.error));
+            };
+
+            const info: LoaderInfo = { shape: loader.shape, batch_size, rank, workers };
+            worker.postMessage({ module: module.toString(), buffer, depth, info });
+        }));
+
+        try {
+            await Promise.all(started);
+        } catch (e) {
+            loader.terminate();
+            throw e;
+        }
+
+        return loader;
+    }
+
+    /**
+     * Copies the next batch into dest and hands its buffer back to the workers.
+     * Blocks until the batch is ready, which is not allowed on the main thread of browsers.
+     */
+    next(dest: RawTensor) {
+        if (dest.nelem !== this.ring.batch_nelem)
+            throw new Error(`Cannot load a batch of ${this.ring.batch_nelem} elements into a tensor of shape [${dest.shape}].`);
+
+        try {
+            this.ring.wait_readable(this.index);
+        } catch (e) {
+            throw new Error(this.error ?? (e as Error).message);
+        }
+
+        dest.data.set(this.ring.slot(this.index), dest.offset);
+        this.ring.mark_read(this.index);
+        this.index++;
+    }
+
+    // a source node that takes the next batch from the loader in every forward pass
+    source(): Source {
+        return new Source([this.batch_size, ...this.shape], (dest: RawTensor) => this.next(dest));
+    }
+
+    terminate() {
+        for (const worker of this.workers) worker.terminate();
+        this.workers.length = 0;
+    }
+}
@@ -0,0 +1,30 @@
+/**
+ * Entry point of the workers of a DataLoader (see loader.ts).
+ * Workers don't load a core, producers write into plain arrays in shared memory.
+ */
+
+import { BatchRing } from "./batch_ring.ts";
+import type { LoaderInfo, ProducerFactory } from "./loader.ts";
+
+declare const self: Worker;
+
+self.onmessage = async (event: MessageEvent) => {
+    const { module, buffer, depth, info }: { module: string, buffer: SharedArrayBuffer, depth: number, info: LoaderInfo } = event.data;
+    const ring = new BatchRing(buffer, depth, info.shape.reduce((acc, size) => acc * size, info.batch_size));
+
+    try {
+        const factory: ProducerFactory = (await import(module)).default;
+        const producer = await factory(info);
+        self.postMessage({ type: "ready" });
+
+        // workers take turns, each one produces every workers-th batch
+        for (let index = info.rank; ; index += info.workers) {
+            ring.wait_writable(index);
+            await producer(ring.slot(index), index);
+            ring.mark_written(index);
+        }
+    } catch (e) {
+        ring.fail();
+        self.postMessage({ type: "error", message: e instanceof Error ? e.message : String(e) });
+    }
+};
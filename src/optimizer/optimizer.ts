@@ -1,8 +1,19 @@
 import Graph from "../autograd/graph";
 import { mul_acc } from "../raw_tensor/raw_tensor_operations";
+import { RawTensor } from "../raw_tensor/raw_tensor";
+import { detach } from "../raw_tensor/lifetime";
+import { INSTR, recorder } from "../raw_tensor/program";
+import core from "../core/core";
 import Tensor from "../tensor";
 
-type sgd_options = { lr: number };
+// values of enum optim_kind_t in the core
+enum OPTIM { SGD, ADAM, ADAMW }
+
+// older cores don't have fused optimizers
+const has_fused = () => core._optimizer_step !== undefined;
+
+// the core structs of optimizers that were garbage collected without being freed
+const registry = new FinalizationRegistry<number>((ptr) => core._free_optimizer(ptr));
 
 export class Optimizer {
     model: Graph;
@@ -13,17 +24,157 @@ export class Optimizer {
     }
 }
 
-export class sgd extends Optimizer {
-    lr: number;
-    
-    constructor(model: Graph, { lr }: sgd_options) {
+type clip_options = {
+    max_grad_norm?: number,     // clips the global norm of the gradients of all parameters, Infinity only measures it
+    grad_scale?: number,        // gradients are multiplied by it before clipping, e.g. 1 / loss scale
+};
+
+/**
+ * Optimizer whose step is a single core call that updates all parameters (see core/src/optim.c).
+ * The state of all parameters (e.g. momentum buffers) is one contiguous tensor with a row per buffer.
+ * Inside of compiled graphs, the step is a single instruction.
+ *
+ * With max_grad_norm, the global norm of the gradients is computed in one sweep before the update and the update
+ * uses the clipped gradients (the gradient tensors are not modified). Steps with a non-finite norm are skipped.
+ */
+export abstract class FusedOptimizer extends Optimizer {
+    private ptr = 0;
+    readonly state?: RawTensor;
+
+    // tensors the core was given for each parameter, and the hyperparameters it was given
+    private readonly bound: { value?: RawTensor, grad?: RawTensor }[] = [];
+    private hparams_set: number[] = [];
+
+    max_grad_norm: number;
+    grad_scale: number;
+
+    /**
+     * @param kind Kind of the optimizer in the core
+     * @param nstate Number of state buffers per parameter element
+     */
+    protected constructor(model: Graph, kind: OPTIM, nstate: number, { max_grad_norm = 0, grad_scale = 1 }: clip_options) {
         super(model);
-        this.lr = lr;
+        this.max_grad_norm = max_grad_norm;
+        this.grad_scale = grad_scale;
+        if (!has_fused()) return;
+
+        this.ptr = core._create_optimizer(kind, model.parameters.length);
+        registry.register(this, this.ptr, this);
+
+        if (nstate > 0) {
+            const total = model.parameters.reduce((acc, param) => acc + param.value.nelem, 0);
+            this.state = RawTensor.create([nstate, total]).zeros();
+            detach(this.state);
+            core._set_optimizer_state(this.ptr, this.state.ptr);
+        }
+    }
+
+    // lr, beta1 (momentum for sgd), beta2, eps and weight_decay
+    protected abstract hparams(): number[];
+
+    // per-parameter fallback for cores without fused optimizers
+    protected unfused_step(): void {
+        throw new Error(`${this.constructor.name} needs a core with fused optimizers, rebuild the core.`);
     }
 
     step() {
-        for (const param of this.model.parameters) {
-            mul_acc(param.grad, -this.lr, param.value);
+        if (!this.ptr) this.unfused_step();
+        else if (recorder) recorder.emit({ kind: INSTR.OPTIMIZER, op: "optimizer_step", aux: this.bind() });
+        else core._optimizer_step(this.bind());
+
+        for (const param of this.model.parameters) param.touch();
+    }
+
+    // passes tensors that were replaced since the last step (e.g. by a memory plan) and changed hyperparameters to the core
+    private bind(): number {
+        this.model.parameters.forEach((param, i) => {
+            const bound = this.bound[i] ??= {};
+            if (bound.value === param.value && bound.grad === param.grad) return;
+            if (!param.grad) throw new Error("Optimizer steps need the gradients of all parameters, run a backward pass first.");
+
+            core._set_optimizer_param(this.ptr, i, param.value.ptr, param.grad.ptr);
+            bound.value = param.value;
+            bound.grad = param.grad;
+        });
+
+        const hparams = [...this.hparams(), this.max_grad_norm, this.grad_scale];
+        if (hparams.some((value, i) => value !== this.hparams_set[i])) {
+            core._set_optimizer_hparams(this.ptr, ...hparams.slice(0, 5));
+            core._set_optimizer_grad_clipping(this.ptr, this.max_grad_norm, this.grad_scale);
+            this.hparams_set = hparams;
         }
+
+        return this.ptr;
+    }
+
+    // global norm of the scaled gradients (before clipping) in the last step, only computed with max_grad_norm
+    get grad_norm(): number {
+        return this.ptr ? core._get_optimizer_grad_norm(this.ptr) : 0;
+    }
+
+    // frees the state and the optimizer in the core. compiled graphs that contain its step can't run afterwards.
+    free() {
+        if (!this.ptr) return;
+
+        registry.unregister(this);
+        core._free_optimizer(this.ptr);
+        this.state?.free();
+        this.ptr = 0;
+    }
+}
+
+type sgd_options = { lr: number, momentum?: number, weight_decay?: number } & clip_options;
+
+// stochastic gradient descent, with momentum buffers if momentum > 0
+export class sgd extends FusedOptimizer {
+    lr: number;
+    readonly momentum: number;
+    weight_decay: number;
+
+    constructor(model: Graph, { lr, momentum = 0, weight_decay = 0, ...clip }: sgd_options) {
+        super(model, OPTIM.SGD, momentum > 0 ? 1 : 0, clip);
+        this.lr = lr;
+        this.momentum = momentum;
+        this.weight_decay = weight_decay;
+    }
+
+    protected hparams() {
+        return [this.lr, this.momentum, 0, 0, this.weight_decay];
+    }
+
+    protected unfused_step() {
+        if (this.momentum > 0 || this.weight_decay > 0 || this.max_grad_norm > 0 || this.grad_scale !== 1) super.unfused_step();
+        for (const param of this.model.parameters) mul_acc(param.grad!, -this.lr, param.value);
+    }
+}
+
+type adam_options = { lr?: number, beta1?: number, beta2?: number, eps?: number, weight_decay?: number } & clip_options;
+
+// adam with bias correction. the weight decay is added to the gradients (l2 regularization).
+export class adam extends FusedOptimizer {
+    lr: number;
+    beta1: number;
+    beta2: number;
+    eps: number;
+    weight_decay: number;
+
+    constructor(model: Graph, { lr = 1e-3, beta1 = .9, beta2 = .999, eps = 1e-8, weight_decay = 0, ...clip }: adam_options = {}, kind = OPTIM.ADAM) {
+        super(model, kind, 2, clip);
+        this.lr = lr;
+        this.beta1 = beta1;
+        this.beta2 = beta2;
+        this.eps = eps;
+        this.weight_decay = weight_decay;
+    }
+
+    protected hparams() {
+        return [this.lr, this.beta1, this.beta2, this.eps, this.weight_decay];
+    }
+}
+
+// adam with decoupled weight decay, which is applied to the values directly
+export class adamw extends adam {
+    constructor(model: Graph, { weight_decay = .01, ...options }: adam_options = {}) {
+        super(model, { weight_decay, ...options }, OPTIM.ADAMW);
     }
 }
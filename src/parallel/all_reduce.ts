@@ -0,0 +1,97 @@
+import type { RawTensor } from "../raw_tensor/raw_tensor.ts";
+
+/**
+ * Gradient exchange between the replicas of a data-parallel trainer (see data_parallel.ts).
+ *
+ * Every replica has its own core, so the gradients are exchanged through a SharedArrayBuffer
+ * that holds a barrier, one slot per replica and the reduced gradients. The reduction is a
+ * reduce-scatter followed by an all-gather: every replica sums up its own range of the
+ * gradients over all slots, then every replica copies all ranges back into its gradients.
+ * The slots are always summed in the same order, so all replicas get bit-identical gradients.
+ */
+
+enum CONTROL { COUNT, GENERATION }
+const CONTROL_BYTES = 8;
+
+// the part [start, end) of n items that belongs to a replica
+export function shard_range(n: number, rank: number, world_size: number): [number, number] {
+    return [Math.floor(n * rank / world_size), Math.floor(n * (rank + 1) / world_size)];
+}
+
+export class SharedGradients {
+    readonly rank: number;
+    readonly world_size: number;
+    readonly nelem: number;
+
+    private readonly control: Int32Array;
+    private readonly slots: Float32Array[] = [];
+    private readonly reduced: Float32Array;
+
+    constructor(buffer: SharedArrayBuffer, nelem: number, rank: number, world_size: number) {
+        this.rank = rank;
+        this.world_size = world_size;
+        this.nelem = nelem;
+        this.control = new Int32Array(buffer, 0, 2);
+
+        for (let i = 0; i < world_size; i++) this.slots.push(new Float32Array(buffer, CONTROL_BYTES + i * nelem * 4, nelem));
+        this.reduced = new Float32Array(buffer, CONTROL_BYTES + world_size * nelem * 4, nelem);
+    }
+
+    // buffer for replicas with nelem gradient elements each
+    static allocate(nelem: number, world_size: number): SharedArrayBuffer {
+        return new SharedArrayBuffer(CONTROL_BYTES + (world_size + 1) * nelem * 4);
+    }
+
+    // blocks until all replicas have called barrier()
+    barrier() {
+        const generation = Atomics.load(this.control, CONTROL.GENERATION);
+
+        if (Atomics.add(this.control, CONTROL.COUNT, 1) === this.world_size - 1) {
+            Atomics.store(this.control, CONTROL.COUNT, 0);
+            Atomics.add(this.control, CONTROL.GENERATION, 1);
+            Atomics.notify(this.control, CONTROL.GENERATION);
+            return;
+        }
+
+        while (Atomics.load(this.control, CONTROL.GENERATION) === generation)
+            Atomics.wait(this.control, CONTROL.GENERATION, generation);
+    }
+
+    /**
+     * Replaces the gradients of all replicas by their weighted sum.
+     * @param grads Gradients of the parameters, in the same order in all replicas
+     * @param weight Share of this replica in the mini-batch
+     */
+    all_reduce(grads: RawTensor[], weight: number) {
+        const slot = this.slots[this.rank];
+        let offset = 0;
+
+        for (const grad of grads) {
+            const data = grad.data;
+            for (let i = 0; i < grad.nelem; i++) slot[offset + i] = data[i] * weight;
+            offset += grad.nelem;
+        }
+
+        this.barrier();
+
+        // reduce-scatter
+        const [start, end] = shard_range(this.nelem, this.rank, this.world_size);
+
+        for (let i = start; i < end; i++) {
+            let sum = 0;
+            for (const other of this.slots) sum += other[i];
+            this.reduced[i] = sum;
+        }
+
+        this.barrier();
+
+        // all-gather. the reduced gradients are only written again after the
+        // first barrier of the next reduction, which waits for all replicas to get here.
+        offset = 0;
+
+        for (const grad of grads) {
+            grad.set_values(this.reduced.subarray(offset, offset + grad.nelem));
+            offset += grad.nelem;
+        }
+    }
+}
@@ -0,0 +1,153 @@
+import type Graph from "../autograd/graph.ts";
+import type { Steppable } from "../autograd/compiler.ts";
+import { SharedGradients, shard_range } from "./all_reduce.ts";
+import { native } from "../core/core.ts";
+
+export { shard_range };
+
+// the part of every mini-batch that a replica trains on
+export interface Shard {
+    rank: number;
+    world_size: number;
+    start: number;      // first sample of the mini-batch
+    end: number;        // one past the last sample
+}
+
+export interface Replica {
+    graph: Graph;
+    optimizer?: Steppable;
+}
+
+/**
+ * Builds the model of a replica. It is the default export of the module that is passed to
+ * DataParallel.create(), every worker imports it. The parameters have to be initialized
+ * the same way in all replicas (e.g. with fixed seeds). The loss should be the mean over
+ * the samples of the shard, the gradients are then averaged over the whole mini-batch.
+ */
+export type ReplicaFactory = (shard: Shard) => Replica | Promise<Replica>;
+
+export interface DataParallelOptions {
+    workers: number;
+    batch_size?: number;    // size of the mini-batch that is split across the workers, defaults to one sample per worker
+}
+
+const terminated = () => new Error("The trainer was terminated.");
+
+// eslint-disable-next-line @typescript-eslint/no-explicit-any
+type Reply = { type: string, [key: string]: any };
+
+/**
+ * Trains replicas of a graph on separate worker threads. In every step, each replica runs a
+ * forward and backward pass on its shard of the mini-batch, the gradients of all replicas are
+ * all-reduced in shared memory (see all_reduce.ts), and each replica performs the same optimizer
+ * step on the same gradients. The parameters therefore stay identical in all replicas,
+ * without being broadcast.
+ */
+export class DataParallel {
+    readonly world_size: number;
+    readonly batch_size: number;
+
+    private readonly workers: Worker[] = [];
+    private readonly pending: { resolve: (reply: Reply) => void, reject: (error: Error) => void }[][] = [];
+
+    private constructor(world_size: number, batch_size: number) {
+        this.world_size = world_size;
+        this.batch_size = batch_size;
+    }
+
+    /**
+     * Starts the workers and builds the replicas.
+     * @param module Module whose default export is a ReplicaFactory, e.g. new URL("./model.ts", import.meta.url)
+     */
+    static async create(module: string | URL, { workers, batch_size = workers }: DataParallelOptions): Promise<DataParallel> {
+        if (workers < 1 || batch_size < workers)
+            throw new Error(`Can't split a mini-batch of ${batch_size} samples across ${workers} workers.`);
+
+        // workers share the process, and with it the native library. replicas need a core of their own.
+        if (native) throw new Error("DataParallel needs a wasm core, the native core is shared by all workers.");
+
+        const trainer = new DataParallel(workers, batch_size);
+        const worker_url = new URL("./replica_worker.ts", import.meta.url);
+
+        for (let rank = 0; rank < workers; rank++) {
+            const worker = new Worker(worker_url);
+            trainer.workers.push(worker);
+            trainer.pending.push([]);
+
+            worker.onmessage = (event: MessageEvent) => {
+                const reply: Reply = event.data;
+                const { resolve, reject } = trainer.pending[rank].shift()!;
+                if (reply.type === "error") reject(new Error(`Worker ${rank}: ${reply.message}`));
+                else resolve(reply);
+            };
+        }
+
+        try {
+            const replies = await trainer.broadcast(rank => {
+                const [start, end] = shard_range(batch_size, rank, workers);
+                return { type: "init", module: module.toString(), shard: { rank, world_size: workers, start, end } };
+            });
+
+            const nelem = replies[0].nelem;
+            if (replies.some(reply => reply.nelem !== nelem))
+                throw new Error("The replicas have a different number of parameters.");
+
+            const buffer = SharedGradients.allocate(nelem, workers);
+            await trainer.broadcast(() => ({ type: "share", buffer, nelem, batch_size }));
+        } catch (e) {
+            trainer.terminate();
+            throw e;
+        }
+
+        return trainer;
+    }
+
+    private request(rank: number, message: object): Promise<Reply> {
+        if (!this.workers.length) return Promise.reject(terminated());
+        return new Promise((resolve, reject) => {
+            this.pending[rank].push({ resolve, reject });
+            this.workers[rank].postMessage(message);
+        });
+    }
+
+    private broadcast(message: (rank: number) => object): Promise<Reply[]> {
+        if (!this.workers.length) return Promise.reject(terminated());
+        return Promise.all(this.workers.map((_, rank) => this.request(rank, message(rank))));
+    }
+
+    /**
+     * Performs training steps (zero_grad, forward, backward, all-reduce, optimizer step).
+     * If a replica fails, the trainer is terminated: the other replicas would wait for it in the all-reduce forever.
+     * @returns The loss of the last step, averaged over all replicas weighted by the size of their shards (like the gradients)
+     */
+    async train(steps = 1): Promise<number> {
+        let replies: Reply[];
+
+        try {
+            replies = await this.broadcast(() => ({ type: "train", steps }));
+        } catch (e) {
+            this.terminate();
+            throw e;
+        }
+
+        return replies.reduce((sum, reply, rank) => {
+            const [start, end] = shard_range(this.batch_size, rank, this.world_size);
+            return sum + reply.loss * (end - start) / this.batch_size;
+        }, 0);
+    }
+
+    // values of the parameters (the same in all replicas), in the order of graph.parameters
+    async parameters(): Promise<Float32Array[]> {
+        return (await this.request(0, { type: "parameters" })).values;
+    }
+
+    terminate() {
+        for (const worker of this.workers) worker.terminate();
+        this.workers.length = 0;
+
+        // requests that are still running don't get a reply anymore
+        for (const pending of this.pending) {
+            for (const { reject } of pending.splice(0)) reject(terminated());
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * Entry point of the workers of a DataParallel trainer (see data_parallel.ts).
+ * Each worker loads its own core and builds one replica of the model.
+ */
+
+import { core_ready } from "../raw_tensor/management.ts";
+import { SharedGradients } from "./all_reduce.ts";
+import type { Replica, ReplicaFactory, Shard } from "./data_parallel.ts";
+
+declare const self: Worker;
+
+let replica: Replica;
+let shard: Shard;
+let gradients: SharedGradients;
+let weight: number;
+
+const parameters = () => replica.graph.parameters.filter(parameter => parameter.requires_grad);
+
+function step() {
+    const graph = replica.graph;
+
+    graph.zero_grad();
+    graph.forward();
+    graph.backward();
+    gradients.all_reduce(parameters().map(parameter => parameter.grad), weight);
+    replica.optimizer?.step();
+}
+
+// eslint-disable-next-line @typescript-eslint/no-explicit-any
+async function handle(message: any): Promise<object> {
+    switch (message.type) {
+        case "init": {
+            await core_ready;
+            shard = message.shard;
+
+            const factory: ReplicaFactory = (await import(message.module)).default;
+            replica = await factory(shard);
+
+            return { nelem: parameters().reduce((sum, parameter) => sum + parameter.grad.nelem, 0) };
+        }
+
+        case "share": {
+            gradients = new SharedGradients(message.buffer, message.nelem, shard.rank, shard.world_size);
+
+            // the gradients are averaged over the samples of the mini-batch
+            weight = (shard.end - shard.start) / message.batch_size;
+            return {};
+        }
+
+        case "train": {
+            for (let i = 0; i < message.steps; i++) step();
+            return { loss: replica.graph.output.item };
+        }
+
+        case "parameters":
+            return { values: replica.graph.parameters.map(parameter => parameter.value.data.slice(0, parameter.value.nelem)) };
+
+        default:
+            throw new Error(`Unknown message "${message.type}".`);
+    }
+}
+
+self.onmessage = async (event: MessageEvent) => {
+    try {
+        self.postMessage({ type: "done", ...await handle(event.data) });
+    } catch (e) {
+        self.postMessage({ type: "error", message: e instanceof Error ? e.message : String(e) });
+    }
+};
@@ -0,0 +1,58 @@
+/**
+ * Storage types of tensor elements.
+ * Computations are always done in fp32, the core converts half precision elements
+ * when it loads and stores them.
+ */
+export type DType = "fp32" | "fp16" | "bf16";
+
+// values of enum dtype_t in the core
+export const DTYPES: DType[] = ["fp32", "fp16", "bf16"];
+export const dtype_id = (dtype: DType) => DTYPES.indexOf(dtype);
+export const dtype_size = (dtype: DType) => dtype === "fp32" ? 4 : 2;
+
+function fp16_to_number(h: number): number {
+    const sign = h & 0x8000 ? -1 : 1;
+    const exp = (h >> 10) & 0x1f;
+    const mant = h & 0x3ff;
+
+    if (exp === 0) return sign * mant * 2 ** -24;
+    if (exp === 0x1f) return mant ? NaN : sign * Infinity;
+    return sign * (1 + mant / 1024) * 2 ** (exp - 15);
+}
+
+// decodes the raw bits of half precision elements
+export function half_to_float32(bits: Uint16Array, dtype: DType): Float32Array {
+    const result = new Float32Array(bits.length);
+
+    if (dtype === "bf16") {
+        // bf16 is the upper half of an fp32
+        const words = new Uint32Array(result.buffer);
+        for (let i = 0; i < bits.length; i++) words[i] = bits[i] << 16;
+        return result;
+    }
+
+    for (let i = 0; i < bits.length; i++) result[i] = fp16_to_number(bits[i]);
+    return result;
+}
+
+// methods of typed arrays that write to them
+const MUTATORS = new Set<string | symbol>(["set", "fill", "copyWithin", "reverse", "sort"]);
+
+// view of an array that throws on writes instead of dropping them, e.g. for decoded copies of half precision elements
+export function read_only(array: Float32Array, message: string): Float32Array {
+    const fail = () => { throw new TypeError(message); };
+
+    return new Proxy(array, {
+        get(target, key) {
+            if (MUTATORS.has(key)) return fail;
+            if (key === "subarray") return (start?: number, end?: number) => read_only(target.subarray(start, end), message);
+
+            // methods are called on the array itself, they don't work on proxies
+            const value = Reflect.get(target, key, target);
+            return typeof value === "function" ? value.bind(target) : value;
+        },
+        set: fail,
+        defineProperty: fail,
+        deleteProperty: fail,
+    });
+}
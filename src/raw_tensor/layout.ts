@@ -0,0 +1,66 @@
+import core, { native, wide_size_t } from "../core/core.ts";
+
+/**
+ * Access to size_t values (struct fields, shapes, strides) in the memory of the core.
+ * size_t is 32 bits wide in the wasm32 build and 64 bits wide in the memory64 and native builds.
+ * 64-bit values are converted to numbers, which is exact up to 2^53.
+ */
+
+export const SIZE_T_BYTES = wide_size_t ? 8 : 4;
+
+type TypedArrayType<T> = { new (buffer: ArrayBufferLike, byte_offset: number, length: number): T, BYTES_PER_ELEMENT: number };
+
+/**
+ * Typed array of length elements at ptr in the memory of the core.
+ * The wasm cores have a single linear memory, the native core has no such memory, so each
+ * array gets an external ArrayBuffer over the native allocation instead.
+ */
+export function heap_array<T>(type: TypedArrayType<T>, ptr: number, length: number): T {
+    if (!native) return new type(core.memory.buffer, ptr, length);
+    if (length === 0) return new type(new ArrayBuffer(0), 0, 0);
+    return new type(core.buffer(ptr, length * type.BYTES_PER_ELEMENT), 0, length);
+}
+
+export interface SizeArray {
+    readonly length: number;
+    get(index: number): number;
+    set(index: number, value: number): void;
+}
+
+class SizeArray32 implements SizeArray {
+    private readonly array: Int32Array;
+
+    constructor(ptr: number, length: number) {
+        this.array = heap_array(Int32Array, ptr, length);
+    }
+
+    get length() { return this.array.length; }
+    get = (index: number) => this.array[index];
+    set = (index: number, value: number) => { this.array[index] = value; };
+}
+
+class SizeArray64 implements SizeArray {
+    private readonly array: BigUint64Array;
+
+    constructor(ptr: number, length: number) {
+        this.array = heap_array(BigUint64Array, ptr, length);
+    }
+
+    get length() { return this.array.length; }
+    get = (index: number) => Number(this.array[index]);
+    set = (index: number, value: number) => { this.array[index] = BigInt(value); };
+}
+
+export const size_array = (ptr: number, length: number): SizeArray =>
+    wide_size_t ? new SizeArray64(ptr, length) : new SizeArray32(ptr, length);
+
+// copies length size_t values starting at ptr into a js array
+export function read_sizes(ptr: number, length: number): number[] {
+    const array = size_array(ptr, length);
+    return Array.from({ length }, (_, i) => array.get(i));
+}
+
+export function write_sizes(ptr: number, values: number[]) {
+    const array = size_array(ptr, values.length);
+    values.forEach((value, i) => array.set(i, value));
+}
@@ -0,0 +1,138 @@
+import core from "../core/core.ts";
+import type { RawTensor } from "./raw_tensor.ts";
+
+/**
+ * Lifetime management for RawTensor handles.
+ *
+ * The memory of a RawTensor lives in the core and is not reclaimed by the js garbage collector.
+ * Tensors that are created inside of a scope are freed when the scope is closed:
+ *
+ *   const result = tensor_scope(() => a.add(b).mul(c));   // the result of add() is freed
+ *
+ *   {
+ *       using scope = open_scope();
+ *       ...                                                // everything is freed at the end of the block
+ *   }
+ *
+ * Handles that are garbage collected without being freed are reported and freed by a
+ * FinalizationRegistry. This is only a safety net, the gc makes no guarantees about if
+ * and when this happens.
+ */
+
+type LeakHandler = (ptr: number) => void;
+
+let leaked = 0;
+let leak_handler: LeakHandler = () => {
+    // only report the first leak, there are usually many of them
+    if (leaked === 1) console.warn("[core] reclaimed a leaked tensor, free tensors explicitly or use tensor_scope()");
+};
+
+const registry = new FinalizationRegistry<number>((ptr) => {
+    leaked++;
+    core._free_tensor(ptr);
+    leak_handler(ptr);
+});
+
+const scopes: TensorScope[] = [];
+const owners = new WeakMap<RawTensor, TensorScope>();
+const freed = new WeakSet<RawTensor>();
+
+export class TensorScope {
+    private readonly tensors = new Set<RawTensor>();
+    private closed = false;
+
+    constructor() {
+        scopes.push(this);
+    }
+
+    add(tensor: RawTensor) {
+        this.tensors.add(tensor);
+        owners.set(tensor, this);
+    }
+
+    delete(tensor: RawTensor) {
+        this.tensors.delete(tensor);
+        owners.delete(tensor);
+    }
+
+    /**
+     * Moves tensors out of this scope into the enclosing one (if any), so they survive closing it.
+     * Views keep the tensors they reference alive as well.
+     */
+    keep(...tensors: RawTensor[]) {
+        const parent = scopes[scopes.indexOf(this) - 1];
+
+        for (const kept of tensors) {
+            for (let tensor: RawTensor | undefined = kept; tensor !== undefined; tensor = tensor.source) {
+                if (owners.get(tensor) !== this) continue;
+                this.delete(tensor);
+                parent?.add(tensor);
+            }
+        }
+    }
+
+    // frees all tensors of the scope, views are freed before the tensors they reference
+    close() {
+        if (this.closed) return;
+        if (scopes[scopes.length - 1] !== this)
+            throw new Error("Tensor scopes need to be closed in reverse order of creation.");
+
+        scopes.pop();
+        this.closed = true;
+
+        for (const tensor of [...this.tensors].reverse()) tensor.free();
+        this.tensors.clear();
+    }
+
+    [Symbol.dispose]() {
+        this.close();
+    }
+}
+
+// registers a newly created handle
+export function track(tensor: RawTensor) {
+    registry.register(tensor, tensor.ptr, tensor);
+    scopes[scopes.length - 1]?.add(tensor);
+}
+
+// unregisters a handle that is about to be freed, returns false if it has been freed already
+export function release(tensor: RawTensor): boolean {
+    if (freed.has(tensor)) return false;
+
+    freed.add(tensor);
+    registry.unregister(tensor);
+    owners.get(tensor)?.delete(tensor);
+    return true;
+}
+
+// removes a handle from its scope, it is then owned by the caller (e.g. a compiled program)
+export function detach(tensor: RawTensor) {
+    owners.get(tensor)?.delete(tensor);
+}
+
+export const open_scope = () => new TensorScope();
+
+/**
+ * Runs fn and frees all tensors created during the call, except for the returned ones.
+ * Returned tensors (or arrays of tensors) are moved into the enclosing scope.
+ * fn has to be synchronous.
+ */
+export function tensor_scope<T>(fn: (scope: TensorScope) => T): T {
+    const scope = new TensorScope();
+
+    try {
+        const result = fn(scope);
+        const returned = result instanceof Array ? result : [result];
+        scope.keep(...returned.filter(is_raw_tensor));
+        return result;
+    } finally {
+        scope.close();
+    }
+}
+
+// avoids a runtime import of raw_tensor.ts, which imports this module
+const is_raw_tensor = (item: unknown): item is RawTensor =>
+    typeof item === "object" && item !== null && "data_ptr" in item && "free" in item;
+
+export const get_leaked = () => leaked;
+export const set_leak_handler = (handler: LeakHandler) => leak_handler = handler;
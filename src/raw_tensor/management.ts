@@ -1,34 +1,49 @@
-import core from "../core/build";
+import core, { native } from "../core/core.ts";
+import { type SizeArray, size_array } from "./layout.ts";
 
-enum  STRUCT_LAYOUT { ALLOCATED, NTENSORS }
+enum  STRUCT_LAYOUT { ALLOCATED, NTENSORS, POOLED, POOL_LIMIT, POOL_HITS }
 const STRUCT_SIZE = Object.entries(STRUCT_LAYOUT).length / 2;
 
-let view: Uint32Array;
-let memory: Uint32Array;
+let view: SizeArray;
+
+/**
+ * Incremented whenever the wasm memory grows.
+ * Growing the memory detaches all typed arrays that view the old buffer. Instead of checking for a
+ * detached buffer on every access, RawTensors store the generation their views were created at
+ * and only re-create them if it changed.
+ */
+export let memory_generation = 0;
+
+let initialized = false;
 
 const init_error = () => console.log("[core] error during initialization");
 const init = () => {
-    memory = new Uint32Array(core.HEAP32.buffer);
-
-    // augmenting the core module with a custom memory object
-    // whenever this object is accessed, we check if the buffer
-    // has been detached (because of a memory growth event)
-    // if so, we create a new view of the memory.
-    // an alternative solution we would be to inject some code into
-    // the emscripten build output to update the view when growth happens.
-    // todo: test perf.
-    Object.defineProperty(core, "memory", {
-        get() {
-            // memory buffer has detached, growth event has ocurred
-            if (memory.byteLength === 0) {
-                memory = new Uint32Array(core.HEAP32.buffer);
-                init_mgmt();
-                console.log("[core] memory growth");
-            }
-
-            return memory;
+    if (initialized) return;
+    initialized = true;
+
+    // the native core has no linear memory that could grow
+    if (native) {
+        init_mgmt();
+        console.log("[core] initialized (native)");
+        return;
+    }
+
+    core.memory = new Uint32Array(core.HEAP32.buffer);
+
+    // emscripten re-creates its HEAP* views right after every memory growth event.
+    // intercepting the assignment to HEAP8 lets us react to growth without polling.
+    let heap8: Int8Array = core.HEAP8;
+
+    Object.defineProperty(core, "HEAP8", {
+        get: () => heap8,
+        set(value: Int8Array) {
+            heap8 = value;
+            core.memory = new Uint32Array(value.buffer);
+            memory_generation++;
+            init_mgmt();
+            console.log("[core] memory growth");
         },
-      
+
         configurable: false,
         enumerable: true,
     });
@@ -40,6 +55,13 @@ const init = () => {
 export const core_ready = new Promise<null>((resolve) => {
     let loaded = false;
 
+    // the native core is ready as soon as it is loaded
+    if (native) {
+        init();
+        resolve(null);
+        return;
+    }
+
     core.onRuntimeInitialized = () => {
         try   { init(); }
         catch { init_error(); }
@@ -68,21 +90,79 @@ export const core_ready = new Promise<null>((resolve) => {
 });
 
 export function init_mgmt() {
-    view = new Uint32Array(core.memory.buffer, core._get_mgmt_ptr(), STRUCT_SIZE);
+    view = size_array(core._get_mgmt_ptr(), STRUCT_SIZE);
 }
 
 export function get_total_allocated(): number {
-    return view[STRUCT_LAYOUT.ALLOCATED];
+    return view.get(STRUCT_LAYOUT.ALLOCATED);
 }
 
 export function get_ntensors(): number {
-    return view[STRUCT_LAYOUT.NTENSORS];
+    return view.get(STRUCT_LAYOUT.NTENSORS);
+}
+
+// amount of bytes held by free data buffers of the tensor pool
+export function get_pooled(): number {
+    return view.get(STRUCT_LAYOUT.POOLED);
+}
+
+// number of tensor allocations that reused a pooled buffer instead of calling malloc
+export function get_pool_hits(): number {
+    return view.get(STRUCT_LAYOUT.POOL_HITS);
+}
+
+export function get_pool_limit(): number {
+    return view.get(STRUCT_LAYOUT.POOL_LIMIT);
+}
+
+// sets the maximum amount of bytes the tensor pool may hold
+export const set_pool_limit = (bytes: number) => core._set_pool_limit(bytes);
+
+// frees all buffers held by the tensor pool
+export const trim_pool = () => core._pool_trim();
+
+/**
+ * Sets the number of threads the kernels of the core may use (including the calling thread).
+ * Only the multithreaded core (TALOS_THREADS=1) can use more than one thread.
+ * Large kernels are split into chunks that idle threads steal from each other,
+ * small kernels always run on the calling thread.
+ * @returns The number of threads that is actually used
+ */
+export function set_num_threads(n: number): number {
+    if (core._set_num_threads === undefined) return 1;
+    return core._set_num_threads(Math.max(1, Math.floor(n)));
+}
+
+export function get_num_threads(): number {
+    return core._get_num_threads?.() ?? 1;
+}
+
+// kernel time measurement of the core (see Profiler in autograd/profiler.ts)
+export const set_profiling = (enabled: boolean) => core._set_profiling?.(enabled ? 1 : 0);
+
+// time spent in kernels while profiling was enabled, in ms. 0 for cores without profiling support.
+export const get_kernel_time = (): number => core._get_kernel_time?.() ?? 0;
+
+// current size of the wasm memory in bytes. the native core has no such memory, there it is the memory held by tensors and the pool.
+export const get_heap_size = (): number => native ? get_total_allocated() + get_pooled() : core.memory.buffer.byteLength;
+
+/**
+ * Grows the wasm memory such that at least the specified amount of bytes can be allocated
+ * without another growth event. Useful for avoiding growth (and the re-binding of all tensor
+ * views that comes with it) in latency critical sections.
+ * The initial size of the memory can be set at build time (INITIAL_MEMORY in the Makefile).
+ */
+export function reserve(bytes: number) {
+    if (!core._reserve_memory(bytes))
+        throw new Error(`Could not reserve ${bytes} bytes of memory, the maximum heap size has been reached.`);
 }
 
 export function print_memory_status() {
     console.log(
         "MEMORY INFO\n" + 
         `  Number of Tensors: ${get_ntensors()}\n` +
-        `  Total allocated:   ${get_total_allocated()} bytes`
+        `  Total allocated:   ${get_total_allocated()} bytes\n` +
+        `  Pooled:            ${get_pooled()} bytes (${get_pool_hits()} hits)\n` +
+        `  Heap size:         ${get_heap_size()} bytes`
     );
 }
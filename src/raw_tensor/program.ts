@@ -0,0 +1,220 @@
+import core from "../core/core.ts";
+import type { RawTensor } from "./raw_tensor.ts";
+import { SIZE_T_BYTES, size_array, heap_array } from "./layout.ts";
+import { detach } from "./lifetime.ts";
+import { get_global_seed } from "./util.ts";
+
+/**
+ * Programs are flat buffers of instructions in wasm memory that the core executes
+ * in a single call (see run_program() in core/src/program.c).
+ *
+ * Programs are recorded: while a Recorder is active, the operations in raw_tensor_operations.ts
+ * validate their operands as usual, but append an instruction to the recorder instead of
+ * calling the kernel. The validation therefore only happens once, when the program is recorded.
+ *
+ * Everything that needs js in between kernels (e.g. the producer of a Source) is recorded as
+ * a callback. A program is split into multiple core calls at callbacks.
+ *
+ * The core derives a dependency graph for every segment (see core/src/schedule.c). With more
+ * than one thread (see set_num_threads()), instructions that don't depend on each other, e.g.
+ * independent branches of a graph, are executed concurrently. Instructions on the critical path
+ * are started first. Instructions that access the same tensors keep their order, so the results
+ * don't depend on the number of threads.
+ */
+
+// values of enum instr_kind_t in the core
+export enum INSTR { UNARY, BINARY, COPY, FILL, DROPOUT, DROPOUT_RESEED, SHIFT, BACKWARD, OPTIMIZER, BACKWARD_BINARY }
+
+// struct instr_t: kind, op, a, b, c, dest, aux and param. param is a float that is padded to the size of a size_t.
+const INSTR_WORDS = 8;
+const PARAM_WORD = 7;
+
+export interface Instruction {
+    kind: INSTR;
+    op: string;         // name of the kernel
+    a?: RawTensor;
+    b?: RawTensor;
+    c?: RawTensor;
+    dest?: RawTensor;
+    aux?: number;
+    param?: number;
+}
+
+export type Step = Instruction | (() => void);
+
+export class NotRecordableError extends Error {}
+
+// the recorder that the operations append to, undefined if the operations are executed immediately
+export let recorder: Recorder | undefined;
+
+// throws if an operation whose result is read in js is called while recording
+export function not_recordable(operation: string) {
+    if (recorder) throw new NotRecordableError(`${operation}() reads its result in js and can't be recorded.`);
+}
+
+export class Recorder {
+    steps: Step[] = [];
+
+    // tensors that were freed while recording. they are referenced by the recorded
+    // instructions (e.g. the temporary scalars of scalar operations), so they are freed with the program.
+    readonly retained: RawTensor[] = [];
+
+    // initial values of the dropout seeds, a program keeps them in a tensor (see INSTR.DROPOUT)
+    readonly seeds: number[] = [];
+    private readonly seed_slots = new Map<object, number>();
+
+    emit = (instruction: Instruction) => this.steps.push(instruction);
+    callback = (fn: () => void) => this.steps.push(fn);
+
+    retain(tensor: RawTensor) {
+        detach(tensor);
+        this.retained.push(tensor);
+    }
+
+    // all dropouts that use the same key share one seed
+    seed_slot(key: object, seed = get_global_seed()): number {
+        if (!this.seed_slots.has(key)) {
+            this.seed_slots.set(key, this.seeds.length);
+            this.seeds.push(seed);
+        }
+
+        return this.seed_slots.get(key)!;
+    }
+
+    // a reseeding dropout draws a new mask on every run, the others reuse the mask of the last reseed
+    dropout(src: RawTensor, dest: RawTensor, p: number, key: object, reseed: boolean, accumulate = false) {
+        const kind = reseed ? INSTR.DROPOUT_RESEED : INSTR.DROPOUT;
+        this.emit({ kind, op: accumulate ? "dropout_acc" : "dropout", a: src, dest, param: p, aux: this.seed_slot(key) });
+    }
+
+    /**
+     * Records the operations performed by fn. Nothing is executed.
+     * If fn calls something that can't be recorded, the steps recorded by fn are discarded
+     * and the whole call is recorded as a callback instead.
+     */
+    record(fn: () => void) {
+        const previous = recorder;
+        const mark = this.steps.length;
+        recorder = this;
+
+        try {
+            fn();
+        } catch (e) {
+            if (!(e instanceof NotRecordableError)) throw e;
+            this.steps.length = mark;
+            this.callback(fn);
+        } finally {
+            recorder = previous;
+        }
+    }
+}
+
+let op_indices: Map<string, number> | undefined;
+
+// indices of the kernels in the op table of the core
+function op_index(name: string): number {
+    if (!op_indices) {
+        op_indices = new Map();
+        const nops = core._get_nops();
+        for (let i = 0; i < nops; i++) op_indices.set(core.ccall("get_op_name", "string", ["number"], [i]), i);
+    }
+
+    const index = op_indices.get(name);
+    if (index === undefined) throw new Error(`The core does not have a kernel named "${name}".`);
+    return index;
+}
+
+type Segment = { ptr: number, ninstr: number, schedule: number } | (() => void);
+
+export class Program {
+    readonly ninstr: number;
+    private readonly segments: Segment[] = [];
+
+    /**
+     * Writes the steps into wasm memory. Consecutive instructions form one segment
+     * that is executed by a single core call.
+     * @param steps Recorded steps
+     * @param seeds Tensor that holds the seeds of the dropout instructions
+     */
+    constructor(steps: Step[], seeds?: RawTensor) {
+        let pending: Instruction[] = [];
+
+        for (const step of steps) {
+            if (typeof step !== "function") {
+                pending.push(step);
+                continue;
+            }
+
+            if (pending.length > 0) this.segments.push(this.encode(pending, seeds));
+            this.segments.push(step);
+            pending = [];
+        }
+
+        if (pending.length > 0) this.segments.push(this.encode(pending, seeds));
+        this.ninstr = steps.filter(step => typeof step !== "function").length;
+    }
+
+    private encode(instructions: Instruction[], seeds?: RawTensor): Segment {
+        const ptr = core._create_program(instructions.length);
+
+        // the memory may grow during create_program(), so the views are created afterwards
+        const words = size_array(ptr, instructions.length * INSTR_WORDS);
+        const params = heap_array(Float32Array, ptr, instructions.length * INSTR_WORDS * SIZE_T_BYTES / 4);
+
+        instructions.forEach((instruction, i) => {
+            const offset = i * INSTR_WORDS;
+            const is_dropout = instruction.kind === INSTR.DROPOUT || instruction.kind === INSTR.DROPOUT_RESEED;
+            const b = is_dropout ? seeds : instruction.b;
+
+            if (is_dropout && !seeds) throw new Error("Programs with dropout instructions need a seed tensor.");
+
+            words.set(offset,     instruction.kind);
+            words.set(offset + 1, op_index(instruction.op));
+            words.set(offset + 2, instruction.a?.ptr ?? 0);
+            words.set(offset + 3, b?.ptr ?? 0);
+            words.set(offset + 4, instruction.c?.ptr ?? 0);
+            words.set(offset + 5, instruction.dest?.ptr ?? 0);
+            words.set(offset + 6, instruction.aux ?? 0);
+            params[(offset + PARAM_WORD) * SIZE_T_BYTES / 4] = instruction.param ?? 0;
+        });
+
+        // older cores don't have a scheduler
+        const schedule = core._plan_program?.(ptr, instructions.length) ?? 0;
+        return { ptr, ninstr: instructions.length, schedule };
+    }
+
+    // number of core calls and callbacks per run
+    get nsegments() {
+        return this.segments.length;
+    }
+
+    // largest average number of instructions that can be executed concurrently in a segment
+    get parallelism(): number {
+        let parallelism = 1;
+
+        for (const segment of this.segments) {
+            if (typeof segment !== "function" && segment.schedule)
+                parallelism = Math.max(parallelism, core._get_parallelism(segment.schedule));
+        }
+
+        return parallelism;
+    }
+
+    run() {
+        for (const segment of this.segments) {
+            if (typeof segment === "function") segment();
+            else if (segment.schedule) core._run_schedule(segment.ptr, segment.schedule);
+            else core._run_program(segment.ptr, segment.ninstr);
+        }
+    }
+
+    free() {
+        for (const segment of this.segments) {
+            if (typeof segment === "function") continue;
+            if (segment.schedule) core._free_schedule(segment.schedule);
+            core._free_program(segment.ptr);
+        }
+
+        this.segments.length = 0;
+    }
+}
@@ -1,11 +1,16 @@
 import Shape from "./shape.ts";
 import Strides from "./strides.ts";
-import core from "../core/build/index.js";
+import core, { wide_size_t } from "../core/core.ts";
 import {tensor_to_string, ordinal_str, tensor_info_to_string} from "./to_string.ts";
 import {flatten, get_global_seed, get_strides_row_major, NDArray} from "./util.ts";
 import * as ops from "./raw_tensor_operations.ts";
+import { track } from "./lifetime.ts";
+import { memory_generation } from "./management.ts";
+import { type SizeArray, size_array, read_sizes, write_sizes, heap_array } from "./layout.ts";
+import { type DType, DTYPES, dtype_id, half_to_float32, read_only } from "./dtype.ts";
+import { INSTR, recorder } from "./program.ts";
 
-enum  STRUCT_LAYOUT { DATA, SHAPE, STRIDES, RANK, NELEM, NDATA, OFFSET, SIZE, ISVIEW, VIEWSRC }
+enum  STRUCT_LAYOUT { DATA, SHAPE, STRIDES, RANK, NELEM, NDATA, OFFSET, SIZE, ISVIEW, VIEWSRC, DTYPE }
 const STRUCT_SIZE = Object.entries(STRUCT_LAYOUT).length / 2;
 
 /**
@@ -16,30 +21,137 @@ const STRUCT_SIZE = Object.entries(STRUCT_LAYOUT).length / 2;
  * in the computation graph.
  */
 export class RawTensor {
-    private readonly view: Int32Array;
-    data: Float32Array; // todo: should be private probably
-    shape: Shape;
-    strides: Strides;
-
-    constructor(ptr: number) {
-        // set up typed arrays for wasm memory access
-        this.view = new Int32Array(core.memory.buffer, ptr, STRUCT_SIZE);
-        this.shape   = new Shape  (new Int32Array(core.memory.buffer, this.shape_ptr, this.rank), true);
-        this.strides = new Strides(new Int32Array(core.memory.buffer, this.strides_ptr, this.rank), true);
-        this.data    = new Float32Array(core.memory.buffer, this.data_ptr, this.ndata);
-    }
-
-    public get rank(): number        { return this.view[STRUCT_LAYOUT.RANK]; }
-    public get nelem(): number       { return this.view[STRUCT_LAYOUT.NELEM]; }
-    public get offset(): number      { return this.view[STRUCT_LAYOUT.OFFSET]; }
-    public get ndata(): number       { return this.view[STRUCT_LAYOUT.NDATA]; }
-    public get size(): number        { return this.view[STRUCT_LAYOUT.SIZE]; }
-    public get isview(): number      { return this.view[STRUCT_LAYOUT.ISVIEW]; }
-    public get viewsrc(): number     { return this.view[STRUCT_LAYOUT.VIEWSRC]; }
-    public get ptr(): number         { return this.view.byteOffset; }
-    public get data_ptr(): number    { return this.view[STRUCT_LAYOUT.DATA]; }
-    public get shape_ptr(): number   { return this.view[STRUCT_LAYOUT.SHAPE]; }
-    public get strides_ptr(): number { return this.view[STRUCT_LAYOUT.STRIDES]; }
+    readonly ptr: number;
+
+    // views keep the tensor they reference alive, so it is not reclaimed before them
+    readonly source?: RawTensor;
+
+    // the typed arrays are detached when the wasm memory grows. they are re-created lazily
+    // on the first access after a growth event (see memory_generation in management.ts).
+    private generation = -1;
+    private _view!: SizeArray;
+    private _data!: Float32Array;
+    private _bits!: Uint16Array;
+    private _shape!: Shape;
+    private _strides!: Strides;
+
+    constructor(ptr: number, source?: RawTensor) {
+        this.ptr = ptr;
+        this.source = source;
+        this.bind();
+
+        track(this);
+    }
+
+    // set up typed arrays for wasm memory access
+    private bind() {
+        const view = size_array(this.ptr, STRUCT_SIZE);
+        const rank = view.get(STRUCT_LAYOUT.RANK);
+        const shape_ptr = view.get(STRUCT_LAYOUT.SHAPE);
+        const strides_ptr = view.get(STRUCT_LAYOUT.STRIDES);
+
+        // in the memory64 and native builds, size_t does not fit into the elements of shape and strides,
+        // so they are copies instead of views there. they are written back by set_layout().
+        if (wide_size_t) {
+            this._shape   = new Shape  (read_sizes(shape_ptr, rank));
+            this._strides = new Strides(read_sizes(strides_ptr, rank));
+        } else {
+            this._shape   = new Shape  (heap_array(Int32Array, shape_ptr, rank), true);
+            this._strides = new Strides(heap_array(Int32Array, strides_ptr, rank), true);
+        }
+
+        // half precision elements are stored as raw 16 bit values
+        const data_ptr = view.get(STRUCT_LAYOUT.DATA);
+        const ndata = view.get(STRUCT_LAYOUT.NDATA);
+        if ((DTYPES[view.get(STRUCT_LAYOUT.DTYPE)] ?? "fp32") !== "fp32")
+            this._bits = heap_array(Uint16Array, data_ptr, ndata);
+        else
+            this._data = heap_array(Float32Array, data_ptr, ndata);
+
+        this._view = view;
+        this.generation = memory_generation;
+    }
+
+    // writes shape and strides into wasm memory
+    private set_layout(shape: number[], strides: number[]) {
+        if (!wide_size_t) {
+            this.shape.set(shape);
+            this.strides.set(strides);
+            return;
+        }
+
+        write_sizes(this.shape_ptr, shape);
+        write_sizes(this.strides_ptr, strides);
+        this.bind();
+    }
+
+    // forces the views to be re-created on the next access, needed if the core changed the metadata
+    public invalidate() {
+        this.generation = -1;
+    }
+
+    private get view(): SizeArray {
+        if (this.generation !== memory_generation) this.bind();
+        return this._view;
+    }
+
+    /**
+     * Elements of the data array of the tensor.
+     * For half precision tensors, this is a decoded, read-only copy that throws on writes. Use set_values() to write to them.
+     */
+    public get data(): Float32Array {
+        if (this.generation !== memory_generation) this.bind();
+        if (this.dtype !== "fp32") return read_only(half_to_float32(this._bits, this.dtype), `The data of ${this.dtype} tensors is a read-only copy, write to it with set_values() or convert the tensor with astype("fp32").`);
+        return this._data;
+    }
+
+    // raw storage of half precision tensors
+    public get bits(): Uint16Array {
+        if (this.dtype === "fp32") throw new Error("RawTensor.bits is only available for half precision tensors.");
+        if (this.generation !== memory_generation) this.bind();
+        return this._bits;
+    }
+
+    public get dtype(): DType {
+        return DTYPES[this.view.get(STRUCT_LAYOUT.DTYPE)] ?? "fp32";
+    }
+
+    // writes the elements of the tensor in row-major order, converting them to its dtype
+    public set_values(values: ArrayLike<number>) {
+        if (this.dtype === "fp32") {
+            this.data.set(values);
+            return;
+        }
+
+        const tmp = RawTensor.create([values.length]);
+        tmp.data.set(values);
+        core._convert_tensor(tmp.ptr, this.ptr);
+        tmp.free();
+    }
+
+    // creates a copy of the tensor with a different dtype
+    public astype = (dtype: DType) => ops.convert(this, dtype);
+
+    public get shape(): Shape {
+        if (this.generation !== memory_generation) this.bind();
+        return this._shape;
+    }
+
+    public get strides(): Strides {
+        if (this.generation !== memory_generation) this.bind();
+        return this._strides;
+    }
+
+    public get rank(): number        { return this.view.get(STRUCT_LAYOUT.RANK); }
+    public get nelem(): number       { return this.view.get(STRUCT_LAYOUT.NELEM); }
+    public get offset(): number      { return this.view.get(STRUCT_LAYOUT.OFFSET); }
+    public get ndata(): number       { return this.view.get(STRUCT_LAYOUT.NDATA); }
+    public get size(): number        { return this.view.get(STRUCT_LAYOUT.SIZE); }
+    public get isview(): number      { return this.view.get(STRUCT_LAYOUT.ISVIEW); }
+    public get viewsrc(): number     { return this.view.get(STRUCT_LAYOUT.VIEWSRC); }
+    public get data_ptr(): number    { return this.view.get(STRUCT_LAYOUT.DATA); }
+    public get shape_ptr(): number   { return this.view.get(STRUCT_LAYOUT.SHAPE); }
+    public get strides_ptr(): number { return this.view.get(STRUCT_LAYOUT.STRIDES); }
     public get rows(): number        { return this.get_axis_size(this.rank - 2); }
     public get cols(): number        { return this.get_axis_size(this.rank - 1); }
     public get is_scalar(): boolean  { return this.nelem === 1; }
@@ -100,7 +212,8 @@ export class RawTensor {
     }
 
     public fill(value: number) {
-        core._init_fill(this.ptr, value);
+        if (recorder) recorder.emit({ kind: INSTR.FILL, op: "init_fill", dest: this, param: value });
+        else core._init_fill(this.ptr, value);
         return this;
     }
 
@@ -121,10 +234,9 @@ export class RawTensor {
             throw new Error(`Cannot reshape tensor of shape [${this.shape}] into [${shape}] because the number of elements does not match.`);
 
         const ptr = core._create_reshape_view(this.ptr, rank);
-        const new_tensor = new RawTensor(ptr);
+        const new_tensor = new RawTensor(ptr, this);
 
-        new_tensor.shape.set(shape);
-        new_tensor.strides.set(_strides);
+        new_tensor.set_layout(_shape, [..._strides]);
 
         return new_tensor;
     }
@@ -157,21 +269,22 @@ export class RawTensor {
 
     // builders
     public static scalar   = (scalar?: number): RawTensor => RawTensor.create([1], scalar ? [scalar] : undefined);
-    public static like     = (other: RawTensor): RawTensor => RawTensor.create([...other.shape]);
-    public static view_of  = (a: RawTensor, axis = 0, offset = 0): RawTensor => new RawTensor(core._create_view(a.ptr, axis, offset));
-    public static create(shape: number[] | Shape, data?: number[]): RawTensor {
+    public static like     = (other: RawTensor): RawTensor => RawTensor.create([...other.shape], undefined, other.dtype);
+    public static view_of  = (a: RawTensor, axis = 0, offset = 0): RawTensor => new RawTensor(core._create_view(a.ptr, axis, offset), a);
+    public static create(shape: number[] | Shape, data?: number[], dtype: DType = "fp32"): RawTensor {
         const _shape = [...shape];
         const nelem = _shape.reduce((acc: number, val: number) => acc * val, 1);
 
         if (data !== undefined && data.length !== nelem)
             throw new Error(`Cannot cast array of size ${data.length} into tensor of shape [${shape}]`);
 
-        const ptr = core._create_tensor(shape.length, nelem);
+        const ptr = dtype === "fp32"
+            ? core._create_tensor(shape.length, nelem)
+            : core._create_tensor_dtype(shape.length, nelem, dtype_id(dtype));
         const new_tensor = new RawTensor(ptr);
     
-        if (data !== undefined) new_tensor.data.set(data);
-        new_tensor.shape.set(shape);
-        new_tensor.strides.set(get_strides_row_major(_shape));
+        new_tensor.set_layout(_shape, get_strides_row_major(_shape));
+        if (data !== undefined) new_tensor.set_values(data);
     
         return new_tensor;
     }
@@ -1,16 +1,23 @@
 import { RawTensor } from "./raw_tensor.ts";
-import core from "../core/build/index.js";
+import core from "../core/core.ts";
 import Shape from "./shape.ts";
+import { release } from "./lifetime.ts";
+import type { DType } from "./dtype.ts";
+import { INSTR, recorder, not_recordable } from "./program.ts";
 
 // types for high level operations
 export type UnaryOp = (src: RawTensor, dest?: RawTensor, param?: number) => RawTensor;
 export type BinaryOp<OtherType> = (src_a: RawTensor, src_b: OtherType, dest?: RawTensor) => RawTensor;
 export type DropoutOp = (src: RawTensor, dest?: RawTensor, p?: number, seed?: number) => RawTensor;
+export type BackwardOp = (src: RawTensor, grad: RawTensor, dest: RawTensor, param?: number) => RawTensor;
+export type BackwardBinaryOp = (src_a: RawTensor, src_b: RawTensor, grad: RawTensor, dest: RawTensor) => RawTensor;
 
 // types of core functions
 type CoreUnaryOp   =  (src_ptr: number, dest_ptr: number, param?: number) => void;
 type CoreBinaryOp  = (src_a_ptr: number, src_b_ptr_or_imm: number, dest_ptr: number) => void;
 type CoreDropoutOp =  (src_ptr: number, dest_ptr: number, p: number, seed: number) => void;
+type CoreBackwardOp = (src_ptr: number, grad_ptr: number, dest_ptr: number, param?: number) => void;
+type CoreBackwardBinaryOp = (src_a_ptr: number, src_b_ptr: number, grad_ptr: number, dest_ptr: number) => void;
 
 // binary operations (dest = a <OP> b)
 export const add    = create_binary_op("add");
@@ -39,6 +46,7 @@ export const leaky_relu = create_unary_op("leaky_relu");
 export const binstep    = create_unary_op("binstep");
 export const logistic   = create_unary_op("logistic");
 export const negate     = create_unary_op("negate");
+export const identity   = create_unary_op("identity");
 export const sin        = create_unary_op("sin");
 export const cos        = create_unary_op("cos");
 export const tan        = create_unary_op("tan");
@@ -65,6 +73,7 @@ export const leaky_relu_acc = create_unary_op("leaky_relu", true);
 export const binstep_acc    = create_unary_op("binstep", true);
 export const logistic_acc   = create_unary_op("logistic", true);
 export const negate_acc     = create_unary_op("negate", true);
+export const identity_acc   = create_unary_op("identity", true);
 export const sin_acc        = create_unary_op("sin", true);
 export const cos_acc        = create_unary_op("cos", true);
 export const tan_acc        = create_unary_op("tan", true);
@@ -108,19 +117,65 @@ export const df_sqrt       = create_unary_op("df_sqrt");
 export const df_abs        = create_unary_op("df_abs");
 export const df_reciprocal = create_unary_op("df_reciprocal");
 
+// fused backward passes (dest += grad * f'(src)) of unary operations, see unary_bw.c.
+// src is the result of the operation for tanh, exp, logistic and sqrt, and its input otherwise.
+export const bw_relu_acc       = create_backward_op("bw_relu", true);
+export const bw_leaky_relu_acc = create_backward_op("bw_leaky_relu", true);
+export const bw_logistic_acc   = create_backward_op("bw_logistic", true);
+export const bw_sin_acc        = create_backward_op("bw_sin", true);
+export const bw_cos_acc        = create_backward_op("bw_cos", true);
+export const bw_tan_acc        = create_backward_op("bw_tan", true);
+export const bw_asin_acc       = create_backward_op("bw_asin", true);
+export const bw_acos_acc       = create_backward_op("bw_acos", true);
+export const bw_atan_acc       = create_backward_op("bw_atan", true);
+export const bw_sinh_acc       = create_backward_op("bw_sinh", true);
+export const bw_cosh_acc       = create_backward_op("bw_cosh", true);
+export const bw_tanh_acc       = create_backward_op("bw_tanh", true);
+export const bw_exp_acc        = create_backward_op("bw_exp", true);
+export const bw_log_acc        = create_backward_op("bw_log", true);
+export const bw_log10_acc      = create_backward_op("bw_log10", true);
+export const bw_log2_acc       = create_backward_op("bw_log2", true);
+export const bw_invsqrt_acc    = create_backward_op("bw_invsqrt", true);
+export const bw_sqrt_acc       = create_backward_op("bw_sqrt", true);
+export const bw_abs_acc        = create_backward_op("bw_abs", true);
+export const bw_reciprocal_acc = create_backward_op("bw_reciprocal", true);
+
+// fused backward passes (dest += grad * df/da or df/db, summed over the broadcast axes of dest) of binary operations, see binary_bw.c
+export const bw_div_b_acc = create_backward_binary_op("bw_div_b", true);
+export const bw_pow_a_acc = create_backward_binary_op("bw_pow_a", true);
+export const bw_pow_b_acc = create_backward_binary_op("bw_pow_b", true);
+
 // reduce operations
 // todo: add pairwise functionality (tensor-valued functions)
-export const sum      = (a: RawTensor) => core._sum_red_scl(a.ptr);
-export const mean     = (a: RawTensor) => core._mean_red_scl(a.ptr);
-export const min_idx  = (a: RawTensor) => core._min_red_idx(a.ptr);
-export const max_idx  = (a: RawTensor) => core._max_red_idx(a.ptr);
-export const sum_tns  = create_reduce_op(core._sum_red_tns);
-export const mean_tns = create_reduce_op(core._mean_red_tns);
+// the results of these are read in js, so they can't be recorded into programs
+export const sum      = create_scalar_op("sum", core._sum_red_scl);
+export const mean     = create_scalar_op("mean", core._mean_red_scl);
+export const min_idx  = create_scalar_op("min_idx", core._min_red_idx);
+export const max_idx  = create_scalar_op("max_idx", core._max_red_idx);
+export const sum_tns  = create_reduce_op("sum_red_tns");
+export const mean_tns = create_reduce_op("mean_red_tns");
+
+export const shift_view = (a: RawTensor, linear_index: number) => {
+    not_recordable("shift_view");
+    core._shift_view(a.ptr, linear_index);
+};
 
-export const shift_view = (a: RawTensor, linear_index: number) => core._shift_view(a.ptr, linear_index);
+/**
+ * Moves views to the smallest/largest element of a tensor.
+ * @param src Tensor to search
+ * @param view View of src (or of a tensor with the same shape) that is moved
+ * @param other_view Optional second view that is moved to the same element
+ */
+export const shift_to_min = create_shift_op("min_red_idx");
+export const shift_to_max = create_shift_op("max_red_idx");
 
 // be aware of tensor data dependencies when deallocating tensors !!
-export const free = (a: RawTensor) => core._free_tensor(a.ptr);
+// freeing a tensor more than once has no effect.
+// tensors that are freed while a program is recorded are kept alive until the program is freed.
+export const free = (a: RawTensor) => {
+    if (recorder) recorder.retain(a);
+    else if (release(a)) core._free_tensor(a.ptr);
+};
 
 /**
  * Creates a deep copy of a tensor.
@@ -135,10 +190,31 @@ export const free = (a: RawTensor) => core._free_tensor(a.ptr);
  */
 export const clone = (src: RawTensor, dest?: RawTensor) => {
     const result = dest || RawTensor.like(src);
-    core._clone_tensor(src.ptr, result.ptr);
+
+    if (recorder) recorder.emit({ kind: INSTR.COPY, op: "clone_tensor", a: src, dest: result });
+    else core._clone_tensor(src.ptr, result.ptr);
+
+    result.invalidate();
     return result;
 };
 
+/**
+ * Copies the elements of a tensor into a tensor of another dtype.
+ * @param src Tensor to convert
+ * @param dest Destination tensor of the same shape, or the dtype of the tensor that is created
+ */
+export function convert(src: RawTensor, dest: RawTensor | DType) {
+    const result = dest instanceof RawTensor ? dest : RawTensor.create([...src.shape], undefined, dest);
+
+    if (result.nelem !== src.nelem)
+        throw new Error(`Cannot convert tensor of shape [${src.shape}] into [${result.shape}].`);
+
+    if (recorder) recorder.emit({ kind: INSTR.COPY, op: "convert_tensor", a: src, dest: result });
+    else core._convert_tensor(src.ptr, result.ptr);
+
+    return result;
+}
+
 export function get_shape_matmul(a: RawTensor, b: RawTensor): Shape {
     if (a.cols !== b.rows)
         throw new Error(`Cannot perform matmul on tensors of shape [${a.shape}] and [${b.shape}]`);
@@ -171,12 +247,12 @@ export function get_shape_dot(a: RawTensor, b: RawTensor): Shape {
 }
 
 function create_matmul_op(opcode: string, accumulative = false):  BinaryOp<RawTensor> {
-    const postfix = accumulative ? "_acc" : "";
-    const core_fn: CoreBinaryOp = core[`_${opcode}${postfix}`];
+    const name = `${opcode}${accumulative ? "_acc" : ""}`;
+    const core_fn: CoreBinaryOp = core[`_${name}`];
 
     return (src_a: RawTensor, src_b: RawTensor, dest?: RawTensor): RawTensor => {
         const result_shape = get_shape_matmul(src_a, src_b);
-        const result = dest || RawTensor.create(result_shape);
+        const result = dest || RawTensor.create(result_shape, undefined, src_a.dtype);
     
         if (dest && !dest.shape.equals(result_shape))
             throw new Error(`Cannot perform matmul. Result tensor [${result_shape}] has different shape than destination tensor [${dest.shape}].`);
@@ -185,62 +261,60 @@ function create_matmul_op(opcode: string, accumulative = false):  BinaryOp<RawTe
         //   or if we can just pass in the data like here
     
         // perform computation using core
-        core_fn(
-            src_a.ptr,
-            src_b.ptr,
-            result.ptr
-        );
+        call_binary(core_fn, name, src_a, src_b, result);
     
         return result;
     };
 }
 
 function create_dot_op(opcode: string, accumulative = false):  BinaryOp<RawTensor> {
-    const postfix = accumulative ? "_acc" : "";
-    const core_fn: CoreBinaryOp = core[`_${opcode}${postfix}`];
+    const name = `${opcode}${accumulative ? "_acc" : ""}`;
+    const core_fn: CoreBinaryOp = core[`_${name}`];
 
     return (a: RawTensor, b: RawTensor, dest?: RawTensor): RawTensor => {
         const result_shape = get_shape_dot(a, b);
-        const result = dest || RawTensor.create(result_shape);
+        const result = dest || RawTensor.create(result_shape, undefined, a.dtype);
     
         if (dest && !dest.shape.equals(result_shape))
             throw new Error(`Cannot compute dot product. Result tensor [${result_shape}] has different shape than destination tensor [${dest.shape}].`);
     
-        core_fn(
-            a.ptr,
-            b.ptr,
-            result.ptr
-        );
+        call_binary(core_fn, name, a, b, result);
     
         return result;
     };
 }
 
 function create_dropout_op(opcode: string, accumulative = false): DropoutOp {
-    const postfix = accumulative ? "_acc" : "";
-    const core_fn: CoreDropoutOp = core[`_${opcode}${postfix}`];
+    const name = `${opcode}${accumulative ? "_acc" : ""}`;
+    const core_fn: CoreDropoutOp = core[`_${name}`];
 
     return (src: RawTensor, dest?: RawTensor, p = .5, seed = 0): RawTensor => {
-        const result = dest || RawTensor.create(src.shape);
+        const result = dest || RawTensor.like(src);
     
         if (dest && !dest.shape.equals(src.shape))
             throw new Error(`Cannot compute dropout. Destination tensor [${dest.shape}] has different shape than source tensor [${src.shape}].`);
     
-        core_fn(src.ptr, result.ptr, p, seed);
+        // the recorded dropout always uses the given seed
+        if (recorder) recorder.emit({ kind: INSTR.DROPOUT, op: name, a: src, dest: result, param: p, aux: recorder.seed_slot({}, seed) });
+        else core_fn(src.ptr, result.ptr, p, seed);
+
         return result;
     };
 }
 
 function create_binary_op(opcode: string, accumulative = false): BinaryOp<RawTensor | number> {
     const postfix = accumulative ? "_acc" : "";
-    const core_fn_brc: CoreBinaryOp = core[`_${opcode}_brc${postfix}`];   //   broadcasting operation
-    const core_fn_dbrc: CoreBinaryOp = core[`_${opcode}_dbrc${postfix}`]; // debroadcasting operations
+    const name_brc = `${opcode}_brc${postfix}`;
+    const name_dbrc = `${opcode}_dbrc${postfix}`;
+    const core_fn_brc: CoreBinaryOp = core[`_${name_brc}`];   //   broadcasting operation
+    const core_fn_dbrc: CoreBinaryOp = core[`_${name_dbrc}`]; // debroadcasting operations
 
     return (src_a: RawTensor, _src_b: RawTensor | number, _dest?: RawTensor): RawTensor => {
         const scalar_op = typeof _src_b === "number";
         const src_b = scalar_op ? RawTensor.scalar(_src_b) : _src_b;
         const brc_result_shape = src_a.shape.broadcast(src_b.shape);
-        const dest = _dest || RawTensor.create(brc_result_shape);
+        // results are stored in the dtype of the first operand
+        const dest = _dest || RawTensor.create(brc_result_shape, undefined, src_a.dtype);
 
         // todo come up with a better error message
         // todo compatibility with brc/dbrc would be nice
@@ -253,7 +327,7 @@ function create_binary_op(opcode: string, accumulative = false): BinaryOp<RawTen
             if (!brc_result_shape.broadcastable(dest.shape))
                 throw new Error(`Cant perform broadcasting because result shape [${brc_result_shape}] is incompatible with shape of destination [${dest.shape}].`);
 
-            core_fn_brc(src_a.ptr, src_b.ptr, dest.ptr);
+            call_binary(core_fn_brc, name_brc, src_a, src_b, dest);
         }
 
         // case: debroadcasting
@@ -261,7 +335,7 @@ function create_binary_op(opcode: string, accumulative = false): BinaryOp<RawTen
             if (!brc_result_shape.broadcastable(dest.shape))
                 throw new Error(`Cant perform debroadcasting because result shape [${brc_result_shape}] is incompatible with shape of destination [${dest.shape}].`);
 
-            core_fn_dbrc(src_a.ptr, src_b.ptr, dest.ptr);
+            call_binary(core_fn_dbrc, name_dbrc, src_a, src_b, dest);
         }
 
         // deallocate temporary scalar tensor
@@ -273,9 +347,12 @@ function create_binary_op(opcode: string, accumulative = false): BinaryOp<RawTen
 
 function create_unary_op(opcode: string, accumulative = false): UnaryOp {
     const postfix = accumulative ? "_acc" : "";
-    const core_fn_prw: CoreUnaryOp = core[`_${opcode}_prw${postfix}`];   // pairwise
-    const core_fn_brc: CoreUnaryOp = core[`_${opcode}_brc${postfix}`];   // broadcasting
-    const core_fn_dbrc: CoreUnaryOp = core[`_${opcode}_dbrc${postfix}`]; // debroadcasting
+    const name_prw = `${opcode}_prw${postfix}`;
+    const name_brc = `${opcode}_brc${postfix}`;
+    const name_dbrc = `${opcode}_dbrc${postfix}`;
+    const core_fn_prw: CoreUnaryOp = core[`_${name_prw}`];   // pairwise
+    const core_fn_brc: CoreUnaryOp = core[`_${name_brc}`];   // broadcasting
+    const core_fn_dbrc: CoreUnaryOp = core[`_${name_dbrc}`]; // debroadcasting
 
     return (src: RawTensor, _dest?: RawTensor, param?: number) => {
         if (_dest && !src.shape.broadcastable(_dest.shape))
@@ -285,7 +362,7 @@ function create_unary_op(opcode: string, accumulative = false): UnaryOp {
 
         // pairwise
         if (src.nelem === dest.nelem) {
-            core_fn_prw(src.ptr, dest.ptr, param);
+            call_unary(core_fn_prw, name_prw, src, dest, param);
             return dest;
         }
 
@@ -293,24 +370,95 @@ function create_unary_op(opcode: string, accumulative = false): UnaryOp {
         if (src.ptr === dest.ptr)
             throw new Error("Could not perform in-place operation in this case.");
 
-        if (src.nelem < dest.nelem) core_fn_brc(src.ptr, dest.ptr);       // broadcasting
-        else if (src.nelem > dest.nelem) core_fn_dbrc(src.ptr, dest.ptr); // debroadcasting
+        if (src.nelem < dest.nelem) call_unary(core_fn_brc, name_brc, src, dest, param);         // broadcasting
+        else if (src.nelem > dest.nelem) call_unary(core_fn_dbrc, name_dbrc, src, dest, param); // debroadcasting
     
         return dest;
     };
 }
 
-function create_reduce_op(core_fn: CoreUnaryOp) {
+function create_backward_op(opcode: string, accumulative = false): BackwardOp {
+    const name = `${opcode}${accumulative ? "_acc" : ""}`;
+    const core_fn: CoreBackwardOp = core[`_${name}`];
+
+    return (src: RawTensor, grad: RawTensor, dest: RawTensor, param?: number): RawTensor => {
+        if (src.nelem !== dest.nelem || grad.nelem !== dest.nelem)
+            throw new Error(`Cannot perform backward pass. Source [${src.shape}], gradient [${grad.shape}] and destination [${dest.shape}] need the same number of elements.`);
+
+        if (recorder) recorder.emit({ kind: INSTR.BACKWARD, op: name, a: src, b: grad, dest, param });
+        else core_fn(src.ptr, grad.ptr, dest.ptr, param);
+
+        return dest;
+    };
+}
+
+function create_backward_binary_op(opcode: string, accumulative = false): BackwardBinaryOp {
+    const name = `${opcode}${accumulative ? "_acc" : ""}`;
+    const core_fn: CoreBackwardBinaryOp = core[`_${name}`];
+
+    return (src_a: RawTensor, src_b: RawTensor, grad: RawTensor, dest: RawTensor): RawTensor => {
+        if (!src_a.shape.broadcast(src_b.shape).equals(grad.shape) || !dest.shape.broadcastable(grad.shape) || !dest.shape.broadcast(grad.shape).equals(grad.shape))
+            throw new Error(`Cannot perform backward pass. Sources [${src_a.shape}] and [${src_b.shape}] need to broadcast to the gradient [${grad.shape}], which needs to debroadcast to the destination [${dest.shape}].`);
+
+        if (recorder) recorder.emit({ kind: INSTR.BACKWARD_BINARY, op: name, a: src_a, b: src_b, c: grad, dest });
+        else core_fn(src_a.ptr, src_b.ptr, grad.ptr, dest.ptr);
+
+        return dest;
+    };
+}
+
+function create_reduce_op(name: string) {
+    const core_fn: CoreUnaryOp = core[`_${name}`];
+
     return (src: RawTensor, dest?: RawTensor) => {
         if (dest && !dest.shape.is_scalar)
             throw new Error(`Cannot perform reduce operation. Provided destination tensor is not scalar. Destination shape: [${dest.shape}]`);
 
         const result: RawTensor = dest || RawTensor.scalar();
-        core_fn(src.ptr, result.ptr);
+
+        if (recorder) recorder.emit({ kind: INSTR.COPY, op: name, a: src, dest: result });
+        else core_fn(src.ptr, result.ptr);
+
         return result;
     };
 }
 
+function create_scalar_op(name: string, core_fn: (src_ptr: number) => number) {
+    return (src: RawTensor): number => {
+        not_recordable(name);
+        return core_fn(src.ptr);
+    };
+}
+
+function create_shift_op(name: "min_red_idx" | "max_red_idx") {
+    const core_fn: (src_ptr: number) => number = core[`_${name}`];
+
+    return (src: RawTensor, view: RawTensor, other_view?: RawTensor) => {
+        if (!view.isview || (other_view && !other_view.isview))
+            throw new Error("Only views can be shifted.");
+
+        if (recorder) {
+            recorder.emit({ kind: INSTR.SHIFT, op: name, a: src, b: other_view, dest: view });
+            return;
+        }
+
+        const linear_index = core_fn(src.ptr);
+        core._shift_view(view.ptr, linear_index);
+        if (other_view) core._shift_view(other_view.ptr, linear_index);
+    };
+}
+
+// calls a kernel, or appends it to the program that is being recorded
+function call_unary(core_fn: CoreUnaryOp, name: string, src: RawTensor, dest: RawTensor, param?: number) {
+    if (recorder) recorder.emit({ kind: INSTR.UNARY, op: name, a: src, dest, param });
+    else core_fn(src.ptr, dest.ptr, param);
+}
+
+function call_binary(core_fn: CoreBinaryOp, name: string, a: RawTensor, b: RawTensor, dest: RawTensor) {
+    if (recorder) recorder.emit({ kind: INSTR.BINARY, op: name, a, b, dest });
+    else core_fn(a.ptr, b.ptr, dest.ptr);
+}
+
 function validate_permutation(permutation: number[], rank: number): void {
     if (permutation.length !== rank)
         throw new Error(`The provided permutation [${permutation}] does not match the rank of the tensor (rank = ${rank}).`);
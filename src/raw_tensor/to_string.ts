@@ -34,7 +34,9 @@ function vec_to_string(vec: RawTensor, n_decimals: number) {
         return `[ ${((exp < 4 - n_decimals || exp > 21) && n_decimals !== 0) ? vec.item.toExponential(n_decimals) : vec.item.toFixed(n_decimals)} ]`;
     }
  
-    const n_integer = Math.floor(Math.max(...vec.data)).toString().length;
+    // decoded once, data is a copy for half precision tensors
+    const data = vec.data;
+    const n_integer = Math.floor(Math.max(...data)).toString().length;
     const cols = vec.cols;
     const col_stride = vec.strides[0];
     const offset = vec.offset;
@@ -42,7 +44,7 @@ function vec_to_string(vec: RawTensor, n_decimals: number) {
 
     for (let c = 0; c < cols; c++) {
         const index = offset + c * col_stride;
-        const val = vec.data[index];
+        const val = data[index];
         const val_floor = Math.floor(val);
         const str = val === val_floor ? val.toString() : val.toFixed(n_decimals);
         const padding_amount = Math.max(n_integer - val_floor.toString().length, 0);
@@ -55,7 +57,8 @@ function vec_to_string(vec: RawTensor, n_decimals: number) {
 
 function mat_to_string(mat: RawTensor, n_decimals: number, space_before: number) {
     // amount of digits in the integer part of the largest number
-    const n_integer = Math.floor(Math.max(...mat.data)).toString().length;
+    const data = mat.data;
+    const n_integer = Math.floor(Math.max(...data)).toString().length;
     const lines: string[] = [];
     const cols = mat.cols;
     const rows = mat.rows;
@@ -65,23 +68,24 @@ function mat_to_string(mat: RawTensor, n_decimals: number, space_before: number)
     const exp = Math.pow(10, n_decimals);
 
     const m = mat.clone();
+    const m_data = m.data;
     let only_integers = true;
-    for (let i = 0; i < m.data.length; i++) {
-        if (m.data[i] !== Math.floor(m.data[i])) {
+    for (let i = 0; i < m_data.length; i++) {
+        if (m_data[i] !== Math.floor(m_data[i])) {
             only_integers = false;
             break;
         }
     }
 
     const max_length = n_integer + 1 + (only_integers ? 0 : n_decimals);
-    const has_negative_vals = Math.min(...mat.data) < 0;
+    const has_negative_vals = Math.min(...data) < 0;
 
     for (let r = 0; r < rows; r++) {
         const vals: string[] = [];
 
         for (let c = 0; c < cols; c++) {
             const index = offset + r * row_stride + c * col_stride;
-            const val = Math.floor(mat.data[index] * exp) / exp;
+            const val = Math.floor(data[index] * exp) / exp;
             const str = (val >= 0 && has_negative_vals ? " " : "") + val.toString();
             const separator = c < cols - 1 ? ", " : "";
             const padding_right = " ".repeat(Math.max(0, max_length - str.length));
@@ -114,6 +118,7 @@ export function tensor_info_to_string(a: RawTensor) {
         `  ndata:   ${a.ndata}\n` +
         `  size:    ${a.size} bytes\n` +
         `  offset:  ${a.offset}\n` +
+        `  dtype:   ${a.dtype}\n` +
         `  data:    [${data.join(", ")}${a.data.length > max_entries ? ", ..." : ""}]\n`);
 }
 
@@ -1,4 +1,4 @@
-import core from "../core/build";
+import core, { native } from "../core/core.ts";
 
 /**
  * "Memory location agnostic array."
@@ -17,7 +17,8 @@ export default class UnifiedArray extends Int32Array {
             if (!(data instanceof Int32Array))
                 throw new Error("Data of attached UnifiedArray is expected to be of type Int32Array.");
 
-            super(core.memory.buffer, data.byteOffset, data.length);
+            // native memory has no single buffer, data already views the allocation
+            super(native ? data.buffer : core.memory.buffer, data.byteOffset, data.length);
         } else {
             // create a detached buffer (not in wasm memory)
             super(data.length);
@@ -2,6 +2,8 @@ import { RawTensor } from "./raw_tensor/raw_tensor.ts";
 import { tensor_scalar } from "./tensor_factory.ts";
 import * as graph_ops from "./autograd/node_operations.ts";
 import Graph from "./autograd/graph.ts";
+import { Subgraph } from "./autograd/subgraph.ts";
+import { is_grad_enabled } from "./autograd/grad_mode.ts";
 
 // NodeOption = any additional option/parameter that can be passed into a node
 // (e.g. negative slope of leaky relu)
@@ -15,21 +17,42 @@ export default abstract class Tensor {
     // state of the node
     abstract value: RawTensor;
     grad?: RawTensor = undefined;
+    requires_grad: boolean;
 
     // metadata
     readonly parents: Tensor[];
     readonly children: Tensor[];
 
     private cached_graph: Graph | undefined;
+    private cached_subgraph: Subgraph | undefined;
     name?: string;
 
+    // options the operation was created with (e.g. the permutation of a transpose)
+    options: NodeOption[] = [];
+
+    // the version changes whenever the value changes. versions are unique across all nodes,
+    // so a node can tell whether its parents changed since it was computed (see Graph.forward()).
+    private static version_counter: number = 0;
+    version: number = ++Tensor.version_counter;
+    private computed_from?: number[];
+
+    // nodes whose value changes in every forward pass, even if their parents didn't (e.g. sources).
+    // intermediates that share a buffer with other intermediates (memory plans) are volatile as well.
+    volatile = false;
+
     protected constructor(parents: Tensor[]) {
         this.parents = parents;
         this.children = [];
+        this.requires_grad = this.parents_require_grad();
 
         // value is initialized in extending classes
     }
 
+    // a node only requires a gradient if it can reach a parameter through its parents
+    protected parents_require_grad(): boolean {
+        return is_grad_enabled() && this.parents.some(parent => parent.requires_grad);
+    }
+
     get rank()  { return this.value.rank; }
     get nelem() { return this.value.nelem; }
     get size()  { return this.value.size; }
@@ -42,6 +65,63 @@ export default abstract class Tensor {
     fw() {} // forward
     bw() {} // backward
 
+    /**
+     * Marks the value as changed, so that the nodes that depend on it are recomputed by the next
+     * forward pass. Changes through the initializers of this class and optimizers are tracked,
+     * direct writes to the value (e.g. value.data.set()) need to be followed by touch().
+     */
+    touch() {
+        this.version = ++Tensor.version_counter;
+    }
+
+    // true if the value is outdated, i.e. a parent changed since the last forward pass
+    get stale(): boolean {
+        if (this.volatile) return true;
+        if (this.parents.length === 0) return false;
+        if (!this.computed_from) return true;
+        return this.parents.some((parent, i) => parent.version !== this.computed_from![i]);
+    }
+
+    // called after forward passes
+    mark_computed() {
+        this.computed_from = this.parents.map(parent => parent.version);
+        this.touch();
+    }
+
+    // forward pass that recomputes a discarded value (gradient checkpointing).
+    // nodes that are not deterministic (e.g. dropout) need to reproduce the previous result.
+    recompute() { this.fw(); }
+
+    // passes that are recorded into the programs of a compiled graph (see Graph.compile()).
+    // by default, the operations performed by fw(), recompute() and bw() are recorded.
+    // nodes that run js code or change state between runs (e.g. dropout seeds) override these.
+    compile_fw() { this.fw(); }
+    compile_recompute() { this.recompute(); }
+    compile_bw() { this.bw(); }
+
+    // estimated number of floating point operations of a forward pass
+    get flops(): number { return this.parents.length === 0 ? 0 : this.value.nelem; }
+
+    // recreates views that were derived from the buffers of the parents.
+    // needs to be called whenever a parent's value or grad is replaced (e.g. by the memory planner)
+    bind_views() {}
+
+    // frees everything that is only needed for backpropagation
+    // extending classes that allocate additional buffers for backprop (interims) need to free them as well
+    release_grad() {
+        if (!this.requires_grad) return;
+        if (this.grad && !this.grad.isview) this.grad.free();
+        this.grad = undefined;
+        this.requires_grad = false;
+    }
+
+    // frees all buffers of a node that was removed from its graph (see autograd/passes.ts)
+    // extending classes that allocate additional buffers or views need to free them as well
+    dispose() {
+        this.release_grad();
+        this.value.free();
+    }
+
     private chain_op<T extends any[]>(operation: (...params: T) => void): (...params: T) => Tensor {
         return (...params: T): Tensor => {
             operation.apply(this, params);
@@ -49,17 +129,25 @@ export default abstract class Tensor {
         };
     }
 
+    // operations that write to the value
+    private init_op<T extends any[]>(operation: (...params: T) => void): (...params: T) => Tensor {
+        return this.chain_op((...params: T) => {
+            operation(...params);
+            this.touch();
+        });
+    }
+
     // initialization stuff
-    uniform         = this.chain_op((min = -1, max = 1, seed?: number) => this.value.rand(min, max, seed));
-    normal          = this.chain_op((mean = 0, std_dev = 1, seed?: number) => this.value.normal(mean, std_dev, seed));
-    kaiming_uniform = this.chain_op((n_in: number, seed?: number) => this.value.kaiming_uniform(n_in, seed));
-    kaiming_normal  = this.chain_op((n_in: number, seed?: number) => this.value.kaiming_normal(n_in, seed));
-    xavier_uniform  = this.chain_op((n_in: number, n_out: number, seed?: number) => this.value.xavier_uniform(n_in, n_out, seed));
-    xavier_normal   = this.chain_op((n_in: number, n_out: number, seed?: number) => this.value.xavier_uniform(n_in, n_out, seed));
-    fill            = this.chain_op((value: number) => this.value.fill(value));
+    uniform         = this.init_op((min = -1, max = 1, seed?: number) => this.value.rand(min, max, seed));
+    normal          = this.init_op((mean = 0, std_dev = 1, seed?: number) => this.value.normal(mean, std_dev, seed));
+    kaiming_uniform = this.init_op((n_in: number, seed?: number) => this.value.kaiming_uniform(n_in, seed));
+    kaiming_normal  = this.init_op((n_in: number, seed?: number) => this.value.kaiming_normal(n_in, seed));
+    xavier_uniform  = this.init_op((n_in: number, n_out: number, seed?: number) => this.value.xavier_uniform(n_in, n_out, seed));
+    xavier_normal   = this.init_op((n_in: number, n_out: number, seed?: number) => this.value.xavier_uniform(n_in, n_out, seed));
+    fill            = this.init_op((value: number) => this.value.fill(value));
     set_name        = this.chain_op((name: string) => this.name = name);
     zero_grad       = this.chain_op(() => this.grad?.zeros());
-    realize         = this.chain_op(() => this.graph.forward());
+    realize         = this.chain_op(() => (this.cached_subgraph ??= new Subgraph([this])).forward());
     zeros           = () => this.fill(0);
     ones            = () => this.fill(1);
 
@@ -113,23 +201,26 @@ export default abstract class Tensor {
 
     // Find all nodes that are directly or transitively connected to this node using DFS
     // i.e. find the set of all nodes in this graph
-    private get_graph_nodes(node_set = new Set<Tensor>()) {
-        if (node_set.has(this)) {
+    // nodes that are shared by several paths are visited once, only nodes on the current path form a cycle
+    private get_graph_nodes(node_set = new Set<Tensor>(), path = new Set<Tensor>()) {
+        if (path.has(this)) {
             // cycle detected
             throw new Error("Detected a cycle in the graph. Computation graphs must be acyclic.");
-            return node_set;
         }
+        if (node_set.has(this)) return node_set;
 
         node_set.add(this);
+        path.add(this);
 
         // note: if you wanted a complete graph that includes all paths
         //       to all outputs, then you could use [...this.parents, ...this.children]
         for (const neighbor of this.parents) {
             if (neighbor !== this) {
-                neighbor.get_graph_nodes(node_set);
+                neighbor.get_graph_nodes(node_set, path);
             }
         }
 
+        path.delete(this);
         return node_set;
     }
 
@@ -160,6 +251,7 @@ export default abstract class Tensor {
             const other: Tensor = _other instanceof Tensor ? _other : tensor_scalar(_other, requires_grad);
             const parents: Tensor[] = [this, other];
             const new_node: Tensor = new op_class(parents, ...params);
+            new_node.options = params;
 
             // Register the new node as a child of its parents. This is necessary because
             // we will need access to each node's children during graph acquisition.
@@ -176,6 +268,7 @@ export default abstract class Tensor {
             // If _other is a scalar, create a tensor that holds the scalar value such that it can be referenced in the graph
             const parents: Tensor[] = [this];
             const new_node: Tensor = new op_class(parents, ...params);
+            new_node.options = params;
 
             // Register the new node as a child of its parents. This is necessary because
             // we will need access to each node's children during graph acquisition.
@@ -187,9 +280,8 @@ export default abstract class Tensor {
 }
 
 /**
- * todo:
- *   requires_grad in its current form wont work properly..
- *   even if requires_grad=true, we will still need to compute the grads for all
- *   nodes, but we don't need to store them. this is a bit difficult to realize
- *   in the current setup...
+ * requires_grad:
+ *   Parameters require grads (unless they were created with gradients disabled).
+ *   Every other node requires a grad iff one of its parents does. Nodes that can't
+ *   reach a parameter never allocate grads or interims and are skipped in Graph.backward().
  */
@@ -2,6 +2,7 @@ import { Constant, Parameter, Source } from "./autograd/node_operations.ts";
 import { RawTensor } from "./raw_tensor/raw_tensor.ts";
 import Shape from "./raw_tensor/shape.ts";
 import {NDArray, flatten} from "./raw_tensor/util.ts";
+import * as ops from "./raw_tensor/raw_tensor_operations.ts";
 import Tensor from "./tensor.ts";
 
 /**
@@ -10,20 +11,53 @@ import Tensor from "./tensor.ts";
  * The created node has no parents, and has NOP operations as forward and backward functions,
  * meaning that it will never alter the state of the model.
  *
+ * Samples are written into the existing value of the node, so producing a sample does not
+ * allocate any memory in the core.
+ *
  * @param shape Shape of the tensors this source node will produce
- * @param producer Function that returns a tensor each time it is called.
- *  These tensors should have the same shape as specified by the shape parameter.
+ * @param producer Function that is called with the value of the source node each time a new sample
+ *  is needed. It can either write the sample into that tensor directly and return nothing, or return
+ *  a Tensor, RawTensor, array or number that is copied into it.
+ *  Returned tensors should have the same shape as specified by the shape parameter.
+ * @param batch_size Number of samples per forward pass. The value of the node then has the shape
+ *  [batch_size, ...shape] and the producer is called once per sample, with a view of the sample
+ *  in the batch and the index of the sample.
  */
-export function tensor_producer(shape: Shape | number[], producer: () => (NDArray | RawTensor | Tensor | number)): Source {
-    // todo: fix, this is not memory safe because we allocate memory
-    return new Source(shape, () => {
-        const item = producer();
-        if (item instanceof Array) return RawTensor.from_array(item);
-        if (item instanceof RawTensor) return item;
-        if (item instanceof Tensor) return item.value;
-
-        throw new Error("Producer returned an element that is not Tensor, RawTensor or Array.");
-    });
+export function tensor_producer(
+    shape: Shape | number[],
+    producer: (dest: RawTensor, index: number) => (NDArray | RawTensor | Tensor | number | void),
+    batch_size?: number,
+): Source {
+    return new Source(shape, (dest: RawTensor, index: number) => {
+        const item = producer(dest, index);
+
+        // sample has been written into dest by the producer
+        if (item === undefined || item === dest) return;
+
+        if (typeof item === "number") {
+            dest.fill(item);
+            return;
+        }
+
+        if (item instanceof Array) {
+            const [, data] = flatten(item);
+            if (data.length !== dest.nelem)
+                throw new Error(`Producer returned an array of size ${data.length}, expected ${dest.nelem} elements.`);
+
+            dest.data.set(data, dest.offset);
+            return;
+        }
+
+        const src = item instanceof Tensor ? item.value : item;
+        if (!(src instanceof RawTensor))
+            throw new Error("Producer returned an element that is not Tensor, RawTensor, Array or number.");
+
+        if (src.rank !== dest.rank || [...src.shape].some((size, i) => size !== dest.shape[i]))
+            throw new Error(`Producer returned a tensor of shape [${src.shape}], expected [${dest.shape}].`);
+
+        // unlike clone, convert keeps dest a view of the batch
+        ops.convert(src, dest);
+    }, batch_size);
 }
 
 // export function tensor_scalar(): Parameter;
@@ -0,0 +1,95 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready, set_num_threads } from "../src/raw_tensor/management.ts";
+import { INSTR, Recorder } from "../src/raw_tensor/program.ts";
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+import Tensor from "../src/tensor.ts";
+
+describe("compiled graphs", async () => {
+    await core_ready;
+
+    test("recording", () => {
+        const a = RawTensor.create([2, 2], [1, 2, 3, 4]);
+        const b = RawTensor.create([2], [1, 1]);
+        const c = RawTensor.create([2, 2]);
+        const recorder = new Recorder();
+
+        recorder.record(() => {
+            ops.add(a, b, c);
+            ops.mul(c, 2, c);
+        });
+
+        // nothing is executed while recording
+        expect([...c.data]).toEqual([0, 0, 0, 0]);
+        expect(recorder.steps.length).toBe(2);
+        expect(recorder.steps[0]).toMatchObject({ kind: INSTR.BINARY, op: "add_brc", a, b, dest: c });
+
+        // the temporary scalar of mul() is kept alive for the program
+        expect(recorder.retained.length).toBe(1);
+
+        // results that are read in js fall back to a callback
+        recorder.record(() => c.fill(ops.sum(a)));
+        expect(recorder.steps.length).toBe(3);
+        expect(typeof recorder.steps[2]).toBe("function");
+    });
+
+    test("training matches the graph", () => {
+        const width = 8;
+
+        function create_model(seed: number) {
+            const weights = tensor([width, width], true).uniform(-1, 1, seed);
+            const bias = tensor([width, 1], true).uniform(-1, 1, seed + 1);
+            const input = tensor_producer([width, 1], (dest) => dest.uniform(0, 1, 42));
+            const target = tensor([width, 1]).uniform(0, 1, 43);
+            const loss: Tensor = weights.matmul(input).add(bias).leaky_relu(.1).mse_loss(target);
+            const graph = loss.graph;
+            return { graph, optimizer: new sgd(graph, { lr: .1 }) };
+        }
+
+        const eager = create_model(1);
+        const compiled = create_model(1);
+        const program = compiled.graph.compile(compiled.optimizer);
+
+        for (let i = 0; i < 10; i++) {
+            eager.graph.zero_grad();
+            eager.graph.forward();
+            eager.graph.backward();
+            eager.optimizer.step();
+
+            program.train_step();
+        }
+
+        // the producer of the source is the only part that needs js
+        expect(program.train_program.nsegments).toBe(3);
+        expect(compiled.graph.output.item).toBeCloseTo(eager.graph.output.item);
+        compiled.graph.parameters.forEach((parameter, i) => {
+            [...parameter.value.data].forEach((v, j) => expect(v).toBeCloseTo(eager.graph.parameters[i].value.data[j]));
+        });
+
+        program.free();
+    });
+
+    test("independent branches", () => {
+        const a = tensor([16, 16], true).uniform(-1, 1, 1);
+        const b = tensor([16, 16], true).uniform(-1, 1, 2);
+        const target = tensor([16, 16]).uniform(0, 1, 3);
+        const loss: Tensor = a.tanh().matmul(a).add(b.logistic().matmul(b)).mse_loss(target);
+        const program = loss.graph.compile();
+
+        // the two branches don't depend on each other
+        expect(program.forward_program.parallelism).toBeGreaterThan(1.2);
+
+        loss.graph.forward();
+        const expected = loss.item;
+        loss.value.zeros();
+
+        set_num_threads(4);
+        program.forward();
+        set_num_threads(1);
+
+        expect(loss.item).toBe(expected);
+        program.free();
+    });
+});
@@ -0,0 +1,30 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { DataLoader } from "../src/data/loader.ts";
+
+describe("data loader", async () => {
+    await core_ready;
+
+    const module = new URL("./data_loader_batches.ts", import.meta.url);
+
+    test("sources take the batches in order", async () => {
+        const loader = await DataLoader.create(module, [2, 3], 4, { workers: 3, depth: 2 });
+        const source = loader.source();
+        const ptr = source.value.ptr;
+
+        expect([...source.value.shape]).toEqual([4, 2, 3]);
+
+        for (let i = 0; i < 10; i++) {
+            source.fw();
+            expect(source.value.ptr).toBe(ptr);
+            [...source.value.data].forEach((v, j) => expect(v).toBe(i * 1000 + j));
+        }
+
+        loader.terminate();
+    });
+
+    test("failing producers", async () => {
+        await expect(DataLoader.create(new URL("./missing_module.ts", import.meta.url), [1], 1)).rejects.toThrow();
+        await expect(DataLoader.create(module, [1], 1, { depth: 0 })).rejects.toThrow();
+    });
+});
@@ -0,0 +1,12 @@
+import type { LoaderInfo } from "../src/data/loader.ts";
+
+// producer for the data loader tests: element j of batch i is i * 1000 + j.
+// the producers take a while, so that the loader has to wait for them.
+export default function create_producer({ rank, workers }: LoaderInfo) {
+    return async (batch: Float32Array, index: number) => {
+        if (index % workers !== rank) throw new Error(`Batch ${index} was sent to the wrong worker.`);
+
+        await new Promise(resolve => setTimeout(resolve, 1));
+        for (let j = 0; j < batch.length; j++) batch[j] = index * 1000 + j;
+    };
+}
@@ -0,0 +1,52 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { DataParallel, shard_range } from "../src/parallel/data_parallel.ts";
+import create_replica from "./data_parallel_model.ts";
+import { native } from "../src/core/core.ts";
+
+// replicas need a core of their own, see DataParallel.create()
+describe.skipIf(native)("data parallel training", async () => {
+    await core_ready;
+
+    test("shards", () => {
+        expect(shard_range(10, 0, 3)).toEqual([0, 3]);
+        expect(shard_range(10, 1, 3)).toEqual([3, 6]);
+        expect(shard_range(10, 2, 3)).toEqual([6, 10]);
+    });
+
+    test("matches training on the whole mini-batch", async () => {
+        const steps = 5;
+        // the shards have different sizes (2 and 3 samples)
+        const trainer = await DataParallel.create(new URL("./data_parallel_model.ts", import.meta.url), { workers: 2, batch_size: 5 });
+        const loss = await trainer.train(steps);
+        const parameters = await trainer.parameters();
+        trainer.terminate();
+
+        const { graph, optimizer } = create_replica({ rank: 0, world_size: 1, start: 0, end: 5 });
+        let expected_loss = 0;
+
+        for (let i = 0; i < steps; i++) {
+            graph.zero_grad();
+            graph.forward();
+            expected_loss = graph.output.value.item;
+            graph.backward();
+            optimizer.step();
+        }
+
+        expect(loss).toBeCloseTo(expected_loss, 5);
+
+        graph.parameters.forEach((parameter, i) => {
+            [...parameter.value.data].forEach((v, j) => expect(parameters[i][j]).toBeCloseTo(v, 5));
+        });
+    });
+
+    test("a failing replica terminates the trainer", async () => {
+        const trainer = await DataParallel.create(new URL("./data_parallel_failing_model.ts", import.meta.url), { workers: 3 });
+
+        await expect(trainer.train()).rejects.toThrow("Worker 1: forward pass failed");
+
+        // the other replicas were blocked in the all-reduce, later calls fail instead of hanging
+        await expect(trainer.train()).rejects.toThrow("terminated");
+        await expect(trainer.parameters()).rejects.toThrow("terminated");
+    });
+});
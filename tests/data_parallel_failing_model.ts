@@ -0,0 +1,9 @@
+import type { Shard } from "../src/parallel/data_parallel.ts";
+import create_replica from "./data_parallel_model.ts";
+
+// replica whose forward pass fails in the worker of rank 1, the other replicas wait for it in the all-reduce
+export default function create_failing_replica(shard: Shard) {
+    const replica = create_replica(shard);
+    if (shard.rank === 1) replica.graph.forward = () => { throw new Error("forward pass failed"); };
+    return replica;
+}
@@ -0,0 +1,22 @@
+import type { Shard } from "../src/parallel/data_parallel.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+
+// replica of a linear regression model for the data parallel tests. every shard is a
+// [features, samples] matrix with the samples [start, end) of a fixed mini-batch.
+export default function create_replica({ start, end }: Shard) {
+    const features = 4, outputs = 3, samples = end - start;
+
+    const weights = tensor([outputs, features], true).uniform(-1, 1, 7);
+    const input = tensor_producer([features, samples], (dest) => {
+        for (let f = 0; f < features; f++)
+            for (let s = 0; s < samples; s++) dest.data[f * samples + s] = Math.sin((start + s) * features + f);
+    });
+    const target = tensor_producer([outputs, samples], (dest) => {
+        for (let o = 0; o < outputs; o++)
+            for (let s = 0; s < samples; s++) dest.data[o * samples + s] = Math.cos((start + s) * outputs + o);
+    });
+
+    const graph = weights.matmul(input).mse_loss(target).graph;
+    return { graph, optimizer: new sgd(graph, { lr: .5 }) };
+}
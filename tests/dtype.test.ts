@@ -0,0 +1,54 @@
+import { describe, expect, test } from "bun:test";
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { half_to_float32 } from "../src/raw_tensor/dtype.ts";
+
+describe("half precision", async () => {
+    await core_ready;
+
+    test("decoding", () => {
+        // 1, -2, 65504 (max), smallest subnormal, inf
+        const fp16 = half_to_float32(new Uint16Array([0x3c00, 0xc000, 0x7bff, 0x0001, 0x7c00]), "fp16");
+        expect([...fp16]).toEqual([1, -2, 65504, 2 ** -24, Infinity]);
+
+        const bf16 = half_to_float32(new Uint16Array([0x3f80, 0xc040, 0x4049]), "bf16");
+        expect([...bf16]).toEqual([1, -3, 3.140625]);
+    });
+
+    test("storage and fp32 compute", () => {
+        for (const dtype of ["fp16", "bf16"] as const) {
+            const a = RawTensor.create([2, 3], [1, 2, 3, 4, 5, 6], dtype);
+            const b = RawTensor.create([3, 2], [1, 2, 3, 4, 5, 6], dtype);
+
+            expect(a.dtype).toBe(dtype);
+            expect(a.bits.length).toBe(6);
+            expect([...a.data]).toEqual([1, 2, 3, 4, 5, 6]);
+
+            // the data is a decoded copy, writes to it throw instead of being lost
+            expect(() => { a.data[0] = 7; }).toThrow();
+            expect(() => a.data.set([7])).toThrow();
+            expect(() => a.data.subarray(1).fill(7)).toThrow();
+            expect(Math.max(...a.data)).toBe(6);
+            expect(a.data.slice(1, 3)).toEqual(new Float32Array([2, 3]));
+
+            // results of operations on half precision tensors are stored in half precision
+            const c = ops.matmul(a, b);
+            expect(c.dtype).toBe(dtype);
+            expect([...c.data]).toEqual([22, 28, 49, 64]);
+
+            const d = ops.add(a, 0.5);
+            expect([...d.data]).toEqual([1.5, 2.5, 3.5, 4.5, 5.5, 6.5]);
+
+            const e = a.astype("fp32");
+            expect(e.dtype).toBe("fp32");
+            expect([...e.data]).toEqual([1, 2, 3, 4, 5, 6]);
+
+            // values are rounded to the precision of the storage type
+            const f = RawTensor.create([1], [1 + 2 ** -12], dtype);
+            expect(f.item).toBe(1);
+
+            for (const t of [a, b, c, d, e, f]) t.free();
+        }
+    });
+});
@@ -0,0 +1,53 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { no_grad } from "../src/autograd/grad_mode.ts";
+import { tensor } from "../src/tensor_factory.ts";
+
+describe("grad mode", async () => {
+    await core_ready;
+
+    test("requires_grad propagation", () => {
+        const constant = tensor([2], [1, -2]);
+        const weight = tensor([2], [3, 3], true);
+
+        // nodes that can't reach a parameter don't allocate grads
+        const a = constant.relu();
+        expect(constant.requires_grad).toBe(false);
+        expect(a.requires_grad).toBe(false);
+        expect(a.grad).toBeUndefined();
+
+        const b = weight.mul(constant).relu();
+        expect(weight.requires_grad).toBe(true);
+        expect(b.requires_grad).toBe(true);
+        expect(b.grad).toBeDefined();
+    });
+
+    test("no_grad", () => {
+        const constant = tensor([2], [1, -2]);
+        const weight = tensor([2], [3, 3], true);
+        const result = no_grad(() => weight.mul(constant).relu());
+
+        expect(result.requires_grad).toBe(false);
+        expect(result.grad).toBeUndefined();
+        expect(result.parents[0].grad).toBeUndefined();
+
+        // gradients are enabled again afterwards
+        expect(weight.mul(constant).requires_grad).toBe(true);
+    });
+
+    test("graph inference mode", () => {
+        const constant = tensor([2], [1, -2]);
+        const weight = tensor([2], [3, 3], true);
+        const output = weight.mul(constant).relu();
+        const graph = output.graph;
+
+        graph.inference();
+        for (const node of graph.all_nodes) {
+            expect(node.requires_grad).toBe(false);
+            expect(node.grad).toBeUndefined();
+        }
+
+        graph.forward();
+        expect([...output.value.data]).toEqual([3, 0]);
+    });
+});
@@ -0,0 +1,99 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+import Tensor from "../src/tensor.ts";
+
+// counts the forward passes of a node
+function count_fw(node: Tensor): () => number {
+    let count = 0;
+    const fw = node.fw.bind(node);
+    node.fw = () => {
+        count++;
+        fw();
+    };
+
+    return () => count;
+}
+
+describe("incremental recomputation", async () => {
+    await core_ready;
+
+    test("only nodes with changed inputs are recomputed", () => {
+        const weight = tensor([2], [1, 2], true);
+        const constant = tensor([2], [3, 4]);
+        const hidden = weight.mul(constant);
+        const output = hidden.add(constant);
+        const graph = output.graph;
+        const hidden_fw = count_fw(hidden), output_fw = count_fw(output);
+
+        graph.forward();
+        expect([...output.value.data]).toEqual([6, 12]);
+        expect([hidden_fw(), output_fw()]).toEqual([1, 1]);
+
+        // nothing changed
+        graph.forward();
+        expect([hidden_fw(), output_fw()]).toEqual([1, 1]);
+
+        weight.fill(2);
+        graph.forward();
+        expect([...output.value.data]).toEqual([9, 12]);
+        expect([hidden_fw(), output_fw()]).toEqual([2, 2]);
+
+        // direct writes need to be marked
+        weight.value.data.set([1, 1], weight.value.offset);
+        graph.forward();
+        expect(output_fw()).toBe(2);
+
+        weight.touch();
+        graph.forward();
+        expect([...output.value.data]).toEqual([6, 8]);
+        expect(output_fw()).toBe(3);
+
+        graph.forward(true);
+        expect([hidden_fw(), output_fw()]).toEqual([4, 4]);
+    });
+
+    test("partial realization", () => {
+        const weight = tensor([2], [1, 2], true);
+        const hidden = weight.exp();
+        const output = hidden.sum();
+        const hidden_fw = count_fw(hidden), output_fw = count_fw(output);
+
+        output.realize();
+        weight.fill(0);
+
+        // the intermediate is brought up to date on its own, the output only recomputes the rest
+        hidden.realize();
+        expect([...hidden.value.data]).toEqual([1, 1]);
+        expect([hidden_fw(), output_fw()]).toEqual([2, 1]);
+
+        output.realize();
+        expect(output.value.item).toBe(2);
+        expect([hidden_fw(), output_fw()]).toEqual([2, 2]);
+    });
+
+    test("sources and optimizer steps", () => {
+        let index = 0;
+        const input = tensor_producer([2], (dest) => { dest.fill(index++); });
+        const weight = tensor([2], [1, 1], true);
+        const constant = tensor([2], [1, 2]);
+        const loss = weight.mul(constant).sum().mul(input.sum());
+        const graph = loss.graph;
+        const scaled = graph.topological_ordering.find(node => node.parents.includes(weight))!;
+        const scaled_fw = count_fw(scaled);
+
+        // sources produce a new value in every forward pass, the branch of the weight is kept
+        graph.forward();
+        graph.forward();
+        expect(index).toBe(2);
+        expect(loss.value.item).toBe(3 * 2);
+        expect(scaled_fw()).toBe(1);
+
+        graph.zero_grad();
+        graph.backward();
+        new sgd(graph, { lr: .1 }).step();
+        graph.forward();
+        expect(scaled_fw()).toBe(2);
+    });
+});
@@ -0,0 +1,72 @@
+import { describe, expect, test } from "bun:test";
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { core_ready, get_ntensors, get_total_allocated } from "../src/raw_tensor/management.ts";
+import { open_scope, tensor_scope } from "../src/raw_tensor/lifetime.ts";
+
+describe("tensor lifetimes", async () => {
+    await core_ready;
+
+    const a = RawTensor.create([2, 3], [1, 2, 3, 4, 5, 6]);
+    const b = RawTensor.create([3, 2], [1, 2, 3, 4, 5, 6]);
+
+    test("tensor scopes free temporaries", () => {
+        const ntensors = get_ntensors();
+        const allocated = get_total_allocated();
+
+        for (let i = 0; i < 100; i++) {
+            tensor_scope(() => {
+                const c = ops.matmul(a, b);
+                ops.add(c.T, 1);
+                for (const row of a) ops.mul(row, 2);
+            });
+        }
+
+        expect(get_ntensors()).toBe(ntensors);
+        expect(get_total_allocated()).toBe(allocated);
+    });
+
+    test("returned and kept tensors survive", () => {
+        const ntensors = get_ntensors();
+
+        const result = tensor_scope(() => ops.add(ops.matmul(a, b), 1));
+        expect([...result.data]).toEqual([23, 29, 50, 65]);
+
+        const view = tensor_scope((scope) => {
+            const c = ops.mul(a, 2);
+            scope.keep(c.T);
+            return c.T;
+        });
+        expect([...view.shape]).toEqual([3, 2]);
+        expect([...view.source!.data]).toEqual([2, 4, 6, 8, 10, 12]);
+
+        // the second scope keeps both views and the tensor they reference
+        expect(get_ntensors()).toBe(ntensors + 4);
+
+        result.free();
+        view.source!.free();
+        view.free();
+        expect(get_ntensors()).toBe(ntensors + 1);
+    });
+
+    test("explicit resource management", () => {
+        const ntensors = get_ntensors();
+
+        {
+            using _scope = open_scope();
+            ops.add(a, a);
+            expect(get_ntensors()).toBe(ntensors + 1);
+        }
+
+        expect(get_ntensors()).toBe(ntensors);
+    });
+
+    test("freeing twice has no effect", () => {
+        const ntensors = get_ntensors();
+        const c = RawTensor.like(a);
+
+        c.free();
+        c.free();
+        expect(get_ntensors()).toBe(ntensors);
+    });
+});
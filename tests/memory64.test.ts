@@ -0,0 +1,34 @@
+import { describe, expect, test } from "bun:test";
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { memory64 } from "../src/core/core.ts";
+
+// only runs against the memory64 core: make main64 && TALOS_MEMORY64=1 bun test memory64
+describe.skipIf(!memory64)("memory64", async () => {
+    await core_ready;
+
+    const nelem = 2 ** 31 + 8;
+
+    test("tensors with more than 2^31 elements", () => {
+        const a = RawTensor.create([nelem]).zeros();
+        expect(a.nelem).toBe(nelem);
+        expect(a.data.length).toBe(nelem);
+
+        a.data[nelem - 1] = 1;
+        expect(ops.max_idx(a)).toBe(nelem - 1);
+
+        // views with offsets beyond 2^31
+        const b = a.reshape([2, nelem / 2]);
+        expect([...b.strides]).toEqual([nelem / 2, 1]);
+
+        const row = RawTensor.view_of(b, 1, nelem / 2);
+        expect(row.nelem).toBe(nelem / 2);
+        expect(row.offset).toBe(nelem / 2);
+        expect(ops.max_idx(row)).toBe(nelem / 2 - 1);
+
+        row.free();
+        b.free();
+        a.free();
+    }, 60_000);
+});
@@ -0,0 +1,32 @@
+import { describe, expect, test } from "bun:test";
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { core_ready, get_heap_size, memory_generation } from "../src/raw_tensor/management.ts";
+import { native } from "../src/core/core.ts";
+
+// the native core has no linear memory that could grow
+describe.skipIf(native)("memory growth", async () => {
+    await core_ready;
+
+    test("tensors stay valid after memory growth", () => {
+        const a = RawTensor.create([2, 2], [1, 2, 3, 4]);
+        const b = a.T;
+        const generation = memory_generation;
+
+        // allocate more than the current heap to force a growth event
+        const large = RawTensor.create([get_heap_size() / Float32Array.BYTES_PER_ELEMENT]);
+
+        expect(memory_generation).toBeGreaterThan(generation);
+        expect([...a.shape]).toEqual([2, 2]);
+        expect([...a.data]).toEqual([1, 2, 3, 4]);
+        expect([...b.strides]).toEqual([1, 2]);
+
+        const c = ops.add(a, b);
+        expect([...c.data]).toEqual([2, 5, 5, 8]);
+
+        large.free();
+        c.free();
+        b.free();
+        a.free();
+    });
+});
@@ -0,0 +1,123 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { plan_memory } from "../src/autograd/memory_planner.ts";
+import { tensor } from "../src/tensor_factory.ts";
+import Tensor from "../src/tensor.ts";
+
+describe("memory planner", async () => {
+    await core_ready;
+
+    const width = 16;
+    const depth = 8;
+
+    // every layer produces three intermediates of the same size (matmul, add, relu)
+    function create_mlp(): Tensor {
+        let x: Tensor = tensor([width, 1]).uniform();
+
+        for (let i = 0; i < depth; i++) {
+            const weight = tensor([width, width], true).uniform();
+            const bias = tensor([width, 1], true).uniform();
+            x = weight.matmul(x).add(bias).relu();
+        }
+
+        return x;
+    }
+
+    test("forward plan", () => {
+        const plan = plan_memory(create_mlp().graph, "forward");
+
+        // all intermediate values except the output value (relus don't need interims)
+        expect(plan.lifetimes.length).toBe(3 * depth - 1);
+        expect(plan.naive_bytes).toBe((3 * depth - 1) * width * 4);
+
+        // in a chain, only the input and the result of the current node are alive
+        expect(plan.buffers.length).toBe(2);
+        expect(plan.planned_bytes).toBe(2 * width * 4);
+        expect(plan.peak_live_bytes).toBe(2 * width * 4);
+    });
+
+    test("training plan", () => {
+        const plan = plan_memory(create_mlp().graph, "training");
+
+        expect(plan.planned_bytes).toBeLessThan(plan.naive_bytes);
+        expect(plan.planned_bytes).toBeGreaterThanOrEqual(plan.peak_live_bytes);
+
+        // tensors that share a buffer must never be alive at the same time
+        for (const buffer of plan.buffers) {
+            const steps = new Set<number>();
+
+            for (const member of buffer.members) {
+                for (const [start, end] of member.intervals) {
+                    for (let step = start; step <= end; step++) {
+                        expect(steps.has(step)).toBe(false);
+                        steps.add(step);
+                    }
+                }
+            }
+        }
+    });
+
+    // the product in front of floor() requires a grad but never receives one
+    function create_model(seed: number): Tensor {
+        let x: Tensor = tensor([width, 1]).uniform(0, 1, seed);
+
+        for (let i = 0; i < depth; i++) {
+            const weight = tensor([width, width], true).uniform(-1, 1, seed + 2 * i + 1);
+            const bias = tensor([width, 1], true).uniform(-1, 1, seed + 2 * i + 2);
+            x = weight.matmul(x).add(bias).relu();
+        }
+
+        const scale = tensor([width, 1], true).uniform(-1, 1, seed + 2 * depth + 1);
+        return x.add(scale.mul(x).floor()).mse_loss(tensor([width, 1]).uniform(0, 1, seed + 2 * depth + 2));
+    }
+
+    test("applied training plan", () => {
+        const planned = create_model(1).graph;
+        const reference = create_model(1).graph;
+        const plan = planned.plan_memory("training");
+        expect(plan.buffers.some(buffer => buffer.members.length > 1)).toBe(true);
+
+        for (let i = 0; i < 2; i++) {
+            for (const graph of [planned, reference]) {
+                graph.zero_grad();
+                graph.forward();
+                graph.backward();
+            }
+
+            expect(planned.output.value.item).toBeCloseTo(reference.output.value.item, 5);
+            planned.parameters.forEach((parameter, p) => {
+                [...parameter.grad!.data].forEach((v, j) => expect(v).toBeCloseTo(reference.parameters[p].grad!.data[j], 5));
+            });
+        }
+    });
+
+    test("gradient checkpointing", () => {
+        const output = create_mlp().mse_loss(tensor([width, 1]).uniform());
+        const graph = output.graph;
+
+        graph.zero_grad();
+        graph.forward();
+        graph.backward();
+        const expected = graph.parameters.map(parameter => [...parameter.grad.data]);
+        const expected_loss = output.value.item;
+
+        const report = graph.set_checkpoints("sqrt");
+        expect(report.checkpoints).toBeGreaterThan(0);
+        expect(report.memory_saved).toBeGreaterThan(0);
+        expect(report.extra_flops).toBeGreaterThan(0);
+        expect(report.extra_flops).toBeLessThan(report.step_flops);
+
+        // recomputing the discarded values in shared buffers must not change the gradients
+        const plan = plan_memory(graph);
+        plan.apply();
+        expect(plan.buffers.some(buffer => buffer.members.some(member => member.node.volatile))).toBe(true);
+
+        graph.zero_grad();
+        graph.forward();
+        graph.backward();
+        expect(output.value.item).toBeCloseTo(expected_loss, 5);
+        graph.parameters.forEach((parameter, i) => {
+            [...parameter.grad.data].forEach((v, j) => expect(v).toBeCloseTo(expected[i][j], 5));
+        });
+    });
+});
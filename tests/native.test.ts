@@ -0,0 +1,83 @@
+import { describe, expect, test } from "bun:test";
+import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import * as ops from "../src/raw_tensor/raw_tensor_operations.ts";
+import { core_ready, get_ntensors, set_num_threads } from "../src/raw_tensor/management.ts";
+import { tensor } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+import { native } from "../src/core/core.ts";
+
+// only runs against the native core: make native && TALOS_NATIVE=1 bun test native
+describe.skipIf(!native)("native core", async () => {
+    await core_ready;
+
+    test("data, shapes and views are backed by native memory", () => {
+        const a = RawTensor.create([2, 3], [1, 2, 3, 4, 5, 6]);
+        expect([...a.shape]).toEqual([2, 3]);
+        expect([...a.strides]).toEqual([3, 1]);
+
+        // writes from js are seen by the kernels and vice versa
+        a.data[0] = 10;
+        expect(ops.sum(a)).toBe(30);
+        a.fill(1);
+        expect([...a.data]).toEqual([1, 1, 1, 1, 1, 1]);
+
+        const row = RawTensor.view_of(a, 1, 3);
+        row.data[0] = 5;
+        expect(a.data[3]).toBe(5);
+
+        const b = a.reshape([3, 2]);
+        expect([...b.shape]).toEqual([3, 2]);
+        expect([...b.strides]).toEqual([2, 1]);
+
+        b.free();
+        row.free();
+        a.free();
+    });
+
+    test("kernels of every signature", () => {
+        const a = RawTensor.create([2, 2], [1, 2, 3, 4]);
+        const b = RawTensor.create([2, 2], [1, 0, 0, 1]);
+
+        expect([...ops.add(a, b).data]).toEqual([2, 2, 3, 5]);
+        expect([...ops.matmul(a, b).data]).toEqual([1, 2, 3, 4]);
+        expect([...ops.exp(RawTensor.create([1], [0])).data]).toEqual([1]);
+        expect([...ops.leaky_relu(RawTensor.create([2], [-1, 1]), undefined, .5).data]).toEqual([-.5, 1]);
+        expect(ops.max_idx(a)).toBe(3);
+
+        const grad = RawTensor.create([2, 2]).fill(1);
+        const dest = RawTensor.create([2, 2]);
+        ops.bw_relu_acc(RawTensor.create([2, 2], [-1, 1, -1, 1]), grad, dest);
+        expect([...dest.data]).toEqual([0, 1, 0, 1]);
+
+        const dropped = ops.dropout(RawTensor.create([1000]).fill(1), undefined, .5, 1);
+        expect(ops.sum(dropped)).toBeGreaterThan(0);
+        expect(ops.sum(dropped)).toBeLessThan(2000);
+    });
+
+    test("training on several threads", () => {
+        set_num_threads(4);
+
+        const weights = tensor([64, 64], true).uniform(-.1, .1, 1);
+        const input = tensor([64, 64]).uniform(0, 1, 2);
+        const loss = input.matmul(weights).mse_loss(tensor([64, 64]).uniform(0, 1, 3));
+        const optimizer = new sgd(loss.graph, { lr: .1 });
+
+        const losses: number[] = [];
+        for (let i = 0; i < 20; i++) {
+            loss.graph.zero_grad();
+            loss.graph.forward();
+            loss.graph.backward();
+            optimizer.step();
+            losses.push(loss.item);
+        }
+
+        expect(losses[19]).toBeLessThan(losses[0]);
+        set_num_threads(1);
+    });
+
+    test("freed tensors are released", () => {
+        const before = get_ntensors();
+        RawTensor.create([256, 256]).free();
+        expect(get_ntensors()).toBe(before);
+    });
+});
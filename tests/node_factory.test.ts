@@ -1,9 +1,11 @@
 import { describe, expect, test } from "bun:test";
 import { add } from "../src/raw_tensor/raw_tensor_operations.ts";
-import { tensor_producer } from "../src/tensor_factory.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
 import { RawTensor } from "../src/raw_tensor/raw_tensor.ts";
+import { core_ready } from "../src/raw_tensor/management.ts";
 
-describe("node operations", () => {
+describe("node operations", async () => {
+    await core_ready;
 
     test("source nodes", () => {
         const input = RawTensor.scalar(0);
@@ -26,6 +28,64 @@ describe("node operations", () => {
         expect(source.value.item).toBeCloseTo(3);
     });
 
+    test("source nodes write into their value", () => {
+        const source = tensor_producer([2], (dest) => { dest.data.set([1, 2]); });
+        const ptr = source.value.ptr;
+
+        source.fw();
+        expect(source.value.ptr).toBe(ptr);
+        expect([...source.value.data]).toEqual([1, 2]);
+
+        const array_source = tensor_producer([2], () => [3, 4]);
+        const array_ptr = array_source.value.ptr;
+
+        array_source.fw();
+        expect(array_source.value.ptr).toBe(array_ptr);
+        expect([...array_source.value.data]).toEqual([3, 4]);
+        expect(() => tensor_producer([3], () => [1, 2]).fw()).toThrow();
+    });
+
+    test("batched source nodes", () => {
+        const source = tensor_producer([2], (_, i) => [i, 2 * i], 3);
+        const ptr = source.value.ptr;
+
+        source.fw();
+        expect([...source.value.shape]).toEqual([3, 2]);
+        expect(source.value.ptr).toBe(ptr);
+        expect([...source.value.data]).toEqual([0, 0, 1, 2, 2, 4]);
+
+        const raw_source = tensor_producer([2], (sample, i) => { sample.fill(i + 1); }, 2);
+        raw_source.fw();
+        expect([...raw_source.value.data]).toEqual([1, 1, 2, 2]);
+
+        expect(() => tensor_producer([2], () => [1, 2], 0)).toThrow();
+    });
+
+    test("mini-batch gradients are the mean of the per-sample gradients", () => {
+        const samples = [[1, 2], [3, -1], [.5, 4]];
+
+        function gradients(batch: number[][]) {
+            const weight = tensor([2, 3], [.1, -.2, .3, .4, .5, -.6], true);
+            const bias = tensor([3], [.1, .2, .3], true);
+            const target = tensor([3], [1, 0, -1]);
+            const input = tensor_producer([2], (_, i) => batch[i], batch.length);
+            const graph = input.matmul(weight).add(bias).mse_loss(target).graph;
+
+            graph.zero_grad();
+            graph.forward();
+            graph.backward();
+            return [...weight.grad.data, ...bias.grad.data];
+        }
+
+        const batched = gradients(samples);
+        const per_sample = samples.map(sample => gradients([sample]));
+
+        batched.forEach((grad, i) => {
+            const mean = per_sample.reduce((sum, grads) => sum + grads[i], 0) / samples.length;
+            expect(grad).toBeCloseTo(mean);
+        });
+    });
+
     test("parameter nodes", () => {
         // todo: it may be a little too early to write tests for this.
         //       the api needs to be refined further.
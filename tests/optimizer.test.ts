@@ -0,0 +1,137 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready, set_num_threads } from "../src/raw_tensor/management.ts";
+import { tensor } from "../src/tensor_factory.ts";
+import { sgd, adam, adamw, FusedOptimizer } from "../src/optimizer/optimizer.ts";
+import Graph from "../src/autograd/graph.ts";
+
+function create_model(seed: number) {
+    const weights = tensor([16, 8], true).uniform(-1, 1, seed);
+    const bias = tensor([16, 1], true).uniform(-1, 1, seed + 1);
+    const input = tensor([8, 1]).uniform(0, 1, seed + 2);
+    return weights.matmul(input).add(bias).mse_loss(tensor([16, 1]).uniform(0, 1, seed + 3)).graph;
+}
+
+type update = (w: number, g: number, state: number[], t: number) => number;
+
+// reference implementations, per element
+const reference: Record<string, update> = {
+    sgd: (w, g, s) => w - .1 * (s[0] = .9 * (s[0] ?? 0) + g + .01 * w),
+    adam: (w, g, s, t) => {
+        g += .01 * w;
+        s[0] = .9 * (s[0] ?? 0) + .1 * g;
+        s[1] = .999 * (s[1] ?? 0) + .001 * g * g;
+        return w - .01 * (s[0] / (1 - .9 ** t)) / (Math.sqrt(s[1] / (1 - .999 ** t)) + 1e-8);
+    },
+    adamw: (w, g, s, t) => {
+        w -= .01 * .01 * w;
+        s[0] = .9 * (s[0] ?? 0) + .1 * g;
+        s[1] = .999 * (s[1] ?? 0) + .001 * g * g;
+        return w - .01 * (s[0] / (1 - .9 ** t)) / (Math.sqrt(s[1] / (1 - .999 ** t)) + 1e-8);
+    },
+};
+
+const optimizers: Record<string, (graph: Graph) => FusedOptimizer> = {
+    sgd: (graph) => new sgd(graph, { lr: .1, momentum: .9, weight_decay: .01 }),
+    adam: (graph) => new adam(graph, { lr: .01, weight_decay: .01 }),
+    adamw: (graph) => new adamw(graph, { lr: .01 }),
+};
+
+describe("fused optimizers", async () => {
+    await core_ready;
+
+    for (const name of Object.keys(optimizers)) test(`${name} matches the reference`, () => {
+        set_num_threads(4);
+
+        const graph = create_model(1);
+        const optimizer = optimizers[name](graph);
+        const states = graph.parameters.map(param => Array.from({ length: param.value.nelem }, () => [] as number[]));
+
+        for (let t = 1; t <= 5; t++) {
+            graph.zero_grad();
+            graph.forward();
+            graph.backward();
+
+            const expected = graph.parameters.map((param, p) =>
+                [...param.value.data].map((w, i) => reference[name](w, param.grad!.data[i], states[p][i], t)));
+
+            optimizer.step();
+
+            graph.parameters.forEach((param, p) => {
+                [...param.value.data].forEach((w, i) => expect(w).toBeCloseTo(expected[p][i], 4));
+            });
+        }
+
+        // the state of all parameters is a single tensor
+        expect([...optimizer.state!.shape]).toEqual([name === "sgd" ? 1 : 2, 16 * 8 + 16]);
+
+        optimizer.free();
+        set_num_threads(1);
+    });
+
+    test("hyperparameters can be changed between steps", () => {
+        const graph = create_model(2);
+        const optimizer = new sgd(graph, { lr: .1 });
+        graph.forward();
+        graph.backward();
+
+        const before = graph.parameters[0].value.data[0], grad = graph.parameters[0].grad!.data[0];
+        optimizer.lr = 0;
+        optimizer.step();
+        expect(graph.parameters[0].value.data[0]).toBe(before);
+
+        optimizer.lr = .5;
+        optimizer.step();
+        expect(graph.parameters[0].value.data[0]).toBeCloseTo(before - .5 * grad);
+        optimizer.free();
+    });
+
+    test("global norm clipping and gradient scaling", () => {
+        const graph = create_model(4);
+        const optimizer = new sgd(graph, { lr: .1, max_grad_norm: .01, grad_scale: .5 });
+        graph.forward();
+        graph.backward();
+
+        const grads = graph.parameters.flatMap(param => [...param.grad!.data]);
+        const norm = Math.sqrt(grads.reduce((acc, g) => acc + g * g, 0)) * .5;
+        const coef = .5 * Math.min(1, .01 / (norm + 1e-6));
+        const expected = graph.parameters.map(param => [...param.value.data].map((w, i) => w - .1 * coef * param.grad!.data[i]));
+
+        optimizer.step();
+        expect(optimizer.grad_norm).toBeCloseTo(norm, 4);
+        graph.parameters.forEach((param, p) => {
+            [...param.value.data].forEach((w, i) => expect(w).toBeCloseTo(expected[p][i], 5));
+        });
+
+        // steps with overflowing gradients are skipped
+        const before = [...graph.parameters[0].value.data];
+        graph.parameters[0].grad!.data[0] = Infinity;
+        optimizer.step();
+        expect(optimizer.grad_norm).toBe(Infinity);
+        expect([...graph.parameters[0].value.data]).toEqual(before);
+        optimizer.free();
+    });
+
+    test("compiled steps match eager steps", () => {
+        const eager = create_model(3), compiled = create_model(3);
+        const eager_optimizer = new adam(eager, { lr: .01 });
+        const compiled_optimizer = new adam(compiled, { lr: .01 });
+        const program = compiled.compile(compiled_optimizer);
+
+        for (let i = 0; i < 5; i++) {
+            eager.zero_grad();
+            eager.forward();
+            eager.backward();
+            eager_optimizer.step();
+
+            program.train_step();
+        }
+
+        compiled.parameters.forEach((param, p) => {
+            [...param.value.data].forEach((w, i) => expect(w).toBeCloseTo(eager.parameters[p].value.data[i], 5));
+        });
+
+        program.free();
+        eager_optimizer.free();
+        compiled_optimizer.free();
+    });
+});
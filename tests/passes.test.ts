@@ -0,0 +1,63 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { tensor } from "../src/tensor_factory.ts";
+import { Exp, Tanh } from "../src/autograd/node_operations.ts";
+import Tensor from "../src/tensor.ts";
+
+describe("graph optimization passes", async () => {
+    await core_ready;
+
+    // builds the same model twice, optimizes one of them and compares a training step
+    function compare(build: (w: Tensor) => Tensor) {
+        const results = [false, true].map(optimize => {
+            const w = tensor([3], [.5, -1, 2], true);
+            const graph = build(w).graph;
+            const report = optimize ? graph.optimize() : undefined;
+
+            graph.zero_grad();
+            graph.forward();
+            graph.backward();
+            return { graph, report, value: graph.output.item, grad: [...w.grad!.data] };
+        });
+
+        expect(results[1].value).toBeCloseTo(results[0].value);
+        results[1].grad.forEach((g, i) => expect(g).toBeCloseTo(results[0].grad[i]));
+        return results[1];
+    }
+
+    test("constant folding", () => {
+        const { graph, report } = compare((w) => {
+            const c = tensor([3], [1, 2, 3]);
+            return w.mul(c.exp().add(c)).sum();
+        });
+
+        expect(report!.folded).toBe(2);
+        expect(graph.all_nodes.some(node => node instanceof Exp)).toBe(false);
+    });
+
+    test("common subexpression elimination", () => {
+        const { graph, report } = compare((w) => w.tanh().add(w.tanh()).sum());
+
+        expect(report!.merged).toBe(1);
+        expect(graph.all_nodes.filter(node => node instanceof Tanh).length).toBe(1);
+    });
+
+    test("grads that can't receive a gradient are released", () => {
+        const { graph, report } = compare((w) => {
+            const x = tensor([3], [1, 2, 3]);
+            return w.mul(x).floor().add(w.mul(2, false)).sum();
+        });
+
+        // the product in front of floor() is skipped during backward passes
+        expect(report!.released).toBe(1);
+        expect(graph.all_nodes.filter(node => node.requires_grad).length).toBe(4);
+    });
+
+    test("checkpoints have to be set afterwards", () => {
+        const w = tensor([3], true);
+        const hidden = w.relu();
+        const graph = hidden.sum().graph;
+        graph.set_checkpoints([hidden]);
+        expect(() => graph.optimize()).toThrow();
+    });
+});
@@ -0,0 +1,71 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
+import { sgd } from "../src/optimizer/optimizer.ts";
+
+describe("profiler", async () => {
+    await core_ready;
+
+    function create_graph() {
+        const input = tensor_producer([16], (dest) => { dest.uniform(0, 1, 1); }, 8);
+        const weight = tensor([16, 16], true).uniform(-1, 1, 2);
+        const target = tensor([16]).uniform(0, 1, 3);
+        return input.matmul(weight).relu().mse_loss(target).graph;
+    }
+
+    test("events of a training step", () => {
+        const graph = create_graph();
+        const optimizer = new sgd(graph, { lr: .1 });
+        const profiler = graph.profile(() => {
+            graph.zero_grad();
+            graph.forward();
+            graph.backward();
+            optimizer.step();
+        });
+
+        // the source and all operations run forward, the nodes that reach the weight run backward
+        const operations = graph.topological_ordering.filter(node => node.parents.length > 0);
+        const backward = graph.backward_schedule.filter(step => step.pass === "bw" && step.node.requires_grad);
+        expect(profiler.events.filter(event => event.pass === "fw").length).toBe(operations.length + 1);
+        expect(profiler.events.filter(event => event.pass === "bw").length).toBe(backward.length);
+
+        for (const event of profiler.events) {
+            expect(event.wall_time).toBeGreaterThanOrEqual(0);
+            expect(event.bytes_written).toBeGreaterThanOrEqual(0);
+        }
+
+        const matmul = profiler.events.find(event => event.pass === "fw" && event.node.constructor.name === "Matmul")!;
+        expect(matmul.flops).toBeGreaterThan(0);
+        expect(matmul.bytes_read).toBe((8 * 16 + 16 * 16) * 4);
+        expect(profiler.total_wall_time).toBeGreaterThanOrEqual(matmul.wall_time);
+
+        // nodes are no longer profiled afterwards
+        graph.forward(true);
+        expect(profiler.events.length).toBe(operations.length + 1 + backward.length);
+        expect(graph.profiler).toBeUndefined();
+
+        expect(profiler.summary()).toContain("PROFILE");
+    });
+
+    test("chrome trace", () => {
+        const graph = create_graph();
+        const profiler = graph.profile(() => graph.forward());
+        const trace = JSON.parse(profiler.chrome_trace());
+
+        expect(trace.traceEvents.length).toBe(profiler.events.length);
+        for (const event of trace.traceEvents) {
+            expect(event.ph).toBe("X");
+            expect(event.dur).toBeGreaterThan(0);
+            expect(event.args.flops).toBeGreaterThanOrEqual(0);
+        }
+    });
+
+    test("kernel time", () => {
+        const graph = create_graph();
+        const profiler = graph.profile(() => graph.forward());
+
+        expect(profiler.total_kernel_time).toBeGreaterThan(0);
+        expect(profiler.total_kernel_time).toBeLessThanOrEqual(profiler.total_wall_time);
+        for (const event of profiler.events) expect(event.kernel_time).toBeLessThanOrEqual(event.wall_time + 1e-3);
+    });
+});
@@ -251,6 +251,58 @@ describe("tensor operations", async () => {
                 ops.sin_acc(t6, res);
                 expect_arrays_closeto(res.data, [0.50636566, 2.9092975, 3.14112, 2.9092975, 3.2431974, 2.9092975]);
             });
+
+            test("fused backward passes", () => {
+                // const t4 = RawTensor.create([3, 2], [7.5, 5.5, -2, 3.5, 0, 3]);
+                const grad = RawTensor.create([3, 2], [1, -2, 3, .5, 2, -1]);
+                const res = RawTensor.like(t4).fill(1);
+                const g = [...grad.data];
+                const x = [...t4.data];
+
+                ops.bw_sin_acc(t4, grad, res);
+                expect_arrays_closeto(res.data, x.map((v, i) => 1 + g[i] * Math.cos(v)));
+
+                res.fill(1);
+                ops.bw_leaky_relu_acc(t4, grad, res, .1);
+                expect_arrays_closeto(res.data, x.map((v, i) => 1 + g[i] * (v < 0 ? .1 : 1)));
+
+                // tanh is differentiated using its result
+                const y = ops.tanh(t4);
+                res.fill(1);
+                ops.bw_tanh_acc(y, grad, res);
+                expect_arrays_closeto(res.data, x.map((v, i) => 1 + g[i] * (1 - Math.tanh(v) ** 2)));
+
+                expect(() => ops.bw_sin_acc(t4, grad, t5)).toThrow();
+
+                y.free();
+                grad.free();
+                res.free();
+            });
+
+            test("fused backward passes of binary operations", () => {
+                const a = RawTensor.create([2, 3], [1.5, 2, .5, 3, 1.25, 2.5]);
+                const b = RawTensor.create([3], [2, -1, .5]);
+                const grad = RawTensor.create([2, 3], [1, -2, 3, .5, 2, -1]);
+                const x = [...a.data], y = [...b.data], g = [...grad.data];
+
+                // pairwise, accumulates into the gradient
+                const res_a = RawTensor.like(a).fill(1);
+                ops.bw_pow_a_acc(a, b, grad, res_a);
+                expect_arrays_closeto(res_a.data, x.map((v, i) => 1 + g[i] * y[i % 3] * v ** (y[i % 3] - 1)));
+
+                // summed over the axis that b was broadcast along
+                const res_b = RawTensor.like(b).fill(1);
+                ops.bw_pow_b_acc(a, b, grad, res_b);
+                expect_arrays_closeto(res_b.data, y.map((v, j) => 1 + [0, 1].reduce((acc, r) => acc + g[r * 3 + j] * x[r * 3 + j] ** v * Math.log(x[r * 3 + j]), 0)));
+
+                res_b.fill(1);
+                ops.bw_div_b_acc(a, b, grad, res_b);
+                expect_arrays_closeto(res_b.data, y.map((v, j) => 1 + [0, 1].reduce((acc, r) => acc - g[r * 3 + j] * x[r * 3 + j] / (v * v), 0)));
+
+                expect(() => ops.bw_pow_a_acc(a, b, res_b, res_a)).toThrow();
+
+                [a, b, grad, res_a, res_b].forEach(t => t.free());
+            });
         });
 
         test("scalar ops", () => {
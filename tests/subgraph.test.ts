@@ -0,0 +1,86 @@
+import { describe, expect, test } from "bun:test";
+import { core_ready } from "../src/raw_tensor/management.ts";
+import { tensor, tensor_producer } from "../src/tensor_factory.ts";
+import { Subgraph } from "../src/autograd/subgraph.ts";
+import Tensor from "../src/tensor.ts";
+
+function count_fw(node: Tensor): () => number {
+    let count = 0;
+    const fw = node.fw.bind(node);
+    node.fw = () => {
+        count++;
+        fw();
+    };
+
+    return () => count;
+}
+
+describe("subgraphs", async () => {
+    await core_ready;
+
+    function create_model() {
+        const input = tensor_producer([2], () => [1, 2]);
+        const weight = tensor([2], [3, 4], true);
+        const trunk = input.mul(weight);
+        const head_a = trunk.sum();
+        const head_b = trunk.mul(weight).sum();
+        const unused = trunk.exp();
+        return { weight, trunk, head_a, head_b, unused };
+    }
+
+    test("shared nodes are evaluated once per run", () => {
+        const { trunk, head_a, head_b, unused } = create_model();
+        const trunk_fw = count_fw(trunk), unused_fw = count_fw(unused);
+        const subgraph = new Subgraph([head_a, head_b]);
+
+        // the input is a source, so the trunk is recomputed in every run
+        for (let i = 1; i <= 2; i++) {
+            const [a, b] = subgraph.run();
+            expect(a.item).toBe(11);
+            expect(b.item).toBe(41);
+            expect(trunk_fw()).toBe(i);
+        }
+
+        expect(unused_fw()).toBe(0);
+        expect(subgraph.ordering).not.toContain(unused);
+        expect(subgraph.ordering.indexOf(trunk)).toBeLessThan(subgraph.ordering.indexOf(head_a));
+    });
+
+    test("gradients of the sum of the outputs", () => {
+        const { weight, trunk, head_a, head_b } = create_model();
+        const subgraph = new Subgraph([head_a, head_b], [weight]);
+
+        // d/dw sum(x * w) + sum(x * w * w) = x + 2 * x * w
+        subgraph.run();
+        expect([...subgraph.grads[0].data]).toEqual([7, 18]);
+
+        // grads are reset in every run
+        subgraph.run();
+        expect([...subgraph.grads[0].data]).toEqual([7, 18]);
+
+        expect(() => new Subgraph([head_a], [trunk.exp()])).toThrow();
+    });
+
+    test("grads off the paths from wrt are left untouched", () => {
+        const w = tensor([2], [3, 4], true);
+        const x = tensor([2], [1, 2], true);
+        const y = w.mul(x).sum();
+
+        // e.g. accumulated by an earlier Graph.backward()
+        x.grad!.data.set([5, 6]);
+
+        const subgraph = new Subgraph([y], [w]);
+        subgraph.run();
+        expect([...w.grad!.data]).toEqual([1, 2]);
+        expect([...x.grad!.data]).toEqual([5, 6]);
+    });
+
+    test("realize", () => {
+        const { trunk, head_a } = create_model();
+        const trunk_fw = count_fw(trunk);
+
+        head_a.realize();
+        expect(head_a.value.item).toBe(11);
+        expect(trunk_fw()).toBe(1);
+    });
+});